@@ -13,6 +13,7 @@
 #include <type_traits>
 
 #include "storm-cli-utilities/model-handling.h"
+#include "storm-cli-utilities/server.h"
 
 // Includes for the linked libraries and versions header.
 #include "storm/adapters/IntelTbbAdapter.h"
@@ -244,6 +245,26 @@ void setUrgentOptions() {
     storm::utility::setOutputDigitsFromGeneralPrecision(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
 
+void processServerWithValueType(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+#ifdef STORM_HAVE_CARL
+    switch (mpi.verificationValueType) {
+        case ModelProcessingInformation::ValueType::Parametric:
+            runServer<storm::RationalFunction>(input);
+            break;
+        case ModelProcessingInformation::ValueType::Exact:
+            runServer<storm::RationalNumber>(input);
+            break;
+        case ModelProcessingInformation::ValueType::FinitePrecision:
+            runServer<double>(input);
+            break;
+    }
+#else
+    STORM_LOG_THROW(mpi.verificationValueType == ModelProcessingInformation::ValueType::FinitePrecision, storm::exceptions::NotSupportedException,
+                    "No exact numbers or parameters are supported in this build.");
+    runServer<double>(input);
+#endif
+}
+
 void processOptions() {
     // Start by setting some urgent options (log levels, resources, etc.)
     setUrgentOptions();
@@ -254,6 +275,13 @@ void processOptions() {
     // Obtain settings for model processing
     ModelProcessingInformation mpi;
 
+    if (storm::settings::getModule<storm::settings::modules::IOSettings>().isServerSet()) {
+        // The constants are defined by the requests, so the symbolic input is only preprocessed to obtain the value type.
+        mpi = preprocessSymbolicInput(symbolicInput).second;
+        processServerWithValueType(symbolicInput, mpi);
+        return;
+    }
+
     // Preprocess the symbolic input
     std::tie(symbolicInput, mpi) = preprocessSymbolicInput(symbolicInput);
 
@@ -11,10 +11,13 @@
 #include "storm/utility/NumberTraits.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/utility/Stopwatch.h"
 #include "storm/utility/initialize.h"
 
+#include <map>
+#include <mutex>
 #include <type_traits>
 
 #include "storm/storage/SymbolicModelDescription.h"
@@ -25,9 +28,13 @@
 #include "storm/models/ModelBase.h"
 
 #include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
 
 #include "storm/exceptions/OptionParserException.h"
 
+#include "storm/modelchecker/prctl/helper/SparseMultiTargetUntilHelper.h"
 #include "storm/modelchecker/results/SymbolicQualitativeCheckResult.h"
 
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -347,7 +354,7 @@ void ensureNoUndefinedPropertyConstants(std::vector<storm::jani::Property> const
     }
 }
 
-std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(SymbolicInput const& input) {
+std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(SymbolicInput const& input, std::string const& constantDefinitionString) {
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
 
     SymbolicInput output = input;
@@ -360,7 +367,6 @@ std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(Sym
     }
 
     // Substitute constant definitions in symbolic input.
-    std::string constantDefinitionString = ioSettings.getConstantDefinitionString();
     std::map<storm::expressions::Variable, storm::expressions::Expression> constantDefinitions;
     if (output.model) {
         constantDefinitions = output.model.get().parseConstantDefinitions(constantDefinitionString);
@@ -408,6 +414,10 @@ std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(Sym
     return {output, mpi};
 }
 
+std::pair<SymbolicInput, ModelProcessingInformation> preprocessSymbolicInput(SymbolicInput const& input) {
+    return preprocessSymbolicInput(input, storm::settings::getModule<storm::settings::modules::IOSettings>().getConstantDefinitionString());
+}
+
 void exportSymbolicInput(SymbolicInput const& input) {
     auto ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
     if (input.model && input.model.get().isJaniModel()) {
@@ -438,7 +448,8 @@ std::shared_ptr<storm::models::ModelBase> buildModelDd(SymbolicInput const& inpu
 }
 
 template<typename ValueType>
-std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings) {
+std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const& input, storm::settings::modules::BuildSettings const& buildSettings,
+                                                           bool buildFullModel = false) {
     storm::builder::BuilderOptions options(createFormulasToRespect(input.properties), input.model.get());
     options.setBuildChoiceLabels(options.isBuildChoiceLabelsSet() || buildSettings.isBuildChoiceLabelsSet());
     options.setBuildStateValuations(options.isBuildStateValuationsSet() || buildSettings.isBuildStateValuationsSet());
@@ -462,7 +473,7 @@ std::shared_ptr<storm::models::ModelBase> buildModelSparse(SymbolicInput const&
     options.setReservedBitsForUnboundedVariables(buildSettings.getBitsForUnboundedVariables());
 
     options.setAddOutOfBoundsState(buildSettings.isBuildOutOfBoundsStateSet());
-    if (buildSettings.isBuildFullModelSet()) {
+    if (buildFullModel || buildSettings.isBuildFullModelSet()) {
         options.clearTerminalStates();
         options.setApplyMaximalProgressAssumption(false);
         options.setBuildAllLabels(true);
@@ -859,11 +870,14 @@ void generateCounterexamples<double>(std::shared_ptr<storm::models::ModelBase> c
     }
 }
 
+/*!
+ * Writes the given result to the given stream, reduced according to the filter type.
+ */
 template<typename ValueType>
-void printFilteredResult(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::modelchecker::FilterType ft) {
+void writeFilteredResult(std::ostream& out, std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::modelchecker::FilterType ft) {
     if (result->isQuantitative()) {
         if (ft == storm::modelchecker::FilterType::VALUES) {
-            STORM_PRINT(*result);
+            out << *result;
         } else {
             ValueType resultValue;
             switch (ft) {
@@ -890,24 +904,24 @@ void printFilteredResult(std::unique_ptr<storm::modelchecker::CheckResult> const
                     STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unhandled filter type.");
             }
             if (storm::NumberTraits<ValueType>::IsExact && storm::utility::isConstant(resultValue)) {
-                STORM_PRINT(resultValue << " (approx. " << storm::utility::convertNumber<double>(resultValue) << ")");
+                out << resultValue << " (approx. " << storm::utility::convertNumber<double>(resultValue) << ")";
             } else {
-                STORM_PRINT(resultValue);
+                out << resultValue;
             }
         }
     } else {
         switch (ft) {
             case storm::modelchecker::FilterType::VALUES:
-                STORM_PRINT(*result << '\n');
+                out << *result << '\n';
                 break;
             case storm::modelchecker::FilterType::EXISTS:
-                STORM_PRINT(result->asQualitativeCheckResult().existsTrue());
+                out << result->asQualitativeCheckResult().existsTrue();
                 break;
             case storm::modelchecker::FilterType::FORALL:
-                STORM_PRINT(result->asQualitativeCheckResult().forallTrue());
+                out << result->asQualitativeCheckResult().forallTrue();
                 break;
             case storm::modelchecker::FilterType::COUNT:
-                STORM_PRINT(result->asQualitativeCheckResult().count());
+                out << result->asQualitativeCheckResult().count();
                 break;
             case storm::modelchecker::FilterType::ARGMIN:
             case storm::modelchecker::FilterType::ARGMAX:
@@ -919,7 +933,14 @@ void printFilteredResult(std::unique_ptr<storm::modelchecker::CheckResult> const
                 STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Filter type only defined for quantitative results.");
         }
     }
-    STORM_PRINT('\n');
+}
+
+template<typename ValueType>
+void printFilteredResult(std::unique_ptr<storm::modelchecker::CheckResult> const& result, storm::modelchecker::FilterType ft) {
+    std::stringstream ss;
+    ss.precision(std::cout.precision());
+    writeFilteredResult<ValueType>(ss, result, ft);
+    STORM_PRINT(ss.str() << '\n');
 }
 
 void printModelCheckingProperty(storm::jani::Property const& property) {
@@ -954,39 +975,59 @@ void verifyProperties(
     SymbolicInput const& input,
     std::function<std::unique_ptr<storm::modelchecker::CheckResult>(std::shared_ptr<storm::logic::Formula const> const& formula,
                                                                     std::shared_ptr<storm::logic::Formula const> const& states)> const& verificationCallback,
-    std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity()) {
+    std::function<void(std::unique_ptr<storm::modelchecker::CheckResult> const&)> const& postprocessingCallback = PostprocessingIdentity(),
+    uint64_t numberOfWorkers = 1) {
     auto transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
     auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
-    for (auto const& property : properties) {
-        printModelCheckingProperty(property);
-        bool ignored = false;
-        storm::utility::Stopwatch watch(true);
+
+    // The outcome of checking a single property.
+    struct PropertyOutcome {
         std::unique_ptr<storm::modelchecker::CheckResult> result;
+        bool ignored = false;
+        storm::utility::Stopwatch watch;
+    };
+    std::vector<PropertyOutcome> outcomes(properties.size());
+
+    auto checkProperty = [&](uint64_t propertyIndex) {
+        auto const& property = properties[propertyIndex];
+        auto& outcome = outcomes[propertyIndex];
+        outcome.watch.start();
         try {
             auto rawFormula = property.getRawFormula();
             if (transformationSettings.isChainEliminationSet() && !storm::transformer::NonMarkovianChainTransformer<ValueType>::preservesFormula(*rawFormula)) {
                 STORM_LOG_WARN("Property is not preserved by elimination of non-markovian states.");
-                ignored = true;
+                outcome.ignored = true;
             } else if (transformationSettings.isToDiscreteTimeModelSet()) {
                 auto propertyFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getRawFormula());
                 auto filterFormula = storm::api::checkAndTransformContinuousToDiscreteTimeFormula<ValueType>(*property.getFilter().getStatesFormula());
                 if (propertyFormula && filterFormula) {
-                    result = verificationCallback(propertyFormula, filterFormula);
+                    outcome.result = verificationCallback(propertyFormula, filterFormula);
                 } else {
-                    ignored = true;
+                    outcome.ignored = true;
                 }
             } else {
-                result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
+                outcome.result = verificationCallback(property.getRawFormula(), property.getFilter().getStatesFormula());
             }
         } catch (storm::exceptions::BaseException const& ex) {
             STORM_LOG_WARN("Cannot handle property: " << ex.what());
         }
-        watch.stop();
-        if (!ignored) {
-            postprocessingCallback(result);
-            printResult<ValueType>(result, property, &watch);
+        outcome.watch.stop();
+    };
+
+    auto reportProperty = [&](uint64_t propertyIndex) {
+        auto& outcome = outcomes[propertyIndex];
+        if (!outcome.ignored) {
+            postprocessingCallback(outcome.result);
+            printResult<ValueType>(outcome.result, properties[propertyIndex], &outcome.watch);
         }
-    }
+        // Free the result as soon as it has been reported.
+        outcome.result.reset();
+    };
+
+    // Concurrently checked properties buffer their output (including warnings), which is printed in the order of the properties.
+    storm::utility::parallel::computeAndReportInOrder(
+        properties.size(), numberOfWorkers, [&](uint64_t propertyIndex) { printModelCheckingProperty(properties[propertyIndex]); }, checkProperty,
+        reportProperty);
 }
 
 std::vector<storm::expressions::Expression> parseConstraints(storm::expressions::ExpressionManager const& expressionManager,
@@ -1090,24 +1131,225 @@ void verifyWithExplorationEngine(SymbolicInput const& input, ModelProcessingInfo
         });
 }
 
+template<typename ValueType>
+void verifyWithSmcEngine(SymbolicInput const& input, ModelProcessingInformation const& mpi) {
+    STORM_LOG_ASSERT(input.model, "Expected symbolic model description.");
+    STORM_LOG_THROW((std::is_same<ValueType, double>::value), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support other data-types than floating points.");
+    verifyProperties<ValueType>(
+        input, [&input, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+            STORM_LOG_THROW(states->isInitialFormula(), storm::exceptions::NotSupportedException,
+                            "Statistical model checking can only filter initial states.");
+            return storm::api::verifyWithSmcEngine<ValueType>(mpi.env, input.model.get(), storm::api::createTask<ValueType>(formula, true));
+        });
+}
+
+struct JointUntilResult {
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    // The number of properties that have been computed jointly with this one (including this one) and the time it took to compute all of them.
+    uint64_t numberOfJointProperties;
+    storm::utility::Stopwatch watch;
+};
+typedef std::map<storm::logic::Formula const*, JointUntilResult> JointUntilResults;
+
+/*!
+ * Retrieves whether the configured solver for the given kind of model is a value iteration that does not need to be sound, i.e., whether
+ * computing until probabilities jointly does not change the solution method.
+ */
+inline bool isJointUntilComputationApplicable(storm::Environment const& env, bool nondeterministic) {
+    if (env.solver().isForceSoundness() || env.solver().isForceExact()) {
+        return false;
+    }
+    if (nondeterministic) {
+        return env.solver().minMax().getMethod() == storm::solver::MinMaxMethod::ValueIteration;
+    }
+    auto const& nativeMethod = env.solver().native().getMethod();
+    return env.solver().getLinearEquationSolverType() == storm::solver::EquationSolverType::Native &&
+           (nativeMethod == storm::solver::NativeLinearEquationSolverMethod::Power ||
+            nativeMethod == storm::solver::NativeLinearEquationSolverMethod::GaussSeidel);
+}
+
+/*!
+ * Computes the probabilities of all unbounded until (and reachability) properties on the given DTMC or MDP jointly, grouped by their optimization
+ * direction. The results are returned for the raw formulas of the properties. Properties that are not of this form are not contained.
+ * Nothing is computed jointly unless the configured solver is a (not necessarily sound) value iteration.
+ */
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, JointUntilResults>::type computeJointUntilProbabilities(
+    storm::Environment const& env, std::shared_ptr<storm::models::sparse::Model<ValueType>> const& sparseModel, SymbolicInput const& input) {
+    JointUntilResults results;
+    bool nondeterministic = sparseModel->isOfType(storm::models::ModelType::Mdp);
+    if (!nondeterministic && !sparseModel->isOfType(storm::models::ModelType::Dtmc)) {
+        STORM_LOG_WARN("Joint computation of until probabilities is only supported for DTMCs and MDPs.");
+        return results;
+    }
+    auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+    if (transformationSettings.isChainEliminationSet() || transformationSettings.isToDiscreteTimeModelSet()) {
+        return results;
+    }
+    if (!isJointUntilComputationApplicable(env, nondeterministic)) {
+        STORM_LOG_WARN("Joint computation of until probabilities requires value iteration ("
+                       << (nondeterministic ? "--minmax:method vi" : "--eqsolver native with --native:method power or gaussseidel")
+                       << ") and no sound or exact computation. Properties are checked individually.");
+        return results;
+    }
+
+    // Group the until formulas by their optimization direction. The key is 0 for deterministic models.
+    typedef std::pair<std::shared_ptr<storm::logic::Formula const>, std::shared_ptr<storm::logic::Formula const>> PhiPsiFormulas;
+    std::map<int, std::vector<std::pair<storm::logic::Formula const*, PhiPsiFormulas>>> groups;
+    auto const& properties = input.preprocessedProperties ? input.preprocessedProperties.get() : input.properties;
+    for (auto const& property : properties) {
+        auto const& rawFormula = property.getRawFormula();
+        if (!rawFormula->isProbabilityOperatorFormula() || rawFormula->asProbabilityOperatorFormula().hasBound()) {
+            continue;
+        }
+        auto const& operatorFormula = rawFormula->asProbabilityOperatorFormula();
+        auto const& pathFormula = operatorFormula.getSubformula();
+        PhiPsiFormulas phiPsi;
+        if (pathFormula.isReachabilityProbabilityFormula()) {
+            phiPsi = {storm::logic::Formula::getTrueFormula(), pathFormula.asEventuallyFormula().getSubformula().asSharedPointer()};
+        } else if (pathFormula.isUntilFormula()) {
+            phiPsi = {pathFormula.asUntilFormula().getLeftSubformula().asSharedPointer(), pathFormula.asUntilFormula().getRightSubformula().asSharedPointer()};
+        } else {
+            continue;
+        }
+        int key = 0;
+        if (nondeterministic) {
+            if (!operatorFormula.hasOptimalityType()) {
+                continue;
+            }
+            key = storm::solver::minimize(operatorFormula.getOptimalityType()) ? 1 : 2;
+        }
+        groups[key].emplace_back(rawFormula.get(), std::move(phiPsi));
+    }
+
+    for (auto const& group : groups) {
+        if (group.second.size() < 2) {
+            continue;
+        }
+        STORM_PRINT_AND_LOG("Computing until probabilities of " << group.second.size() << " properties jointly ...\n");
+        storm::utility::Stopwatch watch(true);
+        try {
+            std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> phiPsiStates;
+            for (auto const& formulaAndPhiPsi : group.second) {
+                auto phiResult =
+                    storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, storm::api::createTask<ValueType>(formulaAndPhiPsi.second.first, false));
+                auto psiResult =
+                    storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, storm::api::createTask<ValueType>(formulaAndPhiPsi.second.second, false));
+                phiPsiStates.emplace_back(phiResult->asExplicitQualitativeCheckResult().getTruthValuesVector(),
+                                          psiResult->asExplicitQualitativeCheckResult().getTruthValuesVector());
+            }
+            boost::optional<storm::solver::OptimizationDirection> dir;
+            if (group.first != 0) {
+                dir = group.first == 1 ? storm::solver::OptimizationDirection::Minimize : storm::solver::OptimizationDirection::Maximize;
+            }
+            storm::models::sparse::Model<ValueType> const& model = *sparseModel;
+            auto const& cache = model.getQualitativeAnalysisCache();
+            auto backwardTransitions = cache ? cache->getBackwardTransitions(model.getTransitionMatrix())
+                                             : std::make_shared<storm::storage::SparseMatrix<ValueType> const>(model.getBackwardTransitions());
+            auto jointResult = storm::modelchecker::helper::SparseMultiTargetUntilHelper<ValueType>::computeUntilProbabilities(
+                env, dir, model.getTransitionMatrix(), *backwardTransitions, phiPsiStates, cache.get());
+            for (uint64_t k = 0; k < jointResult.values.size(); ++k) {
+                if (jointResult.statuses[k] != storm::solver::SolverStatus::Converged) {
+                    STORM_LOG_WARN("Joint computation of until probabilities for " << *group.second[k].first << " ended with status '"
+                                                                                  << jointResult.statuses[k] << "'. The property is checked individually.");
+                    continue;
+                }
+                results[group.second[k].first] = {
+                    std::make_unique<storm::modelchecker::ExplicitQuantitativeCheckResult<ValueType>>(std::move(jointResult.values[k])),
+                    group.second.size(), storm::utility::Stopwatch()};
+            }
+            watch.stop();
+            for (auto const& formulaAndPhiPsi : group.second) {
+                auto resultIt = results.find(formulaAndPhiPsi.first);
+                if (resultIt != results.end()) {
+                    resultIt->second.watch = watch;
+                }
+            }
+        } catch (storm::exceptions::BaseException const& ex) {
+            STORM_LOG_WARN("Cannot compute until probabilities jointly: " << ex.what() << ". Properties are checked individually.");
+        }
+    }
+    return results;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, JointUntilResults>::type computeJointUntilProbabilities(
+    storm::Environment const&, std::shared_ptr<storm::models::sparse::Model<ValueType>> const&, SymbolicInput const&) {
+    STORM_LOG_WARN("Joint computation of until probabilities is only supported for floating point numbers. Properties are checked individually.");
+    return {};
+}
+
 template<typename ValueType>
 void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& model, SymbolicInput const& input, ModelProcessingInformation const& mpi) {
     auto sparseModel = model->as<storm::models::sparse::Model<ValueType>>();
     auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
-    auto verificationCallback = [&sparseModel, &ioSettings, &mpi](std::shared_ptr<storm::logic::Formula const> const& formula,
-                                                                  std::shared_ptr<storm::logic::Formula const> const& states) {
+    auto const& modelCheckerSettings = storm::settings::getModule<storm::settings::modules::ModelCheckerSettings>();
+    uint64_t numberOfWorkers = modelCheckerSettings.getNumberOfConcurrentProperties();
+    if (numberOfWorkers > 1 && !storm::utility::parallel::isIntelTbbEnabled()) {
+        STORM_LOG_WARN("Properties are checked sequentially as concurrent checking of properties requires Intel TBB (--enable-tbb).");
+        numberOfWorkers = 1;
+    }
+    if (numberOfWorkers > 1) {
+        // The model is shared by all concurrently checked properties. Compute lazily initialized data upfront so that it is not written concurrently.
+        sparseModel->getTransitionMatrix().getRowGroupIndices();
+        if (sparseModel->isOfType(storm::models::ModelType::MarkovAutomaton)) {
+            sparseModel->template as<storm::models::sparse::MarkovAutomaton<ValueType>>()->containsZenoCycle();
+        }
+    }
+    if (modelCheckerSettings.isQualitativeCacheSet()) {
+        sparseModel->enableQualitativeAnalysisCache();
+    }
+
+    // Results of the (non-initial) filter formulas, such that properties with the same filter do not check it again.
+    std::map<std::string, std::unique_ptr<storm::modelchecker::CheckResult>> filterResults;
+    std::mutex filterResultsMutex;
+
+    // Results of properties that have been computed jointly with others.
+    JointUntilResults jointResults;
+    if (modelCheckerSettings.isJointUntilSet() && !ioSettings.isExportSchedulerSet()) {
+        jointResults = computeJointUntilProbabilities<ValueType>(mpi.env, sparseModel, input);
+    }
+
+    auto verificationCallback = [&sparseModel, &ioSettings, &mpi, &filterResults, &filterResultsMutex, &jointResults](
+                                    std::shared_ptr<storm::logic::Formula const> const& formula, std::shared_ptr<storm::logic::Formula const> const& states) {
+        // Each property gets its own environment as properties might be checked concurrently.
+        storm::Environment env = mpi.env;
         bool filterForInitialStates = states->isInitialFormula();
-        auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
-        if (ioSettings.isExportSchedulerSet()) {
-            task.setProduceSchedulers(true);
+        std::unique_ptr<storm::modelchecker::CheckResult> result;
+        // Every entry of the joint results is only accessed for its own property.
+        auto jointResultIt = jointResults.find(formula.get());
+        if (jointResultIt != jointResults.end()) {
+            result = std::move(jointResultIt->second.result);
+            STORM_PRINT("Result computed jointly with " << (jointResultIt->second.numberOfJointProperties - 1) << " other properties in "
+                                                        << jointResultIt->second.watch << ".\n");
+        } else {
+            auto task = storm::api::createTask<ValueType>(formula, filterForInitialStates);
+            if (ioSettings.isExportSchedulerSet()) {
+                task.setProduceSchedulers(true);
+            }
+            result = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, task);
         }
-        std::unique_ptr<storm::modelchecker::CheckResult> result = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, task);
 
         std::unique_ptr<storm::modelchecker::CheckResult> filter;
         if (filterForInitialStates) {
             filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(sparseModel->getInitialStates());
         } else {
-            filter = storm::api::verifyWithSparseEngine<ValueType>(mpi.env, sparseModel, storm::api::createTask<ValueType>(states, false));
+            std::string filterKey = states->toString();
+            {
+                std::lock_guard<std::mutex> lock(filterResultsMutex);
+                auto filterIt = filterResults.find(filterKey);
+                if (filterIt != filterResults.end()) {
+                    filter = filterIt->second->clone();
+                }
+            }
+            if (!filter) {
+                filter = storm::api::verifyWithSparseEngine<ValueType>(env, sparseModel, storm::api::createTask<ValueType>(states, false));
+                if (filter) {
+                    std::lock_guard<std::mutex> lock(filterResultsMutex);
+                    filterResults.emplace(filterKey, filter->clone());
+                }
+            }
         }
         if (result && filter) {
             result->filter(filter->asQualitativeCheckResult());
@@ -1154,7 +1396,12 @@ void verifyWithSparseEngine(std::shared_ptr<storm::models::ModelBase> const& mod
         }
         ++exportCount;
     };
-    verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback);
+    verifyProperties<ValueType>(input, verificationCallback, postprocessingCallback, numberOfWorkers);
+    if (sparseModel->getQualitativeAnalysisCache() && storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
+        std::stringstream ss;
+        sparseModel->getQualitativeAnalysisCache()->printStatistics(ss);
+        STORM_PRINT("\n" << ss.str());
+    }
     if (ioSettings.isComputeSteadyStateDistributionSet()) {
         storm::utility::Stopwatch watch(true);
         std::unique_ptr<storm::modelchecker::CheckResult> result;
@@ -1316,6 +1563,8 @@ void processInputWithValueTypeAndDdlib(SymbolicInput const& input, ModelProcessi
         verifyWithAbstractionRefinementEngine<DdType, VerificationValueType>(input, mpi);
     } else if (mpi.engine == storm::utility::Engine::Exploration) {
         verifyWithExplorationEngine<VerificationValueType>(input, mpi);
+    } else if (mpi.engine == storm::utility::Engine::Smc) {
+        verifyWithSmcEngine<VerificationValueType>(input, mpi);
     } else {
         std::shared_ptr<storm::models::ModelBase> model =
             buildPreprocessExportModelWithValueTypeAndDdlib<DdType, BuildValueType, VerificationValueType>(input, mpi);
@@ -0,0 +1,376 @@
+#pragma once
+
+#include <functional>
+#include <iostream>
+#include <list>
+#include <string>
+#include <unordered_map>
+
+#include "storm-cli-utilities/model-handling.h"
+#include "storm/adapters/JsonAdapter.h"
+
+namespace storm {
+namespace cli {
+
+/*!
+ * Estimates the memory occupied by the given sparse model, i.e., by its transitions, labels and reward models.
+ * If the qualitative analysis cache is enabled, the (equally large) backward transitions are also taken into account.
+ */
+template<typename ValueType>
+uint64_t estimateSizeInBytes(storm::models::sparse::Model<ValueType> const& model) {
+    typedef typename storm::storage::SparseMatrix<ValueType>::index_type IndexType;
+    auto matrixSize = [](storm::storage::SparseMatrix<ValueType> const& matrix) {
+        return matrix.getEntryCount() * sizeof(storm::storage::MatrixEntry<IndexType, ValueType>) +
+               (matrix.getRowCount() + matrix.getRowGroupCount() + 2) * sizeof(IndexType);
+    };
+
+    uint64_t result = matrixSize(model.getTransitionMatrix());
+    if (model.getQualitativeAnalysisCache()) {
+        result *= 2;
+    }
+    result += model.getStateLabeling().getNumberOfLabels() * ((model.getNumberOfStates() + 63) / 64) * sizeof(uint64_t);
+    for (auto const& rewardModel : model.getRewardModels()) {
+        if (rewardModel.second.hasStateRewards()) {
+            result += rewardModel.second.getStateRewardVector().size() * sizeof(ValueType);
+        }
+        if (rewardModel.second.hasStateActionRewards()) {
+            result += rewardModel.second.getStateActionRewardVector().size() * sizeof(ValueType);
+        }
+        if (rewardModel.second.hasTransitionRewards()) {
+            result += matrixSize(rewardModel.second.getTransitionRewardMatrix());
+        }
+    }
+    return result;
+}
+
+/*!
+ * The models kept in memory by the server. If the total (estimated) size of the models exceeds the memory budget,
+ * the least recently used models are evicted. The most recently inserted model is never evicted.
+ */
+template<typename ValueType>
+class ResidentModels {
+   public:
+    typedef std::shared_ptr<storm::models::sparse::Model<ValueType>> ModelPointer;
+
+    /*!
+     * @param memoryBudget The memory budget in bytes. Zero means no limit.
+     */
+    explicit ResidentModels(uint64_t memoryBudget) : memoryBudget(memoryBudget) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Retrieves the model with the given key and marks it as most recently used.
+     * @return The model or nullptr if no such model is resident.
+     */
+    ModelPointer find(std::string const& key) {
+        auto indexIt = index.find(key);
+        if (indexIt == index.end()) {
+            ++misses;
+            return nullptr;
+        }
+        ++hits;
+        entries.splice(entries.begin(), entries, indexIt->second);
+        return indexIt->second->model;
+    }
+
+    /*!
+     * Keeps the given model resident under the given key and evicts models if the memory budget is exceeded.
+     */
+    void insert(std::string const& key, ModelPointer const& model) {
+        remove(key);
+        entries.push_front({key, model, estimateSizeInBytes(*model)});
+        index.emplace(key, entries.begin());
+        sizeInBytes += entries.front().sizeInBytes;
+        while (memoryBudget > 0 && sizeInBytes > memoryBudget && entries.size() > 1) {
+            STORM_LOG_INFO("Evicting resident model '" << entries.back().key << "'.");
+            remove(entries.back().key);
+            ++evictions;
+        }
+    }
+
+    /*!
+     * Evicts all models.
+     */
+    void clear() {
+        evictions += entries.size();
+        entries.clear();
+        index.clear();
+        sizeInBytes = 0;
+    }
+
+    storm::json<double> getStatistics() const {
+        storm::json<double> result;
+        result["models"] = entries.size();
+        result["size-bytes"] = sizeInBytes;
+        result["budget-bytes"] = memoryBudget;
+        result["hits"] = hits;
+        result["misses"] = misses;
+        result["evictions"] = evictions;
+        return result;
+    }
+
+   private:
+    struct Entry {
+        std::string key;
+        ModelPointer model;
+        uint64_t sizeInBytes;
+    };
+
+    void remove(std::string const& key) {
+        auto indexIt = index.find(key);
+        if (indexIt != index.end()) {
+            sizeInBytes -= indexIt->second->sizeInBytes;
+            entries.erase(indexIt->second);
+            index.erase(indexIt);
+        }
+    }
+
+    // The resident models, the most recently used one first.
+    std::list<Entry> entries;
+    std::unordered_map<std::string, typename std::list<Entry>::iterator> index;
+
+    uint64_t memoryBudget;
+    uint64_t sizeInBytes = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+/*!
+ * Answers model checking requests on sparse models. Each request is a JSON object on a single line:
+ *
+ *   {"id": 1, "prism": "model.nm", "constants": "N=3", "properties": "P=? [F \"done\"]"}
+ *
+ * The model ("prism" or "jani") is optional and defaults to the model given on the command line. Models are built with all labels and
+ * reward models such that they can be reused by later requests with the same constant definitions. If the properties require bisimulation
+ * or other property-dependent preprocessing, the preprocessed model is kept resident for the same set of properties. The qualitative analysis
+ * cache of every resident model is enabled, so backward transitions and prob0/prob1 states are shared by all requests on the model.
+ *
+ * For each property, a JSON object with the result (or an error) is written, followed by an object marking the request as done. A request that
+ * fails as a whole is answered with an error, also followed by the done marker.
+ * Further commands are {"command": "stats"}, {"command": "evict"} and {"command": "quit"}.
+ */
+template<typename ValueType>
+class ModelServer {
+   public:
+    ModelServer(SymbolicInput const& defaultInput, uint64_t memoryBudget) : defaultInput(defaultInput), residentModels(memoryBudget) {
+        // Intentionally left empty.
+    }
+
+    /*!
+     * Answers requests from the given input until it is exhausted or a quit command is received.
+     */
+    void run(std::istream& requests, std::ostream& responses) {
+        std::string line;
+        bool quit = false;
+        while (!quit && !storm::utility::resources::isTerminate() && std::getline(requests, line)) {
+            if (line.find_first_not_of(" \t\r") == std::string::npos) {
+                continue;
+            }
+            storm::json<double> id;
+            auto respond = [&responses, &id](storm::json<double> response) {
+                if (!id.is_null()) {
+                    response["id"] = id;
+                }
+                responses << response.dump() << std::endl;
+            };
+            // Every request except for statistics is finished with a done marker, also if it failed.
+            storm::utility::Stopwatch requestWatch(true);
+            bool wasResident = false;
+            auto respondDone = [&respond, &requestWatch, &wasResident]() {
+                requestWatch.stop();
+                respond({{"done", true}, {"resident", wasResident}, {"time-ms", requestWatch.getTimeInMilliseconds()}});
+            };
+            try {
+                storm::json<double> request = storm::json<double>::parse(line);
+                if (request.count("id") > 0) {
+                    id = request["id"];
+                }
+                std::string command = request.count("command") > 0 ? request["command"].get<std::string>() : "check";
+                if (command == "check") {
+                    check(request, respond, wasResident);
+                    respondDone();
+                } else if (command == "stats") {
+                    respond({{"stats", residentModels.getStatistics()}});
+                } else if (command == "evict") {
+                    residentModels.clear();
+                    respondDone();
+                } else if (command == "quit") {
+                    quit = true;
+                    respondDone();
+                } else {
+                    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown command '" << command << "'.");
+                }
+            } catch (std::exception const& e) {
+                respond({{"error", e.what()}});
+                respondDone();
+            }
+        }
+    }
+
+   private:
+    /*!
+     * Checks the properties of the given request and reports the result of each property separately.
+     *
+     * @param wasResident Is set to true iff the model was already resident.
+     */
+    void check(storm::json<double> const& request, std::function<void(storm::json<double>)> const& respond, bool& wasResident) {
+        STORM_LOG_THROW(request.count("properties") > 0, storm::exceptions::InvalidArgumentException, "Request does not contain properties.");
+        std::string modelKey;
+        SymbolicInput input = getModelDescription(request, modelKey);
+        std::string constantDefinitionString = request.count("constants") > 0 ? request["constants"].get<std::string>() : "";
+        std::string propertyString = request["properties"].get<std::string>();
+        if (input.model) {
+            input.properties = storm::api::parsePropertiesForSymbolicModelDescription(propertyString, input.model.get());
+        } else {
+            input.properties = storm::api::parseProperties(propertyString);
+        }
+
+        SymbolicInput preprocessedInput;
+        ModelProcessingInformation mpi;
+        std::tie(preprocessedInput, mpi) = preprocessSymbolicInput(input, constantDefinitionString);
+        STORM_LOG_THROW(mpi.engine == storm::utility::Engine::Sparse, storm::exceptions::NotSupportedException, "The server only supports the sparse engine.");
+        STORM_LOG_THROW(mpi.buildValueType == mpi.verificationValueType, storm::exceptions::NotSupportedException,
+                        "The server does not support different value types for building and checking models.");
+
+        wasResident = true;
+        auto model = getModel(preprocessedInput, mpi, modelKey + "|" + constantDefinitionString, wasResident);
+
+        auto const& properties = preprocessedInput.preprocessedProperties ? preprocessedInput.preprocessedProperties.get() : preprocessedInput.properties;
+        for (auto const& property : properties) {
+            storm::json<double> response;
+            response["property"] = property.getName();
+            try {
+                bool filterForInitialStates = property.getFilter().getStatesFormula()->isInitialFormula();
+                storm::Environment env = mpi.env;
+                auto result = storm::api::verifyWithSparseEngine<ValueType>(
+                    env, model, storm::api::createTask<ValueType>(property.getRawFormula(), filterForInitialStates));
+                STORM_LOG_THROW(result, storm::exceptions::NotSupportedException, "Property is unsupported by selected engine/settings.");
+                std::unique_ptr<storm::modelchecker::CheckResult> filter;
+                if (filterForInitialStates) {
+                    filter = std::make_unique<storm::modelchecker::ExplicitQualitativeCheckResult>(model->getInitialStates());
+                } else {
+                    filter = storm::api::verifyWithSparseEngine<ValueType>(env, model,
+                                                                           storm::api::createTask<ValueType>(property.getFilter().getStatesFormula(), false));
+                }
+                result->filter(filter->asQualitativeCheckResult());
+                std::stringstream ss;
+                ss.precision(std::cout.precision());
+                writeFilteredResult<ValueType>(ss, result, property.getFilter().getFilterType());
+                response["result"] = ss.str();
+            } catch (storm::exceptions::BaseException const& e) {
+                response["error"] = e.what();
+            }
+            respond(response);
+        }
+    }
+
+    /*!
+     * Retrieves the model description for the given request and a key that identifies it.
+     */
+    SymbolicInput getModelDescription(storm::json<double> const& request, std::string& modelKey) {
+        auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+        SymbolicInput result;
+        if (request.count("prism") > 0) {
+            std::string filename = request["prism"].get<std::string>();
+            modelKey = "prism:" + filename;
+            auto descriptionIt = modelDescriptions.find(modelKey);
+            if (descriptionIt == modelDescriptions.end()) {
+                storm::storage::SymbolicModelDescription description =
+                    storm::api::parseProgram(filename, buildSettings.isPrismCompatibilityEnabled(), !buildSettings.isNoSimplifySet());
+                descriptionIt = modelDescriptions.emplace(modelKey, std::move(description)).first;
+            }
+            result.model = descriptionIt->second;
+        } else if (request.count("jani") > 0) {
+            std::string filename = request["jani"].get<std::string>();
+            modelKey = "jani:" + filename;
+            auto descriptionIt = modelDescriptions.find(modelKey);
+            if (descriptionIt == modelDescriptions.end()) {
+                storm::storage::SymbolicModelDescription description = storm::api::parseJaniModel(filename, std::vector<std::string>()).first;
+                descriptionIt = modelDescriptions.emplace(modelKey, std::move(description)).first;
+            }
+            result.model = descriptionIt->second;
+        } else {
+            modelKey = "default";
+            result.model = defaultInput.model;
+            auto const& ioSettings = storm::settings::getModule<storm::settings::modules::IOSettings>();
+            STORM_LOG_THROW(result.model || ioSettings.isExplicitSet() || ioSettings.isExplicitDRNSet() || ioSettings.isExplicitIMCASet(),
+                            storm::exceptions::InvalidArgumentException, "Request does not specify a model and no model was given on the command line.");
+        }
+        return result;
+    }
+
+    /*!
+     * Retrieves the preprocessed model for the given input, either from the resident models or by building and preprocessing it.
+     */
+    std::shared_ptr<storm::models::sparse::Model<ValueType>> getModel(SymbolicInput const& input, ModelProcessingInformation const& mpi,
+                                                                       std::string const& builtModelKey, bool& wasResident) {
+        auto const& transformationSettings = storm::settings::getModule<storm::settings::modules::TransformationSettings>();
+        // Bisimulation and the transformation to discrete time depend on the properties. Other preprocessing steps only depend on the model.
+        std::string modelKey = builtModelKey;
+        if (mpi.applyBisimulation || transformationSettings.isToDiscreteTimeModelSet()) {
+            modelKey += "|";
+            for (auto const& formula : createFormulasToRespect(input.properties)) {
+                modelKey += formula->toString() + ";";
+            }
+        }
+        auto model = residentModels.find(modelKey);
+        if (model) {
+            return model;
+        }
+        wasResident = false;
+
+        // Some transformations consume the built model, which therefore can not be kept resident.
+        bool preprocessingConsumesModel = transformationSettings.isToDiscreteTimeModelSet() || transformationSettings.isToNondeterministicModelSet();
+        std::shared_ptr<storm::models::sparse::Model<ValueType>> builtModel;
+        if (!preprocessingConsumesModel) {
+            builtModel = residentModels.find(builtModelKey);
+        }
+        if (!builtModel) {
+            std::shared_ptr<storm::models::ModelBase> modelBase;
+            storm::utility::Stopwatch modelBuildingWatch(true);
+            auto const& buildSettings = storm::settings::getModule<storm::settings::modules::BuildSettings>();
+            if (input.model) {
+                modelBase = buildModelSparse<ValueType>(input, buildSettings, true);
+            } else {
+                modelBase = buildModelExplicit<ValueType>(storm::settings::getModule<storm::settings::modules::IOSettings>(), buildSettings);
+            }
+            modelBuildingWatch.stop();
+            STORM_PRINT("Time for model construction: " << modelBuildingWatch << ".\n\n");
+            builtModel = modelBase->template as<storm::models::sparse::Model<ValueType>>();
+            builtModel->printModelInformationToStream(std::cout);
+        }
+
+        model = preprocessSparseModel<ValueType>(builtModel, input, mpi).first;
+        model->enableQualitativeAnalysisCache();
+        if (modelKey != builtModelKey && !preprocessingConsumesModel) {
+            // The built model is kept resident on its own, so later requests that check it directly also share its qualitative analyses.
+            builtModel->enableQualitativeAnalysisCache();
+            residentModels.insert(builtModelKey, builtModel);
+        }
+        residentModels.insert(modelKey, model);
+        return model;
+    }
+
+    SymbolicInput defaultInput;
+    // The parsed model descriptions of the requests, keyed by their file.
+    std::unordered_map<std::string, storm::storage::SymbolicModelDescription> modelDescriptions;
+    ResidentModels<ValueType> residentModels;
+};
+
+/*!
+ * Runs the server on stdin and stdout. While the server runs, the regular output of Storm is redirected to stderr.
+ */
+template<typename ValueType>
+void runServer(SymbolicInput const& defaultInput) {
+    uint64_t memoryBudget = storm::settings::getModule<storm::settings::modules::IOSettings>().getServerMemoryBudget() * 1024 * 1024;
+    std::streambuf* stdoutBuffer = std::cout.rdbuf(std::cerr.rdbuf());
+    std::ostream responses(stdoutBuffer);
+    ModelServer<ValueType> server(defaultInput, memoryBudget);
+    server.run(std::cin, responses);
+    std::cout.rdbuf(stdoutBuffer);
+}
+
+}  // namespace cli
+}  // namespace storm
@@ -58,18 +58,22 @@ std::shared_ptr<storm::counterexamples::Counterexample> computeKShortestPathCoun
 
     auto generator = storm::utility::ksp::ShortestPathsGenerator<double>(*model, subQualitativeResult.getTruthValuesVector());
     storm::counterexamples::PathCounterexample<double> cex(model);
-    double probability = 0;
     bool thresholdExceeded = false;
-    for (size_t k = 1; k <= maxK; ++k) {
-        cex.addPath(generator.getPathAsList(k), k);
-        probability += generator.getDistance(k);
-        // Check if accumulated probability mass is already enough
-        if ((probability > threshold) || (strictBound && probability >= threshold && strictBound)) {
-            thresholdExceeded = true;
+    bool pathsExhausted = false;
+    // The paths are generated lazily, so only as many paths as needed are computed.
+    while (!thresholdExceeded && cex.getNumberOfPaths() < maxK) {
+        auto path = generator.getNextPath();
+        if (!path) {
+            pathsExhausted = true;
             break;
         }
+        cex.addPath(path->states, path->k);
+        // Check if accumulated probability mass is already enough
+        thresholdExceeded = (path->accumulatedDistance > threshold) || (strictBound && path->accumulatedDistance >= threshold);
     }
-    STORM_LOG_WARN_COND(thresholdExceeded, "Aborted computation because maximal number of paths was reached. Probability threshold is not yet exceeded.");
+    STORM_LOG_WARN_COND(thresholdExceeded || pathsExhausted,
+                        "Aborted computation because maximal number of paths was reached. Probability threshold is not yet exceeded.");
+    STORM_LOG_WARN_COND(!pathsExhausted, "Aborted computation because no further paths exist. Probability threshold is not exceeded.");
 
     return std::make_shared<storm::counterexamples::PathCounterexample<double>>(cex);
 }
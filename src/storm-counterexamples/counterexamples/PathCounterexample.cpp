@@ -1,29 +1,37 @@
 #include "storm-counterexamples/counterexamples/PathCounterexample.h"
 
 #include "storm/io/export.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
 
 namespace storm {
 namespace counterexamples {
 
 template<typename ValueType>
-PathCounterexample<ValueType>::PathCounterexample(std::shared_ptr<storm::models::sparse::Model<ValueType>> model) : model(model) {
+PathCounterexample<ValueType>::PathCounterexample(std::shared_ptr<storm::models::sparse::Model<ValueType>> model) : model(model), pathOffsets({0}) {
     // Intentionally left empty.
 }
 
 template<typename ValueType>
-void PathCounterexample<ValueType>::addPath(std::vector<storage::sparse::state_type> path, size_t k) {
-    if (k >= shortestPaths.size()) {
-        shortestPaths.resize(k);
-    }
-    shortestPaths[k - 1] = path;
+void PathCounterexample<ValueType>::addPath(std::vector<storage::sparse::state_type> const& path, size_t k) {
+    STORM_LOG_THROW(k == getNumberOfPaths() + 1, storm::exceptions::InvalidArgumentException,
+                    "Expected the " << getNumberOfPaths() + 1 << "-shortest path, but got the " << k << "-shortest path.");
+    pathStates.insert(pathStates.end(), path.begin(), path.end());
+    pathOffsets.push_back(pathStates.size());
+}
+
+template<typename ValueType>
+size_t PathCounterexample<ValueType>::getNumberOfPaths() const {
+    return pathOffsets.size() - 1;
 }
 
 template<typename ValueType>
 void PathCounterexample<ValueType>::writeToStream(std::ostream& out) const {
-    out << "Shortest path counterexample with k = " << shortestPaths.size() << " paths: \n";
-    for (size_t i = 0; i < shortestPaths.size(); ++i) {
+    out << "Shortest path counterexample with k = " << getNumberOfPaths() << " paths: \n";
+    for (size_t i = 0; i < getNumberOfPaths(); ++i) {
         out << i + 1 << "-shortest path: \n";
-        for (auto it = shortestPaths[i].rbegin(); it != shortestPaths[i].rend(); ++it) {
+        for (auto it = pathStates.rend() - pathOffsets[i + 1], ite = pathStates.rend() - pathOffsets[i]; it != ite; ++it) {
             out << "\tstate " << *it;
             if (model->hasStateValuations()) {
                 out << ": " << model->getStateValuations().getStateInfo(*it);
@@ -12,13 +12,22 @@ class PathCounterexample : public Counterexample {
    public:
     PathCounterexample(std::shared_ptr<storm::models::sparse::Model<ValueType>> model);
 
-    void addPath(std::vector<storage::sparse::state_type> path, size_t k);
+    /*!
+     * Adds the k-shortest path, given as back-to-front traversal. Paths need to be added in order, i.e., k is the number of previously
+     * added paths plus one.
+     */
+    void addPath(std::vector<storage::sparse::state_type> const& path, size_t k);
+
+    size_t getNumberOfPaths() const;
 
     void writeToStream(std::ostream& out) const override;
 
    private:
     std::shared_ptr<storm::models::sparse::Model<ValueType>> model;
-    std::vector<std::vector<storage::sparse::state_type>> shortestPaths;
+
+    // The states of all paths are stored consecutively, where the i-th path occupies the range [pathOffsets[i], pathOffsets[i+1]).
+    std::vector<storage::sparse::state_type> pathStates;
+    std::vector<uint64_t> pathOffsets;
 };
 
 }  // namespace counterexamples
@@ -7,6 +7,7 @@
 #include "storm-counterexamples/counterexamples/HighLevelCounterexample.h"
 #include "storm-counterexamples/settings/modules/CounterexampleGeneratorSettings.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/modelchecker/prctl/helper/SparseDtmcPrctlHelper.h"
 #include "storm/modelchecker/prctl/helper/SparseMdpPrctlHelper.h"
@@ -21,6 +22,7 @@
 #include "storm/storage/sparse/PrismChoiceOrigins.h"
 #include "storm/utility/cli.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 
@@ -1273,6 +1275,54 @@ class SMTMinimalLabelSetGenerator {
         return getUsedLabelSet(*solver.getModel(), variableInformation);
     }
 
+    /*!
+     * Finds up to the given number of distinct smallest sets of labels such that the constraint system of the solver is still satisfiable.
+     * All sets but the first are enumerated with the current bound, where the already found sets are ruled out within a backtracking point of
+     * the solver. Hence, the constraint system is unchanged afterwards (apart from a relaxation of the bound, see findSmallestCommandSet).
+     *
+     * @param solver The solver to use for the satisfiability evaluation.
+     * @param variableInformation A structure with information about the variables of the solver.
+     * @param relevancyInformation A structure with information about the relevant labels.
+     * @param currentBound The currently known lower bound for the number of labels that need to be enabled.
+     * @param maximalNumberOfSets The maximal number of sets to find.
+     * @return The found sets, which is empty if the constraint system is unsatisfiable for all bounds.
+     */
+    static std::vector<storm::storage::FlatSet<uint_fast64_t>> findSmallestCommandSets(storm::solver::SmtSolver& solver,
+                                                                                       VariableInformation& variableInformation,
+                                                                                       RelevancyInformation const& relevancyInformation,
+                                                                                       uint_fast64_t& currentBound, uint64_t maximalNumberOfSets) {
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> result;
+        boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(solver, variableInformation, currentBound);
+        if (smallest == boost::none) {
+            return result;
+        }
+        result.push_back(std::move(smallest.get()));
+
+        if (maximalNumberOfSets > 1) {
+            storm::expressions::Expression assumption = !variableInformation.auxiliaryVariables.back();
+            solver.push();
+            while (result.size() < maximalNumberOfSets) {
+                ruleOutSingleSolution(solver, result.back(), variableInformation, relevancyInformation);
+                if (solver.checkWithAssumptions({assumption}) != storm::solver::SmtSolver::CheckResult::Sat) {
+                    break;
+                }
+                result.push_back(getUsedLabelSet(*solver.getModel(), variableInformation));
+            }
+            solver.pop();
+            STORM_LOG_DEBUG("Found " << result.size() << " candidate command sets with bound " << currentBound << ".");
+        }
+        return result;
+    }
+
+    /*!
+     * The result of checking the sub-model induced by a candidate label set.
+     */
+    struct CandidateCheckResult {
+        std::shared_ptr<storm::models::sparse::Model<T>> subModel;
+        std::vector<storm::storage::FlatSet<uint_fast64_t>> subLabelSets;
+        std::vector<double> maximalPropertyValue;
+    };
+
     static void ruleOutSingleSolution(storm::solver::SmtSolver& solver, storm::storage::FlatSet<uint_fast64_t> const& labelSet,
                                       VariableInformation& variableInformation, RelevancyInformation const& relevancyInformation) {
         std::vector<storm::expressions::Expression> formulae;
@@ -1698,6 +1748,7 @@ class SMTMinimalLabelSetGenerator {
 
             encodeReachability = settings.isEncodeReachabilitySet();
             useDynamicConstraints = settings.isUseDynamicConstraintsSet();
+            candidateBatchSize = settings.getCandidateBatchSize();
         }
 
         bool checkThresholdFeasible;
@@ -1709,6 +1760,8 @@ class SMTMinimalLabelSetGenerator {
         uint64_t maximumCounterexamples = 1;
         uint64_t multipleCounterexampleSizeCap = 100000000;
         uint64_t maximumExtraIterations = 100000000;
+        // The number of candidate label sets that are enumerated at once and whose sub-models are checked in parallel.
+        uint64_t candidateBatchSize = 1;
     };
 
     struct GeneratorStats {
@@ -1852,118 +1905,155 @@ class SMTMinimalLabelSetGenerator {
         size_t smallestCounterexampleSize = model.getNumberOfChoices();  // Definitive upper bound
         uint64_t progressDelay = storm::settings::getModule<storm::settings::modules::GeneralSettings>().getShowProgressDelay();
         do {
-            ++iterations;
-
-            if (result.size() > 0 && iterations > firstCounterexampleFound + options.maximumExtraIterations) {
-                break;
-            }
             if (result.size() == 0) {
                 STORM_LOG_DEBUG("Sanity check to see whether constraint system is still satisfiable.");
                 STORM_LOG_ASSERT(solver->check() == storm::solver::SmtSolver::CheckResult::Sat, "Constraint system is not satisfiable anymore.");
             }
             STORM_LOG_DEBUG("Computing minimal command set.");
             solverClock = std::chrono::high_resolution_clock::now();
-            boost::optional<storm::storage::FlatSet<uint_fast64_t>> smallest = findSmallestCommandSet(*solver, variableInformation, currentBound);
+            std::vector<storm::storage::FlatSet<uint_fast64_t>> candidates =
+                findSmallestCommandSets(*solver, variableInformation, relevancyInformation, currentBound, options.candidateBatchSize);
             totalSolverTime += std::chrono::high_resolution_clock::now() - solverClock;
-            if (smallest == boost::none) {
+            if (candidates.empty()) {
                 STORM_LOG_DEBUG("No further counterexamples.");
                 break;
-            } else {
-                commandSet = smallest.get();
             }
-            STORM_LOG_DEBUG("Computed minimal command with bound " << currentBound << " and set of size "
-                                                                   << commandSet.size() + relevancyInformation.knownLabels.size() << " (" << commandSet.size()
-                                                                   << " + " << relevancyInformation.knownLabels.size() << ") ");
+            for (auto& candidate : candidates) {
+                STORM_LOG_DEBUG("Computed minimal command with bound " << currentBound << " and set of size "
+                                                                       << candidate.size() + relevancyInformation.knownLabels.size() << " ("
+                                                                       << candidate.size() << " + " << relevancyInformation.knownLabels.size() << ") ");
+                candidate.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
+                candidate.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
+            }
 
-            // Restrict the given model to the current set of labels and compute the reachability probability.
+            // Restrict the given model to each candidate set of labels and compute the reachability probability. The candidates are independent of
+            // each other, so their sub-models are built and checked in parallel if Intel TBB is enabled.
             modelCheckingClock = std::chrono::high_resolution_clock::now();
-            commandSet.insert(relevancyInformation.knownLabels.begin(), relevancyInformation.knownLabels.end());
-            commandSet.insert(relevancyInformation.dontCareLabels.begin(), relevancyInformation.dontCareLabels.end());
-            if (commandSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
-                (result.size() > 1 && commandSet.size() > options.multipleCounterexampleSizeCap)) {
-                STORM_LOG_DEBUG("No further counterexamples of similar size.");
-                break;
+            std::vector<CandidateCheckResult> checkResults(candidates.size());
+            auto checkCandidate = [&](uint64_t index) {
+                if (candidates[index].size() == nrCommands(symbolicModel)) {
+                    // The full command set is a counterexample without checking.
+                    return;
+                }
+                auto subChoiceOrigins =
+                    restrictModelToLabelSet(model, candidates[index], rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
+                checkResults[index].subModel = subChoiceOrigins.first;
+                checkResults[index].subLabelSets = std::move(subChoiceOrigins.second);
+                checkResults[index].maximalPropertyValue =
+                    computeMaximalReachabilityProbability(env, *checkResults[index].subModel, phiStates, psiStates, rewardName);
+            };
+            bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+            parallelize = candidates.size() > 1 && storm::utility::parallel::isIntelTbbEnabled();
+            if (parallelize) {
+                tbb::parallel_for(tbb::blocked_range<uint64_t>(0, candidates.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                    for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                        checkCandidate(index);
+                    }
+                });
             }
-
-            if (commandSet.size() == nrCommands(symbolicModel)) {
-                result.push_back(commandSet);
-                break;
+#endif
+            if (!parallelize) {
+                for (uint64_t index = 0; index < candidates.size(); ++index) {
+                    checkCandidate(index);
+                }
             }
+            totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
 
-            auto subChoiceOrigins = restrictModelToLabelSet(model, commandSet, rewardName ? boost::make_optional(psiStates.getNextSetIndex(0)) : boost::none);
-            std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = subChoiceOrigins.first;
-            std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = subChoiceOrigins.second;
+            // Process the candidates in the order in which they were found.
+            for (uint64_t index = 0; index < candidates.size() && !done; ++index) {
+                ++iterations;
 
-            // Now determine the maximal reachability probability in the sub-model.
-            maximalPropertyValue = computeMaximalReachabilityProbability(env, *subModel, phiStates, psiStates, rewardName);
-            totalModelCheckingTime += std::chrono::high_resolution_clock::now() - modelCheckingClock;
+                if (result.size() > 0 && iterations > firstCounterexampleFound + options.maximumExtraIterations) {
+                    done = true;
+                    break;
+                }
 
-            // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the iteration
-            // process.
-            analysisClock = std::chrono::high_resolution_clock::now();
-            bool violation = false;
-            for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
-                violation |=
-                    (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
-            }
+                commandSet = std::move(candidates[index]);
+                if (commandSet.size() > smallestCounterexampleSize + options.continueAfterFirstCounterexampleUntil ||
+                    (result.size() > 1 && commandSet.size() > options.multipleCounterexampleSizeCap)) {
+                    STORM_LOG_DEBUG("No further counterexamples of similar size.");
+                    done = true;
+                    break;
+                }
 
-            if (violation) {
-                if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
-                    ++zeroProbabilityCount;
+                if (commandSet.size() == nrCommands(symbolicModel)) {
+                    result.push_back(commandSet);
+                    done = true;
+                    break;
                 }
 
-                if (options.useDynamicConstraints) {
-                    // Determine which of the two analysis techniques to call by performing a reachability analysis.
-                    storm::storage::BitVector reachableStates =
-                        storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
+                std::shared_ptr<storm::models::sparse::Model<T>> const& subModel = checkResults[index].subModel;
+                std::vector<storm::storage::FlatSet<uint_fast64_t>> const& subLabelSets = checkResults[index].subLabelSets;
+                maximalPropertyValue = checkResults[index].maximalPropertyValue;
+
+                // Depending on whether the threshold was successfully achieved or not, we proceed by either analyzing the bad solution or stopping the
+                // iteration process.
+                analysisClock = std::chrono::high_resolution_clock::now();
+                bool violation = false;
+                for (uint64_t i = 0; i < maximalPropertyValue.size(); i++) {
+                    violation |=
+                        (strictBound && maximalPropertyValue[i] < propertyThreshold[i]) || (!strictBound && maximalPropertyValue[i] <= propertyThreshold[i]);
+                }
 
-                    if (reachableStates.isDisjointFrom(psiStates)) {
-                        // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
-                        analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                       variableInformation, relevancyInformation);
-                    } else {
-                        // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was insufficient
-                        // to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
-                        analyzeInsufficientProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
-                                                               variableInformation, relevancyInformation);
+                if (violation) {
+                    if (!rewardName && maximalPropertyValue.front() == storm::utility::zero<T>()) {
+                        ++zeroProbabilityCount;
                     }
 
-                    if (relevancyInformation.dontCareLabels.size() > 0) {
+                    if (options.useDynamicConstraints) {
+                        // Determine which of the two analysis techniques to call by performing a reachability analysis.
+                        storm::storage::BitVector reachableStates =
+                            storm::utility::graph::getReachableStates(subModel->getTransitionMatrix(), subModel->getInitialStates(), phiStates, psiStates);
+
+                        if (reachableStates.isDisjointFrom(psiStates)) {
+                            // If there was no target state reachable, analyze the solution and guide the solver into the right direction.
+                            analyzeZeroProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
+                                                           variableInformation, relevancyInformation);
+                        } else {
+                            // If the reachability probability was greater than zero (i.e. there is a reachable target state), but the probability was
+                            // insufficient to exceed the given threshold, we analyze the solution and try to guide the solver into the right direction.
+                            analyzeInsufficientProbabilitySolution(*solver, *subModel, subLabelSets, model, labelSets, phiStates, psiStates, commandSet,
+                                                                   variableInformation, relevancyInformation);
+                        }
+
+                        if (relevancyInformation.dontCareLabels.size() > 0) {
+                            ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
+                        }
+                    } else {
+                        // Do not guide solver, just rule out current solution.
                         ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
                     }
                 } else {
-                    // Do not guide solver, just rule out current solution.
-                    ruleOutSingleSolution(*solver, commandSet, variableInformation, relevancyInformation);
-                }
-            } else {
-                STORM_LOG_DEBUG("Found a counterexample.");
-                if (result.empty()) {
-                    // If this is the first counterexample we find, we store when we found it.
-                    firstCounterexampleFound = iterations;
-                }
-                result.push_back(commandSet);
-                if (options.maximumCounterexamples > result.size()) {
-                    STORM_LOG_DEBUG("Exclude counterexample for future.");
-                    ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
-                } else {
-                    STORM_LOG_DEBUG("Stop searching for further counterexamples.");
-                    done = true;
+                    STORM_LOG_DEBUG("Found a counterexample.");
+                    if (result.empty()) {
+                        // If this is the first counterexample we find, we store when we found it.
+                        firstCounterexampleFound = iterations;
+                    }
+                    result.push_back(commandSet);
+                    if (options.maximumCounterexamples > result.size()) {
+                        STORM_LOG_DEBUG("Exclude counterexample for future.");
+                        ruleOutBiggerSolutions(*solver, commandSet, variableInformation, relevancyInformation);
+                    } else {
+                        STORM_LOG_DEBUG("Stop searching for further counterexamples.");
+                        done = true;
+                    }
+                    smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
                 }
-                smallestCounterexampleSize = std::min(smallestCounterexampleSize, commandSet.size());
-            }
-            totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
-
-            auto now = std::chrono::high_resolution_clock::now();
-            auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
-            if (static_cast<uint64_t>(durationSinceLastMessage) >= progressDelay || lastSize < commandSet.size()) {
-                auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now - totalClock).count();
-                if (lastSize < commandSet.size()) {
-                    STORM_LOG_DEBUG("Improved lower bound to " << currentBound << " after " << milliseconds << "ms.");
-                    lastSize = commandSet.size();
-                } else {
-                    STORM_LOG_DEBUG("Lower bound on label set size is " << currentBound << " after " << milliseconds << "ms (checked " << iterations
-                                                                        << " models, " << zeroProbabilityCount << " could not reach the target set).");
-                    timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                totalAnalysisTime += (std::chrono::high_resolution_clock::now() - analysisClock);
+
+                auto now = std::chrono::high_resolution_clock::now();
+                auto durationSinceLastMessage = std::chrono::duration_cast<std::chrono::seconds>(now - timeOfLastMessage).count();
+                if (static_cast<uint64_t>(durationSinceLastMessage) >= progressDelay || lastSize < commandSet.size()) {
+                    auto milliseconds = std::chrono::duration_cast<std::chrono::milliseconds>(now - totalClock).count();
+                    if (lastSize < commandSet.size()) {
+                        STORM_LOG_DEBUG("Improved lower bound to " << currentBound << " after " << milliseconds << "ms.");
+                        lastSize = commandSet.size();
+                    } else {
+                        STORM_LOG_DEBUG("Lower bound on label set size is " << currentBound << " after " << milliseconds << "ms (checked " << iterations
+                                                                            << " models, " << zeroProbabilityCount << " could not reach the target set).");
+                        timeOfLastMessage = std::chrono::high_resolution_clock::now();
+                    }
                 }
             }
         } while (!done);
@@ -91,6 +91,14 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
      */
     bool isUseDynamicConstraintsSet() const;
 
+    /*!
+     * Retrieves the number of candidate command sets that the MAXSAT-based technique enumerates (with the same size) before checking
+     * them in parallel.
+     *
+     * @return The number of candidates per batch.
+     */
+    uint64_t getCandidateBatchSize() const;
+
     bool check() const override;
 
     // The name of the module.
@@ -106,6 +114,7 @@ class CounterexampleGeneratorSettings : public ModuleSettings {
     static const std::string encodeReachabilityOptionName;
     static const std::string schedulerCutsOptionName;
     static const std::string noDynamicConstraintsOptionName;
+    static const std::string candidateBatchSizeOptionName;
 };
 
 }  // namespace modules
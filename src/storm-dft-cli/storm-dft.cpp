@@ -159,6 +159,24 @@ void processOptions() {
         }
     }
 
+    // Analysis via Monte-Carlo simulation
+    if (dftIOSettings.isAnalyzeWithSimulation()) {
+        std::vector<double> timepoints;
+        if (dftIOSettings.usePropTimepoints()) {
+            timepoints = dftIOSettings.getPropTimepoints();
+        }
+        if (dftIOSettings.usePropTimebound()) {
+            timepoints.push_back(dftIOSettings.getPropTimebound());
+        }
+        STORM_LOG_WARN_COND(!timepoints.empty() || dftIOSettings.usePropExpectedTime(),
+                            "No property given. Simulation supports the unreliability (timebound, timepoints) and the MTTF (expectedtime).");
+        storm::dft::api::analyzeDFTSimulation<ValueType>(*dft, timepoints, dftIOSettings.usePropExpectedTime(), faultTreeSettings.getSimulationConfidence(),
+                                                         faultTreeSettings.getSimulationPrecision(), faultTreeSettings.isSimulationPrecisionRelative(),
+                                                         faultTreeSettings.getSimulationMaxTraces(), faultTreeSettings.getSimulationWorkers(),
+                                                         faultTreeSettings.getSimulationSeed());
+        return;
+    }
+
     // From now on we analyse the DFT via model checking
 
     // Set min or max
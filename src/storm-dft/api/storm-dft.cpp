@@ -10,6 +10,7 @@
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
 #include "storm-dft/modelchecker/DftModularizationChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/simulator/DFTMonteCarloSimulator.h"
 #include "storm-dft/storage/DFT.h"
 #include "storm-dft/storage/DftJsonExporter.h"
 #include "storm-dft/storage/SylvanBddManager.h"
@@ -167,6 +168,43 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<storm::RationalFunct
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "BDD analysis is not supportet for this data type.");
 }
 
+template<>
+void analyzeDFTSimulation(storm::dft::storage::DFT<double> const& dft, std::vector<double> const& timepoints, bool calculateMttf, double confidenceLevel,
+                          double precision, bool relativePrecision, uint64_t maximalNumberOfTraces, uint64_t numberOfWorkers, uint64_t seed) {
+    // Prepare DFT for state generation
+    std::shared_ptr<storm::dft::storage::DFT<double>> preparedDft = storm::dft::api::prepareForMarkovAnalysis<double>(dft);
+    preparedDft->setRelevantEvents(storm::dft::api::computeRelevantEvents<double>(*preparedDft, {}, {}), false);
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(preparedDft->buildStateGenerationInfo(symmetries));
+
+    storm::dft::simulator::DFTMonteCarloSimulator<double> simulator(*preparedDft, stateGenerationInfo, numberOfWorkers, seed);
+    simulator.setConfidenceLevel(confidenceLevel);
+    simulator.setPrecision(precision, relativePrecision);
+    simulator.setMaximalNumberOfTraces(maximalNumberOfTraces);
+
+    auto printResult = [confidenceLevel](storm::dft::simulator::MonteCarloResult const& result) {
+        std::cout << result.estimate << " (" << confidenceLevel * 100 << "% confidence interval [" << result.lowerBound << ", " << result.upperBound << "], "
+                  << result.numberOfTraces << " traces" << (result.converged ? "" : ", precision not reached") << ")\n";
+    };
+
+    if (calculateMttf) {
+        std::cout << "The simulated MTTF is ";
+        printResult(simulator.computeMTTF());
+    }
+    for (auto const& timebound : timepoints) {
+        std::cout << "Simulated system failure probability at timebound " << timebound << " is ";
+        printResult(simulator.computeUnreliability(timebound));
+    }
+}
+
+template<>
+void analyzeDFTSimulation(storm::dft::storage::DFT<storm::RationalFunction> const& dft, std::vector<double> const& timepoints, bool calculateMttf,
+                          double confidenceLevel, double precision, bool relativePrecision, uint64_t maximalNumberOfTraces, uint64_t numberOfWorkers,
+                          uint64_t seed) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation is not supported for this data type.");
+}
+
 template<typename ValueType>
 void exportDFTToJsonFile(storm::dft::storage::DFT<ValueType> const& dft, std::string const& file) {
     storm::dft::storage::DftJsonExporter<ValueType>::toFile(dft, file);
@@ -249,6 +249,24 @@ void analyzeDFTBdd(std::shared_ptr<storm::dft::storage::DFT<ValueType>> const& d
                    std::vector<double> const& timepoints, std::vector<std::shared_ptr<storm::logic::Formula const>> const& properties,
                    std::vector<std::string> const& additionalRelevantEventNames, size_t const chunksize);
 
+/*!
+ * Analyze the DFT via Monte-Carlo simulation and print the results.
+ * The simulation stops once the confidence intervals are sufficiently tight or the maximal number of traces is reached.
+ *
+ * @param dft DFT.
+ * @param timepoints Time bounds for which the unreliability is estimated.
+ * @param calculateMttf Whether the MTTF is estimated.
+ * @param confidenceLevel Confidence level of the confidence intervals.
+ * @param precision Maximal half-width of the confidence intervals.
+ * @param relativePrecision Whether the precision is relative to the estimated value.
+ * @param maximalNumberOfTraces Maximal number of traces per estimated value.
+ * @param numberOfWorkers Number of workers generating traces.
+ * @param seed Seed for the random number generators.
+ */
+template<typename ValueType>
+void analyzeDFTSimulation(storm::dft::storage::DFT<ValueType> const& dft, std::vector<double> const& timepoints, bool calculateMttf, double confidenceLevel,
+                          double precision, bool relativePrecision, uint64_t maximalNumberOfTraces, uint64_t numberOfWorkers, uint64_t seed);
+
 /*!
  * Analyze the DFT using the SMT encoding
  *
@@ -232,21 +232,28 @@ typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextSta
     std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const>& triggeringDependency, bool dependencySuccessful) const {
     // Construct new state as copy from original one
     DFTStatePointer newState = state->copy();
+    applyFailure(newState, failedBE, triggeringDependency, dependencySuccessful);
+    return newState;
+}
 
+template<typename ValueType, typename StateType>
+void DftNextStateGenerator<ValueType, StateType>::applyFailure(
+    DFTStatePointer newState, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& failedBE,
+    std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const>& triggeringDependency, bool dependencySuccessful) const {
     if (!dependencySuccessful) {
         // Dependency was unsuccessful -> no BE fails
         STORM_LOG_ASSERT(triggeringDependency != nullptr, "Dependency is not given");
         STORM_LOG_TRACE("With the unsuccessful triggering of PDEP " << triggeringDependency->name() << " [" << triggeringDependency->id() << "]"
-                                                                    << " in " << mDft.getStateString(state));
+                                                                    << " in " << mDft.getStateString(newState));
         newState->letDependencyBeUnsuccessful(triggeringDependency);
-        return newState;
+        return;
     }
 
     STORM_LOG_TRACE("With the failure of " << failedBE->name() << " [" << failedBE->id() << "]"
                                            << (triggeringDependency != nullptr ? " (through dependency " + triggeringDependency->name() + " [" +
                                                                                      std::to_string(triggeringDependency->id()) + ")]"
                                                                                : "")
-                                           << " in " << mDft.getStateString(state));
+                                           << " in " << mDft.getStateString(newState));
 
     newState->letBEFail(failedBE, triggeringDependency);
 
@@ -278,7 +285,6 @@ typename DftNextStateGenerator<ValueType, StateType>::DFTStatePointer DftNextSta
         newState->updateDontCareDependencies(failedBE->id());
         newState->updateFailableInRestrictions(failedBE->id());
     }
-    return newState;
 }
 
 template<typename ValueType, typename StateType>
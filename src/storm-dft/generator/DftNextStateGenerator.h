@@ -69,6 +69,20 @@ class DftNextStateGenerator {
                                          std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const>& triggeringDependency,
                                          bool dependencySuccessful = true) const;
 
+    /*!
+     * Let the given BE fail in the given state and propagate the failure.
+     * In contrast to createSuccessorState(), the given state is modified in-place.
+     *
+     * @param state State which is modified.
+     * @param failedBE BE which fails next.
+     * @param triggeringDependency Dependency which triggered the failure (or nullptr if BE failed on its own).
+     * @param dependencySuccessful Whether the triggering dependency was successful.
+     *              If the dependency is unsuccessful, failedBE does not fail and only the depedendy is marked as failed.
+     */
+    void applyFailure(DFTStatePointer state, std::shared_ptr<storm::dft::storage::elements::DFTBE<ValueType> const>& failedBE,
+                      std::shared_ptr<storm::dft::storage::elements::DFTDependency<ValueType> const>& triggeringDependency,
+                      bool dependencySuccessful = true) const;
+
     /**
      * Propagate the failures in a given state if the given BE fails
      *
@@ -1,17 +1,28 @@
 #include "DftModularizationChecker.h"
 
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <limits>
+#include <numeric>
 #include <sstream>
 
+#include <boost/functional/hash.hpp>
+
 #include "storm-dft/adapters/SFTBDDPropertyFormulaAdapter.h"
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/builder/DFTBuilder.h"
 #include "storm-dft/modelchecker/DFTModelChecker.h"
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
+#include "storm-dft/storage/elements/DFTElements.h"
 #include "storm-dft/utility/DftModularizer.h"
 
 #include "storm-parsers/api/properties.h"
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/api/properties.h"
 #include "storm/exceptions/InvalidModelException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/parallel.h"
 
 namespace storm::dft {
 namespace modelchecker {
@@ -26,6 +37,9 @@ DftModularizationChecker<ValueType>::DftModularizationChecker(std::shared_ptr<st
 
     // Gather all dynamic modules
     populateDynamicModules(topModule);
+    for (auto const& mod : dynamicModules) {
+        dynamicModuleKeys.push_back(computeModuleKey(mod));
+    }
 }
 
 template<typename ValueType>
@@ -66,21 +80,79 @@ std::vector<ValueType> DftModularizationChecker<ValueType>::getProbabilitiesAtTi
 
 template<typename ValueType>
 std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<ValueType>::replaceDynamicModules(std::vector<ValueType> const& timepoints) {
+    // Determine the distinct dynamic modules for which results are still missing
+    std::vector<size_t> modulesToAnalyse;
+    std::vector<std::vector<ValueType>> missingTimepoints;
+    std::set<std::string> consideredKeys;
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        std::string const& key = dynamicModuleKeys[i];
+        if (!consideredKeys.insert(key).second) {
+            STORM_LOG_DEBUG("Dynamic module " << dynamicModules[i].toString(*dft) << " is isomorphic to a previous module and is not analysed again.");
+            continue;
+        }
+        auto const& cachedResults = moduleResults[key];
+        std::vector<ValueType> missing;
+        for (auto const& timebound : timepoints) {
+            if (cachedResults.find(timebound) == cachedResults.end()) {
+                missing.push_back(timebound);
+            }
+        }
+        if (!missing.empty()) {
+            modulesToAnalyse.push_back(i);
+            missingTimepoints.push_back(std::move(missing));
+        }
+    }
+
+    // Create properties beforehand to avoid parsing concurrently
+    std::vector<FormulaVector> properties;
+    for (auto const& moduleTimepoints : missingTimepoints) {
+        std::stringstream propertyStream{};
+        for (auto const timebound : moduleTimepoints) {
+            propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+        }
+        properties.push_back(storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str())));
+    }
+
+    // Analyse the dynamic modules
+    std::vector<typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results> results(modulesToAnalyse.size());
+    bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+    parallelize = modulesToAnalyse.size() > 1 && storm::utility::parallel::isIntelTbbEnabled();
+    if (parallelize) {
+        tbb::parallel_for(tbb::blocked_range<size_t>(0, modulesToAnalyse.size(), 1), [&](tbb::blocked_range<size_t> const& range) {
+            // The model checker keeps internal state and can therefore not be shared between tasks
+            storm::dft::modelchecker::DFTModelChecker<ValueType> moduleChecker(false);
+            for (size_t i = range.begin(); i < range.end(); ++i) {
+                results[i] = analyseDynamicModule(dynamicModules[modulesToAnalyse[i]], properties[i], moduleChecker);
+            }
+        });
+    }
+#endif
+    if (!parallelize) {
+        for (size_t i = 0; i < modulesToAnalyse.size(); ++i) {
+            results[i] = analyseDynamicModule(dynamicModules[modulesToAnalyse[i]], properties[i], modelchecker);
+        }
+    }
+
+    numberOfModuleAnalyses += modulesToAnalyse.size();
+
+    // Remember probabilities for modules
+    for (size_t i = 0; i < modulesToAnalyse.size(); ++i) {
+        auto& cachedResults = moduleResults[dynamicModuleKeys[modulesToAnalyse[i]]];
+        for (size_t j = 0; j < missingTimepoints[i].size(); ++j) {
+            cachedResults[missingTimepoints[i][j]] = boost::get<ValueType>(results[i][j]);
+        }
+    }
+
     // Map from module representatives to their sample points
     std::map<size_t, std::map<ValueType, ValueType>> samplePoints;
-
-    // First analyse all dynamic modules
-    for (auto const& mod : dynamicModules) {
-        STORM_LOG_DEBUG("Analyse dynamic module " << mod.toString(*dft));
-        auto result = analyseDynamicModule(mod, timepoints);
-        // Remember probabilities for module
+    for (size_t i = 0; i < dynamicModules.size(); ++i) {
+        auto const& cachedResults = moduleResults.at(dynamicModuleKeys[i]);
         std::map<ValueType, ValueType> activeSamples{};
-        for (size_t i{0}; i < timepoints.size(); ++i) {
-            auto const probability{boost::get<ValueType>(result[i])};
-            auto const timebound{timepoints[i]};
-            activeSamples[timebound] = probability;
+        for (auto const& timebound : timepoints) {
+            activeSamples[timebound] = cachedResults.at(timebound);
         }
-        samplePoints.insert({mod.getRepresentative(), activeSamples});
+        samplePoints.insert({dynamicModules[i].getRepresentative(), activeSamples});
     }
 
     // Gather all elements contained in dynamic modules
@@ -123,20 +195,193 @@ std::shared_ptr<storm::dft::storage::DFT<ValueType>> DftModularizationChecker<Va
 
 template<typename ValueType>
 typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results DftModularizationChecker<ValueType>::analyseDynamicModule(
-    storm::dft::storage::DftIndependentModule const& module, std::vector<ValueType> const& timepoints) {
+    storm::dft::storage::DftIndependentModule const& module, FormulaVector const& properties,
+    storm::dft::modelchecker::DFTModelChecker<ValueType>& checker) const {
     STORM_LOG_ASSERT(!module.isStatic() && !module.isFullyStatic(), "Module should be dynamic.");
     STORM_LOG_ASSERT(!dft->getElement(module.getRepresentative())->isBasicElement(), "Dynamic module should not be a single BE.");
+    STORM_LOG_DEBUG("Analyse dynamic module " << module.toString(*dft));
 
     auto subDft = module.getSubtree(*dft);
+    return checker.check(subDft, properties, false, false, {});
+}
+
+template<typename ValueType>
+std::string DftModularizationChecker<ValueType>::computeModuleKey(storm::dft::storage::DftIndependentModule const& module) const {
+    // Structural hash of the sub-tree below each element which is independent of names and ids.
+    // The hashes are only used to order children and constraints, hash collisions therefore do not lead to wrong results.
+    std::map<size_t, size_t> structureHashes;
+    std::function<size_t(size_t)> computeStructureHash = [&](size_t id) -> size_t {
+        auto it = structureHashes.find(id);
+        if (it != structureHashes.end()) {
+            return it->second;
+        }
+        auto const element = dft->getElement(id);
+        size_t hash = std::hash<std::string>()(describeElement(element));
+        if (element->isGate()) {
+            std::vector<size_t> childHashes;
+            for (auto const& child : dft->getGate(id)->children()) {
+                childHashes.push_back(computeStructureHash(child->id()));
+            }
+            if (element->isStaticElement()) {
+                std::sort(childHashes.begin(), childHashes.end());
+            }
+            for (size_t childHash : childHashes) {
+                boost::hash_combine(hash, childHash);
+            }
+        }
+        structureHashes.emplace(id, hash);
+        return hash;
+    };
+
+    // Order elements whose order is irrelevant (such as children of static gates) by their structure
+    auto orderElements = [&](auto const& elements, bool commutative) {
+        std::vector<size_t> ids;
+        for (auto const& element : elements) {
+            ids.push_back(element->id());
+        }
+        if (commutative) {
+            std::stable_sort(ids.begin(), ids.end(), [&](size_t a, size_t b) { return computeStructureHash(a) < computeStructureHash(b); });
+        }
+        return ids;
+    };
+
+    // Serialize the module via DFS. Each element is described upon its first visit, later visits refer to the visiting index.
+    // This way, shared sub-trees are represented faithfully and equal keys imply isomorphic modules.
+    std::stringstream stream;
+    std::map<size_t, size_t> visitIndex;
+    std::function<void(size_t)> serialize = [&](size_t id) {
+        auto it = visitIndex.find(id);
+        if (it != visitIndex.end()) {
+            stream << "#" << it->second;
+            return;
+        }
+        size_t const index = visitIndex.size();
+        visitIndex.emplace(id, index);
+        auto const element = dft->getElement(id);
+        stream << describeElement(element);
+        if (element->isGate()) {
+            stream << "(";
+            for (size_t childId : orderElements(dft->getGate(id)->children(), element->isStaticElement())) {
+                serialize(childId);
+                stream << ",";
+            }
+            stream << ")";
+        }
+    };
+    serialize(module.getRepresentative());
+
+    // Serialize dependencies and restrictions
+    std::vector<size_t> constraints;
+    for (size_t id : module.getAllElements()) {
+        auto const element = dft->getElement(id);
+        if (element->isDependency() || element->isRestriction()) {
+            constraints.push_back(id);
+        }
+    }
+    std::vector<size_t> constraintHashes;
+    for (size_t id : constraints) {
+        auto const element = dft->getElement(id);
+        size_t hash = std::hash<std::string>()(describeElement(element));
+        if (element->isDependency()) {
+            auto const dependency = dft->getDependency(id);
+            boost::hash_combine(hash, computeStructureHash(dependency->triggerEvent()->id()));
+            for (size_t dependentId : orderElements(dependency->dependentEvents(), true)) {
+                boost::hash_combine(hash, computeStructureHash(dependentId));
+            }
+        } else {
+            auto const restriction = dft->getRestriction(id);
+            for (size_t childId : orderElements(restriction->children(), restriction->isMutex())) {
+                boost::hash_combine(hash, computeStructureHash(childId));
+            }
+        }
+        constraintHashes.push_back(hash);
+    }
+    std::vector<size_t> constraintOrder(constraints.size());
+    std::iota(constraintOrder.begin(), constraintOrder.end(), 0);
+    std::stable_sort(constraintOrder.begin(), constraintOrder.end(), [&](size_t a, size_t b) { return constraintHashes[a] < constraintHashes[b]; });
 
-    // Create properties
-    std::stringstream propertyStream{};
-    for (auto const timebound : timepoints) {
-        propertyStream << "Pmin=? [F<=" << timebound << "\"failed\"];";
+    for (size_t i : constraintOrder) {
+        size_t const id = constraints[i];
+        auto const element = dft->getElement(id);
+        stream << ";" << describeElement(element) << "(";
+        if (element->isDependency()) {
+            auto const dependency = dft->getDependency(id);
+            serialize(dependency->triggerEvent()->id());
+            stream << "=>";
+            for (size_t dependentId : orderElements(dependency->dependentEvents(), true)) {
+                serialize(dependentId);
+                stream << ",";
+            }
+        } else {
+            auto const restriction = dft->getRestriction(id);
+            for (size_t childId : orderElements(restriction->children(), restriction->isMutex())) {
+                serialize(childId);
+                stream << ",";
+            }
+        }
+        stream << ")";
     }
-    auto const props{storm::api::extractFormulasFromProperties(storm::api::parseProperties(propertyStream.str()))};
+    return stream.str();
+}
 
-    return std::move(modelchecker.check(subDft, props, false, false, {}));
+template<typename ValueType>
+std::string DftModularizationChecker<ValueType>::describeElement(DFTElementCPointer const& element) const {
+    std::stringstream stream;
+    // Use full precision such that different parameters always yield different descriptions
+    stream << std::setprecision(std::numeric_limits<ValueType>::max_digits10);
+    if (element->isBasicElement()) {
+        auto const be = std::static_pointer_cast<storm::dft::storage::elements::DFTBE<ValueType> const>(element);
+        stream << be->beType() << "[";
+        switch (be->beType()) {
+            case storm::dft::storage::elements::BEType::CONSTANT: {
+                auto const beConst = std::static_pointer_cast<storm::dft::storage::elements::BEConst<ValueType> const>(be);
+                stream << beConst->failed();
+                break;
+            }
+            case storm::dft::storage::elements::BEType::PROBABILITY: {
+                auto const beProb = std::static_pointer_cast<storm::dft::storage::elements::BEProbability<ValueType> const>(be);
+                stream << beProb->activeFailureProbability() << " " << beProb->passiveFailureProbability();
+                break;
+            }
+            case storm::dft::storage::elements::BEType::EXPONENTIAL: {
+                auto const beExp = std::static_pointer_cast<storm::dft::storage::elements::BEExponential<ValueType> const>(be);
+                stream << beExp->activeFailureRate() << " " << beExp->passiveFailureRate() << " " << beExp->isTransient();
+                break;
+            }
+            case storm::dft::storage::elements::BEType::ERLANG: {
+                auto const beErlang = std::static_pointer_cast<storm::dft::storage::elements::BEErlang<ValueType> const>(be);
+                stream << beErlang->activeFailureRate() << " " << beErlang->passiveFailureRate() << " " << beErlang->phases();
+                break;
+            }
+            case storm::dft::storage::elements::BEType::WEIBULL: {
+                auto const beWeibull = std::static_pointer_cast<storm::dft::storage::elements::BEWeibull<ValueType> const>(be);
+                stream << beWeibull->shape() << " " << beWeibull->rate();
+                break;
+            }
+            case storm::dft::storage::elements::BEType::LOGNORMAL: {
+                auto const beLogNormal = std::static_pointer_cast<storm::dft::storage::elements::BELogNormal<ValueType> const>(be);
+                stream << beLogNormal->mean() << " " << beLogNormal->standardDeviation();
+                break;
+            }
+            case storm::dft::storage::elements::BEType::SAMPLES: {
+                auto const beSamples = std::static_pointer_cast<storm::dft::storage::elements::BESamples<ValueType> const>(be);
+                for (auto const& [time, probability] : beSamples->activeSamples()) {
+                    stream << time << ":" << probability << " ";
+                }
+                break;
+            }
+            default:
+                STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "BE type '" << be->beType() << "' is not known.");
+        }
+        stream << "]";
+    } else {
+        // The type string contains the relevant parameters of gates and restrictions, e.g., the threshold of VOT gates
+        stream << element->typestring();
+        if (element->isDependency()) {
+            stream << "[" << dft->getDependency(element->id())->probability() << " " << dft->isDependencyInConflict(element->id()) << "]";
+        }
+    }
+    return stream.str();
 }
 
 // Explicitly instantiate the class.
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <map>
 #include <memory>
+#include <string>
 #include <vector>
 
 #include "storm-dft/modelchecker/DFTModelChecker.h"
@@ -17,6 +19,10 @@ namespace modelchecker {
  * Dynamic modules are analyzed via model checking and replaced by a single BE capturing the probabilities of the module.
  * The resulting (static) fault tree is then analyzed via BDDs.
  *
+ * Isomorphic dynamic modules (e.g., replicated subsystems) are identified via a canonical description and analyzed only once.
+ * Results are cached per module and reused in subsequent analyses with the same time points.
+ * If Intel TBB is enabled, the remaining dynamic modules are analyzed in parallel.
+ *
  * @note All public functions must make sure that workDFT is set correctly and should assume workDFT to be in an erroneous state.
  */
 template<typename ValueType>
@@ -58,6 +64,23 @@ class DftModularizationChecker {
         return getProbabilitiesAtTimepoints({timebound}).at(0);
     }
 
+    /*!
+     * Get the number of dynamic modules, including isomorphic ones.
+     * @return Number of dynamic modules.
+     */
+    size_t getNumberOfDynamicModules() const {
+        return dynamicModules.size();
+    }
+
+    /*!
+     * Get the number of dynamic module analyses performed so far. Isomorphic modules are analysed only once and
+     * each module is analysed again only if results for new time points are required.
+     * @return Number of module analyses.
+     */
+    size_t getNumberOfModuleAnalyses() const {
+        return numberOfModuleAnalyses;
+    }
+
    private:
     /*!
      * Recursively populate the list of dynamic modules.
@@ -75,10 +98,28 @@ class DftModularizationChecker {
     /*!
      * Analyse the given dynamic module.
      * @param module Module.
-     * @param timepoints Time points for which the failure probability of element should be computed.
+     * @param properties Properties corresponding to the time points for which the failure probability of element should be computed.
+     * @param checker Model checker used for the analysis.
      */
     typename storm::dft::modelchecker::DFTModelChecker<ValueType>::dft_results analyseDynamicModule(storm::dft::storage::DftIndependentModule const &module,
-                                                                                                    std::vector<ValueType> const &timepoints);
+                                                                                                    FormulaVector const &properties,
+                                                                                                    storm::dft::modelchecker::DFTModelChecker<ValueType> &checker) const;
+
+    /*!
+     * Compute a canonical description of the given module which is independent of element names and ids.
+     * Isomorphic modules which are built in the same way obtain the same description.
+     * Modules with the same description are guaranteed to be isomorphic.
+     * @param module Module.
+     * @return Canonical description.
+     */
+    std::string computeModuleKey(storm::dft::storage::DftIndependentModule const &module) const;
+
+    /*!
+     * Describe the given element by its type and parameters, but without its name and id.
+     * @param element Element.
+     * @return Description.
+     */
+    std::string describeElement(DFTElementCPointer const &element) const;
 
     // DFT.
     std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft;
@@ -89,6 +130,12 @@ class DftModularizationChecker {
     std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager;
     // Independent modules with their top element
     std::vector<storm::dft::storage::DftIndependentModule> dynamicModules;
+    // Canonical description of each dynamic module (same order as dynamicModules)
+    std::vector<std::string> dynamicModuleKeys;
+    // Failure probabilities over time computed so far for each canonical module description
+    std::map<std::string, std::map<ValueType, ValueType>> moduleResults;
+    // Number of dynamic module analyses performed so far
+    size_t numberOfModuleAnalyses = 0;
 };
 
 }  // namespace modelchecker
@@ -1,6 +1,7 @@
 #include <gmm/gmm_std.h>
 
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
 #include "storm-dft/modelchecker/SFTBDDChecker.h"
@@ -235,6 +236,113 @@ Eigen::ArrayXd const *recursiveBirnbaumFactors(size_t const chunksize, uint32_t
     bddToBirnbaumFactorsElement.second = currentProbabilities * thenBirnbaumFactors + (1 - currentProbabilities) * elseBirnbaumFactors;
     return &bddToBirnbaumFactorsElement.second;
 }
+
+/**
+ * Recursively collects all non-terminal nodes of the given bdd
+ * such that every node occurs after all of its sub Bdds.
+ *
+ * \param bdd
+ * The current bdd
+ *
+ * \param visited
+ * The ids of the Bdds which were already collected.
+ *
+ * \param order
+ * Reference to the resulting list of Bdds.
+ */
+void recursiveTopologicalOrder(Bdd const bdd, std::unordered_set<uint64_t> &visited, std::vector<Bdd> &order) {
+    if (bdd.isTerminal() || !visited.insert(bdd.GetBDD()).second) {
+        return;
+    }
+    recursiveTopologicalOrder(bdd.Then(), visited, order);
+    recursiveTopologicalOrder(bdd.Else(), visited, order);
+    order.push_back(bdd);
+}
+
+/**
+ * \returns
+ * The birnbaum importance factors of all variables at once.
+ * Variables that do not occur in the bdd are not contained in the result
+ * and have a birnbaum factor of 0.
+ *
+ * The birnbaum factor of a variable x is the derivative of P(bdd) w.r.t. P(x).
+ * Similar to reverse-mode differentiation, we first compute the probabilities
+ * bottom-up and afterwards propagate the probabilities to reach each node top-down.
+ * The birnbaum factor of x is then the sum over all nodes n labelled with x
+ * of P(reach n) * (P(Then(n)) - P(Else(n))).
+ * Thus, only a single traversal of the bdd is needed for all variables.
+ *
+ * \param chunksize
+ * The width of the Eigen Arrays
+ *
+ * \param bdd
+ * The bdd for which to calculate the factors
+ *
+ * \param indexToProbabilities
+ * A reference to a mapping
+ * that must map every variable in the bdd to probabilities
+ *
+ * \param bddToProbabilities
+ * A cache for common sub Bdds.
+ * Must be empty or from an earlier call with a bdd that is an
+ * ancestor of the current one.
+ */
+std::map<uint32_t, Eigen::ArrayXd> allBirnbaumFactors(size_t const chunksize, Bdd const bdd, std::map<uint32_t, Eigen::ArrayXd> const &indexToProbabilities,
+                                                      std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> &bddToProbabilities) {
+    std::map<uint32_t, Eigen::ArrayXd> indexToBirnbaumFactors{};
+    if (bdd.isTerminal()) {
+        return indexToBirnbaumFactors;
+    }
+
+    // Bottom-up: probabilities of all sub Bdds
+    recursiveProbabilities(chunksize, bdd, indexToProbabilities, bddToProbabilities);
+
+    std::vector<Bdd> order{};
+    std::unordered_set<uint64_t> visited{};
+    recursiveTopologicalOrder(bdd, visited, order);
+
+    // Top-down: probabilities to reach the nodes
+    // Every node is processed after all of its parents
+    std::unordered_map<uint64_t, Eigen::ArrayXd> bddToReachProbabilities{};
+    bddToReachProbabilities[bdd.GetBDD()] = Eigen::ArrayXd::Constant(chunksize, 1);
+    auto const addReachProbabilities{[&bddToReachProbabilities](Bdd const &child, Eigen::ArrayXd const &reachProbabilities) {
+        if (child.isTerminal()) {
+            return;
+        }
+        auto const it{bddToReachProbabilities.find(child.GetBDD())};
+        if (it == bddToReachProbabilities.end()) {
+            bddToReachProbabilities.emplace(child.GetBDD(), reachProbabilities);
+        } else {
+            it->second += reachProbabilities;
+        }
+    }};
+
+    for (auto it{order.rbegin()}; it != order.rend(); ++it) {
+        auto const &currentBdd{*it};
+        auto const reachIt{bddToReachProbabilities.find(currentBdd.GetBDD())};
+        // Reach probabilities are no longer needed after the node is processed
+        Eigen::ArrayXd const reachProbabilities{std::move(reachIt->second)};
+        bddToReachProbabilities.erase(reachIt);
+
+        auto const currentVar{currentBdd.TopVar()};
+        auto const &currentProbabilities{indexToProbabilities.at(currentVar)};
+        auto const &thenProbabilities{*recursiveProbabilities(chunksize, currentBdd.Then(), indexToProbabilities, bddToProbabilities)};
+        auto const &elseProbabilities{*recursiveProbabilities(chunksize, currentBdd.Else(), indexToProbabilities, bddToProbabilities)};
+
+        Eigen::ArrayXd const contribution = reachProbabilities * (thenProbabilities - elseProbabilities);
+        auto const birnbaumIt{indexToBirnbaumFactors.find(currentVar)};
+        if (birnbaumIt == indexToBirnbaumFactors.end()) {
+            indexToBirnbaumFactors.emplace(currentVar, contribution);
+        } else {
+            birnbaumIt->second += contribution;
+        }
+
+        addReachProbabilities(currentBdd.Then(), reachProbabilities * currentProbabilities);
+        addReachProbabilities(currentBdd.Else(), reachProbabilities * (1 - currentProbabilities));
+    }
+
+    return indexToBirnbaumFactors;
+}
 }  // namespace
 
 SFTBDDChecker::SFTBDDChecker(std::shared_ptr<storm::dft::storage::DFT<ValueType>> dft, std::shared_ptr<storm::dft::storage::SylvanBddManager> sylvanBddManager)
@@ -391,26 +499,12 @@ ValueType SFTBDDChecker::getImportanceMeasureAtTimebound(std::string const &beNa
 
 template<typename FuncType>
 std::vector<ValueType> SFTBDDChecker::getAllImportanceMeasuresAtTimebound(ValueType timebound, FuncType func) {
-    auto const bdd{getTopLevelElementBdd()};
+    auto const measuresAtTimepoints{getAllImportanceMeasuresAtTimepoints({timebound}, 1, func)};
 
     std::vector<ValueType> resultVector{};
-    resultVector.reserve(getDFT()->getBasicElements().size());
-
-    std::map<uint32_t, ValueType> indexToProbability{};
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const currentIndex{getSylvanBddManager()->getIndex(be->name())};
-        indexToProbability[currentIndex] = be->getUnreliability(timebound);
-    }
-    std::map<uint64_t, ValueType> bddToProbability{};
-
-    auto const probability{recursiveProbability(bdd, indexToProbability, bddToProbability)};
-
-    for (auto const &be : getDFT()->getBasicElements()) {
-        auto const index{getSylvanBddManager()->getIndex(be->name())};
-        std::map<uint64_t, ValueType> bddToBirnbaumFactor{};
-        auto const birnbaumFactor{recursiveBirnbaumFactor(index, bdd, indexToProbability, bddToProbability, bddToBirnbaumFactor)};
-        auto const &beProbability{indexToProbability[index]};
-        resultVector.push_back(func(beProbability, probability, birnbaumFactor));
+    resultVector.reserve(measuresAtTimepoints.size());
+    for (auto const &measures : measuresAtTimepoints) {
+        resultVector.push_back(measures.front());
     }
     return resultVector;
 }
@@ -458,7 +552,6 @@ std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTim
     auto const basicElements{getDFT()->getBasicElements()};
 
     std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToProbabilities{};
-    std::unordered_map<uint64_t, std::pair<bool, Eigen::ArrayXd>> bddToBirnbaumFactors{};
     std::vector<std::vector<ValueType>> resultVector{};
     resultVector.resize(getDFT()->getBasicElements().size());
     for (auto &i : resultVector) {
@@ -471,20 +564,20 @@ std::vector<std::vector<ValueType>> SFTBDDChecker::getAllImportanceMeasuresAtTim
             i.second.first = false;
         }
 
+        // Great care was made so that the pointer returned is always
+        // valid and points to an element in bddToProbabilities
         auto const &probabilitiesArray{*recursiveProbabilities(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
 
+        // The birnbaum factors of all basic elements are computed in a single pass
+        auto const indexToBirnbaumFactors{allBirnbaumFactors(currentChunksize, bdd, indexToProbabilities, bddToProbabilities)};
+        Eigen::ArrayXd const zeroArray = Eigen::ArrayXd::Constant(currentChunksize, 0);
+
         for (size_t basicElementIndex{0}; basicElementIndex < basicElements.size(); ++basicElementIndex) {
             auto const &be{basicElements[basicElementIndex]};
-            // Invalidate bdd cache
-            for (auto &i : bddToBirnbaumFactors) {
-                i.second.first = false;
-            }
-
-            // Great care was made so that the pointer returned is always
-            // valid and points to an element in bddToProbabilities
             auto const index{getSylvanBddManager()->getIndex(be->name())};
-            auto const &birnbaumFactorsArray{
-                *recursiveBirnbaumFactors(currentChunksize, index, bdd, indexToProbabilities, bddToProbabilities, bddToBirnbaumFactors)};
+            auto const birnbaumIt{indexToBirnbaumFactors.find(index)};
+            // Basic elements not occurring in the bdd have birnbaum factor 0
+            auto const &birnbaumFactorsArray{birnbaumIt != indexToBirnbaumFactors.end() ? birnbaumIt->second : zeroArray};
 
             auto const &beProbabilitiesArray{indexToProbabilities.at(index)};
 
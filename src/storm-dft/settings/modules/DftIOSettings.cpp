@@ -25,6 +25,7 @@ const std::string DftIOSettings::propTimepointsOptionName = "timepoints";
 const std::string DftIOSettings::minValueOptionName = "min";
 const std::string DftIOSettings::maxValueOptionName = "max";
 const std::string DftIOSettings::analyzeWithBdds = "bdd";
+const std::string DftIOSettings::analyzeWithSimulation = "simulate";
 const std::string DftIOSettings::minimalCutSets = "mcs";
 const std::string DftIOSettings::exportToJsonOptionName = "export-json";
 const std::string DftIOSettings::exportToSmtOptionName = "export-smt";
@@ -78,6 +79,9 @@ DftIOSettings::DftIOSettings() : ModuleSettings(moduleName) {
     this->addOption(
         storm::settings::OptionBuilder(moduleName, analyzeWithBdds, false, "Try to use Bdds for the analysis. Unsupportet properties will be ignored.")
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, analyzeWithSimulation, false,
+                                                   "Analyze the DFT via Monte-Carlo simulation. Only the unreliability and the MTTF are supported.")
+                        .build());
     this->addOption(storm::settings::OptionBuilder(moduleName, minimalCutSets, false, "Calculate minimal cut sets.").build());
 
     this->addOption(storm::settings::OptionBuilder(moduleName, exportToJsonOptionName, false, "Export the model to the Cytoscape JSON format.")
@@ -159,6 +163,10 @@ bool DftIOSettings::isAnalyzeWithBdds() const {
     return this->getOption(analyzeWithBdds).getHasOptionBeenSet();
 }
 
+bool DftIOSettings::isAnalyzeWithSimulation() const {
+    return this->getOption(analyzeWithSimulation).getHasOptionBeenSet();
+}
+
 bool DftIOSettings::isMinimalCutSets() const {
     return this->getOption(minimalCutSets).getHasOptionBeenSet();
 }
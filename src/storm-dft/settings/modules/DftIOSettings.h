@@ -121,6 +121,13 @@ class DftIOSettings : public storm::settings::modules::ModuleSettings {
      */
     bool isAnalyzeWithBdds() const;
 
+    /*!
+     * Retrieves whether the analyze with simulation option was set.
+     *
+     * @return True if the analyze with simulation option was set.
+     */
+    bool isAnalyzeWithSimulation() const;
+
     /*!
      * Retrieves whether the minimal cut sets option was set.
      *
@@ -197,6 +204,7 @@ class DftIOSettings : public storm::settings::modules::ModuleSettings {
     static const std::string minValueOptionName;
     static const std::string maxValueOptionName;
     static const std::string analyzeWithBdds;
+    static const std::string analyzeWithSimulation;
     static const std::string minimalCutSets;
     static const std::string exportToJsonOptionName;
     static const std::string exportToSmtOptionName;
@@ -35,6 +35,12 @@ const std::string FaultTreeSettings::chunksizeOptionName = "chunksize";
 const std::string FaultTreeSettings::mttfPrecisionName = "mttf-precision";
 const std::string FaultTreeSettings::mttfStepsizeName = "mttf-stepsize";
 const std::string FaultTreeSettings::mttfAlgorithmName = "mttf-algorithm";
+const std::string FaultTreeSettings::simulationConfidenceOptionName = "sim-confidence";
+const std::string FaultTreeSettings::simulationPrecisionOptionName = "sim-precision";
+const std::string FaultTreeSettings::simulationRelativeOptionName = "sim-relative";
+const std::string FaultTreeSettings::simulationMaxTracesOptionName = "sim-maxtraces";
+const std::string FaultTreeSettings::simulationWorkersOptionName = "sim-workers";
+const std::string FaultTreeSettings::simulationSeedOptionName = "sim-seed";
 
 FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, noSymmetryReductionOptionName, false, "Do not exploit symmetric structure of model.")
@@ -106,6 +112,44 @@ FaultTreeSettings::FaultTreeSettings() : ModuleSettings(moduleName) {
                              .setDefaultValueString("proceeding")
                              .build())
             .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationConfidenceOptionName, false,
+                                                   "The confidence level of the confidence intervals computed via simulation.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The confidence level.")
+                                         .setDefaultValueDouble(0.95)
+                                         .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationPrecisionOptionName, false,
+                                                   "The simulation stops once the half-width of the confidence interval is below this precision.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The precision to achieve.")
+                                         .setDefaultValueDouble(1e-3)
+                                         .addValidatorDouble(storm::settings::ArgumentValidatorFactory::createDoubleGreaterValidator(0.0))
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, simulationRelativeOptionName, false, "Interpret the simulation precision relative to the estimated value.")
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationMaxTracesOptionName, false, "The maximal number of traces to simulate.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The maximal number of traces.")
+                                         .setDefaultValueUnsignedInteger(10000000)
+                                         .build())
+                        .build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, simulationWorkersOptionName, false,
+                                       "The number of workers generating traces. Each worker has its own random number generator. Workers run in parallel if "
+                                       "Intel TBB is enabled.")
+            .setIsAdvanced()
+            .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("number", "The number of workers.")
+                             .setDefaultValueUnsignedInteger(4)
+                             .addValidatorUnsignedInteger(storm::settings::ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                             .build())
+            .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, simulationSeedOptionName, false,
+                                                   "The seed for the simulation. Results are reproducible for the same seed and number of workers.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("seed", "The seed.").setDefaultValueUnsignedInteger(5).build())
+                        .build());
 }
 
 bool FaultTreeSettings::useSymmetryReduction() const {
@@ -201,6 +245,30 @@ std::string FaultTreeSettings::getMttfAlgorithm() const {
     return this->getOption(mttfAlgorithmName).getArgumentByName("algorithm").getValueAsString();
 }
 
+double FaultTreeSettings::getSimulationConfidence() const {
+    return this->getOption(simulationConfidenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double FaultTreeSettings::getSimulationPrecision() const {
+    return this->getOption(simulationPrecisionOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+bool FaultTreeSettings::isSimulationPrecisionRelative() const {
+    return this->getOption(simulationRelativeOptionName).getHasOptionBeenSet();
+}
+
+uint64_t FaultTreeSettings::getSimulationMaxTraces() const {
+    return this->getOption(simulationMaxTracesOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getSimulationWorkers() const {
+    return this->getOption(simulationWorkersOptionName).getArgumentByName("number").getValueAsUnsignedInteger();
+}
+
+uint64_t FaultTreeSettings::getSimulationSeed() const {
+    return this->getOption(simulationSeedOptionName).getArgumentByName("seed").getValueAsUnsignedInteger();
+}
+
 void FaultTreeSettings::finalize() {}
 
 bool FaultTreeSettings::check() const {
@@ -167,6 +167,48 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
      */
     std::string getMttfAlgorithm() const;
 
+    /*!
+     * Retrieves the confidence level of the confidence intervals computed via simulation.
+     *
+     * @return The confidence level.
+     */
+    double getSimulationConfidence() const;
+
+    /*!
+     * Retrieves the maximal half-width of the confidence intervals computed via simulation.
+     *
+     * @return The precision.
+     */
+    double getSimulationPrecision() const;
+
+    /*!
+     * Retrieves whether the precision of the simulation is relative to the estimated value.
+     *
+     * @return True iff the option was set.
+     */
+    bool isSimulationPrecisionRelative() const;
+
+    /*!
+     * Retrieves the maximal number of traces to simulate.
+     *
+     * @return The maximal number of traces.
+     */
+    uint64_t getSimulationMaxTraces() const;
+
+    /*!
+     * Retrieves the number of workers generating traces.
+     *
+     * @return The number of workers.
+     */
+    uint64_t getSimulationWorkers() const;
+
+    /*!
+     * Retrieves the seed for the random number generators of the simulation.
+     *
+     * @return The seed.
+     */
+    uint64_t getSimulationSeed() const;
+
     bool check() const override;
 
     void finalize() override;
@@ -196,6 +238,12 @@ class FaultTreeSettings : public storm::settings::modules::ModuleSettings {
     static const std::string mttfPrecisionName;
     static const std::string mttfStepsizeName;
     static const std::string mttfAlgorithmName;
+    static const std::string simulationConfidenceOptionName;
+    static const std::string simulationPrecisionOptionName;
+    static const std::string simulationRelativeOptionName;
+    static const std::string simulationMaxTracesOptionName;
+    static const std::string simulationWorkersOptionName;
+    static const std::string simulationSeedOptionName;
 };
 
 }  // namespace modules
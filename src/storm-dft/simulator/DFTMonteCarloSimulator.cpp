@@ -0,0 +1,195 @@
+#include "DFTMonteCarloSimulator.h"
+
+#include <boost/math/distributions/normal.hpp>
+#include <cmath>
+#include <limits>
+#include <random>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm::dft {
+namespace simulator {
+
+template<typename ValueType>
+DFTMonteCarloSimulator<ValueType>::Worker::Worker(storm::dft::storage::DFT<ValueType> const& dft,
+                                                  storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t seed, uint64_t index)
+    : randomGenerator(), simulator(dft, stateGenerationInfo, randomGenerator) {
+    // Derive an independent stream for each worker from the global seed and the worker index
+    std::seed_seq seedSequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(index)};
+    randomGenerator.seed(seedSequence);
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::SampleStatistics::add(double sample) {
+    // Welford's online algorithm
+    ++count;
+    double delta = sample - mean;
+    mean += delta / count;
+    squaredDifferences += delta * (sample - mean);
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::SampleStatistics::merge(SampleStatistics const& other) {
+    if (other.count == 0) {
+        return;
+    }
+    uint64_t newCount = count + other.count;
+    double delta = other.mean - mean;
+    mean += delta * other.count / newCount;
+    squaredDifferences += other.squaredDifferences + delta * delta * count * other.count / newCount;
+    count = newCount;
+}
+
+template<typename ValueType>
+DFTMonteCarloSimulator<ValueType>::DFTMonteCarloSimulator(storm::dft::storage::DFT<ValueType> const& dft,
+                                                          storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t numberOfWorkers,
+                                                          uint64_t seed) {
+    STORM_LOG_THROW(numberOfWorkers > 0, storm::exceptions::InvalidArgumentException, "At least one worker is required for the simulation.");
+    for (uint64_t i = 0; i < numberOfWorkers; ++i) {
+        workers.push_back(std::make_unique<Worker>(dft, stateGenerationInfo, seed, i));
+    }
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setConfidenceLevel(double confidenceLevel) {
+    STORM_LOG_THROW(confidenceLevel > 0 && confidenceLevel < 1, storm::exceptions::InvalidArgumentException, "Confidence level must be in (0,1).");
+    this->confidenceLevel = confidenceLevel;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setPrecision(double precision, bool relative) {
+    STORM_LOG_THROW(precision > 0, storm::exceptions::InvalidArgumentException, "Precision must be positive.");
+    this->precision = precision;
+    this->relativePrecision = relative;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setMaximalNumberOfTraces(uint64_t maximalNumberOfTraces) {
+    this->maximalNumberOfTraces = maximalNumberOfTraces;
+}
+
+template<typename ValueType>
+void DFTMonteCarloSimulator<ValueType>::setTracesPerRound(uint64_t tracesPerRound) {
+    STORM_LOG_THROW(tracesPerRound > 0, storm::exceptions::InvalidArgumentException, "At least one trace per round is required.");
+    this->tracesPerRound = tracesPerRound;
+}
+
+template<typename ValueType>
+MonteCarloResult DFTMonteCarloSimulator<ValueType>::computeUnreliability(double timebound) {
+    return simulate(
+        [timebound](DFTTraceSimulator<ValueType>& simulator) {
+            SimulationResult result = simulator.simulateCompleteTrace(timebound);
+            return result == SimulationResult::SUCCESSFUL ? 1.0 : 0.0;
+        },
+        true);
+}
+
+template<typename ValueType>
+MonteCarloResult DFTMonteCarloSimulator<ValueType>::computeMTTF() {
+    return simulate(
+        [](DFTTraceSimulator<ValueType>& simulator) {
+            auto result = simulator.simulateTimeToFailure();
+            if (result.first != SimulationResult::SUCCESSFUL) {
+                // The DFT does not fail on this trace
+                return std::numeric_limits<double>::infinity();
+            }
+            return result.second;
+        },
+        false);
+}
+
+template<typename ValueType>
+MonteCarloResult DFTMonteCarloSimulator<ValueType>::simulate(std::function<double(DFTTraceSimulator<ValueType>&)> const& sampleTrace, bool bernoulli) {
+    SampleStatistics statistics;
+    std::vector<SampleStatistics> workerStatistics(workers.size());
+
+    // Simulates the traces of one worker in the current round
+    auto simulateRound = [&](uint64_t workerIndex) {
+        SampleStatistics& roundStatistics = workerStatistics[workerIndex];
+        roundStatistics = SampleStatistics();
+        for (uint64_t i = 0; i < tracesPerRound; ++i) {
+            roundStatistics.add(sampleTrace(workers[workerIndex]->simulator));
+        }
+    };
+
+    while (true) {
+        bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+        parallelize = workers.size() > 1 && storm::utility::parallel::isIntelTbbEnabled();
+        if (parallelize) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, workers.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t workerIndex = range.begin(); workerIndex < range.end(); ++workerIndex) {
+                    simulateRound(workerIndex);
+                }
+            });
+        }
+#endif
+        if (!parallelize) {
+            for (uint64_t workerIndex = 0; workerIndex < workers.size(); ++workerIndex) {
+                simulateRound(workerIndex);
+            }
+        }
+
+        // Merge in a fixed order to obtain reproducible results
+        for (auto const& roundStatistics : workerStatistics) {
+            statistics.merge(roundStatistics);
+        }
+
+        if (std::isinf(statistics.mean)) {
+            // A sample mean of infinity does not yield a confidence interval. The simulation therefore stops without reaching the required precision.
+            STORM_LOG_WARN("The DFT does not fail on some simulated traces. The estimated value is unbounded.");
+            double const infinity = std::numeric_limits<double>::infinity();
+            return MonteCarloResult{infinity, 0, infinity, statistics.count, false};
+        }
+
+        MonteCarloResult result = computeConfidenceInterval(statistics, bernoulli);
+        STORM_LOG_DEBUG("Simulated " << result.numberOfTraces << " traces. Estimate: " << result.estimate << ", confidence interval: [" << result.lowerBound
+                                     << ", " << result.upperBound << "]");
+        if (result.converged) {
+            return result;
+        }
+        if (statistics.count >= maximalNumberOfTraces || storm::utility::resources::isTerminate()) {
+            STORM_LOG_WARN("Simulation stopped after " << statistics.count << " traces before the required precision was reached.");
+            return result;
+        }
+    }
+}
+
+template<typename ValueType>
+MonteCarloResult DFTMonteCarloSimulator<ValueType>::computeConfidenceInterval(SampleStatistics const& statistics, bool bernoulli) const {
+    double const z = boost::math::quantile(boost::math::normal(), 1 - (1 - confidenceLevel) / 2);
+    double const n = statistics.count;
+
+    MonteCarloResult result;
+    result.estimate = statistics.mean;
+    result.numberOfTraces = statistics.count;
+    double halfWidth;
+    if (bernoulli) {
+        // Wilson score interval, which is also reliable for probabilities close to 0 or 1
+        double const p = statistics.mean;
+        double const denominator = 1 + z * z / n;
+        double const center = (p + z * z / (2 * n)) / denominator;
+        halfWidth = z * std::sqrt(p * (1 - p) / n + z * z / (4 * n * n)) / denominator;
+        result.lowerBound = std::max(0.0, center - halfWidth);
+        result.upperBound = std::min(1.0, center + halfWidth);
+    } else {
+        double const variance = n > 1 ? statistics.squaredDifferences / (n - 1) : std::numeric_limits<double>::infinity();
+        halfWidth = z * std::sqrt(variance / n);
+        result.lowerBound = statistics.mean - halfWidth;
+        result.upperBound = statistics.mean + halfWidth;
+    }
+
+    // A relative precision can not be reached for an estimate of zero, so the precision is used as absolute precision in this case.
+    double const requiredHalfWidth = relativePrecision && statistics.mean != 0 ? precision * std::abs(statistics.mean) : precision;
+    result.converged = halfWidth <= requiredHalfWidth;
+    return result;
+}
+
+template class DFTMonteCarloSimulator<double>;
+
+}  // namespace simulator
+}  // namespace storm::dft
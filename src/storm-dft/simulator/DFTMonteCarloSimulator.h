@@ -0,0 +1,149 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "storm-dft/simulator/DFTTraceSimulator.h"
+
+namespace storm::dft {
+namespace simulator {
+
+/*!
+ * Result of a statistical analysis via simulation.
+ */
+struct MonteCarloResult {
+    // Estimated value.
+    double estimate;
+    // Lower and upper bound of the confidence interval.
+    double lowerBound;
+    double upperBound;
+    // Number of simulated traces.
+    uint64_t numberOfTraces;
+    // Whether the required precision was reached.
+    bool converged;
+};
+
+/*!
+ * Statistical analysis of DFTs via Monte-Carlo simulation.
+ * Traces are generated by several workers which each have their own trace simulator and random number generator.
+ * The random number generator of a worker is seeded with the global seed and the index of the worker.
+ * Traces are simulated in rounds in which each worker generates the same number of traces.
+ * The results therefore only depend on the seed and the number of workers, but not on the order in which the workers are executed.
+ * If Intel TBB is enabled, the workers of a round run in parallel.
+ *
+ * After each round, the confidence interval of the estimate is computed and the simulation stops
+ * once the half-width of the interval is below the required precision or the maximal number of traces is reached.
+ */
+template<typename ValueType>
+class DFTMonteCarloSimulator {
+   public:
+    /*!
+     * Constructor.
+     *
+     * @param dft DFT.
+     * @param stateGenerationInfo Info for state generation.
+     * @param numberOfWorkers Number of workers generating traces.
+     * @param seed Seed for the random number generators.
+     */
+    DFTMonteCarloSimulator(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo,
+                           uint64_t numberOfWorkers, uint64_t seed);
+
+    /*!
+     * Set the confidence level of the confidence intervals.
+     *
+     * @param confidenceLevel Confidence level in (0,1).
+     */
+    void setConfidenceLevel(double confidenceLevel);
+
+    /*!
+     * Set the required precision, i.e., the maximal half-width of the confidence interval.
+     *
+     * @param precision Precision.
+     * @param relative If true, the half-width is compared relative to the estimated value (or absolute if the estimate is zero).
+     */
+    void setPrecision(double precision, bool relative);
+
+    /*!
+     * Set the maximal number of traces after which the simulation stops even if the required precision is not reached.
+     *
+     * @param maximalNumberOfTraces Maximal number of traces.
+     */
+    void setMaximalNumberOfTraces(uint64_t maximalNumberOfTraces);
+
+    /*!
+     * Set the number of traces each worker simulates in one round.
+     *
+     * @param tracesPerRound Number of traces per worker and round.
+     */
+    void setTracesPerRound(uint64_t tracesPerRound);
+
+    /*!
+     * Estimate the probability that the top-level event fails within the given time bound.
+     * The confidence interval is the Wilson score interval.
+     *
+     * @param timebound Time bound.
+     * @return Estimated unreliability.
+     */
+    MonteCarloResult computeUnreliability(double timebound);
+
+    /*!
+     * Estimate the mean time to failure of the top-level event.
+     * The confidence interval is based on the normal approximation of the sample mean.
+     * If the DFT does not fail on some simulated trace, the estimate is infinite and the result is not converged.
+     *
+     * @return Estimated MTTF.
+     */
+    MonteCarloResult computeMTTF();
+
+   private:
+    /*!
+     * A worker with its own random number generator and trace simulator.
+     */
+    struct Worker {
+        Worker(storm::dft::storage::DFT<ValueType> const& dft, storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, uint64_t seed,
+               uint64_t index);
+
+        boost::mt19937 randomGenerator;
+        DFTTraceSimulator<ValueType> simulator;
+    };
+
+    /*!
+     * Running mean and variance of samples.
+     */
+    struct SampleStatistics {
+        void add(double sample);
+        void merge(SampleStatistics const& other);
+
+        uint64_t count = 0;
+        double mean = 0;
+        // Sum of squared differences from the mean
+        double squaredDifferences = 0;
+    };
+
+    /*!
+     * Simulate traces in rounds until the stopping criterion holds.
+     *
+     * @param sampleTrace Function which simulates a trace with the given simulator and returns the sampled value.
+     *                    Returns infinity if the sampled value is infinite.
+     * @param bernoulli Whether the samples are 0/1-valued and the Wilson score interval should be used.
+     * @return Result.
+     */
+    MonteCarloResult simulate(std::function<double(DFTTraceSimulator<ValueType>&)> const& sampleTrace, bool bernoulli);
+
+    /*!
+     * Compute the confidence interval for the given statistics.
+     */
+    MonteCarloResult computeConfidenceInterval(SampleStatistics const& statistics, bool bernoulli) const;
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    double confidenceLevel = 0.95;
+    double precision = 1e-3;
+    bool relativePrecision = false;
+    uint64_t maximalNumberOfTraces = 10000000;
+    uint64_t tracesPerRound = 1000;
+};
+
+}  // namespace simulator
+}  // namespace storm::dft
@@ -1,5 +1,7 @@
 #include "DFTTraceSimulator.h"
 
+#include <limits>
+
 namespace storm::dft {
 namespace simulator {
 
@@ -8,6 +10,7 @@ DFTTraceSimulator<ValueType>::DFTTraceSimulator(storm::dft::storage::DFT<ValueTy
                                                 storm::dft::storage::DFTStateGenerationInfo const& stateGenerationInfo, boost::mt19937& randomGenerator)
     : dft(dft), stateGenerationInfo(stateGenerationInfo), generator(dft, stateGenerationInfo), randomGenerator(randomGenerator) {
     // Set initial state
+    initialState = generator.createInitialState();
     state = generator.createInitialState();
 }
 
@@ -119,14 +122,53 @@ SimulationResult DFTTraceSimulator<ValueType>::step(storm::dft::storage::Failabl
     return SimulationResult::SUCCESSFUL;
 }
 
+template<typename ValueType>
+SimulationResult DFTTraceSimulator<ValueType>::pooledStep(storm::dft::storage::FailableElements::const_iterator nextFailElement, bool dependencySuccessful) {
+    if (nextFailElement == state->getFailableElements().end()) {
+        // No next failure possible
+        return SimulationResult::UNSUCCESSFUL;
+    }
+
+    // Compute the successor in the spare state instead of allocating a new state
+    auto nextBEPair = nextFailElement.getFailBE(dft);
+    spareState->assign(*traceState);
+    generator.applyFailure(spareState, nextBEPair.first, nextBEPair.second, dependencySuccessful);
+
+    if (spareState->isInvalid() || spareState->isTransient()) {
+        STORM_LOG_TRACE("Step is invalid because new state " << (spareState->isInvalid() ? "it is invalid" : "the transient fault is ignored"));
+        return SimulationResult::INVALID;
+    }
+
+    std::swap(traceState, spareState);
+    state = traceState;
+    return SimulationResult::SUCCESSFUL;
+}
+
 template<typename ValueType>
 SimulationResult DFTTraceSimulator<ValueType>::simulateCompleteTrace(double timebound) {
-    resetToInitial();
+    return simulateTrace(timebound).first;
+}
+
+template<typename ValueType>
+std::pair<SimulationResult, double> DFTTraceSimulator<ValueType>::simulateTimeToFailure() {
+    return simulateTrace(std::numeric_limits<double>::infinity());
+}
+
+template<typename ValueType>
+std::pair<SimulationResult, double> DFTTraceSimulator<ValueType>::simulateTrace(double timebound) {
+    // Reset pooled states
+    if (traceState) {
+        traceState->assign(*initialState);
+    } else {
+        traceState = initialState->copy();
+        spareState = initialState->copy();
+    }
+    state = traceState;
 
     // Check whether DFT is initially already failed.
     if (state->hasFailed(dft.getTopLevelIndex())) {
         STORM_LOG_TRACE("DFT is initially failed");
-        return SimulationResult::SUCCESSFUL;
+        return std::make_pair(SimulationResult::SUCCESSFUL, 0);
     }
 
     double time = 0;
@@ -139,14 +181,14 @@ SimulationResult DFTTraceSimulator<ValueType>::simulateCompleteTrace(double time
         if (addTime < 0) {
             // No next state can be reached, because no element can fail anymore.
             STORM_LOG_TRACE("No next state possible in state " << dft.getStateString(state) << " because no element can fail anymore");
-            return SimulationResult::UNSUCCESSFUL;
+            return std::make_pair(SimulationResult::UNSUCCESSFUL, time);
         }
 
         // TODO: exit if time would be up after this failure
         // This is only correct if no invalid states are possible! (no restrictors and no transient failures)
 
         // Apply next failure
-        auto stepResult = step(nextFailable, successfulDependency);
+        auto stepResult = pooledStep(nextFailable, successfulDependency);
         STORM_LOG_TRACE("Current state: " << dft.getStateString(state));
 
         // Check whether state is invalid
@@ -155,7 +197,7 @@ SimulationResult DFTTraceSimulator<ValueType>::simulateCompleteTrace(double time
             // No next state can be reached, because the state is invalid.
             STORM_LOG_TRACE("No next state possible in state " << dft.getStateString(state) << " because simulation was invalid");
             STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Handling of invalid states is not supported for simulation");
-            return SimulationResult::INVALID;
+            return std::make_pair(SimulationResult::INVALID, time);
         }
 
         // Check whether time is up
@@ -164,21 +206,21 @@ SimulationResult DFTTraceSimulator<ValueType>::simulateCompleteTrace(double time
         time += addTime;
         if (time > timebound) {
             STORM_LOG_TRACE("Time limit" << timebound << " exceeded: " << time);
-            return SimulationResult::UNSUCCESSFUL;
+            return std::make_pair(SimulationResult::UNSUCCESSFUL, time);
         }
 
         // Check whether DFT is failed
         if (state->hasFailed(dft.getTopLevelIndex())) {
             STORM_LOG_TRACE("DFT has failed after " << time);
-            return SimulationResult::SUCCESSFUL;
+            return std::make_pair(SimulationResult::SUCCESSFUL, time);
         }
     }
     STORM_LOG_ASSERT(false, "Should not be reachable");
-    return SimulationResult::UNSUCCESSFUL;
+    return std::make_pair(SimulationResult::UNSUCCESSFUL, time);
 }
 
 template<>
-SimulationResult DFTTraceSimulator<storm::RationalFunction>::simulateCompleteTrace(double timebound) {
+std::pair<SimulationResult, double> DFTTraceSimulator<storm::RationalFunction>::simulateTrace(double timebound) {
     STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Simulation not support for parametric DFTs.");
 }
 
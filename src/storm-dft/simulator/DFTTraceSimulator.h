@@ -95,7 +95,35 @@ class DFTTraceSimulator {
      */
     SimulationResult simulateCompleteTrace(double timebound);
 
+    /*!
+     * Perform a complete simulation of a failure trace without time bound by using the random number generator.
+     * The simulation starts in the initial state and runs until the top-level event of the DFT has failed or no further failure is possible.
+     *
+     * @return Pair of the simulation result and the time of the system failure.
+     *         The simulation result is successful if a system failure occurred and unsuccessful if the DFT can never fail on the generated trace.
+     */
+    std::pair<SimulationResult, double> simulateTimeToFailure();
+
    protected:
+    /*!
+     * Perform a complete simulation of a failure trace.
+     * In contrast to step(), the states of the trace are not allocated anew in each step.
+     * Instead, two pooled states are used alternately and overwritten, so states obtained via getCurrentState() may change afterwards.
+     *
+     * @param timebound Time bound in which the system failure should occur.
+     * @return Pair of the simulation result and the time which has passed until the last step.
+     */
+    std::pair<SimulationResult, double> simulateTrace(double timebound);
+
+    /*!
+     * Perform one simulation step on the pooled states.
+     *
+     * @param nextFailElement Iterator giving the next element which should fail.
+     * @param dependencySuccessful Whether the triggering dependency was successful.
+     * @return Successful if step could be performed, unsuccesful if no element can fail or invalid if the next state is invalid.
+     */
+    SimulationResult pooledStep(storm::dft::storage::FailableElements::const_iterator nextFailElement, bool dependencySuccessful);
+
     // The DFT used for the generation of next states.
     storm::dft::storage::DFT<ValueType> const& dft;
 
@@ -108,6 +136,14 @@ class DFTTraceSimulator {
     // Current state
     DFTStatePointer state;
 
+    // Initial state which is used to reset the pooled states
+    DFTStatePointer initialState;
+
+    // Pooled states used for simulating complete traces.
+    // The current state of the trace and a spare state in which the successor is computed.
+    DFTStatePointer traceState;
+    DFTStatePointer spareState;
+
     // Random number generator
     boost::mt19937& randomGenerator;
 };
@@ -71,6 +71,14 @@ class DFTState {
 
     std::shared_ptr<DFTState<ValueType>> copy() const;
 
+    /**
+     * Overwrite this state with the given state.
+     * In contrast to copy(), no new state is allocated and the memory of this state is reused.
+     *
+     * @param other State to take the content from. It must belong to the same DFT.
+     */
+    void assign(DFTState<ValueType> const& other);
+
     DFTElementState getElementState(size_t id) const;
 
     static DFTElementState getElementState(storm::storage::BitVector const& state, DFTStateGenerationInfo const& stateGenerationInfo, size_t id);
@@ -443,6 +443,23 @@ namespace storm {
                 modelchecker.setInstantiationsAreGraphPreserving(samples.graphPreserving);
 
                 storm::utility::parametric::Valuation<ValueType> valuation;
+                
+                // Valuations are collected and checked in batches.
+                uint64_t const batchSize = storm::settings::getModule<storm::settings::modules::ParametricSettings>().getSampleBatchSize();
+                std::vector<storm::utility::parametric::Valuation<ValueType>> batch;
+                auto checkBatch = [&] () {
+                    storm::utility::Stopwatch batchWatch(true);
+                    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = modelchecker.checkMultiple(Environment(), batch);
+                    batchWatch.stop();
+                    for (uint64_t i = 0; i < batch.size(); ++i) {
+                        if (results[i]) {
+                            results[i]->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                        }
+                        printInitialStatesResult<ValueType>(results[i], nullptr, &batch[i]);
+                    }
+                    STORM_PRINT_AND_LOG("Time for model checking " << batch.size() << " instances: " << batchWatch << ".\n\n");
+                    batch.clear();
+                };
 
                 std::vector<typename utility::parametric::VariableType<ValueType>::type> parameters;
                 std::vector<typename std::vector<typename utility::parametric::CoefficientType<ValueType>::type>::const_iterator> iterators;
@@ -467,14 +484,21 @@ namespace storm {
                             valuation[parameters[i]] = *iterators[i];
                         }
 
-                        storm::utility::Stopwatch valuationWatch(true);
-                        std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
-                        valuationWatch.stop();
+                        if (batchSize > 1) {
+                            batch.push_back(valuation);
+                            if (batch.size() == batchSize) {
+                                checkBatch();
+                            }
+                        } else {
+                            storm::utility::Stopwatch valuationWatch(true);
+                            std::unique_ptr<storm::modelchecker::CheckResult> result = modelchecker.check(Environment(), valuation);
+                            valuationWatch.stop();
 
-                        if (result) {
-                            result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                            if (result) {
+                                result->filter(storm::modelchecker::ExplicitQualitativeCheckResult(model.getInitialStates()));
+                            }
+                            printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
                         }
-                        printInitialStatesResult<ValueType>(result, &valuationWatch, &valuation);
 
                         for (uint64_t i = 0; i < parameters.size(); ++i) {
                             ++iterators[i];
@@ -494,6 +518,9 @@ namespace storm {
 
                     }
                 }
+                if (!batch.empty()) {
+                    checkBatch();
+                }
 
                 watch.stop();
                 STORM_PRINT_AND_LOG("Overall time for sampling all instances: " << watch << "\n\n");
@@ -656,17 +683,18 @@ namespace storm {
                     = storm::modelchecker::CheckTask<storm::logic::Formula, ValueType>(*formulaWithoutBound);
                 modelChecker.specifyFormula(Environment(), checkTask);
 
+                auto results = modelChecker.checkMultipleParameters(Environment(), instantiation, std::vector<RationalFunctionVariable>(vars.begin(), vars.end()));
                 for (auto const& parameter : vars) {
                     std::cout << "Derivative w.r.t. " << parameter << ": ";
-                    
-                    auto result = modelChecker.check(Environment(), instantiation, parameter);
-                    std::cout << *result << '\n';
+                    std::cout << *results.at(parameter) << '\n';
                 }
                 return;
             } else if (derSettings.isFeasibleInstantiationSearchSet()) {
                 STORM_PRINT("Finding an extremum using Gradient Descent\n");
                 storm::utility::Stopwatch derivativeWatch(true);
                 storm::derivative::GradientDescentInstantiationSearcher<storm::RationalFunction, double> derivativeChecker(*dtmc, *method, derSettings.getLearningRate(), derSettings.getAverageDecay(), derSettings.getSquaredAverageDecay(), derSettings.getMiniBatchSize(), derSettings.getTerminationEpsilon(), startPoint, *constraintMethod, derSettings.isPrintJsonSet());
+                derivativeChecker.setInstantiationsAreGraphPreserving(derSettings.isGraphPreservingSet());
+                derivativeChecker.setWarmStart(derSettings.isWarmStartSet());
                 storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> checkTask(*formula);
                 derivativeChecker.specifyFormula(Environment(), checkTask);
                 auto instantiationAndValue = derivativeChecker.gradientDescent(Environment());
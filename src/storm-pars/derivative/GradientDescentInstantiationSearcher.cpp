@@ -300,9 +300,8 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
         }
 
         if (computeValue) {
-            std::unique_ptr<storm::modelchecker::CheckResult> intermediateResult = instantiationModelChecker->check(env, nesterovPredictedPosition);
-            std::vector<ConstantType> valueVector = intermediateResult->asExplicitQuantitativeCheckResult<ConstantType>().getValueVector();
-            if (Nesterov* nesterov = boost::get<Nesterov>(&gradientDescentType)) {
+            std::vector<ConstantType> valueVector;
+            if (boost::get<Nesterov>(&gradientDescentType)) {
                 std::map<VariableType<FunctionType>, CoefficientType<FunctionType>> modelCheckPosition(position);
                 if (constraintMethod == GradientDescentConstraintMethod::LOGISTIC_SIGMOID) {
                     for (auto const& parameter : parameters) {
@@ -312,10 +311,14 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
                              utility::convertNumber<CoefficientType<FunctionType>>(std::exp(-utility::convertNumber<double>(modelCheckPosition[parameter]))));
                     }
                 }
-                std::unique_ptr<storm::modelchecker::CheckResult> terminationResult = instantiationModelChecker->check(env, modelCheckPosition);
-                std::vector<ConstantType> terminationValueVector = terminationResult->asExplicitQuantitativeCheckResult<ConstantType>().getValueVector();
-                currentValue = terminationValueVector[initialStateModel];
+                // Both positions share the same model structure, so we check them together.
+                std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results =
+                    instantiationModelChecker->checkMultiple(env, {nesterovPredictedPosition, modelCheckPosition});
+                valueVector = std::move(results[0]->asExplicitQuantitativeCheckResult<ConstantType>().getValueVector());
+                currentValue = results[1]->asExplicitQuantitativeCheckResult<ConstantType>().getValueVector()[initialStateModel];
             } else {
+                std::unique_ptr<storm::modelchecker::CheckResult> intermediateResult = instantiationModelChecker->check(env, nesterovPredictedPosition);
+                valueVector = std::move(intermediateResult->asExplicitQuantitativeCheckResult<ConstantType>().getValueVector());
                 currentValue = valueVector[initialStateModel];
             }
 
@@ -323,9 +326,10 @@ ConstantType GradientDescentInstantiationSearcher<FunctionType, ConstantType>::s
                 break;
             }
 
+            // All derivatives of the mini-batch share the same equation system, so they are computed together.
+            auto derivatives = derivativeEvaluationHelper->checkMultipleParameters(env, nesterovPredictedPosition, miniBatch, valueVector);
             for (auto const& parameter : miniBatch) {
-                auto checkResult = derivativeEvaluationHelper->check(env, nesterovPredictedPosition, parameter, valueVector);
-                ConstantType delta = checkResult->getValueVector()[derivativeEvaluationHelper->getInitialState()];
+                ConstantType delta = derivatives.at(parameter)->getValueVector()[derivativeEvaluationHelper->getInitialState()];
                 if (currentCheckTask->getBound().comparisonType == logic::ComparisonType::Less ||
                     currentCheckTask->getBound().comparisonType == logic::ComparisonType::LessEqual) {
                     delta = -delta;
@@ -161,6 +161,23 @@ class GradientDescentInstantiationSearcher {
         derivativeEvaluationHelper->specifyFormula(env, *this->currentCheckTaskNoBound);
     }
 
+    /**
+     * Sets whether it can be assumed that all instantiations visited by the search are graph-preserving.
+     * If set, instantiations that are checked together are solved simultaneously.
+     * @param value The new value.
+     */
+    void setInstantiationsAreGraphPreserving(bool value) {
+        instantiationModelChecker->setInstantiationsAreGraphPreserving(value);
+    }
+
+    /**
+     * Sets whether the derivatives of a step are used as the initial guess when computing the derivatives of the next step.
+     * @param value The new value.
+     */
+    void setWarmStart(bool value) {
+        derivativeEvaluationHelper->setWarmStart(value);
+    }
+
     /**
      * Perform Gradient Descent.
      * @param env The environment. Pass the same environment as to specifyFormula.
@@ -1,4 +1,5 @@
 #include "SparseDerivativeInstantiationModelChecker.h"
+#include "adapters/IntelTbbAdapter.h"
 #include "analysis/GraphConditions.h"
 #include "environment/Environment.h"
 #include "environment/solver/GmmxxSolverEnvironment.h"
@@ -26,6 +27,7 @@
 #include "utility/constants.h"
 #include "utility/graph.h"
 #include "utility/logging.h"
+#include "utility/parallel.h"
 
 namespace storm {
 namespace derivative {
@@ -39,6 +41,15 @@ template<typename FunctionType, typename ConstantType>
 std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::check(
     Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation, VariableType<FunctionType> const& parameter,
     boost::optional<std::vector<ConstantType>> const& valueVector) {
+    auto results = checkMultipleParameters(env, valuation, {parameter}, valueVector);
+    return std::move(results.at(parameter));
+}
+
+template<typename FunctionType, typename ConstantType>
+std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::checkMultipleParameters(
+    Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+    std::vector<VariableType<FunctionType>> const& parametersToCheck, boost::optional<std::vector<ConstantType>> const& valueVector) {
     std::vector<ConstantType> reachabilityProbabilities;
     if (!valueVector.is_initialized()) {
         storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<FunctionType>, ConstantType> instantiationModelChecker(model);
@@ -58,65 +69,115 @@ std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>> Spa
             interestingReachabilityProbabilities.push_back(reachabilityProbabilities[i]);
         }
     }
-    // Instantiate the matrices with the given instantiation
 
+    // Instantiate the matrices with the given instantiation. The equation system matrix is the same for all parameters,
+    // only the right-hand sides depend on the parameter.
+    // Evaluating the functions is done sequentially as the rational function library is not thread-safe.
     instantiationWatch.start();
 
-    // STORM_PRINT_AND_LOG(valuation << "\n");
-
-    // Write results into the placeholders
     for (auto& functionResult : this->functionsUnderived) {
         functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
     }
-    for (auto& functionResult : this->functionsDerived.at(parameter)) {
-        functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
-    }
-
-    auto deltaConstrainedMatrixInstantiated = deltaConstrainedMatricesInstantiated->at(parameter);
-
-    // Write the instantiated values to the matrices and vectors according to the stored mappings
     for (auto& entryValuePair : this->matrixMappingUnderived) {
         entryValuePair.first->setValue(*(entryValuePair.second));
     }
-    for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
-        entryValuePair.first->setValue(*(entryValuePair.second));
-    }
 
-    std::vector<ConstantType> instantiatedDerivedOutputVec(derivedOutputVecs->at(parameter).size());
-    for (uint_fast64_t i = 0; i < derivedOutputVecs->at(parameter).size(); i++) {
-        instantiatedDerivedOutputVec[i] = utility::convertNumber<ConstantType>(derivedOutputVecs->at(parameter)[i].evaluate(valuation));
+    std::vector<std::vector<ConstantType>> instantiatedDerivedOutputVecs;
+    instantiatedDerivedOutputVecs.reserve(parametersToCheck.size());
+    for (auto const& parameter : parametersToCheck) {
+        for (auto& functionResult : this->functionsDerived.at(parameter)) {
+            functionResult.second = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functionResult.first, valuation));
+        }
+        for (auto& entryValuePair : this->matrixMappingsDerived.at(parameter)) {
+            entryValuePair.first->setValue(*(entryValuePair.second));
+        }
+
+        std::vector<FunctionType> const& derivedOutputVec = derivedOutputVecs->at(parameter);
+        std::vector<ConstantType> instantiatedDerivedOutputVec(derivedOutputVec.size());
+        for (uint_fast64_t i = 0; i < derivedOutputVec.size(); i++) {
+            instantiatedDerivedOutputVec[i] = utility::convertNumber<ConstantType>(derivedOutputVec[i].evaluate(valuation));
+        }
+        instantiatedDerivedOutputVecs.push_back(std::move(instantiatedDerivedOutputVec));
     }
 
     instantiationWatch.stop();
 
     approximationWatch.start();
 
-    std::vector<ConstantType> resultVec(interestingReachabilityProbabilities.size());
-    deltaConstrainedMatrixInstantiated.multiplyWithVector(interestingReachabilityProbabilities, resultVec);
-    for (uint_fast64_t i = 0; i < instantiatedDerivedOutputVec.size(); ++i) {
-        resultVec[i] += instantiatedDerivedOutputVec[i];
-    }
+    std::vector<std::vector<ConstantType>> derivatives(parametersToCheck.size());
 
-    // Here's where the real magic happens - the solver call!
-    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
-    auto solver = factory.create(env);
+    // Calculates (1-M)^-1 * (M' * x + b') for the parameter with the given index, reusing the given solver.
+    auto solveForParameter = [&](storm::solver::LinearEquationSolver<ConstantType>& solver, uint64_t parameterIndex) {
+        auto const& parameter = parametersToCheck[parameterIndex];
+        std::vector<ConstantType> resultVec(interestingReachabilityProbabilities.size());
+        deltaConstrainedMatricesInstantiated->at(parameter).multiplyWithVector(interestingReachabilityProbabilities, resultVec);
+        storm::utility::vector::addVectors(resultVec, instantiatedDerivedOutputVecs[parameterIndex], resultVec);
 
-    // Calculate (1-M)^-1 * resultVec
-    // STORM_PRINT_AND_LOG(constrainedMatrixInstantiated << "\n");
-    // STORM_PRINT_AND_LOG("calling solver\n");
-    solver->setMatrix(constrainedMatrixInstantiated);
-    std::vector<ConstantType> finalResult(resultVec.size());
-    solver->solveEquations(env, finalResult, resultVec);
+        std::vector<ConstantType>& derivative = derivatives[parameterIndex];
+        auto previousDerivativeIt = previousDerivatives.find(parameter);
+        if (warmStart && previousDerivativeIt != previousDerivatives.end() && previousDerivativeIt->second.size() == resultVec.size()) {
+            derivative = previousDerivativeIt->second;
+        } else {
+            derivative.assign(resultVec.size(), storm::utility::zero<ConstantType>());
+        }
+        solver.solveEquations(env, derivative, resultVec);
+    };
+
+    // Creates a solver for the instantiated equation system. Caching is enabled such that factorizations and preconditioners
+    // computed for the first right-hand side are reused for the remaining ones.
+    storm::solver::GeneralLinearEquationSolverFactory<ConstantType> factory;
+    auto createSolver = [&]() {
+        auto solver = factory.create(env, constrainedMatrixInstantiated);
+        solver->setCachingEnabled(true);
+        return solver;
+    };
+
+    bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+    parallelize = parametersToCheck.size() > 1 && storm::utility::parallel::isIntelTbbEnabled();
+    if (parallelize) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, parametersToCheck.size()), [&](tbb::blocked_range<uint64_t> const& range) {
+            // Solvers are not thread-safe, so every chunk of parameters gets its own solver.
+            auto solver = createSolver();
+            for (uint64_t parameterIndex = range.begin(); parameterIndex < range.end(); ++parameterIndex) {
+                solveForParameter(*solver, parameterIndex);
+            }
+        });
+    }
+#endif
+    if (!parallelize) {
+        auto solver = createSolver();
+        for (uint64_t parameterIndex = 0; parameterIndex < parametersToCheck.size(); ++parameterIndex) {
+            solveForParameter(*solver, parameterIndex);
+        }
+    }
 
     approximationWatch.stop();
 
-    return std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(finalResult);
+    std::map<VariableType<FunctionType>, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>> results;
+    for (uint64_t parameterIndex = 0; parameterIndex < parametersToCheck.size(); ++parameterIndex) {
+        auto const& parameter = parametersToCheck[parameterIndex];
+        if (warmStart) {
+            previousDerivatives[parameter] = derivatives[parameterIndex];
+        }
+        results[parameter] = std::make_unique<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>(std::move(derivatives[parameterIndex]));
+    }
+    return results;
+}
+
+template<typename FunctionType, typename ConstantType>
+void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::setWarmStart(bool value) {
+    warmStart = value;
+    if (!warmStart) {
+        previousDerivatives.clear();
+    }
 }
 
 template<typename FunctionType, typename ConstantType>
 void SparseDerivativeInstantiationModelChecker<FunctionType, ConstantType>::specifyFormula(
     Environment const& env, modelchecker::CheckTask<storm::logic::Formula, FunctionType> const& checkTask) {
     this->currentFormula = checkTask.getFormula().asSharedPointer();
+    this->previousDerivatives.clear();
     this->currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, FunctionType>>(
         checkTask.substituteFormula(*currentFormula).template convertValueType<FunctionType>());
     this->parameters = storm::models::sparse::getProbabilityParameters(model);
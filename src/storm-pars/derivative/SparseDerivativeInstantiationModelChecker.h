@@ -46,7 +46,30 @@ class SparseDerivativeInstantiationModelChecker {
         Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
         typename utility::parametric::VariableType<FunctionType>::type const& parameter,
         boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
-    
+
+    /**
+     * checkMultipleParameters calculates the derivatives of the model w.r.t. several parameters at an instantiation.
+     * The equation systems for the different parameters only differ in their right-hand sides, so the system matrix is instantiated
+     * once and the solver (including factorizations or preconditioners) is reused for all parameters.
+     * If Intel TBB is enabled, the parameters are distributed over several threads.
+     * Call specifyFormula first!
+     * @param env The environment.
+     * @param valuation The instantiation at which the derivatives are computed.
+     * @param parametersToCheck The parameters w.r.t. which the derivatives are computed.
+     * @param valueVector The values of the model at the instantiation. They are computed if not given.
+     */
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::unique_ptr<modelchecker::ExplicitQuantitativeCheckResult<ConstantType>>>
+    checkMultipleParameters(Environment const& env, storm::utility::parametric::Valuation<FunctionType> const& valuation,
+                            std::vector<typename utility::parametric::VariableType<FunctionType>::type> const& parametersToCheck,
+                            boost::optional<std::vector<ConstantType>> const& valueVector = boost::none);
+
+    /**
+     * Sets whether the derivatives computed in the previous call are used as the initial guess for the next call.
+     * This is beneficial for iterative solvers if consecutive instantiations are close to each other, e.g., during gradient descent.
+     * @param value The new value.
+     */
+    void setWarmStart(bool value);
+
     uint64_t getInitialState() {
         return initialStateEqSystem;
     }
@@ -71,6 +94,10 @@ class SparseDerivativeInstantiationModelChecker {
         deltaConstrainedMatricesInstantiated;
     std::unique_ptr<std::map<typename utility::parametric::VariableType<FunctionType>::type, std::vector<FunctionType>>> derivedOutputVecs;
 
+    // Whether the derivatives of the previous call are used as initial guesses and these derivatives.
+    bool warmStart = false;
+    std::map<typename utility::parametric::VariableType<FunctionType>::type, std::vector<ConstantType>> previousDerivatives;
+
     // next states: states that have a relevant successor
     storage::BitVector next;
     uint_fast64_t initialStateEqSystem;
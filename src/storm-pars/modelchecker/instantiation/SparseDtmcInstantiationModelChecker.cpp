@@ -4,6 +4,9 @@
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
 #include "storm/modelchecker/hints/ExplicitModelCheckerHint.h"
+#include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -12,10 +15,17 @@ namespace storm {
     namespace modelchecker {
         
         template <typename SparseModelType, typename ConstantType>
-        SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel) {
+        SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel) : SparseInstantiationModelChecker<SparseModelType, ConstantType>(parametricModel), modelInstantiator(parametricModel), multiValuationEquationSystemInitialized(false) {
             //Intentionally left empty
         }
 
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) {
+            SparseInstantiationModelChecker<SparseModelType, ConstantType>::specifyFormula(checkTask);
+            multiValuationEquationSystem.reset();
+            multiValuationEquationSystemInitialized = false;
+        }
+
         template <typename SparseModelType, typename ConstantType>
         std::unique_ptr<CheckResult> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) {
             STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
@@ -162,6 +172,106 @@ namespace storm {
             return result;
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkMultiple(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            STORM_LOG_THROW(this->currentCheckTask, storm::exceptions::InvalidStateException, "Checking has been invoked but no property has been specified before.");
+            // Simultaneous solving is only sound if all instantiations share the graph of the parametric model.
+            // Moreover, exact arithmetic is not supported as it relies on value iteration.
+            if (std::is_same<ConstantType, double>::value && this->getInstantiationsAreGraphPreserving() && valuations.size() > 1) {
+                if (!multiValuationEquationSystemInitialized) {
+                    initializeMultiValuationEquationSystem();
+                    multiValuationEquationSystemInitialized = true;
+                }
+                if (multiValuationEquationSystem) {
+                    return checkMultipleWithMultiValuationEquationSystem(env, valuations);
+                }
+            }
+            return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkMultiple(env, valuations);
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        void SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::initializeMultiValuationEquationSystem() {
+            typedef typename SparseModelType::ValueType ParametricType;
+            auto const& formula = this->currentCheckTask->getFormula();
+            if (!formula.isProbabilityOperatorFormula() && !formula.isRewardOperatorFormula()) {
+                return;
+            }
+            auto const& subformula = formula.asOperatorFormula().getSubformula();
+            
+            // Since the instantiations are graph preserving, the qualitative analysis can be done on the parametric model directly.
+            auto const& transitionMatrix = this->parametricModel.getTransitionMatrix();
+            storm::storage::SparseMatrix<ParametricType> backwardTransitions = transitionMatrix.transpose(true);
+            storm::modelchecker::SparsePropositionalModelChecker<SparseModelType> propositionalModelChecker(this->parametricModel);
+            uint64_t const numberOfStates = this->parametricModel.getNumberOfStates();
+            
+            std::vector<ParametricType> parametricVector;
+            if (subformula.isReachabilityProbabilityFormula() || subformula.isUntilFormula()) {
+                storm::storage::BitVector phiStates(numberOfStates, true);
+                storm::storage::BitVector psiStates;
+                if (subformula.isUntilFormula()) {
+                    auto const& untilFormula = subformula.asUntilFormula();
+                    if (!untilFormula.getLeftSubformula().isInFragment(storm::logic::propositional()) || !untilFormula.getRightSubformula().isInFragment(storm::logic::propositional())) {
+                        return;
+                    }
+                    phiStates = propositionalModelChecker.check(untilFormula.getLeftSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                    psiStates = propositionalModelChecker.check(untilFormula.getRightSubformula())->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                } else {
+                    auto const& targetFormula = subformula.asEventuallyFormula().getSubformula();
+                    if (!targetFormula.isInFragment(storm::logic::propositional())) {
+                        return;
+                    }
+                    psiStates = propositionalModelChecker.check(targetFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                }
+                auto statesWithProbability01 = storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+                multiValuationMaybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+                multiValuationResultTemplate = std::vector<ConstantType>(numberOfStates, storm::utility::zero<ConstantType>());
+                storm::utility::vector::setVectorValues(multiValuationResultTemplate, statesWithProbability01.second, storm::utility::one<ConstantType>());
+                parametricVector = transitionMatrix.getConstrainedRowSumVector(multiValuationMaybeStates, statesWithProbability01.second);
+            } else if (subformula.isReachabilityRewardFormula() && formula.asRewardOperatorFormula().getMeasureType() == storm::logic::RewardMeasureType::Expectation) {
+                auto const& targetFormula = subformula.asEventuallyFormula().getSubformula();
+                if (!targetFormula.isInFragment(storm::logic::propositional())) {
+                    return;
+                }
+                storm::storage::BitVector targetStates = propositionalModelChecker.check(targetFormula)->asExplicitQualitativeCheckResult().getTruthValuesVector();
+                storm::storage::BitVector infinityStates = ~storm::utility::graph::performProb1(backwardTransitions, storm::storage::BitVector(numberOfStates, true), targetStates);
+                multiValuationMaybeStates = ~(targetStates | infinityStates);
+                multiValuationResultTemplate = std::vector<ConstantType>(numberOfStates, storm::utility::zero<ConstantType>());
+                storm::utility::vector::setVectorValues(multiValuationResultTemplate, infinityStates, storm::utility::infinity<ConstantType>());
+                auto const& rewardModel = this->parametricModel.getRewardModel(this->currentCheckTask->isRewardModelSet() ? this->currentCheckTask->getRewardModel() : "");
+                parametricVector = storm::utility::vector::filterVector(rewardModel.getTotalRewardVector(transitionMatrix), multiValuationMaybeStates);
+            } else {
+                return;
+            }
+            
+            multiValuationEquationSystem = std::make_unique<storm::utility::MultiValuationEquationSystem<ParametricType, ConstantType>>(transitionMatrix.getSubmatrix(false, multiValuationMaybeStates, multiValuationMaybeStates), parametricVector);
+        }
+        
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseDtmcInstantiationModelChecker<SparseModelType, ConstantType>::checkMultipleWithMultiValuationEquationSystem(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            multiValuationEquationSystem->instantiate(valuations);
+            std::vector<ConstantType> x(multiValuationEquationSystem->getNumberOfRows() * valuations.size(), storm::utility::zero<ConstantType>());
+            if (!multiValuationEquationSystem->solveEquations(env, x) && !storm::utility::resources::isTerminate()) {
+                // Do not return the values of systems that did not converge. The single-valuation checks can use a different solution method.
+                STORM_LOG_WARN("Solving the equation systems of all valuations simultaneously did not converge. Checking the valuations one after another.");
+                return SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkMultiple(env, valuations);
+            }
+            
+            auto const& operatorFormula = this->currentCheckTask->getFormula().asOperatorFormula();
+            std::vector<std::unique_ptr<CheckResult>> result;
+            result.reserve(valuations.size());
+            for (uint64_t valuationIndex = 0; valuationIndex < valuations.size(); ++valuationIndex) {
+                std::vector<ConstantType> values = multiValuationResultTemplate;
+                storm::utility::vector::setVectorValues(values, multiValuationMaybeStates, multiValuationEquationSystem->getSolution(x, valuationIndex));
+                auto quantitativeResult = std::make_unique<ExplicitQuantitativeCheckResult<ConstantType>>(std::move(values));
+                if (operatorFormula.hasQuantitativeResult()) {
+                    result.push_back(std::move(quantitativeResult));
+                } else {
+                    result.push_back(quantitativeResult->compareAgainstBound(operatorFormula.getComparisonType(), operatorFormula.template getThresholdAs<ConstantType>()));
+                }
+            }
+            return result;
+        }
+        
         template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double>;
         template class SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, storm::RationalNumber>;
 
@@ -5,6 +5,7 @@
 
 #include "storm-pars/modelchecker/instantiation/SparseInstantiationModelChecker.h"
 #include "storm-pars/utility/ModelInstantiator.h"
+#include "storm-pars/utility/MultiValuationEquationSystem.h"
 #include "storm/models/sparse/Dtmc.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
@@ -20,7 +21,17 @@ namespace storm {
         public:
             SparseDtmcInstantiationModelChecker(SparseModelType const& parametricModel);
             
+            virtual void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask) override;
+            
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) override;
+            
+            /*!
+             * Checks the formula for each of the given valuations.
+             * If the instantiations are graph preserving and the formula is an (unbounded) reachability probability or reachability reward formula,
+             * the instantiated equation systems are solved simultaneously (see MultiValuationEquationSystem).
+             * Otherwise, the valuations are checked one after another.
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkMultiple(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) override;
 
         protected:
             
@@ -29,7 +40,18 @@ namespace storm {
             std::unique_ptr<CheckResult> checkReachabilityRewardFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             std::unique_ptr<CheckResult> checkBoundedUntilFormula(Environment const& env, storm::modelchecker::SparseDtmcPrctlModelChecker<storm::models::sparse::Dtmc<ConstantType>>& modelChecker);
             
+            // Simultaneous solving of multiple valuations
+            void initializeMultiValuationEquationSystem();
+            std::vector<std::unique_ptr<CheckResult>> checkMultipleWithMultiValuationEquationSystem(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+            
             storm::utility::ModelInstantiator<SparseModelType, storm::models::sparse::Dtmc<ConstantType>> modelInstantiator;
+            
+            // The equation system over the maybe states of the current formula (if the formula is supported).
+            std::unique_ptr<storm::utility::MultiValuationEquationSystem<typename SparseModelType::ValueType, ConstantType>> multiValuationEquationSystem;
+            bool multiValuationEquationSystemInitialized;
+            storm::storage::BitVector multiValuationMaybeStates;
+            // The result values of the non-maybe states. These do not depend on the valuation.
+            std::vector<ConstantType> multiValuationResultTemplate;
         };
     }
 }
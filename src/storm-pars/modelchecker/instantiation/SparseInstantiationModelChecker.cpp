@@ -22,6 +22,16 @@ namespace storm {
             currentCheckTask = std::make_unique<storm::modelchecker::CheckTask<storm::logic::Formula, ConstantType>>(checkTask.substituteFormula(*currentFormula).template convertValueType<ConstantType>());
         }
         
+        template <typename SparseModelType, typename ConstantType>
+        std::vector<std::unique_ptr<CheckResult>> SparseInstantiationModelChecker<SparseModelType, ConstantType>::checkMultiple(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations) {
+            std::vector<std::unique_ptr<CheckResult>> result;
+            result.reserve(valuations.size());
+            for (auto const& valuation : valuations) {
+                result.push_back(check(env, valuation));
+            }
+            return result;
+        }
+        
         template <typename SparseModelType, typename ConstantType>
         void SparseInstantiationModelChecker<SparseModelType, ConstantType>::setInstantiationsAreGraphPreserving(bool value) {
             instantiationsAreGraphPreserving = value;
@@ -21,10 +21,17 @@ namespace storm {
             SparseInstantiationModelChecker(SparseModelType const& parametricModel);
             virtual ~SparseInstantiationModelChecker() = default;
             
-            void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
+            virtual void specifyFormula(CheckTask<storm::logic::Formula, typename SparseModelType::ValueType> const& checkTask);
             
             virtual std::unique_ptr<CheckResult> check(Environment const& env, storm::utility::parametric::Valuation<typename SparseModelType::ValueType> const& valuation) = 0;
             
+            /*!
+             * Checks the formula for each of the given valuations.
+             * By default, the valuations are checked one after another. Subclasses may override this to solve the instantiated models simultaneously.
+             * @return One check result for each valuation (in the same order)
+             */
+            virtual std::vector<std::unique_ptr<CheckResult>> checkMultiple(Environment const& env, std::vector<storm::utility::parametric::Valuation<typename SparseModelType::ValueType>> const& valuations);
+            
             // If set, it is assumed that all considered model instantiations have the same underlying graph structure.
             // This bypasses the graph analysis for the different instantiations.
             void setInstantiationsAreGraphPreserving(bool value);
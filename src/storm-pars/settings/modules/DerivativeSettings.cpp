@@ -28,6 +28,8 @@ namespace storm {
             const std::string DerivativeSettings::omitInconsequentialParams = "omit-inconsequential-params";
             const std::string DerivativeSettings::startPoint = "start-point";
             const std::string DerivativeSettings::constraintMethod = "constraint-method";
+            const std::string DerivativeSettings::graphPreserving = "gd-graph-preserving";
+            const std::string DerivativeSettings::warmStart = "gd-warm-start";
 
             DerivativeSettings::DerivativeSettings() : ModuleSettings(moduleName) {
                 this->addOption(storm::settings::OptionBuilder(moduleName, feasibleInstantiationSearch, false, "Search for a feasible instantiation (restart with new instantiation while not feasible)").build());
@@ -50,6 +52,8 @@ namespace storm {
                 this->addOption(storm::settings::OptionBuilder(moduleName, omitInconsequentialParams, false, "Parameters that are removed in minimization because they have no effect on the rational function are normally set to 0.5 in the final instantiation. If this flag is set, they will be omitted from the final instantiation entirely.").setIsAdvanced().build());
                 this->addOption(storm::settings::OptionBuilder(moduleName, constraintMethod, false, "Constraint Method").setIsAdvanced()
                         .addArgument(storm::settings::ArgumentBuilder::createStringArgument(constraintMethod, "Method for dealing with constraints").setDefaultValueString("project-gradient").build()).build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, graphPreserving, false, "Sets whether it can be assumed that all instantiations visited by gradient descent are graph-preserving. Enables simultaneous solving of several instantiations.").setIsAdvanced().build());
+                this->addOption(storm::settings::OptionBuilder(moduleName, warmStart, false, "Sets whether the derivatives computed in a gradient descent step are used as initial guesses for the next step.").setIsAdvanced().build());
             }
 
             bool DerivativeSettings::isFeasibleInstantiationSearchSet() const {
@@ -112,6 +116,14 @@ namespace storm {
                 return boost::none;
             }
 
+            bool DerivativeSettings::isGraphPreservingSet() const {
+                return this->getOption(graphPreserving).getHasOptionBeenSet();
+            }
+
+            bool DerivativeSettings::isWarmStartSet() const {
+                return this->getOption(warmStart).getHasOptionBeenSet();
+            }
+
             boost::optional<derivative::GradientDescentMethod> DerivativeSettings::methodFromString(const std::string &str) const {
                   derivative::GradientDescentMethod method;
                   if (str == "adam") {
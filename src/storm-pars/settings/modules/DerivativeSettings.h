@@ -93,6 +93,16 @@ namespace storm {
                  */
                 boost::optional<std::string> getStartPoint() const;
 
+                /*!
+                 * Retrieves whether it can be assumed that all instantiations visited by the search are graph-preserving.
+                 */
+                bool isGraphPreservingSet() const;
+
+                /*!
+                 * Retrieves whether the derivatives of a gradient descent step are used as initial guesses for the next step.
+                 */
+                bool isWarmStartSet() const;
+
                 const static std::string moduleName;
             private:
                 const static std::string extremumSearch;
@@ -109,6 +119,8 @@ namespace storm {
                 const static std::string omitInconsequentialParams;
                 const static std::string startPoint;
                 const static std::string constraintMethod;
+                const static std::string graphPreserving;
+                const static std::string warmStart;
                 boost::optional<derivative::GradientDescentMethod> methodFromString(const std::string &str) const;
                 boost::optional<derivative::GradientDescentConstraintMethod> constraintMethodFromString(const std::string &str) const;
             };
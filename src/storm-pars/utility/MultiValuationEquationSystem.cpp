@@ -0,0 +1,174 @@
+#include "storm-pars/utility/MultiValuationEquationSystem.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/SignalHandler.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+    namespace utility {
+
+        template<typename ParametricType, typename ConstantType>
+        MultiValuationEquationSystem<ParametricType, ConstantType>::MultiValuationEquationSystem(storm::storage::SparseMatrix<ParametricType> const& matrix, std::vector<ParametricType> const& vector) : numberOfValuations(0) {
+            STORM_LOG_THROW(matrix.hasTrivialRowGrouping(), storm::exceptions::InvalidArgumentException, "Expected a matrix without row groups.");
+            STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException, "Expected a square matrix.");
+            STORM_LOG_THROW(matrix.getRowCount() == vector.size(), storm::exceptions::InvalidArgumentException, "Dimensions of matrix and vector do not match.");
+
+            std::unordered_map<ParametricType, uint64_t> functionToIndexMap;
+            rowIndications.reserve(matrix.getRowCount() + 1);
+            columns.reserve(matrix.getEntryCount());
+            matrixFunctionIndices.reserve(matrix.getEntryCount());
+            rowIndications.push_back(0);
+            for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+                for (auto const& entry : matrix.getRow(row)) {
+                    columns.push_back(entry.getColumn());
+                    matrixFunctionIndices.push_back(getFunctionIndex(entry.getValue(), functionToIndexMap));
+                }
+                rowIndications.push_back(columns.size());
+            }
+            vectorFunctionIndices.reserve(vector.size());
+            for (auto const& function : vector) {
+                vectorFunctionIndices.push_back(getFunctionIndex(function, functionToIndexMap));
+            }
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        uint64_t MultiValuationEquationSystem<ParametricType, ConstantType>::getFunctionIndex(ParametricType const& function, std::unordered_map<ParametricType, uint64_t>& functionToIndexMap) {
+            auto insertionRes = functionToIndexMap.emplace(function, functions.size());
+            if (insertionRes.second) {
+                functions.push_back(function);
+            }
+            return insertionRes.first->second;
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        void MultiValuationEquationSystem<ParametricType, ConstantType>::instantiate(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations) {
+            numberOfValuations = valuations.size();
+            uint64_t const K = numberOfValuations;
+
+            // Evaluate every distinct function once per valuation.
+            std::vector<ConstantType> functionValues(functions.size() * K);
+            for (uint64_t functionIndex = 0; functionIndex < functions.size(); ++functionIndex) {
+                auto valueIt = functionValues.begin() + functionIndex * K;
+                for (auto const& valuation : valuations) {
+                    *valueIt = storm::utility::convertNumber<ConstantType>(storm::utility::parametric::evaluate(functions[functionIndex], valuation));
+                    ++valueIt;
+                }
+            }
+
+            // Scatter the function values to the interleaved matrix and vector values.
+            matrixValues.resize(matrixFunctionIndices.size() * K);
+            auto matrixValueIt = matrixValues.begin();
+            for (auto const& functionIndex : matrixFunctionIndices) {
+                matrixValueIt = std::copy_n(functionValues.begin() + functionIndex * K, K, matrixValueIt);
+            }
+            vectorValues.resize(vectorFunctionIndices.size() * K);
+            auto vectorValueIt = vectorValues.begin();
+            for (auto const& functionIndex : vectorFunctionIndices) {
+                vectorValueIt = std::copy_n(functionValues.begin() + functionIndex * K, K, vectorValueIt);
+            }
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        uint64_t MultiValuationEquationSystem<ParametricType, ConstantType>::getNumberOfValuations() const {
+            return numberOfValuations;
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        uint64_t MultiValuationEquationSystem<ParametricType, ConstantType>::getNumberOfRows() const {
+            return rowIndications.size() - 1;
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        bool MultiValuationEquationSystem<ParametricType, ConstantType>::solveEquations(Environment const& env, std::vector<ConstantType>& x) const {
+            uint64_t const K = numberOfValuations;
+            uint64_t const numberOfRows = getNumberOfRows();
+            STORM_LOG_THROW(x.size() == numberOfRows * K, storm::exceptions::InvalidArgumentException, "Unexpected size of the solution vector.");
+
+            ConstantType const precision = storm::utility::convertNumber<ConstantType>(env.solver().native().getPrecision());
+            bool const relative = env.solver().native().getRelativeTerminationCriterion();
+            uint64_t const maxIterations = env.solver().native().getMaximalNumberOfIterations();
+
+            // Tracks for every valuation whether its system has converged.
+            std::vector<bool> converged(K, false);
+            uint64_t numberOfConverged = 0;
+
+            std::vector<ConstantType> rowValues(K);
+            std::vector<ConstantType> diagonalValues(K);
+            std::vector<ConstantType> maxDifferences(K);
+            uint64_t iterations = 0;
+            while (numberOfConverged < K && iterations < maxIterations) {
+                std::fill(maxDifferences.begin(), maxDifferences.end(), storm::utility::zero<ConstantType>());
+                for (uint64_t row = 0; row < numberOfRows; ++row) {
+                    // Initialize with the row's entry of b.
+                    std::copy_n(vectorValues.begin() + row * K, K, rowValues.begin());
+                    std::fill(diagonalValues.begin(), diagonalValues.end(), storm::utility::zero<ConstantType>());
+                    for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+                        uint64_t const column = columns[entry];
+                        auto const* entryValues = &matrixValues[entry * K];
+                        if (column == row) {
+                            for (uint64_t k = 0; k < K; ++k) {
+                                diagonalValues[k] = entryValues[k];
+                            }
+                        } else {
+                            auto const* columnValues = &x[column * K];
+                            for (uint64_t k = 0; k < K; ++k) {
+                                rowValues[k] += entryValues[k] * columnValues[k];
+                            }
+                        }
+                    }
+                    auto* rowSolution = &x[row * K];
+                    for (uint64_t k = 0; k < K; ++k) {
+                        ConstantType newValue = rowValues[k] / (storm::utility::one<ConstantType>() - diagonalValues[k]);
+                        ConstantType difference = storm::utility::abs<ConstantType>(newValue - rowSolution[k]);
+                        if (relative && !storm::utility::isZero(newValue)) {
+                            difference /= storm::utility::abs<ConstantType>(newValue);
+                        }
+                        maxDifferences[k] = std::max(maxDifferences[k], difference);
+                        rowSolution[k] = std::move(newValue);
+                    }
+                }
+                ++iterations;
+
+                for (uint64_t k = 0; k < K; ++k) {
+                    if (!converged[k] && maxDifferences[k] <= precision) {
+                        converged[k] = true;
+                        ++numberOfConverged;
+                        STORM_LOG_TRACE("System for valuation " << k << " converged after " << iterations << " iterations.");
+                    }
+                }
+
+                if (storm::utility::resources::isTerminate()) {
+                    break;
+                }
+            }
+
+            STORM_LOG_WARN_COND(numberOfConverged == K, "Simultaneous value iteration did not converge for " << (K - numberOfConverged) << " of " << K << " valuations within " << iterations << " iterations.");
+            STORM_LOG_INFO("Simultaneous value iteration for " << K << " valuations performed " << iterations << " iterations.");
+            return numberOfConverged == K;
+        }
+
+        template<typename ParametricType, typename ConstantType>
+        std::vector<ConstantType> MultiValuationEquationSystem<ParametricType, ConstantType>::getSolution(std::vector<ConstantType> const& x, uint64_t valuationIndex) const {
+            STORM_LOG_ASSERT(valuationIndex < numberOfValuations, "Invalid valuation index.");
+            std::vector<ConstantType> result;
+            result.reserve(getNumberOfRows());
+            for (uint64_t index = valuationIndex; index < x.size(); index += numberOfValuations) {
+                result.push_back(x[index]);
+            }
+            return result;
+        }
+
+#ifdef STORM_HAVE_CARL
+        template class MultiValuationEquationSystem<storm::RationalFunction, double>;
+        template class MultiValuationEquationSystem<storm::RationalFunction, storm::RationalNumber>;
+#endif
+    }
+}
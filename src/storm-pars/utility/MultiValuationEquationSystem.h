@@ -0,0 +1,82 @@
+#pragma once
+
+#include <unordered_map>
+#include <vector>
+
+#include "storm-pars/utility/parametric.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+
+    class Environment;
+
+    namespace utility {
+
+        /*!
+         * Represents a parametric equation system of the form x = A*x + b that is instantiated for several valuations at once.
+         * The instantiated systems share the sparsity pattern of A. We therefore store the values of all K instantiations
+         * interleaved, i.e., the K values of a matrix entry (respectively a vector entry) are stored consecutively.
+         * The same holds for the K solution vectors. This way, every read of a column index is amortized over K systems.
+         */
+        template<typename ParametricType, typename ConstantType>
+        class MultiValuationEquationSystem {
+        public:
+            /*!
+             * Creates the equation system x = A*x + b.
+             * @param matrix The parametric matrix A. Needs to be square and must not have row groups.
+             * @param vector The parametric vector b.
+             */
+            MultiValuationEquationSystem(storm::storage::SparseMatrix<ParametricType> const& matrix, std::vector<ParametricType> const& vector);
+
+            /*!
+             * Instantiates the equation system with the given valuations. Every occurring function is evaluated only once per valuation.
+             */
+            void instantiate(std::vector<storm::utility::parametric::Valuation<ParametricType>> const& valuations);
+
+            /*!
+             * Retrieves the number of valuations with which the system was instantiated last.
+             */
+            uint64_t getNumberOfValuations() const;
+
+            /*!
+             * Retrieves the number of rows (i.e., the number of unknowns) of a single instantiated system.
+             */
+            uint64_t getNumberOfRows() const;
+
+            /*!
+             * Solves all instantiated systems simultaneously using Gauss-Seidel iterations.
+             * The convergence criterion (precision, relative or absolute, maximal number of iterations) is taken from the native solver environment.
+             * Convergence is tracked separately for each valuation.
+             *
+             * @param x The interleaved solution vector, i.e., the value of row r for valuation k is stored at x[r * K + k].
+             * Its initial content is used as the starting point and it needs to have size getNumberOfRows() * getNumberOfValuations().
+             * @return True iff all systems converged within the maximal number of iterations.
+             */
+            bool solveEquations(Environment const& env, std::vector<ConstantType>& x) const;
+
+            /*!
+             * Extracts the (non-interleaved) solution of the given valuation from the interleaved solution vector.
+             */
+            std::vector<ConstantType> getSolution(std::vector<ConstantType> const& x, uint64_t valuationIndex) const;
+
+        private:
+            uint64_t getFunctionIndex(ParametricType const& function, std::unordered_map<ParametricType, uint64_t>& functionToIndexMap);
+
+            // The row indications and the column indices of A. These are shared by all instantiations.
+            std::vector<uint64_t> rowIndications;
+            std::vector<uint64_t> columns;
+
+            // The distinct functions occurring in A and b.
+            std::vector<ParametricType> functions;
+            // For each entry of A (respectively b), the index of the corresponding function.
+            std::vector<uint64_t> matrixFunctionIndices;
+            std::vector<uint64_t> vectorFunctionIndices;
+
+            // The interleaved values of A and b.
+            std::vector<ConstantType> matrixValues;
+            std::vector<ConstantType> vectorValues;
+
+            uint64_t numberOfValuations;
+        };
+    }
+}
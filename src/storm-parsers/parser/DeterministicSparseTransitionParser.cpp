@@ -1,5 +1,6 @@
 #include "storm-parsers/parser/DeterministicSparseTransitionParser.h"
 
+#include <algorithm>
 #include <clocale>
 #include <cstdint>
 #include <cstdio>
@@ -7,6 +8,7 @@
 #include <iostream>
 #include <string>
 
+#include "storm-parsers/parser/FileChunks.h"
 #include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/util/cstring.h"
 #include "storm/exceptions/FileIoException.h"
@@ -47,20 +49,6 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
     MappedFile file(filename.c_str());
     char const* buf = file.getData();
 
-    // Perform first pass, i.e. count entries that are not zero.
-    DeterministicSparseTransitionParser<ValueType>::FirstPassResult firstPass =
-        DeterministicSparseTransitionParser<ValueType>::firstPass(file.getData(), !isRewardFile);
-
-    STORM_LOG_TRACE("First pass on " << filename << " shows " << firstPass.numberOfNonzeroEntries << " non-zeros.");
-
-    // If first pass returned zero, the file format was wrong.
-    if (firstPass.numberOfNonzeroEntries == 0) {
-        STORM_LOG_ERROR("Error while parsing " << filename << ": empty or erroneous file format.");
-        throw storm::exceptions::WrongFormatException();
-    }
-
-    // Perform second pass.
-
     // Skip the format hint if it is there.
     buf = trimWhitespaces(buf);
     if (buf[0] < '0' || buf[0] > '9') {
@@ -68,95 +56,116 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
         buf = trimWhitespaces(buf);
     }
 
+    // Perform first pass, i.e. count the transitions of every chunk.
+    FileChunks chunks(std::min(buf, file.getDataEnd()), file.getDataEnd());
+    std::vector<ChunkInformation> chunkInformation(chunks.size());
+    chunks.forEach([&](uint64_t chunk) { chunkInformation[chunk] = firstPass(chunks.getBegin(chunk), chunks.getEnd(chunk)); });
+
+    // Combine the results of the chunks. This determines the position of the entries of each chunk in the matrix.
+    DeterministicSparseTransitionParser<ValueType>::FirstPassResult firstPassResult;
+    bool hasRow = false, hasUnorderedRows = false;
+    uint_fast64_t lastRow = 0, lastColumn = 0, numberOfDeadlockStates = 0, firstDeadlockState = 0;
+    for (auto& chunk : chunkInformation) {
+        if (chunk.numberOfTransitions == 0) {
+            continue;
+        }
+
+        // Check the transitions at the border to the previous chunk and count the states in between that do not have transitions.
+        uint_fast64_t skippedRowsBeforeChunk = chunk.firstRow;
+        if (hasRow) {
+            STORM_LOG_THROW(chunk.firstRow >= lastRow, storm::exceptions::InvalidArgumentException,
+                            "A transition of state " << chunk.firstRow << " is given after a transition of state " << lastRow << ".");
+            STORM_LOG_THROW(chunk.firstRow != lastRow || chunk.firstColumn != lastColumn, storm::exceptions::InvalidArgumentException,
+                            "The same transition (" << lastRow << ", " << lastColumn << ") is given twice.");
+            hasUnorderedRows |= chunk.firstRow == lastRow && chunk.firstColumn < lastColumn;
+            skippedRowsBeforeChunk = chunk.firstRow > lastRow ? chunk.firstRow - lastRow - 1 : 0;
+        }
+        if (numberOfDeadlockStates == 0) {
+            firstDeadlockState = skippedRowsBeforeChunk > 0 ? chunk.firstRow - skippedRowsBeforeChunk : chunk.firstSkippedRow;
+        }
+        numberOfDeadlockStates += skippedRowsBeforeChunk + chunk.numberOfSkippedRows;
+
+        chunk.entryOffset = firstPassResult.numberOfNonzeroEntries;
+        chunk.hasPreviousRow = hasRow;
+        chunk.previousRow = lastRow;
+        firstPassResult.numberOfNonzeroEntries += chunk.numberOfTransitions;
+        if (!isRewardFile) {
+            // Reserve space for the self-loops of states without transitions.
+            firstPassResult.numberOfNonzeroEntries += skippedRowsBeforeChunk + chunk.numberOfSkippedRows;
+        }
+        firstPassResult.highestStateIndex = std::max(firstPassResult.highestStateIndex, chunk.highestStateIndex);
+        hasUnorderedRows |= chunk.hasUnorderedRow;
+
+        hasRow = true;
+        lastRow = chunk.lastRow;
+        lastColumn = chunk.lastColumn;
+    }
+
+    STORM_LOG_TRACE("First pass on " << filename << " shows " << firstPassResult.numberOfNonzeroEntries << " non-zeros.");
+
+    // If there was no transition, the file format was wrong.
+    if (!hasRow) {
+        STORM_LOG_ERROR("Error while parsing " << filename << ": empty or erroneous file format.");
+        throw storm::exceptions::WrongFormatException();
+    }
+
     if (isRewardFile) {
         // The reward matrix should match the size of the transition matrix.
-        if (firstPass.highestStateIndex + 1 > transitionMatrix.getRowCount() || firstPass.highestStateIndex + 1 > transitionMatrix.getColumnCount()) {
+        if (firstPassResult.highestStateIndex + 1 > transitionMatrix.getRowCount() || firstPassResult.highestStateIndex + 1 > transitionMatrix.getColumnCount()) {
             STORM_LOG_ERROR("Reward matrix has more rows or columns than transition matrix.");
             throw storm::exceptions::WrongFormatException() << "Reward matrix has more rows or columns than transition matrix.";
         } else {
             // If we found the right number of states or less, we set it to the number of states represented by the transition matrix.
-            firstPass.highestStateIndex = transitionMatrix.getRowCount() - 1;
+            firstPassResult.highestStateIndex = transitionMatrix.getRowCount() - 1;
         }
     }
 
-    // Creating matrix builder here.
-    // The actual matrix will be build once all contents are inserted.
-    storm::storage::SparseMatrixBuilder<ValueType> resultMatrix(firstPass.highestStateIndex + 1, firstPass.highestStateIndex + 1,
-                                                                firstPass.numberOfNonzeroEntries);
-
-    uint_fast64_t row, col, lastRow = 0;
-    double val;
-    bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
-    bool hadDeadlocks = false;
-
-    // Read all transitions from file. Note that we assume that the
-    // transitions are listed in canonical order, otherwise this will not
-    // work, i.e. the values in the matrix will be at wrong places.
-
-    // Different parsing routines for transition systems and transition rewards.
-    if (isRewardFile) {
-        while (buf[0] != '\0') {
-            // Read next transition.
-            row = checked_strtol(buf, &buf);
-            col = checked_strtol(buf, &buf);
-            val = checked_strtod(buf, &buf);
-
-            resultMatrix.addNextValue(row, col, val);
-            buf = trimWhitespaces(buf);
+    // The entries of the states after the last one with transitions are appended to the entries of the last chunk.
+    uint_fast64_t const rowCount = firstPassResult.highestStateIndex + 1;
+    uint_fast64_t const numberOfEntriesOfChunks = firstPassResult.numberOfNonzeroEntries;
+    if (!isRewardFile) {
+        if (numberOfDeadlockStates == 0) {
+            firstDeadlockState = lastRow + 1;
         }
-    } else {
-        // Read first row and add self-loops if necessary.
-        char const* tmp;
-        row = checked_strtol(buf, &tmp);
-
-        if (row > 0) {
-            for (uint_fast64_t skippedRow = 0; skippedRow < row; ++skippedRow) {
-                hadDeadlocks = true;
-                if (!dontFixDeadlocks) {
-                    resultMatrix.addNextValue(skippedRow, skippedRow, storm::utility::one<ValueType>());
-                    STORM_LOG_WARN("Warning while parsing " << filename << ": state " << skippedRow
-                                                            << " has no outgoing transitions. A self-loop was inserted.");
-                } else {
-                    STORM_LOG_ERROR("Error while parsing " << filename << ": state " << skippedRow << " has no outgoing transitions.");
-                    // Before throwing the appropriate exception we will give notice of all deadlock states.
-                }
+        numberOfDeadlockStates += rowCount - lastRow - 1;
+        firstPassResult.numberOfNonzeroEntries += rowCount - lastRow - 1;
+
+        if (numberOfDeadlockStates > 0) {
+            bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+            if (dontFixDeadlocks) {
+                STORM_LOG_ERROR("Error while parsing " << filename << ": " << numberOfDeadlockStates << " states (e.g. state " << firstDeadlockState
+                                                       << ") have no outgoing transitions.");
+                throw storm::exceptions::WrongFormatException() << "Some of the states do not have outgoing transitions.";
             }
+            STORM_LOG_WARN("Warning while parsing " << filename << ": " << numberOfDeadlockStates << " states (e.g. state " << firstDeadlockState
+                                                    << ") have no outgoing transitions. Self-loops were inserted.");
         }
+    }
 
-        while (buf[0] != '\0') {
-            // Read next transition.
-            row = checked_strtol(buf, &buf);
-            col = checked_strtol(buf, &buf);
-            val = checked_strtod(buf, &buf);
-
-            // Test if we moved to a new row.
-            // Handle all incomplete or skipped rows.
-            if (lastRow != row) {
-                for (uint_fast64_t skippedRow = lastRow + 1; skippedRow < row; ++skippedRow) {
-                    hadDeadlocks = true;
-                    if (!dontFixDeadlocks) {
-                        resultMatrix.addNextValue(skippedRow, skippedRow, storm::utility::one<ValueType>());
-                        STORM_LOG_INFO("Warning while parsing " << filename << ": state " << skippedRow
-                                                                << " has no outgoing transitions. A self-loop was inserted.");
-                    } else {
-                        STORM_LOG_ERROR("Error while parsing " << filename << ": state " << skippedRow << " has no outgoing transitions.");
-                        // Before throwing the appropriate exception we will give notice of all deadlock states.
-                    }
-                }
-                lastRow = row;
-            }
+    // Perform second pass, i.e. write the transitions of every chunk to their position in the matrix.
+    std::vector<storm::storage::SparseMatrixIndexType> rowIndications(rowCount + 1);
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> columnsAndValues(firstPassResult.numberOfNonzeroEntries);
+    chunks.forEach([&](uint64_t chunk) {
+        if (chunkInformation[chunk].numberOfTransitions > 0) {
+            secondPass(chunks.getBegin(chunk), chunks.getEnd(chunk), chunkInformation[chunk], !isRewardFile, rowIndications, columnsAndValues);
+        }
+    });
 
-            resultMatrix.addNextValue(row, col, val);
-            buf = trimWhitespaces(buf);
+    uint_fast64_t position = numberOfEntriesOfChunks;
+    for (uint_fast64_t row = lastRow + 1; row < rowCount; ++row) {
+        rowIndications[row] = position;
+        if (!isRewardFile) {
+            columnsAndValues[position++] = storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(row, storm::utility::one<ValueType>());
         }
+    }
+    rowIndications[rowCount] = position;
 
-        // If we encountered deadlock and did not fix them, now is the time to throw the exception.
-        if (dontFixDeadlocks && hadDeadlocks)
-            throw storm::exceptions::WrongFormatException() << "Some of the states do not have outgoing transitions.";
+    if (hasUnorderedRows) {
+        sortRowsOfParsedMatrix(rowIndications, columnsAndValues, chunks.isParallel());
     }
 
     // Finally, build the actual matrix, test and return it.
-    storm::storage::SparseMatrix<ValueType> result = resultMatrix.build();
+    storm::storage::SparseMatrix<ValueType> result(rowCount, std::move(rowIndications), std::move(columnsAndValues), boost::none);
 
     // Since we cannot check if each transition for which there is a reward in the reward file also exists in the transition matrix during parsing, we have to
     // do it afterwards.
@@ -169,70 +178,98 @@ storm::storage::SparseMatrix<ValueType> DeterministicSparseTransitionParser<Valu
 }
 
 template<typename ValueType>
-typename DeterministicSparseTransitionParser<ValueType>::FirstPassResult DeterministicSparseTransitionParser<ValueType>::firstPass(
-    char const* buf, bool reserveDiagonalElements) {
-    DeterministicSparseTransitionParser<ValueType>::FirstPassResult result;
-
-    // Skip the format hint if it is there.
-    buf = trimWhitespaces(buf);
-    if (buf[0] < '0' || buf[0] > '9') {
-        buf = forwardToLineEnd(buf);
-        buf = trimWhitespaces(buf);
-    }
+typename DeterministicSparseTransitionParser<ValueType>::ChunkInformation DeterministicSparseTransitionParser<ValueType>::firstPass(char const* begin,
+                                                                                                                                    char const* end) {
+    DeterministicSparseTransitionParser<ValueType>::ChunkInformation result;
+
+    // Check all transitions for their order, duplicates and deadlock states.
+    uint_fast64_t row, col;
+    char const* buf = trimWhitespaces(begin);
+    while (buf < end) {
+        // Read the transition.
+        row = checked_strtol(buf, &buf, end);
+        col = checked_strtol(buf, &buf, end);
+        // The actual read value is not needed here.
+        checked_strtod(buf, &buf, end);
 
-    // Check all transitions for non-zero diagonal entries and deadlock states.
-    uint_fast64_t row, col, lastRow = 0, lastCol = -1;
+        if (result.numberOfTransitions == 0) {
+            result.firstRow = row;
+            result.firstColumn = col;
+        } else {
+            if (row < result.lastRow) {
+                STORM_LOG_ERROR("A transition of state " << row << " is given after a transition of state " << result.lastRow << ".");
+                throw storm::exceptions::InvalidArgumentException()
+                    << "A transition of state " << row << " is given after a transition of state " << result.lastRow << ".";
+            }
 
-    // Read first row and reserve space for self-loops if necessary.
-    char const* tmp;
-    row = checked_strtol(buf, &tmp);
-    if (row > 0 && reserveDiagonalElements) {
-        for (uint_fast64_t skippedRow = 0; skippedRow < row; ++skippedRow) {
-            ++result.numberOfNonzeroEntries;
-        }
-    }
+            // Have we already seen this transition?
+            if (row == result.lastRow && col == result.lastColumn) {
+                STORM_LOG_ERROR("The same transition (" << row << ", " << col << ") is given twice.");
+                throw storm::exceptions::InvalidArgumentException() << "The same transition (" << row << ", " << col << ") is given twice.";
+            }
 
-    while (buf[0] != '\0') {
-        // Read the transition.
-        row = checked_strtol(buf, &buf);
-        col = checked_strtol(buf, &buf);
-        // The actual read value is not needed here.
-        checked_strtod(buf, &buf);
+            if (row == result.lastRow && col < result.lastColumn) {
+                result.hasUnorderedRow = true;
+            }
 
-        if (lastRow != row && reserveDiagonalElements) {
             // Compensate for missing rows.
-            for (uint_fast64_t skippedRow = lastRow + 1; skippedRow < row; ++skippedRow) {
-                ++result.numberOfNonzeroEntries;
+            if (row > result.lastRow + 1) {
+                if (result.numberOfSkippedRows == 0) {
+                    result.firstSkippedRow = result.lastRow + 1;
+                }
+                result.numberOfSkippedRows += row - result.lastRow - 1;
             }
         }
 
         // Check if a higher state id was found.
-        if (row > result.highestStateIndex)
-            result.highestStateIndex = row;
-        if (col > result.highestStateIndex)
-            result.highestStateIndex = col;
-
-        ++result.numberOfNonzeroEntries;
-
-        // Have we already seen this transition?
-        if (row == lastRow && col == lastCol) {
-            STORM_LOG_ERROR("The same transition (" << row << ", " << col << ") is given twice.");
-            throw storm::exceptions::InvalidArgumentException() << "The same transition (" << row << ", " << col << ") is given twice.";
-        }
+        result.highestStateIndex = std::max(result.highestStateIndex, std::max(row, col));
 
-        lastRow = row;
-        lastCol = col;
+        ++result.numberOfTransitions;
+        result.lastRow = row;
+        result.lastColumn = col;
 
         buf = trimWhitespaces(buf);
     }
 
-    if (reserveDiagonalElements) {
-        for (uint_fast64_t skippedRow = (uint_fast64_t)(lastRow + 1); skippedRow <= result.highestStateIndex; ++skippedRow) {
-            ++result.numberOfNonzeroEntries;
+    return result;
+}
+
+template<typename ValueType>
+void DeterministicSparseTransitionParser<ValueType>::secondPass(
+    char const* begin, char const* end, ChunkInformation const& chunk, bool insertSelfLoops, std::vector<storm::storage::SparseMatrixIndexType>& rowIndications,
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& columnsAndValues) {
+    uint_fast64_t row, col, position = chunk.entryOffset;
+    uint_fast64_t lastRow = chunk.previousRow;
+    bool hasRow = chunk.hasPreviousRow;
+    double val;
+
+    // Read all transitions from the chunk. Note that the first pass made sure that the transitions are listed in the order of their source
+    // state, so the entries of every row are contiguous.
+    char const* buf = trimWhitespaces(begin);
+    while (buf < end) {
+        // Read next transition.
+        row = checked_strtol(buf, &buf, end);
+        col = checked_strtol(buf, &buf, end);
+        val = checked_strtod(buf, &buf, end);
+
+        // Test if we moved to a new row.
+        // Handle all skipped rows.
+        if (!hasRow || row != lastRow) {
+            for (uint_fast64_t skippedRow = hasRow ? lastRow + 1 : 0; skippedRow < row; ++skippedRow) {
+                rowIndications[skippedRow] = position;
+                if (insertSelfLoops) {
+                    columnsAndValues[position++] =
+                        storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(skippedRow, storm::utility::one<ValueType>());
+                }
+            }
+            rowIndications[row] = position;
+            hasRow = true;
+            lastRow = row;
         }
-    }
 
-    return result;
+        columnsAndValues[position++] = storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(col, val);
+        buf = trimWhitespaces(buf);
+    }
 }
 
 template class DeterministicSparseTransitionParser<double>;
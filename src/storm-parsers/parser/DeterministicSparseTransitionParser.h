@@ -9,9 +9,9 @@ namespace parser {
 /*!
  *	This class can be used to parse a file containing either transitions or transition rewards of a deterministic model.
  *
- *	The file is parsed in two passes.
- *	The first pass tests the file format and collects statistical data needed for the second pass.
- *	The second pass then parses the file data and constructs a SparseMatrix representing it.
+ *	The file is split into chunks of complete lines that are parsed in two passes, where each pass processes the chunks in parallel (if enabled).
+ *	The first pass tests the file format and counts the transitions of each chunk. From these counts, the position of each chunk in the matrix
+ *	is derived. The second pass then parses the file data and writes it directly to the SparseMatrix representing it.
  */
 template<typename ValueType = double>
 class DeterministicSparseTransitionParser {
@@ -61,19 +61,66 @@ class DeterministicSparseTransitionParser {
 
    private:
     /*
-     * Performs the first pass on the input pointed to by the given buffer to obtain the number of
-     * transitions and the maximum node id.
+     * A structure representing the result of the first pass on a chunk of the input together with the information about the preceding chunks that
+     * is needed for the second pass.
+     */
+    struct ChunkInformation {
+        //! The number of transitions given in the chunk.
+        uint_fast64_t numberOfTransitions = 0;
+
+        //! The source states of the first and the last transition of the chunk.
+        uint_fast64_t firstRow = 0;
+        uint_fast64_t lastRow = 0;
+
+        //! The target states of the first and the last transition of the chunk.
+        uint_fast64_t firstColumn = 0;
+        uint_fast64_t lastColumn = 0;
+
+        //! The number of states between the first and the last row of the chunk that do not have a transition as well as the first of them.
+        uint_fast64_t numberOfSkippedRows = 0;
+        uint_fast64_t firstSkippedRow = 0;
+
+        //! The highest state index that appears in the chunk.
+        uint_fast64_t highestStateIndex = 0;
+
+        //! A flag indicating whether the transitions of some state are not ordered by their target state.
+        bool hasUnorderedRow = false;
+
+        //! The position in the matrix at which the entries of this chunk begin.
+        uint_fast64_t entryOffset = 0;
+
+        //! A flag indicating whether some preceding chunk contains a transition and, if so, the source state of the last such transition.
+        bool hasPreviousRow = false;
+        uint_fast64_t previousRow = 0;
+    };
+
+    /*
+     * Performs the first pass on the given chunk of the input to obtain the number of transitions and the maximum node id.
      *
-     * @param buffer The buffer that contains the input.
-     * @param reserveDiagonalElements A flag indicating whether the diagonal elements should be counted as if they
-     * were present to enable fixes later.
+     * @param begin The first character of the chunk.
+     * @param end The first position after the chunk.
      * @return A structure representing the result of the first pass.
      */
-    static FirstPassResult firstPass(char const* buffer, bool reserveDiagonalElements);
+    static ChunkInformation firstPass(char const* begin, char const* end);
+
+    /*
+     * Performs the second pass on the given chunk of the input, i.e., writes its transitions to the given matrix contents.
+     *
+     * @param begin The first character of the chunk.
+     * @param end The first position after the chunk.
+     * @param chunk The information obtained for the chunk in the first pass.
+     * @param insertSelfLoops A flag indicating whether self-loops are to be inserted for states without transitions.
+     * @param rowIndications The row indications of the matrix.
+     * @param columnsAndValues The entries of the matrix.
+     */
+    static void secondPass(char const* begin, char const* end, ChunkInformation const& chunk, bool insertSelfLoops,
+                           std::vector<storm::storage::SparseMatrixIndexType>& rowIndications,
+                           std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& columnsAndValues);
 
     /*
      * The main parsing routine.
-     * Opens the given file, calls the first pass and performs the second pass, parsing the content of the file into a SparseMatrix.
+     * Opens the given file, performs the first pass on all chunks, combines their results and performs the second pass on all chunks, parsing
+     * the content of the file into a SparseMatrix.
      *
      * @param filename The path and name of the file to be parsed.
      * @param rewardFile A flag set iff the file to be parsed contains transition rewards.
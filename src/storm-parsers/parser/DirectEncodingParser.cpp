@@ -2,9 +2,15 @@
 
 #include <boost/algorithm/string.hpp>
 #include <boost/algorithm/string/predicate.hpp>
+#include <algorithm>
+#include <cstring>
 #include <iostream>
 #include <regex>
 #include <string>
+#include <type_traits>
+
+#include "storm-parsers/parser/FileChunks.h"
+#include "storm-parsers/parser/MappedFile.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 
@@ -48,6 +54,8 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
     size_t nrChoices = 0;
     storm::models::ModelType type;
     std::vector<std::string> rewardModelNames;
+    bool sawModel = false;
+    std::streamoff modelOffset = 0;
     std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> modelComponents;
 
     // Parse header
@@ -117,15 +125,22 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
             STORM_LOG_THROW(!options.buildChoiceLabeling || nrChoices != 0, storm::exceptions::WrongFormatException,
                             "No. of actions (@nr_choices) has to be declared before model.");
             STORM_LOG_WARN_COND(nrChoices != 0, "No. of actions has to be declared. We may continue now, but future versions might not support this.");
-            // Construct model components
-            modelComponents = parseStates(file, type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
+            // The rest of the model is parsed from the mapped file.
+            sawModel = true;
+            modelOffset = file.tellg();
             break;
         } else {
             STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Could not parse line '" << line << "'.");
         }
     }
-    // Done parsing
+    // Done parsing the header
     storm::utility::closeFile(file);
+    STORM_LOG_THROW(sawModel, storm::exceptions::WrongFormatException, "Model (@model) missing.");
+
+    // Construct model components
+    MappedFile mappedFile(filename.c_str());
+    char const* modelBegin = modelOffset < 0 ? mappedFile.getDataEnd() : std::min(mappedFile.getData() + modelOffset, mappedFile.getDataEnd());
+    modelComponents = parseStates(modelBegin, mappedFile.getDataEnd(), type, nrStates, nrChoices, placeholders, valueParser, rewardModelNames, options);
 
     // Build model
     return storm::utility::builder::buildModelFromComponents(type, std::move(*modelComponents));
@@ -133,22 +148,20 @@ std::shared_ptr<storm::models::sparse::Model<ValueType, RewardModelType>> Direct
 
 template<typename ValueType, typename RewardModelType>
 std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> DirectEncodingParser<ValueType, RewardModelType>::parseStates(
-    std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-    ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options) {
+    char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+    std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames,
+    DirectEncodingParserOptions const& options) {
     // Initialize
     auto modelComponents = std::make_shared<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>>();
     bool nonDeterministic =
         (type == storm::models::ModelType::Mdp || type == storm::models::ModelType::MarkovAutomaton || type == storm::models::ModelType::Pomdp);
     bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
-    storm::storage::SparseMatrixBuilder<ValueType> builder = storm::storage::SparseMatrixBuilder<ValueType>(0, 0, 0, false, nonDeterministic, 0);
     modelComponents->stateLabeling = storm::models::sparse::StateLabeling(stateSize);
     modelComponents->observabilityClasses = std::vector<uint32_t>();
     modelComponents->observabilityClasses->resize(stateSize);
     if (options.buildChoiceLabeling) {
         modelComponents->choiceLabeling = storm::models::sparse::ChoiceLabeling(nrChoices);
     }
-    std::vector<std::vector<ValueType>> stateRewards;
-    std::vector<std::vector<ValueType>> actionRewards;
     if (continuousTime) {
         modelComponents->exitRates = std::vector<ValueType>(stateSize);
         if (type == storm::models::ModelType::MarkovAutomaton) {
@@ -160,14 +173,250 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         modelComponents->rateTransitions = true;
     }
 
+    // Split the model section into chunks that each begin with the declaration of a state.
+    FileChunks chunks(begin, end, [end](char const* line) { return end - line >= 6 && std::strncmp(line, "state ", 6) == 0; });
+    if (std::is_same<ValueType, storm::RationalFunction>::value) {
+        // The parser for rational functions must not be used concurrently.
+        chunks.setSequential();
+    }
+    // Count the lines of every chunk such that error messages can refer to the correct line numbers.
+    std::vector<uint64_t> numberOfLines(chunks.size());
+    chunks.forEach([&](uint64_t chunk) { numberOfLines[chunk] = std::count(chunks.getBegin(chunk), chunks.getEnd(chunk), '\n'); });
+    std::vector<ChunkResult> chunkResults(chunks.size());
+    for (uint64_t chunk = 1; chunk < chunks.size(); ++chunk) {
+        chunkResults[chunk].lineOffset = chunkResults[chunk - 1].lineOffset + numberOfLines[chunk - 1];
+    }
+
+    // Parse all chunks.
+    chunks.forEach([&](uint64_t chunk) {
+        parseChunk(chunks.getBegin(chunk), chunks.getEnd(chunk), type, stateSize, placeholders, valueParser, options, chunkResults[chunk]);
+    });
+    if (std::any_of(chunkResults.begin(), chunkResults.end(), [](ChunkResult const& chunkResult) { return chunkResult.aborted; })) {
+        uint64_t numberOfParsedStates = 0;
+        for (auto const& chunkResult : chunkResults) {
+            numberOfParsedStates += chunkResult.rowGroupStarts.size();
+        }
+        std::cout << "Parsed " << numberOfParsedStates << "/" << stateSize << " states before abort.\n";
+        STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
+    }
+
+    // Check that the states of the chunks are consecutive and determine the positions of the rows and transitions of every chunk.
+    std::vector<uint64_t> rowOffsets(chunks.size()), entryOffsets(chunks.size());
+    uint64_t rowCount = 0, entryCount = 0, nextState = 0;
+    for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+        auto const& chunkResult = chunkResults[chunk];
+        if (!chunkResult.hasState) {
+            continue;
+        }
+        STORM_LOG_THROW(nextState == chunkResult.firstState, storm::exceptions::WrongFormatException,
+                        "In line " << chunkResult.firstStateLineNumber << " state ids are not ordered and without gaps. Expected " << nextState << " but got "
+                                   << chunkResult.firstState << ".");
+        rowOffsets[chunk] = rowCount;
+        entryOffsets[chunk] = entryCount;
+        rowCount += chunkResult.rowIndications.size();
+        entryCount += chunkResult.entries.size();
+        nextState = chunkResult.lastState + 1;
+    }
+    STORM_LOG_TRACE("Finished parsing");
+
+    if (nonDeterministic) {
+        STORM_LOG_THROW(nrChoices == 0 || rowCount == nrChoices, storm::exceptions::WrongFormatException,
+                        "Number of actions detected (" << rowCount << ") does not match number of actions declared (" << nrChoices << ", in @nr_choices).");
+    }
+    STORM_LOG_THROW(!options.buildChoiceLabeling || rowCount <= nrChoices, storm::exceptions::WrongFormatException,
+                    "More actions detected than declared (in @nr_choices).");
+
+    // Build transition matrix. States that are not declared get an empty row group.
+    std::vector<storm::storage::SparseMatrixIndexType> rowIndications(rowCount + 1);
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> columnsAndValues(entryCount);
+    boost::optional<std::vector<storm::storage::SparseMatrixIndexType>> rowGroupIndices;
+    if (nonDeterministic) {
+        rowGroupIndices = std::vector<storm::storage::SparseMatrixIndexType>(stateSize + 1, rowCount);
+    }
+    chunks.forEach([&](uint64_t chunk) {
+        auto& chunkResult = chunkResults[chunk];
+        if (!chunkResult.hasState) {
+            return;
+        }
+        for (uint64_t row = 0; row < chunkResult.rowIndications.size(); ++row) {
+            rowIndications[rowOffsets[chunk] + row] = entryOffsets[chunk] + chunkResult.rowIndications[row];
+        }
+        std::move(chunkResult.entries.begin(), chunkResult.entries.end(), columnsAndValues.begin() + entryOffsets[chunk]);
+        for (uint64_t localState = 0; localState < chunkResult.rowGroupStarts.size(); ++localState) {
+            uint64_t state = chunkResult.firstState + localState;
+            if (nonDeterministic) {
+                rowGroupIndices.get()[state] = rowOffsets[chunk] + chunkResult.rowGroupStarts[localState];
+            }
+            if (continuousTime) {
+                modelComponents->exitRates.get()[state] = std::move(chunkResult.exitRates[localState]);
+            }
+            if (type == storm::models::ModelType::Pomdp) {
+                modelComponents->observabilityClasses.get()[state] = chunkResult.observations[localState];
+            }
+        }
+    });
+    rowIndications[rowCount] = entryCount;
+    modelComponents->transitionMatrix =
+        storm::storage::SparseMatrix<ValueType>(stateSize, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices));
+    STORM_LOG_TRACE("Built matrix");
+
+    if (type == storm::models::ModelType::MarkovAutomaton) {
+        for (uint64_t state = 0; state < stateSize; ++state) {
+            if (!storm::utility::isZero<ValueType>(modelComponents->exitRates.get()[state])) {
+                modelComponents->markovianStates.get().set(state);
+            }
+        }
+    }
+
+    // Build labelings. The labels are added in the order of their first occurrence.
+    std::unordered_map<std::string, uint64_t> stateLabelIndices, choiceLabelIndices;
+    std::vector<std::string> stateLabelNames, choiceLabelNames;
+    std::vector<storm::storage::BitVector> labeledStates, labeledChoices;
+    for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+        auto const& chunkResult = chunkResults[chunk];
+        std::vector<uint64_t> labelIndices;
+        for (auto const& label : chunkResult.stateLabelNames) {
+            auto labelIt = stateLabelIndices.emplace(label, stateLabelNames.size()).first;
+            if (labelIt->second == stateLabelNames.size()) {
+                stateLabelNames.push_back(label);
+                labeledStates.emplace_back(stateSize);
+            }
+            labelIndices.push_back(labelIt->second);
+        }
+        for (auto const& stateAndLabel : chunkResult.stateLabels) {
+            labeledStates[labelIndices[stateAndLabel.second]].set(stateAndLabel.first);
+        }
+        labelIndices.clear();
+        for (auto const& label : chunkResult.choiceLabelNames) {
+            auto labelIt = choiceLabelIndices.emplace(label, choiceLabelNames.size()).first;
+            if (labelIt->second == choiceLabelNames.size()) {
+                choiceLabelNames.push_back(label);
+                labeledChoices.emplace_back(nrChoices);
+            }
+            labelIndices.push_back(labelIt->second);
+        }
+        for (auto const& rowAndLabel : chunkResult.choiceLabels) {
+            labeledChoices[labelIndices[rowAndLabel.second]].set(rowOffsets[chunk] + rowAndLabel.first);
+        }
+    }
+    for (uint64_t labelIndex = 0; labelIndex < stateLabelNames.size(); ++labelIndex) {
+        modelComponents->stateLabeling.addLabel(stateLabelNames[labelIndex], std::move(labeledStates[labelIndex]));
+    }
+    for (uint64_t labelIndex = 0; labelIndex < choiceLabelNames.size(); ++labelIndex) {
+        modelComponents->choiceLabeling.get().addLabel(choiceLabelNames[labelIndex], std::move(labeledChoices[labelIndex]));
+    }
+
+    // Collect rewards
+    std::vector<std::vector<ValueType>> stateRewards;
+    std::vector<std::vector<ValueType>> actionRewards;
+    for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+        auto& chunkResult = chunkResults[chunk];
+        if (stateRewards.size() < chunkResult.numberOfStateRewardModels) {
+            stateRewards.resize(chunkResult.numberOfStateRewardModels);
+        }
+        for (auto& reward : chunkResult.stateRewards) {
+            auto& stateRewardVector = stateRewards[std::get<0>(reward)];
+            if (stateRewardVector.empty()) {
+                stateRewardVector.resize(stateSize, storm::utility::zero<ValueType>());
+            }
+            stateRewardVector[std::get<1>(reward)] = std::move(std::get<2>(reward));
+        }
+        if (actionRewards.size() < chunkResult.numberOfActionRewardModels) {
+            actionRewards.resize(chunkResult.numberOfActionRewardModels);
+        }
+        for (auto& reward : chunkResult.actionRewards) {
+            auto& actionRewardVector = actionRewards[std::get<0>(reward)];
+            if (actionRewardVector.empty()) {
+                actionRewardVector.resize(rowCount, storm::utility::zero<ValueType>());
+            }
+            actionRewardVector[rowOffsets[chunk] + std::get<1>(reward)] = std::move(std::get<2>(reward));
+        }
+    }
+
+    // Build reward models
+    uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
+    for (uint64_t i = 0; i < numRewardModels; ++i) {
+        std::string rewardModelName;
+        if (rewardModelNames.size() <= i) {
+            rewardModelName = "rew" + std::to_string(i);
+        } else {
+            rewardModelName = rewardModelNames[i];
+        }
+        boost::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
+        if (i < stateRewards.size() && !stateRewards[i].empty()) {
+            stateRewardVector = std::move(stateRewards[i]);
+        }
+        if (i < actionRewards.size() && !actionRewards[i].empty()) {
+            actionRewardVector = std::move(actionRewards[i]);
+        }
+        modelComponents->rewardModels.emplace(
+            rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
+    }
+    STORM_LOG_TRACE("Built reward models");
+    return modelComponents;
+}
+
+template<typename ValueType, typename RewardModelType>
+void DirectEncodingParser<ValueType, RewardModelType>::parseChunk(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize,
+                                                                  std::unordered_map<std::string, ValueType> const& placeholders,
+                                                                  ValueParser<ValueType> const& valueParser, DirectEncodingParserOptions const& options,
+                                                                  ChunkResult& result) {
+    bool continuousTime = (type == storm::models::ModelType::Ctmc || type == storm::models::ModelType::MarkovAutomaton);
+    std::unordered_map<std::string, uint64_t> stateLabelIndices, choiceLabelIndices;
+
+    // Labels are separated by whitespace and can optionally be enclosed in quotation marks
+    // Regex for labels with two cases:
+    // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
+    //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
+    //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
+    //   (?=(\s|$|\"))
+    // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
+    //   - First part matches string without whitespace and quotation marks [^\s\"]+?
+    //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
+    std::regex const labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
+
+    // If the transitions of the current row are not given in the order of their target states, the row is sorted once it is complete. As for
+    // the matrix builder, multiple transitions to the same target state are added up.
+    bool rowIsUnordered = false;
+    auto finishRow = [&]() {
+        if (!rowIsUnordered) {
+            return;
+        }
+        auto rowBegin = result.entries.begin() + result.rowIndications.back();
+        std::stable_sort(rowBegin, result.entries.end(),
+                         [](storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType> const& a,
+                            storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType> const& b) { return a.getColumn() < b.getColumn(); });
+        auto insertIt = rowBegin;
+        for (auto it = rowBegin + 1; it != result.entries.end(); ++it) {
+            if (it->getColumn() == insertIt->getColumn()) {
+                insertIt->setValue(insertIt->getValue() + it->getValue());
+            } else {
+                ++insertIt;
+                *insertIt = std::move(*it);
+            }
+        }
+        result.entries.erase(insertIt + 1, result.entries.end());
+        rowIsUnordered = false;
+    };
+
     // Iterate over all lines
     std::string line;
-    size_t row = 0;
-    size_t state = 0;
-    uint64_t lineNumber = 0;
-    bool firstState = true;
+    uint64_t lineNumber = result.lineOffset;
+    uint64_t state = 0;
     bool firstActionForState = true;
-    while (storm::utility::getline(file, line)) {
+    char const* position = begin;
+    while (position < end) {
+        char const* lineEnd = static_cast<char const*>(std::memchr(position, '\n', end - position));
+        if (lineEnd == nullptr) {
+            lineEnd = end;
+        }
+        line.assign(position, lineEnd);
+        position = lineEnd == end ? end : lineEnd + 1;
+        // Remove linebreaks
+        while (!line.empty() && (line.back() == '\r' || line.back() == '\n')) {
+            line.pop_back();
+        }
+
         lineNumber++;
         if (boost::starts_with(line, "//")) {
             continue;
@@ -179,15 +428,8 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
         boost::trim_left(line);
         if (boost::starts_with(line, "state ")) {
             // New state
-            if (firstState) {
-                firstState = false;
-            } else {
-                ++state;
-                ++row;
-            }
+            finishRow();
             firstActionForState = true;
-            STORM_LOG_TRACE("New state " << state);
-            STORM_LOG_THROW(state <= stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
 
             // Parse state id
             line = line.substr(6);  // Remove "state "
@@ -200,14 +442,22 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 line = "";
             }
             size_t parsedId = parseNumber<size_t>(curString);
-            STORM_LOG_THROW(state == parsedId, storm::exceptions::WrongFormatException,
-                            "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state << " but got " << parsedId << ".");
-            if (nonDeterministic) {
-                STORM_LOG_TRACE("new Row Group starts at " << row << ".");
-                builder.newRowGroup(row);
-                STORM_LOG_THROW(nrChoices == 0 || builder.getCurrentRowGroupCount() <= nrChoices, storm::exceptions::WrongFormatException,
-                                "More actions detected than declared (in @nr_choices).");
+            if (result.hasState) {
+                STORM_LOG_THROW(state + 1 == parsedId, storm::exceptions::WrongFormatException,
+                                "In line " << lineNumber << " state ids are not ordered and without gaps. Expected " << state + 1 << " but got " << parsedId
+                                           << ".");
+            } else {
+                // Whether the first state of the chunk has the right id is checked once all chunks are parsed.
+                result.hasState = true;
+                result.firstState = parsedId;
+                result.firstStateLineNumber = lineNumber;
             }
+            state = parsedId;
+            result.lastState = state;
+            STORM_LOG_TRACE("New state " << state);
+            STORM_LOG_THROW(state < stateSize, storm::exceptions::WrongFormatException, "More states detected than declared (in @nr_states).");
+            result.rowGroupStarts.push_back(result.rowIndications.size());
+            result.rowIndications.push_back(result.entries.size());
 
             if (continuousTime) {
                 // Parse exit rate for CTMC or MA
@@ -222,11 +472,8 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                     line = "";
                 }
                 ValueType exitRate = parseValue(curString, placeholders, valueParser);
-                if (type == storm::models::ModelType::MarkovAutomaton && !storm::utility::isZero<ValueType>(exitRate)) {
-                    modelComponents->markovianStates.get().set(state);
-                }
                 STORM_LOG_TRACE("Exit rate " << exitRate);
-                modelComponents->exitRates.get()[state] = exitRate;
+                result.exitRates.push_back(std::move(exitRate));
             }
 
             if (boost::starts_with(line, "[")) {
@@ -237,19 +484,12 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 STORM_LOG_TRACE("State rewards: " << rewardsStr);
                 std::vector<std::string> rewards;
                 boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (stateRewards.size() < rewards.size()) {
-                    stateRewards.resize(rewards.size());
-                }
-                auto stateRewardsIt = stateRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
+                result.numberOfStateRewardModels = std::max<uint64_t>(result.numberOfStateRewardModels, rewards.size());
+                for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewards.size(); ++rewardModelIndex) {
+                    auto rewardValue = parseValue(rewards[rewardModelIndex], placeholders, valueParser);
                     if (!storm::utility::isZero(rewardValue)) {
-                        if (stateRewardsIt->empty()) {
-                            stateRewardsIt->resize(stateSize, storm::utility::zero<ValueType>());
-                        }
-                        (*stateRewardsIt)[state] = std::move(rewardValue);
+                        result.stateRewards.emplace_back(rewardModelIndex, state, std::move(rewardValue));
                     }
-                    ++stateRewardsIt;
                 }
                 line = line.substr(posEndReward + 1);
             }
@@ -259,7 +499,7 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                     size_t posEndObservation = line.find("}");
                     std::string observation = line.substr(1, posEndObservation - 1);
                     STORM_LOG_TRACE("State observation " << observation);
-                    modelComponents->observabilityClasses.get()[state] = std::stoi(observation);
+                    result.observations.push_back(std::stoi(observation));
                     line = line.substr(posEndObservation + 1);
                 } else {
                     STORM_LOG_THROW(false, storm::exceptions::WrongFormatException, "Expected an observation for state " << state << " in line " << lineNumber);
@@ -268,46 +508,32 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
 
             // Parse labels
             if (!line.empty()) {
-                std::vector<std::string> labels;
-                // Labels are separated by whitespace and can optionally be enclosed in quotation marks
-                // Regex for labels with two cases:
-                // * Enclosed in quotation marks: \"([^\"]+?)\"(?=(\s|$|\"))
-                //   - First part matches string enclosed in quotation marks with no quotation mark inbetween (\"([^\"]+?)\")
-                //   - second part is lookahead which ensures that after the matched part either whitespace, end of line or a new quotation mark follows
-                //   (?=(\s|$|\"))
-                // * Separated by whitespace: [^\s\"]+?(?=(\s|$))
-                //   - First part matches string without whitespace and quotation marks [^\s\"]+?
-                //   - Second part is again lookahead matching whitespace or end of line (?=(\s|$))
-                std::regex labelRegex(R"(\"([^\"]+?)\"(?=(\s|$|\"))|([^\s\"]+?(?=(\s|$))))");
-
                 // Iterate over matches
                 auto match_begin = std::sregex_iterator(line.begin(), line.end(), labelRegex);
                 auto match_end = std::sregex_iterator();
                 for (std::sregex_iterator i = match_begin; i != match_end; ++i) {
                     std::smatch match = *i;
                     // Find matched group and add as label
-                    if (match.length(1) > 0) {
-                        labels.push_back(match.str(1));
-                    } else {
-                        labels.push_back(match.str(3));
-                    }
-                }
-
-                for (std::string const& label : labels) {
-                    if (!modelComponents->stateLabeling.containsLabel(label)) {
-                        modelComponents->stateLabeling.addLabel(label);
+                    std::string label = match.length(1) > 0 ? match.str(1) : match.str(3);
+                    auto labelIt = stateLabelIndices.emplace(label, result.stateLabelNames.size()).first;
+                    if (labelIt->second == result.stateLabelNames.size()) {
+                        result.stateLabelNames.push_back(label);
                     }
-                    modelComponents->stateLabeling.addLabelToState(label, state);
+                    result.stateLabels.emplace_back(state, labelIt->second);
                     STORM_LOG_TRACE("New label: '" << label << "'");
                 }
             }
         } else if (boost::starts_with(line, "action ")) {
             // New action
+            STORM_LOG_THROW(result.hasState, storm::exceptions::WrongFormatException,
+                            "In line " << lineNumber << " an action is given before the first state.");
             if (firstActionForState) {
                 firstActionForState = false;
             } else {
-                ++row;
+                finishRow();
+                result.rowIndications.push_back(result.entries.size());
             }
+            uint64_t row = result.rowIndications.size() - 1;
             STORM_LOG_TRACE("New action: " << row);
             line = line.substr(7);
             std::string curString = line;
@@ -322,10 +548,11 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
             // curString contains action name.
             if (options.buildChoiceLabeling) {
                 if (curString != "__NOLABEL__") {
-                    if (!modelComponents->choiceLabeling.get().containsLabel(curString)) {
-                        modelComponents->choiceLabeling.get().addLabel(curString);
+                    auto labelIt = choiceLabelIndices.emplace(curString, result.choiceLabelNames.size()).first;
+                    if (labelIt->second == result.choiceLabelNames.size()) {
+                        result.choiceLabelNames.push_back(curString);
                     }
-                    modelComponents->choiceLabeling.get().addLabelToChoice(curString, row);
+                    result.choiceLabels.emplace_back(row, labelIt->second);
                 }
             }
             // Check for rewards
@@ -337,78 +564,45 @@ std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelTy
                 STORM_LOG_TRACE("Action rewards: " << rewardsStr);
                 std::vector<std::string> rewards;
                 boost::split(rewards, rewardsStr, boost::is_any_of(","));
-                if (actionRewards.size() < rewards.size()) {
-                    actionRewards.resize(rewards.size());
-                }
-                auto actionRewardsIt = actionRewards.begin();
-                for (auto const& rew : rewards) {
-                    auto rewardValue = parseValue(rew, placeholders, valueParser);
+                result.numberOfActionRewardModels = std::max<uint64_t>(result.numberOfActionRewardModels, rewards.size());
+                for (uint64_t rewardModelIndex = 0; rewardModelIndex < rewards.size(); ++rewardModelIndex) {
+                    auto rewardValue = parseValue(rewards[rewardModelIndex], placeholders, valueParser);
                     if (!storm::utility::isZero(rewardValue)) {
-                        if (actionRewardsIt->size() <= row) {
-                            actionRewardsIt->resize(std::max(row + 1, stateSize), storm::utility::zero<ValueType>());
-                        }
-                        (*actionRewardsIt)[row] = std::move(rewardValue);
+                        result.actionRewards.emplace_back(rewardModelIndex, row, std::move(rewardValue));
                     }
-                    ++actionRewardsIt;
                 }
                 line = line.substr(posEndReward + 1);
             }
 
         } else {
             // New transition
+            STORM_LOG_THROW(result.hasState, storm::exceptions::WrongFormatException,
+                            "In line " << lineNumber << " a transition is given before the first state.");
             size_t posColon = line.find(':');
             STORM_LOG_THROW(posColon != std::string::npos, storm::exceptions::WrongFormatException,
                             "':' not found in '" << line << "' on line " << lineNumber << ".");
             size_t target = parseNumber<size_t>(line.substr(0, posColon - 1));
             std::string valueStr = line.substr(posColon + 2);
             ValueType value = parseValue(valueStr, placeholders, valueParser);
-            STORM_LOG_TRACE("Transition " << row << " -> " << target << ": " << value);
+            STORM_LOG_TRACE("Transition " << result.rowIndications.size() - 1 << " -> " << target << ": " << value);
             STORM_LOG_THROW(target < stateSize, storm::exceptions::WrongFormatException,
                             "In line " << lineNumber << " target state " << target << " is greater than state size " << stateSize);
-            builder.addNextValue(row, target, value);
+            bool rowHasEntry = result.rowIndications.back() < result.entries.size();
+            if (rowHasEntry && result.entries.back().getColumn() == target) {
+                result.entries.back().setValue(result.entries.back().getValue() + value);
+            } else {
+                rowIsUnordered |= rowHasEntry && target < result.entries.back().getColumn();
+                result.entries.emplace_back(target, std::move(value));
+            }
         }
 
         if (storm::utility::resources::isTerminate()) {
-            std::cout << "Parsed " << state << "/" << stateSize << " states before abort.\n";
-            STORM_LOG_THROW(false, storm::exceptions::AbortException, "Aborted in state space exploration.");
-            break;
+            result.aborted = true;
+            return;
         }
 
     }  // end state iteration
-    STORM_LOG_TRACE("Finished parsing");
-
-    if (nonDeterministic) {
-        STORM_LOG_THROW(nrChoices == 0 || builder.getLastRow() + 1 == nrChoices, storm::exceptions::WrongFormatException,
-                        "Number of actions detected (at least " << builder.getLastRow() + 1 << ") does not match number of actions declared (" << nrChoices
-                                                                << ", in @nr_choices).");
-    }
-
-    // Build transition matrix
-    modelComponents->transitionMatrix = builder.build(row + 1, stateSize, nonDeterministic ? stateSize : 0);
-    STORM_LOG_TRACE("Built matrix");
-
-    // Build reward models
-    uint64_t numRewardModels = std::max(stateRewards.size(), actionRewards.size());
-    for (uint64_t i = 0; i < numRewardModels; ++i) {
-        std::string rewardModelName;
-        if (rewardModelNames.size() <= i) {
-            rewardModelName = "rew" + std::to_string(i);
-        } else {
-            rewardModelName = rewardModelNames[i];
-        }
-        boost::optional<std::vector<ValueType>> stateRewardVector, actionRewardVector;
-        if (i < stateRewards.size() && !stateRewards[i].empty()) {
-            stateRewardVector = std::move(stateRewards[i]);
-        }
-        if (i < actionRewards.size() && !actionRewards[i].empty()) {
-            actionRewards[i].resize(row + 1, storm::utility::zero<ValueType>());
-            actionRewardVector = std::move(actionRewards[i]);
-        }
-        modelComponents->rewardModels.emplace(
-            rewardModelName, storm::models::sparse::StandardRewardModel<ValueType>(std::move(stateRewardVector), std::move(actionRewardVector)));
-    }
-    STORM_LOG_TRACE("Built reward models");
-    return modelComponents;
+    finishRow();
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -1,6 +1,10 @@
 #ifndef STORM_PARSER_DIRECTENCODINGPARSER_H_
 #define STORM_PARSER_DIRECTENCODINGPARSER_H_
 
+#include <tuple>
+#include <utility>
+#include <vector>
+
 #include "storm-parsers/parser/ValueParser.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
@@ -30,9 +34,52 @@ class DirectEncodingParser {
 
    private:
     /*!
-     * Parse states and return transition matrix.
+     * The contents of a chunk of the model section, i.e., of a sequence of complete states. States are given by their index, choices (rows)
+     * are given relative to the first choice of the chunk.
+     */
+    struct ChunkResult {
+        //! The number of lines of the model section in front of the chunk.
+        uint64_t lineOffset = 0;
+
+        //! A flag indicating whether the chunk declares a state and, if so, the first and the last declared state.
+        bool hasState = false;
+        uint64_t firstState = 0;
+        uint64_t lastState = 0;
+        uint64_t firstStateLineNumber = 0;
+
+        //! The first row of every state of the chunk.
+        std::vector<uint64_t> rowGroupStarts;
+
+        //! The transitions of the chunk as well as the position of the first transition of every row.
+        std::vector<uint64_t> rowIndications;
+        std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> entries;
+
+        //! The exit rates and the observations of the states of the chunk (if the model type requires them).
+        std::vector<ValueType> exitRates;
+        std::vector<uint32_t> observations;
+
+        //! The non-zero state and action rewards of the chunk as (reward model index, state/row, value) and the number of given rewards.
+        std::vector<std::tuple<uint64_t, uint64_t, ValueType>> stateRewards;
+        std::vector<std::tuple<uint64_t, uint64_t, ValueType>> actionRewards;
+        uint64_t numberOfStateRewardModels = 0;
+        uint64_t numberOfActionRewardModels = 0;
+
+        //! The state labels and choice labels of the chunk as (state/row, index in the corresponding label names).
+        std::vector<std::string> stateLabelNames;
+        std::vector<std::pair<uint64_t, uint64_t>> stateLabels;
+        std::vector<std::string> choiceLabelNames;
+        std::vector<std::pair<uint64_t, uint64_t>> choiceLabels;
+
+        //! A flag indicating whether the parsing of the chunk was aborted.
+        bool aborted = false;
+    };
+
+    /*!
+     * Parse states and return transition matrix. The model section is split into chunks of complete states that are parsed in parallel
+     * (if enabled and if the values can be parsed in parallel). The results of the chunks are then merged.
      *
-     * @param file Input file stream.
+     * @param begin Beginning of the model section of the file.
+     * @param end End of the file.
      * @param type Model type.
      * @param stateSize No. of states
      * @param placeholders Placeholders for values.
@@ -42,8 +89,24 @@ class DirectEncodingParser {
      * @return Transition matrix.
      */
     static std::shared_ptr<storm::storage::sparse::ModelComponents<ValueType, RewardModelType>> parseStates(
-        std::istream& file, storm::models::ModelType type, size_t stateSize, size_t nrChoices, std::unordered_map<std::string, ValueType> const& placeholders,
-        ValueParser<ValueType> const& valueParser, std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+        char const* begin, char const* end, storm::models::ModelType type, size_t stateSize, size_t nrChoices,
+        std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+        std::vector<std::string> const& rewardModelNames, DirectEncodingParserOptions const& options);
+
+    /*!
+     * Parse the states of a chunk of the model section.
+     *
+     * @param begin Beginning of the chunk.
+     * @param end End of the chunk.
+     * @param type Model type.
+     * @param stateSize No. of states
+     * @param placeholders Placeholders for values.
+     * @param valueParser Value parser.
+     * @param result The result of the chunk. The line offset has to be set already.
+     */
+    static void parseChunk(char const* begin, char const* end, storm::models::ModelType type, size_t stateSize,
+                           std::unordered_map<std::string, ValueType> const& placeholders, ValueParser<ValueType> const& valueParser,
+                           DirectEncodingParserOptions const& options, ChunkResult& result);
 
     /*!
      * Parse value from string while using placeholders.
@@ -0,0 +1,114 @@
+#include "storm-parsers/parser/FileChunks.h"
+
+#include <cstring>
+
+#include "storm-parsers/util/cstring.h"
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace parser {
+
+const std::size_t FileChunks::defaultMinimalChunkSize = 1 << 20;
+
+FileChunks::FileChunks(char const* begin, char const* end, std::function<bool(char const*)> const& mayBeginChunk, std::size_t minimalChunkSize)
+    : parallel(storm::utility::parallel::isIntelTbbEnabled()) {
+    STORM_LOG_ASSERT(minimalChunkSize > 0, "Illegal chunk size.");
+    boundaries.push_back(begin);
+    char const* position = begin;
+    while (static_cast<std::size_t>(end - position) > minimalChunkSize) {
+        // Move to the beginning of the line after the one that contains the last character of a minimal chunk.
+        char const* newline = static_cast<char const*>(std::memchr(position + minimalChunkSize - 1, '\n', end - (position + minimalChunkSize - 1)));
+        position = newline == nullptr ? end : newline + 1;
+
+        // Skip all lines at which a chunk must not begin.
+        if (mayBeginChunk) {
+            while (position < end) {
+                char const* firstCharacter = storm::utility::cstring::trimWhitespaces(position);
+                if (firstCharacter >= end || mayBeginChunk(firstCharacter)) {
+                    break;
+                }
+                newline = static_cast<char const*>(std::memchr(firstCharacter, '\n', end - firstCharacter));
+                position = newline == nullptr ? end : newline + 1;
+            }
+        }
+
+        if (position < end) {
+            boundaries.push_back(position);
+        }
+    }
+    boundaries.push_back(end);
+}
+
+uint64_t FileChunks::size() const {
+    return boundaries.size() - 1;
+}
+
+char const* FileChunks::getBegin(uint64_t chunk) const {
+    return boundaries[chunk];
+}
+
+char const* FileChunks::getEnd(uint64_t chunk) const {
+    return boundaries[chunk + 1];
+}
+
+bool FileChunks::isParallel() const {
+    return parallel;
+}
+
+void FileChunks::setSequential() {
+    parallel = false;
+}
+
+template<typename ValueType>
+void sortRowsOfParsedMatrix(std::vector<storm::storage::SparseMatrixIndexType> const& rowIndications,
+                            std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& columnsAndValues, bool parallel) {
+    typedef storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType> EntryType;
+    auto sortRow = [&](uint64_t row) {
+        auto rowBegin = columnsAndValues.begin() + rowIndications[row];
+        auto rowEnd = columnsAndValues.begin() + rowIndications[row + 1];
+        auto compareColumns = [](EntryType const& first, EntryType const& second) { return first.getColumn() < second.getColumn(); };
+        if (!std::is_sorted(rowBegin, rowEnd, compareColumns)) {
+            STORM_LOG_TRACE("Sorting row " << row << " as its entries are given out of order.");
+            std::stable_sort(rowBegin, rowEnd, compareColumns);
+        }
+        auto duplicate =
+            std::adjacent_find(rowBegin, rowEnd, [](EntryType const& first, EntryType const& second) { return first.getColumn() == second.getColumn(); });
+        STORM_LOG_THROW(duplicate == rowEnd, storm::exceptions::InvalidArgumentException,
+                        "The entry (" << row << ", " << duplicate->getColumn() << ") is given twice.");
+    };
+
+    uint64_t const rowCount = rowIndications.size() - 1;
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, rowCount), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t row = range.begin(); row != range.end(); ++row) {
+                sortRow(row);
+            }
+        });
+        return;
+    }
+#endif
+    for (uint64_t row = 0; row < rowCount; ++row) {
+        sortRow(row);
+    }
+}
+
+template void sortRowsOfParsedMatrix(std::vector<storm::storage::SparseMatrixIndexType> const& rowIndications,
+                                     std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, double>>& columnsAndValues, bool parallel);
+template void sortRowsOfParsedMatrix(std::vector<storm::storage::SparseMatrixIndexType> const& rowIndications,
+                                     std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, storm::RationalNumber>>& columnsAndValues,
+                                     bool parallel);
+template void sortRowsOfParsedMatrix(std::vector<storm::storage::SparseMatrixIndexType> const& rowIndications,
+                                     std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, storm::RationalFunction>>& columnsAndValues,
+                                     bool parallel);
+#ifdef STORM_HAVE_CARL
+template void sortRowsOfParsedMatrix(std::vector<storm::storage::SparseMatrixIndexType> const& rowIndications,
+                                     std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, storm::Interval>>& columnsAndValues,
+                                     bool parallel);
+#endif
+
+}  // namespace parser
+}  // namespace storm
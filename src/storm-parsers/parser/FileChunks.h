@@ -0,0 +1,107 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace parser {
+
+/*!
+ * Splits (a part of) the contents of a mapped file into chunks of complete lines, such that the chunks can be parsed independently of each other.
+ *
+ * Parsers that use this class typically work in two passes that are both performed for all chunks in parallel. The first pass counts the
+ * elements of each chunk, the offsets of the chunks in the result are then obtained by a prefix sum over these counts and the second pass
+ * writes the elements of each chunk to their final position.
+ */
+class FileChunks {
+   public:
+    //! The minimal number of bytes in a chunk (except for the last one) if no other size is given.
+    static const std::size_t defaultMinimalChunkSize;
+
+    /*!
+     * Splits the given range into chunks.
+     *
+     * @param begin A pointer to the first character of the range. This has to be the beginning of a line.
+     * @param end A pointer to the first position after the range.
+     * @param mayBeginChunk If given, chunks only begin at lines for which this function returns true. The function is called with a pointer to
+     * the first non-whitespace character of the line.
+     * @param minimalChunkSize The minimal number of bytes in a chunk (except for the last one).
+     */
+    FileChunks(char const* begin, char const* end, std::function<bool(char const*)> const& mayBeginChunk = nullptr,
+               std::size_t minimalChunkSize = defaultMinimalChunkSize);
+
+    /*!
+     * Retrieves the number of chunks.
+     */
+    uint64_t size() const;
+
+    /*!
+     * Retrieves a pointer to the first character of the given chunk.
+     */
+    char const* getBegin(uint64_t chunk) const;
+
+    /*!
+     * Retrieves a pointer to the first position after the given chunk, which is the beginning of the next chunk (if any).
+     */
+    char const* getEnd(uint64_t chunk) const;
+
+    /*!
+     * Calls the given function for the index of every chunk. If Intel TBB is available and enabled, the chunks are processed in parallel.
+     * If the function throws an exception for some chunk, the exception is passed on to the caller.
+     */
+    template<typename Function>
+    void forEach(Function const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+        if (parallel && size() > 1) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t chunk = range.begin(); chunk != range.end(); ++chunk) {
+                    function(chunk);
+                }
+            });
+            return;
+        }
+#endif
+        for (uint64_t chunk = 0; chunk < size(); ++chunk) {
+            function(chunk);
+        }
+    }
+
+    /*!
+     * Retrieves whether the chunks are processed in parallel.
+     */
+    bool isParallel() const;
+
+    /*!
+     * Enforces that the chunks are processed sequentially, e.g., because parsing the values of the file is not thread-safe.
+     */
+    void setSequential();
+
+   private:
+    // The boundaries of the chunks, i.e., chunk i ranges from boundaries[i] to boundaries[i + 1].
+    std::vector<char const*> boundaries;
+
+    // A flag indicating whether the chunks are processed in parallel.
+    bool parallel;
+};
+
+/*!
+ * Sorts the entries of the rows of the given matrix contents whose columns are not in ascending order. This is necessary if a file lists the
+ * entries of a row out of order, because the matrix rows are filled in the order of the file.
+ *
+ * @param rowIndications The (complete) row indications of the matrix.
+ * @param columnsAndValues The entries of the matrix.
+ * @param parallel If set, the rows are processed in parallel (if Intel TBB is available).
+ * @throws InvalidArgumentException if a row contains two entries for the same column.
+ */
+template<typename ValueType>
+void sortRowsOfParsedMatrix(std::vector<storm::storage::SparseMatrixIndexType> const& rowIndications,
+                            std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& columnsAndValues, bool parallel);
+
+}  // namespace parser
+}  // namespace storm
@@ -1,5 +1,9 @@
 #include "MarkovAutomatonSparseTransitionParser.h"
 
+#include <algorithm>
+
+#include "storm-parsers/parser/FileChunks.h"
+
 #include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/util/cstring.h"
 #include "storm/exceptions/FileIoException.h"
@@ -15,10 +19,14 @@ namespace parser {
 using namespace storm::utility::cstring;
 
 template<typename ValueType>
-typename MarkovAutomatonSparseTransitionParser<ValueType>::FirstPassResult MarkovAutomatonSparseTransitionParser<ValueType>::firstPass(char const* buf) {
-    MarkovAutomatonSparseTransitionParser::FirstPassResult result;
+typename MarkovAutomatonSparseTransitionParser<ValueType>::Result MarkovAutomatonSparseTransitionParser<ValueType>::parseMarkovAutomatonTransitions(
+    std::string const& filename) {
+    // Set the locale to correctly recognize floating point numbers.
+    setlocale(LC_NUMERIC, "C");
 
-    bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+    // Open file and prepare pointer to buffer.
+    MappedFile file(filename.c_str());
+    char const* buf = file.getData();
 
     // Skip the format hint if it is there.
     buf = trimWhitespaces(buf);
@@ -27,56 +35,185 @@ typename MarkovAutomatonSparseTransitionParser<ValueType>::FirstPassResult Marko
         buf = trimWhitespaces(buf);
     }
 
+    // Perform the first pass, i.e. count the choices and transitions of every chunk. As chunks may only begin at the beginning of a choice, the
+    // successors of a choice are never distributed over several chunks.
+    FileChunks chunks(std::min(buf, file.getDataEnd()), file.getDataEnd(), [](char const* line) { return *line != '*'; });
+    std::vector<ChunkInformation> chunkInformation(chunks.size());
+    chunks.forEach([&](uint64_t chunk) { chunkInformation[chunk] = firstPass(chunks.getBegin(chunk), chunks.getEnd(chunk)); });
+
+    // Combine the results of the chunks. This determines the position of the choices and transitions of each chunk in the matrix.
+    FirstPassResult firstPassResult;
+    bool hasChoice = false, stateHasMarkovianChoice = false, lastChoiceHasSuccessor = false;
+    uint_fast64_t lastSource = 0, numberOfDeadlockStates = 0, firstDeadlockState = 0;
+    for (auto& chunk : chunkInformation) {
+        if (chunk.numberOfChoices == 0) {
+            continue;
+        }
+
+        // Check the choices at the border to the previous chunk and count the states in between that do not have a choice.
+        uint_fast64_t skippedStatesBeforeChunk = chunk.firstSource;
+        if (hasChoice) {
+            if (chunk.firstSource < lastSource) {
+                STORM_LOG_ERROR("Illegal state choice order. A choice of state " << chunk.firstSource << " appears at an illegal position.");
+                throw storm::exceptions::WrongFormatException()
+                    << "Illegal state choice order. A choice of state " << chunk.firstSource << " appears at an illegal position.";
+            }
+            if (chunk.firstSource == lastSource && chunk.firstStateHasMarkovianChoice) {
+                if (stateHasMarkovianChoice) {
+                    STORM_LOG_ERROR("The state " << lastSource << " has multiple Markovian choices.");
+                    throw storm::exceptions::WrongFormatException() << "The state " << lastSource << " has multiple Markovian choices.";
+                }
+                STORM_LOG_ERROR(
+                    "The state " << lastSource
+                                 << " has a probabilistic choice preceding a Markovian choice. The Markovian choice must be the first choice listed.");
+                throw storm::exceptions::WrongFormatException()
+                    << "The state " << lastSource
+                    << " has a probabilistic choice preceding a Markovian choice. The Markovian choice must be the first choice listed.";
+            }
+            skippedStatesBeforeChunk = chunk.firstSource > lastSource ? chunk.firstSource - lastSource - 1 : 0;
+        }
+        if (numberOfDeadlockStates == 0) {
+            firstDeadlockState = skippedStatesBeforeChunk > 0 ? chunk.firstSource - skippedStatesBeforeChunk : chunk.firstSkippedState;
+        }
+        numberOfDeadlockStates += skippedStatesBeforeChunk + chunk.numberOfSkippedStates;
+
+        // Every state without a choice gets a choice with a self-loop.
+        chunk.choiceOffset = firstPassResult.numberOfChoices;
+        chunk.entryOffset = firstPassResult.numberOfNonzeroEntries;
+        chunk.hasPreviousChoice = hasChoice;
+        chunk.previousSource = lastSource;
+        firstPassResult.numberOfChoices += chunk.numberOfChoices + skippedStatesBeforeChunk + chunk.numberOfSkippedStates;
+        firstPassResult.numberOfNonzeroEntries += chunk.numberOfTransitions + skippedStatesBeforeChunk + chunk.numberOfSkippedStates;
+        firstPassResult.highestStateIndex = std::max(firstPassResult.highestStateIndex, chunk.highestStateIndex);
+
+        if (hasChoice && chunk.lastSource == lastSource) {
+            stateHasMarkovianChoice |= chunk.lastStateHasMarkovianChoice;
+        } else {
+            stateHasMarkovianChoice = chunk.lastStateHasMarkovianChoice;
+        }
+        hasChoice = true;
+        lastSource = chunk.lastSource;
+        lastChoiceHasSuccessor = chunk.lastChoiceHasSuccessor;
+    }
+
+    // If there was no choice, the file format was wrong.
+    if (!hasChoice) {
+        STORM_LOG_ERROR("Error while parsing " << filename << ": empty or erroneous file format.");
+        throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": empty or erroneous file format.";
+    }
+    if (!lastChoiceHasSuccessor) {
+        STORM_LOG_ERROR("Premature end-of-file. Expected at least one successor state for state " << lastSource << ".");
+        throw storm::exceptions::WrongFormatException() << "Premature end-of-file. Expected at least one successor state for state " << lastSource << ".";
+    }
+
+    // The states behind the last source for which no choice was specified get a self-loop as well.
+    uint_fast64_t const stateCount = firstPassResult.highestStateIndex + 1;
+    uint_fast64_t const numberOfChoicesOfChunks = firstPassResult.numberOfChoices;
+    uint_fast64_t const numberOfEntriesOfChunks = firstPassResult.numberOfNonzeroEntries;
+    if (numberOfDeadlockStates == 0) {
+        firstDeadlockState = lastSource + 1;
+    }
+    numberOfDeadlockStates += stateCount - lastSource - 1;
+    firstPassResult.numberOfChoices += stateCount - lastSource - 1;
+    firstPassResult.numberOfNonzeroEntries += stateCount - lastSource - 1;
+
+    if (numberOfDeadlockStates > 0) {
+        bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+        if (dontFixDeadlocks) {
+            STORM_LOG_ERROR("Found deadlock states (e.g. " << firstDeadlockState << ") during parsing. Please fix them or set the appropriate flag.");
+            throw storm::exceptions::WrongFormatException()
+                << "Found deadlock states (e.g. " << firstDeadlockState << ") during parsing. Please fix them or set the appropriate flag.";
+        }
+        STORM_LOG_WARN("Warning while parsing " << filename << ": " << numberOfDeadlockStates << " states (e.g. state " << firstDeadlockState
+                                                << ") have no outgoing transitions. Self-loops were inserted.");
+    }
+
+    // Perform the second pass, i.e. write the choices of every chunk to their position in the matrix.
+    Result result(firstPassResult);
+    std::vector<storm::storage::SparseMatrixIndexType> rowIndications(firstPassResult.numberOfChoices + 1);
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> columnsAndValues(firstPassResult.numberOfNonzeroEntries);
+    std::vector<storm::storage::SparseMatrixIndexType> rowGroupIndices(stateCount + 1);
+    std::vector<std::vector<uint_fast64_t>> markovianStatesOfChunks(chunks.size());
+    chunks.forEach([&](uint64_t chunk) {
+        if (chunkInformation[chunk].numberOfChoices > 0) {
+            secondPass(chunks.getBegin(chunk), chunks.getEnd(chunk), chunkInformation[chunk], rowIndications, columnsAndValues, rowGroupIndices,
+                       result.exitRates, markovianStatesOfChunks[chunk]);
+        }
+    });
+    for (auto const& markovianStates : markovianStatesOfChunks) {
+        for (auto state : markovianStates) {
+            result.markovianStates.set(state, true);
+        }
+    }
+
+    // Insert the self-loops of the states behind the last source. Note that we assume all these states to be Markovian.
+    uint_fast64_t choice = numberOfChoicesOfChunks, position = numberOfEntriesOfChunks;
+    for (uint_fast64_t state = lastSource + 1; state < stateCount; ++state) {
+        result.markovianStates.set(state, true);
+        result.exitRates[state] = storm::utility::one<ValueType>();
+        rowGroupIndices[state] = choice;
+        rowIndications[choice++] = position;
+        columnsAndValues[position++] = storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(state, storm::utility::one<ValueType>());
+    }
+    rowGroupIndices[stateCount] = choice;
+    rowIndications[choice] = position;
+
+    // As the Markovian choice of a state has to be its first choice, the Markovian choices are given by the Markovian states.
+    for (auto state : result.markovianStates) {
+        result.markovianChoices.set(rowGroupIndices[state], true);
+    }
+
+    // The matrix is assembled directly. A builder is opened on it so that the matrix can be built as before.
+    result.transitionMatrixBuilder = storm::storage::SparseMatrixBuilder<ValueType>(
+        storm::storage::SparseMatrix<ValueType>(stateCount, std::move(rowIndications), std::move(columnsAndValues), std::move(rowGroupIndices)));
+    return result;
+}
+
+template<typename ValueType>
+typename MarkovAutomatonSparseTransitionParser<ValueType>::ChunkInformation MarkovAutomatonSparseTransitionParser<ValueType>::firstPass(char const* begin,
+                                                                                                                                      char const* end) {
+    ChunkInformation result;
+
     // Now read the transitions.
     uint_fast64_t source, target = 0;
-    uint_fast64_t lastsource = 0;
-    bool encounteredEOF = false;
     bool stateHasMarkovianChoice = false;
     bool stateHasProbabilisticChoice = false;
-    while (buf[0] != '\0' && !encounteredEOF) {
+    char const* buf = trimWhitespaces(begin);
+    while (buf < end) {
         // At the current point, the next thing to read is the source state of the next choice to come.
-        source = checked_strtol(buf, &buf);
+        source = checked_strtol(buf, &buf, end);
 
         // Check if we encountered a state index that is bigger than all previously seen ones and record it if necessary.
-        if (source > result.highestStateIndex) {
-            result.highestStateIndex = source;
-        }
+        result.highestStateIndex = std::max(result.highestStateIndex, source);
 
-        // If we have skipped some states, we need to reserve the space for the self-loop insertion in the second pass.
-        if (source > lastsource + 1) {
-            if (!dontFixDeadlocks) {
-                result.numberOfNonzeroEntries += source - lastsource - 1;
-                result.numberOfChoices += source - lastsource - 1;
-            } else {
-                STORM_LOG_ERROR("Found deadlock states (e.g. " << lastsource + 1 << ") during parsing. Please fix them or set the appropriate flag.");
-                throw storm::exceptions::WrongFormatException()
-                    << "Found deadlock states (e.g. " << lastsource + 1 << ") during parsing. Please fix them or set the appropriate flag.";
-            }
-        } else if (source < lastsource) {
+        if (result.numberOfChoices == 0) {
+            result.firstSource = source;
+        } else if (source < result.lastSource) {
             STORM_LOG_ERROR("Illegal state choice order. A choice of state " << source << " appears at an illegal position.");
             throw storm::exceptions::WrongFormatException() << "Illegal state choice order. A choice of state " << source << " appears at an illegal position.";
+        } else if (source > result.lastSource + 1) {
+            // If we have skipped some states, we need to reserve the space for the self-loop insertion in the second pass.
+            if (result.numberOfSkippedStates == 0) {
+                result.firstSkippedState = result.lastSource + 1;
+            }
+            result.numberOfSkippedStates += source - result.lastSource - 1;
         }
 
-        ++result.numberOfChoices;
-
         // If we have moved to the next state, we need to clear the flag that stores whether or not the source has a Markovian or probabilistic choice.
-        if (source != lastsource) {
+        if (result.numberOfChoices == 0 || source != result.lastSource) {
             stateHasMarkovianChoice = false;
             stateHasProbabilisticChoice = false;
         }
 
+        ++result.numberOfChoices;
+
         // Record that the current source was the last source.
-        lastsource = source;
+        result.lastSource = source;
 
         buf = trimWhitespaces(buf);
 
         // Depending on the action name, the choice is either a probabilitic one or a markovian one.
-        bool isMarkovianChoice = false;
-        if (buf[0] == '!' && skipWord(buf) - buf == 1) {
-            isMarkovianChoice = true;
-        } else {
-            isMarkovianChoice = false;
-        }
+        bool isMarkovianChoice = buf[0] == '!' && skipWord(buf) - buf == 1;
         buf = skipWord(buf);
 
         if (isMarkovianChoice) {
@@ -93,150 +230,101 @@ typename MarkovAutomatonSparseTransitionParser<ValueType>::FirstPassResult Marko
                     << " has a probabilistic choice preceding a Markovian choice. The Markovian choice must be the first choice listed.";
             }
             stateHasMarkovianChoice = true;
+            if (source == result.firstSource) {
+                result.firstStateHasMarkovianChoice = true;
+            }
         } else {
             stateHasProbabilisticChoice = true;
         }
+        result.lastStateHasMarkovianChoice = stateHasMarkovianChoice;
 
         // Go to the next line where the transitions start.
         buf = forwardToNextLine(buf);
 
         // Now that we have the source state and the information whether or not the current choice is probabilistic or Markovian, we need to read the list of
-        // successors and the probabilities/rates.
+        // successors and the probabilities/rates until the end of the chunk or the beginning of the next choice.
         bool hasSuccessorState = false;
-        bool encounteredNewDistribution = false;
         uint_fast64_t lastSuccessorState = 0;
+        buf = trimWhitespaces(buf);
+        while (buf < end && buf[0] == '*') {
+            // As we have encountered a "*", we know that there is an additional successor state for the current choice.
+            buf = skipWord(buf);
+
+            // Now we need to read the successor state and check if we already saw a higher state index.
+            target = checked_strtol(buf, &buf, end);
+            result.highestStateIndex = std::max(result.highestStateIndex, target);
+            if (hasSuccessorState && target <= lastSuccessorState) {
+                STORM_LOG_ERROR("Illegal transition order for source state " << source << ".");
+                throw storm::exceptions::WrongFormatException() << "Illegal transition order for source state " << source << ".";
+            }
 
-        // At this point, we need to check whether there is an additional successor or we have reached the next choice for the same or a different state.
-        do {
-            buf = trimWhitespaces(buf);
-            // If the end of the file was reached, we need to abort and check whether we are in a legal state.
-            if (buf[0] == '\0') {
-                if (!hasSuccessorState) {
-                    STORM_LOG_ERROR("Premature end-of-file. Expected at least one successor state for state " << source << ".");
-                    throw storm::exceptions::WrongFormatException()
-                        << "Premature end-of-file. Expected at least one successor state for state " << source << ".";
-                } else {
-                    // If there was at least one successor for the current choice, this is legal and we need to move on.
-                    encounteredEOF = true;
-                }
-            } else if (buf[0] == '*') {
-                // As we have encountered a "*", we know that there is an additional successor state for the current choice.
-                buf = skipWord(buf);
-
-                // Now we need to read the successor state and check if we already saw a higher state index.
-                target = checked_strtol(buf, &buf);
-                if (target > result.highestStateIndex) {
-                    result.highestStateIndex = target;
-                }
-                if (hasSuccessorState && target <= lastSuccessorState) {
-                    STORM_LOG_ERROR("Illegal transition order for source state " << source << ".");
-                    throw storm::exceptions::WrongFormatException() << "Illegal transition order for source state " << source << ".";
-                }
-
-                // And the corresponding probability/rate.
-                double val = checked_strtod(buf, &buf);
-                if (val < 0.0) {
-                    STORM_LOG_ERROR("Illegal negative probability/rate value for transition from " << source << " to " << target << ": " << val << ".");
-                    throw storm::exceptions::WrongFormatException()
-                        << "Illegal negative probability/rate value for transition from " << source << " to " << target << ": " << val << ".";
-                }
-                if (!isMarkovianChoice && val > 1.0) {
-                    STORM_LOG_ERROR("Illegal probability value for transition from " << source << " to " << target << ": " << val << ".");
-                    throw storm::exceptions::WrongFormatException()
-                        << "Illegal probability value for transition from " << source << " to " << target << ": " << val << ".";
-                }
-
-                // We need to record that we found at least one successor state for the current choice.
-                hasSuccessorState = true;
-                lastSuccessorState = target;
+            // And the corresponding probability/rate.
+            double val = checked_strtod(buf, &buf, end);
+            if (val < 0.0) {
+                STORM_LOG_ERROR("Illegal negative probability/rate value for transition from " << source << " to " << target << ": " << val << ".");
+                throw storm::exceptions::WrongFormatException()
+                    << "Illegal negative probability/rate value for transition from " << source << " to " << target << ": " << val << ".";
+            }
+            if (!isMarkovianChoice && val > 1.0) {
+                STORM_LOG_ERROR("Illegal probability value for transition from " << source << " to " << target << ": " << val << ".");
+                throw storm::exceptions::WrongFormatException()
+                    << "Illegal probability value for transition from " << source << " to " << target << ": " << val << ".";
+            }
 
-                // As we found a new successor, we need to increase the number of nonzero entries.
-                ++result.numberOfNonzeroEntries;
+            // We need to record that we found at least one successor state for the current choice.
+            hasSuccessorState = true;
+            lastSuccessorState = target;
 
-                buf = forwardToNextLine(buf);
-            } else {
-                // If it was not a "*", we have to assume that we encountered the beginning of a new choice definition. In this case, we don't move the pointer
-                // to the buffer, because we still need to read the new source state.
-                encounteredNewDistribution = true;
-            }
-        } while (!encounteredEOF && !encounteredNewDistribution);
-    }
+            // As we found a new successor, we need to increase the number of nonzero entries.
+            ++result.numberOfTransitions;
 
-    // If there are some states with indices that are behind the last source for which no transition was specified,
-    // we need to reserve some space for introducing self-loops later.
-    if (!dontFixDeadlocks) {
-        result.numberOfNonzeroEntries += result.highestStateIndex - lastsource;
-        result.numberOfChoices += result.highestStateIndex - lastsource;
-    } else {
-        STORM_LOG_ERROR("Found deadlock states (e.g. " << lastsource + 1 << ") during parsing. Please fix them or set the appropriate flag.");
-        throw storm::exceptions::WrongFormatException()
-            << "Found deadlock states (e.g. " << lastsource + 1 << ") during parsing. Please fix them or set the appropriate flag.";
+            buf = forwardToNextLine(buf);
+            buf = trimWhitespaces(buf);
+        }
+        result.lastChoiceHasSuccessor = hasSuccessorState;
     }
 
     return result;
 }
 
 template<typename ValueType>
-typename MarkovAutomatonSparseTransitionParser<ValueType>::Result MarkovAutomatonSparseTransitionParser<ValueType>::secondPass(
-    char const* buf, FirstPassResult const& firstPassResult) {
-    Result result(firstPassResult);
-
-    bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
-
-    // Skip the format hint if it is there.
-    buf = trimWhitespaces(buf);
-    if (buf[0] < '0' || buf[0] > '9') {
-        buf = forwardToLineEnd(buf);
-        buf = trimWhitespaces(buf);
-    }
-
-    // Now read the transitions.
-    uint_fast64_t source, target = 0;
-    uint_fast64_t lastsource = 0;
-    bool encounteredEOF = false;
-    uint_fast64_t currentChoice = 0;
-
-    // The first choice of the first state already starts a new row group of the matrix.
-    result.transitionMatrixBuilder.newRowGroup(0);
-
-    while (buf[0] != '\0' && !encounteredEOF) {
+void MarkovAutomatonSparseTransitionParser<ValueType>::secondPass(
+    char const* begin, char const* end, ChunkInformation const& chunk, std::vector<storm::storage::SparseMatrixIndexType>& rowIndications,
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& columnsAndValues,
+    std::vector<storm::storage::SparseMatrixIndexType>& rowGroupIndices, std::vector<ValueType>& exitRates, std::vector<uint_fast64_t>& markovianStates) {
+    uint_fast64_t source, target;
+    uint_fast64_t currentChoice = chunk.choiceOffset, position = chunk.entryOffset;
+    uint_fast64_t lastSource = chunk.previousSource;
+    bool hasSource = chunk.hasPreviousChoice;
+
+    char const* buf = trimWhitespaces(begin);
+    while (buf < end) {
         // At the current point, the next thing to read is the source state of the next choice to come.
-        source = checked_strtol(buf, &buf);
-
-        // If we have skipped some states, we need to insert self-loops if requested.
-        if (source > lastsource + 1) {
-            if (!dontFixDeadlocks) {
-                for (uint_fast64_t index = lastsource + 1; index < source; ++index) {
-                    result.transitionMatrixBuilder.newRowGroup(currentChoice);
-                    result.transitionMatrixBuilder.addNextValue(currentChoice, index, 1);
-                    ++currentChoice;
-                }
-            } else {
-                STORM_LOG_ERROR("Found deadlock states (e.g. " << lastsource + 1 << ") during parsing. Please fix them or set the appropriate flag.");
-                throw storm::exceptions::WrongFormatException()
-                    << "Found deadlock states (e.g. " << lastsource + 1 << ") during parsing. Please fix them or set the appropriate flag.";
+        source = checked_strtol(buf, &buf, end);
+
+        if (!hasSource || source != lastSource) {
+            // If we have skipped some states, we need to insert self-loops.
+            for (uint_fast64_t state = hasSource ? lastSource + 1 : 0; state < source; ++state) {
+                rowGroupIndices[state] = currentChoice;
+                rowIndications[currentChoice++] = position;
+                columnsAndValues[position++] =
+                    storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(state, storm::utility::one<ValueType>());
             }
-        }
 
-        if (source != lastsource) {
             // If we skipped to a new state we need to create a new row group for the choices of the new state.
-            result.transitionMatrixBuilder.newRowGroup(currentChoice);
+            rowGroupIndices[source] = currentChoice;
+            hasSource = true;
+            lastSource = source;
         }
-
-        // Record that the current source was the last source.
-        lastsource = source;
+        rowIndications[currentChoice] = position;
 
         buf = trimWhitespaces(buf);
 
         // Depending on the action name, the choice is either a probabilitic one or a markovian one.
-        bool isMarkovianChoice = false;
-        if (buf[0] == '!' && skipWord(buf) - buf == 1) {
-            isMarkovianChoice = true;
-
+        bool isMarkovianChoice = buf[0] == '!' && skipWord(buf) - buf == 1;
+        if (isMarkovianChoice) {
             // Mark the current state as a Markovian one.
-            result.markovianStates.set(source, true);
-        } else {
-            isMarkovianChoice = false;
+            markovianStates.push_back(source);
         }
 
         // Go to the next line where the transitions start.
@@ -244,74 +332,27 @@ typename MarkovAutomatonSparseTransitionParser<ValueType>::Result MarkovAutomato
 
         // Now that we have the source state and the information whether or not the current choice is probabilistic or Markovian, we need to read the list of
         // successors and the probabilities/rates.
-        bool encounteredNewDistribution = false;
+        buf = trimWhitespaces(buf);
+        while (buf < end && buf[0] == '*') {
+            // As we have encountered a "*", we know that there is an additional successor state for the current choice.
+            buf = skipWord(buf);
+
+            // Now we need to read the successor state and the corresponding probability/rate.
+            target = checked_strtol(buf, &buf, end);
+            double val = checked_strtod(buf, &buf, end);
+
+            // Record the value as well as the exit rate in case of a Markovian choice.
+            columnsAndValues[position++] = storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(target, val);
+            if (isMarkovianChoice) {
+                exitRates[source] += val;
+            }
 
-        // At this point, we need to check whether there is an additional successor or we have reached the next choice for the same or a different state.
-        do {
+            buf = forwardToNextLine(buf);
             buf = trimWhitespaces(buf);
-
-            // If the end of the file was reached, we need to abort and check whether we are in a legal state.
-            if (buf[0] == '\0') {
-                // Under the assumption that the currently open choice has at least one successor (which is given after the first run)
-                // we may legally stop reading here.
-                encounteredEOF = true;
-            } else if (buf[0] == '*') {
-                // As we have encountered a "*", we know that there is an additional successor state for the current choice.
-                buf = skipWord(buf);
-
-                // Now we need to read the successor state and check if we already saw a higher state index.
-                target = checked_strtol(buf, &buf);
-
-                // And the corresponding probability/rate.
-                double val = checked_strtod(buf, &buf);
-
-                // Record the value as well as the exit rate in case of a Markovian choice.
-                result.transitionMatrixBuilder.addNextValue(currentChoice, target, val);
-                if (isMarkovianChoice) {
-                    result.exitRates[source] += val;
-                }
-
-                buf = forwardToNextLine(buf);
-            } else {
-                // If it was not a "*", we have to assume that we encountered the beginning of a new choice definition. In this case, we don't move the pointer
-                // to the buffer, because we still need to read the new source state.
-                encounteredNewDistribution = true;
-            }
-        } while (!encounteredEOF && !encounteredNewDistribution);
+        }
 
         ++currentChoice;
     }
-
-    // If there are some states with indices that are behind the last source for which no transition was specified,
-    // we need to insert the self-loops now. Note that we assume all these states to be Markovian.
-    if (!dontFixDeadlocks) {
-        for (uint_fast64_t index = lastsource + 1; index <= firstPassResult.highestStateIndex; ++index) {
-            result.markovianStates.set(index, true);
-            result.exitRates[index] = storm::utility::one<ValueType>();
-            result.transitionMatrixBuilder.newRowGroup(currentChoice);
-            result.transitionMatrixBuilder.addNextValue(currentChoice, index, storm::utility::one<ValueType>());
-            ++currentChoice;
-        }
-    } else {
-        STORM_LOG_ERROR("Found deadlock states (e.g. " << lastsource + 1 << ") during parsing. Please fix them or set the appropriate flag.");
-        throw storm::exceptions::WrongFormatException()
-            << "Found deadlock states (e.g. " << lastsource + 1 << ") during parsing. Please fix them or set the appropriate flag.";
-    }
-
-    return result;
-}
-
-template<typename ValueType>
-typename MarkovAutomatonSparseTransitionParser<ValueType>::Result MarkovAutomatonSparseTransitionParser<ValueType>::parseMarkovAutomatonTransitions(
-    std::string const& filename) {
-    // Set the locale to correctly recognize floating point numbers.
-    setlocale(LC_NUMERIC, "C");
-
-    // Open file and prepare pointer to buffer.
-    MappedFile file(filename.c_str());
-    char const* buf = file.getData();
-
-    return secondPass(buf, firstPass(buf));
 }
 
 template class MarkovAutomatonSparseTransitionParser<double>;
@@ -10,9 +10,9 @@ namespace parser {
 /*!
  * A class providing the functionality to parse the transitions of a Markov automaton.
  *
- * The file is parsed in two passes.
- * The first pass tests the file format and collects statistical data needed for the second pass.
- * The second pass then collects the actual file data and compiles it into a Result.
+ * The file is split into chunks of complete choices that are parsed in two passes, where each pass processes the chunks in parallel (if enabled).
+ * The first pass tests the file format and counts the choices and transitions of each chunk. From these counts, the position of each chunk in the
+ * matrix is derived. The second pass then collects the actual file data and compiles it into a Result.
  */
 template<typename ValueType = double>
 class MarkovAutomatonSparseTransitionParser {
@@ -51,9 +51,7 @@ class MarkovAutomatonSparseTransitionParser {
          * @param firstPassResult A reference to the result of the first pass.
          */
         Result(FirstPassResult const& firstPassResult)
-            : transitionMatrixBuilder(firstPassResult.numberOfChoices, firstPassResult.highestStateIndex + 1, firstPassResult.numberOfNonzeroEntries, true,
-                                      firstPassResult.highestStateIndex + 1),
-              markovianChoices(firstPassResult.numberOfChoices),
+            : markovianChoices(firstPassResult.numberOfChoices),
               markovianStates(firstPassResult.highestStateIndex + 1),
               exitRates(firstPassResult.highestStateIndex + 1) {
             // Intentionally left empty.
@@ -82,21 +80,68 @@ class MarkovAutomatonSparseTransitionParser {
 
    private:
     /*!
-     * Performs the first pass on the input pointed to by the given buffer.
+     * A structure representing the result of the first pass on a chunk of the input together with the information about the preceding chunks that
+     * is needed for the second pass.
+     */
+    struct ChunkInformation {
+        //! The number of choices and transitions given in the chunk.
+        uint_fast64_t numberOfChoices = 0;
+        uint_fast64_t numberOfTransitions = 0;
+
+        //! The source states of the first and the last choice of the chunk.
+        uint_fast64_t firstSource = 0;
+        uint_fast64_t lastSource = 0;
+
+        //! The number of states between the first and the last source state of the chunk that do not have a choice as well as the first of them.
+        uint_fast64_t numberOfSkippedStates = 0;
+        uint_fast64_t firstSkippedState = 0;
+
+        //! The highest state index that appears in the chunk.
+        uint_fast64_t highestStateIndex = 0;
+
+        //! Flags indicating whether the first source state has a Markovian choice in the chunk and whether the last source state has a Markovian
+        //! choice in the chunk.
+        bool firstStateHasMarkovianChoice = false;
+        bool lastStateHasMarkovianChoice = false;
+
+        //! A flag indicating whether the last choice of the chunk has a successor state.
+        bool lastChoiceHasSuccessor = false;
+
+        //! The positions in the matrix at which the entries and the new rows of this chunk begin.
+        uint_fast64_t entryOffset = 0;
+        uint_fast64_t choiceOffset = 0;
+
+        //! A flag indicating whether some preceding chunk contains a choice and, if so, the source state of the last such choice.
+        bool hasPreviousChoice = false;
+        uint_fast64_t previousSource = 0;
+    };
+
+    /*!
+     * Performs the first pass on the given chunk of the input.
      *
-     * @param buffer The buffer that cointains the input.
+     * @param begin The first character of the chunk.
+     * @param end The first position after the chunk.
      * @return A structure representing the result of the first pass.
      */
-    static FirstPassResult firstPass(char const* buffer);
+    static ChunkInformation firstPass(char const* begin, char const* end);
 
     /*!
-     * Performs the second pass on the input pointed to by the given buffer with the information of the first pass.
+     * Performs the second pass on the given chunk of the input with the information of the first pass.
      *
-     * @param buffer The buffer that cointains the input.
-     * @param firstPassResult The result of the first pass performed on the same input.
-     * @return A structure representing the result of the second pass.
+     * @param begin The first character of the chunk.
+     * @param end The first position after the chunk.
+     * @param chunk The information obtained for the chunk in the first pass.
+     * @param rowIndications The row indications of the transition matrix.
+     * @param columnsAndValues The entries of the transition matrix.
+     * @param rowGroupIndices The row group indices of the transition matrix.
+     * @param exitRates The exit rates of the states.
+     * @param markovianStates The states of the chunk that have a Markovian choice are inserted here.
      */
-    static Result secondPass(char const* buffer, FirstPassResult const& firstPassResult);
+    static void secondPass(char const* begin, char const* end, ChunkInformation const& chunk,
+                           std::vector<storm::storage::SparseMatrixIndexType>& rowIndications,
+                           std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& columnsAndValues,
+                           std::vector<storm::storage::SparseMatrixIndexType>& rowGroupIndices, std::vector<ValueType>& exitRates,
+                           std::vector<uint_fast64_t>& markovianStates);
 };
 
 }  // namespace parser
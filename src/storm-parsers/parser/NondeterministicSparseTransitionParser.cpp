@@ -1,7 +1,9 @@
 #include "storm-parsers/parser/NondeterministicSparseTransitionParser.h"
 
+#include <algorithm>
 #include <string>
 
+#include "storm-parsers/parser/FileChunks.h"
 #include "storm-parsers/parser/MappedFile.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/OutOfRangeException.h"
@@ -14,6 +16,7 @@
 #include "storm-parsers/util/cstring.h"
 
 #include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
 namespace storm {
 namespace parser {
@@ -44,18 +47,6 @@ storm::storage::SparseMatrix<ValueType> NondeterministicSparseTransitionParser<V
     MappedFile file(filename.c_str());
     char const* buf = file.getData();
 
-    // Perform first pass, i.e. obtain number of columns, rows and non-zero elements.
-    NondeterministicSparseTransitionParser::FirstPassResult firstPass =
-        NondeterministicSparseTransitionParser::firstPass(file.getData(), isRewardFile, modelInformation);
-
-    // If first pass returned zero, the file format was wrong.
-    if (firstPass.numberOfNonzeroEntries == 0) {
-        STORM_LOG_ERROR("Error while parsing " << filename << ": erroneous file format.");
-        throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": erroneous file format.";
-    }
-
-    // Perform second pass.
-
     // Skip the format hint if it is there.
     buf = trimWhitespaces(buf);
     if (buf[0] < '0' || buf[0] > '9') {
@@ -63,130 +54,150 @@ storm::storage::SparseMatrix<ValueType> NondeterministicSparseTransitionParser<V
         buf = trimWhitespaces(buf);
     }
 
-    if (isRewardFile) {
-        // The reward matrix should match the size of the transition matrix.
-        if (firstPass.choices > modelInformation.getRowCount() || (uint_fast64_t)(firstPass.highestStateIndex + 1) > modelInformation.getColumnCount()) {
-            STORM_LOG_ERROR("Reward matrix size exceeds transition matrix size.");
-            throw storm::exceptions::OutOfRangeException() << "Reward matrix size exceeds transition matrix size.";
-        } else if (firstPass.choices != modelInformation.getRowCount()) {
-            STORM_LOG_ERROR("Reward matrix row count does not match transition matrix row count.");
-            throw storm::exceptions::OutOfRangeException() << "Reward matrix row count does not match transition matrix row count.";
-        } else if (firstPass.numberOfNonzeroEntries > modelInformation.getEntryCount()) {
-            STORM_LOG_ERROR("The reward matrix has more entries than the transition matrix. There must be a reward for a non existent transition");
-            throw storm::exceptions::OutOfRangeException() << "The reward matrix has more entries than the transition matrix.";
-        } else {
-            firstPass.highestStateIndex = modelInformation.getColumnCount() - 1;
+    // Perform first pass, i.e. obtain number of columns, rows and non-zero elements of every chunk.
+    FileChunks chunks(std::min(buf, file.getDataEnd()), file.getDataEnd());
+    std::vector<ChunkInformation> chunkInformation(chunks.size());
+    chunks.forEach(
+        [&](uint64_t chunk) { chunkInformation[chunk] = firstPass(chunks.getBegin(chunk), chunks.getEnd(chunk), isRewardFile, modelInformation); });
+
+    // Combine the results of the chunks. This determines the position of the rows and entries of each chunk in the matrix.
+    NondeterministicSparseTransitionParser::FirstPassResult firstPassResult;
+    bool hasTransition = false, hasUnorderedRows = false;
+    uint_fast64_t lastSource = 0, lastChoice = 0, lastTarget = 0, numberOfDeadlockStates = 0, firstDeadlockState = 0;
+    for (auto& chunk : chunkInformation) {
+        if (chunk.numberOfTransitions == 0) {
+            continue;
         }
-    }
-
-    // Create the matrix builder.
-    // The matrix to be build should have as many columns as we have nodes and as many rows as we have choices.
-    // Those two values, as well as the number of nonzero elements, was been calculated in the first run.
-    STORM_LOG_INFO("Attempting to create matrix of size " << firstPass.choices << " x " << (firstPass.highestStateIndex + 1) << " with "
-                                                          << firstPass.numberOfNonzeroEntries << " entries.");
-    storm::storage::SparseMatrixBuilder<ValueType> matrixBuilder;
-    if (!isRewardFile) {
-        matrixBuilder = storm::storage::SparseMatrixBuilder<ValueType>(firstPass.choices, firstPass.highestStateIndex + 1, firstPass.numberOfNonzeroEntries,
-                                                                       true, true, firstPass.highestStateIndex + 1);
-    } else {
-        matrixBuilder = storm::storage::SparseMatrixBuilder<ValueType>(firstPass.choices, firstPass.highestStateIndex + 1, firstPass.numberOfNonzeroEntries,
-                                                                       true, true, modelInformation.getRowGroupCount());
-    }
 
-    // Initialize variables for the parsing run.
-    uint_fast64_t source = 0, target = 0, lastSource = 0, choice = 0, lastChoice = 0, curRow = 0;
-    double val = 0.0;
-    bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
-    bool hadDeadlocks = false;
-
-    // The first state already starts a new row group of the matrix.
-    matrixBuilder.newRowGroup(0);
-
-    // Read all transitions from file.
-    while (buf[0] != '\0') {
-        // Read source state and choice.
-        source = checked_strtol(buf, &buf);
-        choice = checked_strtol(buf, &buf);
-
-        if (isRewardFile) {
-            // If we have switched the source state, we possibly need to insert the rows of the last
-            // source state.
-            if (source != lastSource) {
-                curRow += ((modelInformation.getRowGroupIndices())[lastSource + 1] - (modelInformation.getRowGroupIndices())[lastSource]) - (lastChoice + 1);
+        // Check the transitions at the border to the previous chunk.
+        uint_fast64_t skippedStatesBeforeChunk = chunk.firstSource;
+        bool continuesChoice = false;
+        if (hasTransition) {
+            if (chunk.firstSource < lastSource) {
+                STORM_LOG_ERROR("The current source state " << chunk.firstSource << " is smaller than the last one " << lastSource << ".");
+                throw storm::exceptions::InvalidArgumentException()
+                    << "The current source state " << chunk.firstSource << " is smaller than the last one " << lastSource << ".";
             }
-
-            // If we skipped some states, we need to reserve empty rows for all their nondeterministic
-            // choices and create the row groups.
-            for (uint_fast64_t i = lastSource + 1; i < source; ++i) {
-                matrixBuilder.newRowGroup(modelInformation.getRowGroupIndices()[i]);
-                curRow += ((modelInformation.getRowGroupIndices())[i + 1] - (modelInformation.getRowGroupIndices())[i]);
-            }
-
-            // If we moved to the next source, we need to open the next row group.
-            if (source != lastSource) {
-                matrixBuilder.newRowGroup(modelInformation.getRowGroupIndices()[source]);
+            STORM_LOG_THROW(!isRewardFile || chunk.firstSource != lastSource || chunk.firstChoice >= lastChoice, storm::exceptions::InvalidArgumentException,
+                            "The choice " << chunk.firstChoice << " of state " << chunk.firstSource << " is given after choice " << lastChoice << ".");
+            continuesChoice = chunk.firstSource == lastSource && chunk.firstChoice == lastChoice;
+            if (continuesChoice && chunk.firstTarget == lastTarget) {
+                STORM_LOG_ERROR("The same transition (" << lastSource << ", " << lastChoice << ", " << lastTarget << ") is given twice.");
+                throw storm::exceptions::InvalidArgumentException()
+                    << "The same transition (" << lastSource << ", " << lastChoice << ", " << lastTarget << ") is given twice.";
             }
+            hasUnorderedRows |= continuesChoice && chunk.firstTarget < lastTarget;
+            skippedStatesBeforeChunk = chunk.firstSource > lastSource ? chunk.firstSource - lastSource - 1 : 0;
+        }
 
-            // If we advanced to the next state, but skipped some choices, we have to reserve rows
-            // for them
-            if (source != lastSource) {
-                curRow += choice + 1;
-            } else if (choice != lastChoice) {
-                curRow += choice - lastChoice;
-            }
-        } else {
-            // Increase line count if we have either finished reading the transitions of a certain state
-            // or we have finished reading one nondeterministic choice of a state.
-            if ((source != lastSource || choice != lastChoice)) {
-                ++curRow;
+        chunk.entryOffset = firstPassResult.numberOfNonzeroEntries;
+        chunk.rowOffset = firstPassResult.choices;
+        chunk.hasPreviousTransition = hasTransition;
+        chunk.previousSource = lastSource;
+        chunk.previousChoice = lastChoice;
+        firstPassResult.numberOfNonzeroEntries += chunk.numberOfTransitions;
+        if (!isRewardFile) {
+            if (numberOfDeadlockStates == 0) {
+                firstDeadlockState = skippedStatesBeforeChunk > 0 ? chunk.firstSource - skippedStatesBeforeChunk : chunk.firstSkippedState;
             }
+            numberOfDeadlockStates += skippedStatesBeforeChunk + chunk.numberOfSkippedStates;
 
-            // Check if we have skipped any source node, i.e. if any node has no
-            // outgoing transitions. If so, insert a self-loop.
-            // Also begin a new rowGroup for the skipped state.
-            for (uint_fast64_t node = lastSource + 1; node < source; node++) {
-                hadDeadlocks = true;
-                if (!dontFixDeadlocks) {
-                    matrixBuilder.newRowGroup(curRow);
-                    matrixBuilder.addNextValue(curRow, node, 1);
-                    ++curRow;
-                    STORM_LOG_INFO("Warning while parsing " << filename << ": node " << node << " has no outgoing transitions. A self-loop was inserted.");
-                } else {
-                    STORM_LOG_ERROR("Error while parsing " << filename << ": node " << node << " has no outgoing transitions.");
-                }
-            }
-            if (source != lastSource) {
-                // Create a new rowGroup for the source, if this is the first choice we encounter for this state.
-                matrixBuilder.newRowGroup(curRow);
-            }
+            // Reserve one row and one entry for the self-loop of every skipped state.
+            firstPassResult.numberOfNonzeroEntries += skippedStatesBeforeChunk + chunk.numberOfSkippedStates;
+            firstPassResult.choices += skippedStatesBeforeChunk + chunk.numberOfSkippedStates + chunk.numberOfChoices - (continuesChoice ? 1 : 0);
         }
+        firstPassResult.highestStateIndex = std::max(firstPassResult.highestStateIndex, chunk.highestStateIndex);
+        hasUnorderedRows |= chunk.hasUnorderedRow;
 
-        // Read target and value and write it to the matrix.
-        target = checked_strtol(buf, &buf);
-        val = checked_strtod(buf, &buf);
-        matrixBuilder.addNextValue(curRow, target, val);
-
-        lastSource = source;
-        lastChoice = choice;
+        hasTransition = true;
+        lastSource = chunk.lastSource;
+        lastChoice = chunk.lastChoice;
+        lastTarget = chunk.lastTarget;
+    }
 
-        // Proceed to beginning of next line in file and next row in matrix.
-        buf = forwardToLineEnd(buf);
+    // If there was no transition, the file format was wrong.
+    if (!hasTransition) {
+        STORM_LOG_ERROR("Error while parsing " << filename << ": erroneous file format.");
+        throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": erroneous file format.";
+    }
 
-        buf = trimWhitespaces(buf);
+    uint_fast64_t const numberOfEntriesOfChunks = firstPassResult.numberOfNonzeroEntries;
+    uint_fast64_t const numberOfRowsOfChunks = firstPassResult.choices;
+    if (isRewardFile) {
+        // Since we assume the transition rewards are for the transitions of the model, the reward matrix has the dimensions of the transition matrix.
+        // The first pass already made sure that all transitions are within these dimensions.
+        if (firstPassResult.numberOfNonzeroEntries > modelInformation.getEntryCount()) {
+            STORM_LOG_ERROR("The reward matrix has more entries than the transition matrix. There must be a reward for a non existent transition");
+            throw storm::exceptions::OutOfRangeException() << "The reward matrix has more entries than the transition matrix.";
+        }
+        firstPassResult.choices = modelInformation.getRowCount();
+        firstPassResult.highestStateIndex = modelInformation.getColumnCount() - 1;
+    } else {
+        // The states after the last one with transitions do not have transitions either.
+        if (numberOfDeadlockStates == 0) {
+            firstDeadlockState = lastSource + 1;
+        }
+        numberOfDeadlockStates += firstPassResult.highestStateIndex - lastSource;
+        firstPassResult.numberOfNonzeroEntries += firstPassResult.highestStateIndex - lastSource;
+        firstPassResult.choices += firstPassResult.highestStateIndex - lastSource;
+
+        if (numberOfDeadlockStates > 0) {
+            bool dontFixDeadlocks = storm::settings::getModule<storm::settings::modules::BuildSettings>().isDontFixDeadlocksSet();
+            if (dontFixDeadlocks) {
+                STORM_LOG_ERROR("Error while parsing " << filename << ": " << numberOfDeadlockStates << " nodes (e.g. node " << firstDeadlockState
+                                                       << ") have no outgoing transitions.");
+                throw storm::exceptions::WrongFormatException() << "Some of the states do not have outgoing transitions.";
+            }
+            STORM_LOG_WARN("Warning while parsing " << filename << ": " << numberOfDeadlockStates << " nodes (e.g. node " << firstDeadlockState
+                                                    << ") have no outgoing transitions. Self-loops were inserted.");
+        }
     }
 
-    if (dontFixDeadlocks && hadDeadlocks && !isRewardFile)
-        throw storm::exceptions::WrongFormatException() << "Some of the states do not have outgoing transitions.";
+    // Perform second pass, i.e. write the transitions of every chunk to their position in the matrix.
+    // The matrix to be build should have as many columns as we have nodes and as many rows as we have choices.
+    STORM_LOG_INFO("Attempting to create matrix of size " << firstPassResult.choices << " x " << (firstPassResult.highestStateIndex + 1) << " with "
+                                                          << firstPassResult.numberOfNonzeroEntries << " entries.");
+    std::vector<storm::storage::SparseMatrixIndexType> rowIndications(firstPassResult.choices + 1);
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>> columnsAndValues(firstPassResult.numberOfNonzeroEntries);
+    std::vector<storm::storage::SparseMatrixIndexType> rowGroupIndices;
+    if (isRewardFile) {
+        rowGroupIndices = modelInformation.getRowGroupIndices();
+    } else {
+        rowGroupIndices.resize(firstPassResult.highestStateIndex + 2);
+    }
+    chunks.forEach([&](uint64_t chunk) {
+        if (chunkInformation[chunk].numberOfTransitions > 0) {
+            secondPass(chunks.getBegin(chunk), chunks.getEnd(chunk), chunkInformation[chunk], isRewardFile, modelInformation, rowIndications, columnsAndValues,
+                       rowGroupIndices);
+        }
+    });
 
-    // Since we assume the transition rewards are for the transitions of the model, we copy the rowGroupIndices.
+    uint_fast64_t position = numberOfEntriesOfChunks;
     if (isRewardFile) {
-        for (uint_fast64_t node = lastSource + 1; node < modelInformation.getRowGroupCount(); node++) {
-            matrixBuilder.newRowGroup(modelInformation.getRowGroupIndices()[node]);
+        // Close the rows after the last one with a reward.
+        for (uint_fast64_t row = rowGroupIndices[lastSource] + lastChoice + 1; row < firstPassResult.choices; ++row) {
+            rowIndications[row] = position;
         }
+    } else {
+        // Insert the self-loops for the states after the last one with transitions.
+        uint_fast64_t row = numberOfRowsOfChunks;
+        for (uint_fast64_t node = lastSource + 1; node <= firstPassResult.highestStateIndex; ++node) {
+            rowGroupIndices[node] = row;
+            rowIndications[row++] = position;
+            columnsAndValues[position++] =
+                storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(node, storm::utility::one<ValueType>());
+        }
+        rowGroupIndices[firstPassResult.highestStateIndex + 1] = firstPassResult.choices;
+    }
+    rowIndications[firstPassResult.choices] = position;
+
+    if (hasUnorderedRows) {
+        sortRowsOfParsedMatrix(rowIndications, columnsAndValues, chunks.isParallel());
     }
 
     // Finally, build the actual matrix, test and return it.
-    storm::storage::SparseMatrix<ValueType> resultMatrix = matrixBuilder.build();
+    storm::storage::SparseMatrix<ValueType> resultMatrix(firstPassResult.highestStateIndex + 1, std::move(rowIndications), std::move(columnsAndValues),
+                                                         std::move(rowGroupIndices));
 
     // Since we cannot check if each transition for which there is a reward in the reward file also exists in the transition matrix during parsing, we have to
     // do it afterwards.
@@ -200,120 +211,103 @@ storm::storage::SparseMatrix<ValueType> NondeterministicSparseTransitionParser<V
 
 template<typename ValueType>
 template<typename MatrixValueType>
-typename NondeterministicSparseTransitionParser<ValueType>::FirstPassResult NondeterministicSparseTransitionParser<ValueType>::firstPass(
-    char const* buf, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation) {
-    // Check file header and extract number of transitions.
-
-    // Skip the format hint if it is there.
-    buf = trimWhitespaces(buf);
-    if (buf[0] < '0' || buf[0] > '9') {
-        buf = forwardToLineEnd(buf);
-        buf = trimWhitespaces(buf);
-    }
-
+typename NondeterministicSparseTransitionParser<ValueType>::ChunkInformation NondeterministicSparseTransitionParser<ValueType>::firstPass(
+    char const* begin, char const* end, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation) {
     // Read all transitions.
-    uint_fast64_t source = 0, target = 0, choice = 0, lastChoice = 0, lastSource = 0, lastTarget = -1;
+    uint_fast64_t source = 0, target = 0, choice = 0;
     double val = 0.0;
-    typename NondeterministicSparseTransitionParser<ValueType>::FirstPassResult result;
+    typename NondeterministicSparseTransitionParser<ValueType>::ChunkInformation result;
 
-    // Since the first line is already a new choice but is not covered below, that has to be covered here.
-    result.choices = 1;
-
-    while (buf[0] != '\0') {
+    char const* buf = trimWhitespaces(begin);
+    while (buf < end) {
         // Read source state and choice.
-        source = checked_strtol(buf, &buf);
+        source = checked_strtol(buf, &buf, end);
 
         // Read the name of the nondeterministic choice.
-        choice = checked_strtol(buf, &buf);
+        choice = checked_strtol(buf, &buf, end);
 
-        if (source < lastSource) {
-            STORM_LOG_ERROR("The current source state " << source << " is smaller than the last one " << lastSource << ".");
-            throw storm::exceptions::InvalidArgumentException()
-                << "The current source state " << source << " is smaller than the last one " << lastSource << ".";
-        }
-
-        // Check if we encountered a state index that is bigger than all previously seen.
-        if (source > result.highestStateIndex) {
-            result.highestStateIndex = source;
-        }
+        // Read target and value.
+        target = checked_strtol(buf, &buf, end);
+        val = checked_strtod(buf, &buf, end);
 
         if (isRewardFile) {
-            // Make sure that the highest state index of the reward file is not higher than the highest state index of the corresponding model.
-            if (result.highestStateIndex > modelInformation.getColumnCount() - 1) {
-                STORM_LOG_ERROR("State index " << result.highestStateIndex << " found. This exceeds the highest state index of the model, which is "
+            // Make sure that the transition exists in the dimensions of the corresponding model.
+            if (source >= modelInformation.getRowGroupCount() || target >= modelInformation.getColumnCount()) {
+                STORM_LOG_ERROR("State index " << std::max(source, target) << " found. This exceeds the highest state index of the model, which is "
                                                << modelInformation.getColumnCount() - 1 << " .");
                 throw storm::exceptions::OutOfRangeException()
-                    << "State index " << result.highestStateIndex << " found. This exceeds the highest state index of the model, which is "
+                    << "State index " << std::max(source, target) << " found. This exceeds the highest state index of the model, which is "
                     << modelInformation.getColumnCount() - 1 << " .";
             }
-
-            // If we have switched the source state, we possibly need to insert rows for skipped choices of the last
-            // source state.
-            if (source != lastSource) {
-                // number of choices skipped = number of choices of last state - number of choices read
-                result.choices +=
-                    ((modelInformation.getRowGroupIndices())[lastSource + 1] - (modelInformation.getRowGroupIndices())[lastSource]) - (lastChoice + 1);
-            }
-
-            // If we skipped some states, we need to reserve empty rows for all their nondeterministic
-            // choices.
-            for (uint_fast64_t i = lastSource + 1; i < source; ++i) {
-                result.choices += ((modelInformation.getRowGroupIndices())[i + 1] - (modelInformation.getRowGroupIndices())[i]);
+            if (choice >= modelInformation.getRowGroupSize(source)) {
+                STORM_LOG_ERROR("Choice " << choice << " of state " << source << " found, but the state has only " << modelInformation.getRowGroupSize(source)
+                                          << " choices.");
+                throw storm::exceptions::OutOfRangeException() << "Choice " << choice << " of state " << source << " found, but the state has only "
+                                                               << modelInformation.getRowGroupSize(source) << " choices.";
             }
+        }
 
-            // If we advanced to the next state, but skipped some choices, we have to reserve rows
-            // for them.
-            if (source != lastSource) {
-                result.choices += choice + 1;
-            } else if (choice != lastChoice) {
-                result.choices += choice - lastChoice;
-            }
+        if (result.numberOfTransitions == 0) {
+            result.firstSource = source;
+            result.firstChoice = choice;
+            result.firstTarget = target;
+            result.numberOfChoices = 1;
         } else {
-            // If we have skipped some states, we need to reserve the space for the self-loop insertion
-            // in the second pass.
-            if (source > lastSource + 1) {
-                result.numberOfNonzeroEntries += source - lastSource - 1;
-                result.choices += source - lastSource - 1;
+            if (source < result.lastSource) {
+                STORM_LOG_ERROR("The current source state " << source << " is smaller than the last one " << result.lastSource << ".");
+                throw storm::exceptions::InvalidArgumentException()
+                    << "The current source state " << source << " is smaller than the last one " << result.lastSource << ".";
             }
 
-            if (source != lastSource || choice != lastChoice) {
-                // If we have switched the source state or the nondeterministic choice, we need to
-                // reserve one row more.
-                ++result.choices;
+            if (source == result.lastSource && choice == result.lastChoice) {
+                // Have we already seen this transition?
+                if (target == result.lastTarget) {
+                    STORM_LOG_ERROR("The same transition (" << source << ", " << choice << ", " << target << ") is given twice.");
+                    throw storm::exceptions::InvalidArgumentException()
+                        << "The same transition (" << source << ", " << choice << ", " << target << ") is given twice.";
+                }
+                if (target < result.lastTarget) {
+                    result.hasUnorderedRow = true;
+                }
+            } else {
+                // If we have switched the source state or the nondeterministic choice, we need to reserve one row more.
+                ++result.numberOfChoices;
+
+                // In reward files, the choices of a state refer to the rows of the model and thus have to be given in ascending order.
+                if (isRewardFile && source == result.lastSource && choice < result.lastChoice) {
+                    STORM_LOG_ERROR("The choice " << choice << " of state " << source << " is given after choice " << result.lastChoice << ".");
+                    throw storm::exceptions::InvalidArgumentException()
+                        << "The choice " << choice << " of state " << source << " is given after choice " << result.lastChoice << ".";
+                }
             }
-        }
-
-        // Read target and check if we encountered a state index that is bigger than all previously seen.
-        target = checked_strtol(buf, &buf);
 
-        if (target > result.highestStateIndex) {
-            result.highestStateIndex = target;
+            // If we have skipped some states, we need to reserve the space for the self-loop insertion in the second pass.
+            if (source > result.lastSource + 1) {
+                if (result.numberOfSkippedStates == 0) {
+                    result.firstSkippedState = result.lastSource + 1;
+                }
+                result.numberOfSkippedStates += source - result.lastSource - 1;
+            }
         }
 
-        // Also, have we already seen this transition?
-        if (target == lastTarget && choice == lastChoice && source == lastSource) {
-            STORM_LOG_ERROR("The same transition (" << source << ", " << choice << ", " << target << ") is given twice.");
-            throw storm::exceptions::InvalidArgumentException() << "The same transition (" << source << ", " << choice << ", " << target << ") is given twice.";
-        }
+        // Check if we encountered a state index that is bigger than all previously seen.
+        result.highestStateIndex = std::max(result.highestStateIndex, std::max(source, target));
 
-        // Read value and check whether it's positive.
-        val = checked_strtod(buf, &buf);
+        // Check whether the value is positive.
         if (!isRewardFile && (val < 0.0 || val > 1.0)) {
-            STORM_LOG_ERROR("Expected a positive probability but got \"" << std::string(buf, 0, 16) << "\".");
-            NondeterministicSparseTransitionParser::FirstPassResult nullResult;
-            return nullResult;
+            STORM_LOG_ERROR("Expected a positive probability but got \"" << val << "\".");
+            throw storm::exceptions::WrongFormatException() << "Expected a positive probability but got \"" << val << "\".";
         } else if (val < 0.0) {
-            STORM_LOG_ERROR("Expected a positive reward value but got \"" << std::string(buf, 0, 16) << "\".");
-            NondeterministicSparseTransitionParser::FirstPassResult nullResult;
-            return nullResult;
+            STORM_LOG_ERROR("Expected a positive reward value but got \"" << val << "\".");
+            throw storm::exceptions::WrongFormatException() << "Expected a positive reward value but got \"" << val << "\".";
         }
 
-        lastChoice = choice;
-        lastSource = source;
-        lastTarget = target;
+        result.lastSource = source;
+        result.lastChoice = choice;
+        result.lastTarget = target;
 
         // Increase number of non-zero values.
-        result.numberOfNonzeroEntries++;
+        ++result.numberOfTransitions;
 
         // The PRISM output format lists the name of the transition in the fourth column,
         // but omits the fourth column if it is an internal action. In either case we can skip to the end of the line.
@@ -322,18 +316,74 @@ typename NondeterministicSparseTransitionParser<ValueType>::FirstPassResult Nond
         buf = trimWhitespaces(buf);
     }
 
-    if (isRewardFile) {
-        // If not all rows were filled for the last state, we need to insert them.
-        result.choices += ((modelInformation.getRowGroupIndices())[lastSource + 1] - (modelInformation.getRowGroupIndices())[lastSource]) - (lastChoice + 1);
+    return result;
+}
+
+template<typename ValueType>
+template<typename MatrixValueType>
+void NondeterministicSparseTransitionParser<ValueType>::secondPass(
+    char const* begin, char const* end, ChunkInformation const& chunk, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation,
+    std::vector<storm::storage::SparseMatrixIndexType>& rowIndications,
+    std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& columnsAndValues,
+    std::vector<storm::storage::SparseMatrixIndexType>& rowGroupIndices) {
+    // Initialize variables for the parsing run.
+    uint_fast64_t source = 0, target = 0, choice = 0, curRow = 0;
+    uint_fast64_t lastSource = chunk.previousSource, lastChoice = chunk.previousChoice;
+    bool hasTransition = chunk.hasPreviousTransition;
+    uint_fast64_t nextRow = chunk.rowOffset, position = chunk.entryOffset;
+    double val = 0.0;
+
+    // Read all transitions from the chunk.
+    char const* buf = trimWhitespaces(begin);
+    while (buf < end) {
+        // Read source state and choice.
+        source = checked_strtol(buf, &buf, end);
+        choice = checked_strtol(buf, &buf, end);
+
+        if (isRewardFile) {
+            // The row is given by the choice of the source state in the model. If we skipped some rows, they remain empty.
+            curRow = modelInformation.getRowGroupIndices()[source] + choice;
+            if (!hasTransition || source != lastSource || choice != lastChoice) {
+                uint_fast64_t lastRow = modelInformation.getRowGroupIndices()[lastSource] + lastChoice;
+                for (uint_fast64_t row = hasTransition ? lastRow + 1 : 0; row <= curRow; ++row) {
+                    rowIndications[row] = position;
+                }
+            }
+        } else if (!hasTransition || source != lastSource || choice != lastChoice) {
+            // Check if we have skipped any source node, i.e. if any node has no outgoing transitions. If so, insert a self-loop.
+            // Also begin a new rowGroup for the skipped state.
+            if (!hasTransition || source != lastSource) {
+                for (uint_fast64_t node = hasTransition ? lastSource + 1 : 0; node < source; ++node) {
+                    rowGroupIndices[node] = nextRow;
+                    rowIndications[nextRow++] = position;
+                    columnsAndValues[position++] =
+                        storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(node, storm::utility::one<ValueType>());
+                }
 
-        // If we skipped some states, we need to reserve empty rows for all their nondeterministic
-        // choices.
-        for (uint_fast64_t i = lastSource + 1; i < modelInformation.getRowGroupIndices().size() - 1; ++i) {
-            result.choices += ((modelInformation.getRowGroupIndices())[i + 1] - (modelInformation.getRowGroupIndices())[i]);
+                // Create a new rowGroup for the source, if this is the first choice we encounter for this state.
+                rowGroupIndices[source] = nextRow;
+            }
+
+            // Begin a new row as we have either finished reading the transitions of a certain state or we have finished reading one
+            // nondeterministic choice of a state.
+            curRow = nextRow++;
+            rowIndications[curRow] = position;
         }
-    }
 
-    return result;
+        // Read target and value and write it to the matrix.
+        target = checked_strtol(buf, &buf, end);
+        val = checked_strtod(buf, &buf, end);
+        columnsAndValues[position++] = storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>(target, val);
+
+        hasTransition = true;
+        lastSource = source;
+        lastChoice = choice;
+
+        // Proceed to beginning of next line in file and next row in matrix.
+        buf = forwardToLineEnd(buf);
+
+        buf = trimWhitespaces(buf);
+    }
 }
 
 template class NondeterministicSparseTransitionParser<double>;
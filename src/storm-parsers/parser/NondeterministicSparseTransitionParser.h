@@ -11,9 +11,9 @@ namespace parser {
 /*!
  * A class providing the functionality to parse the transitions of a nondeterministic model.
  *
- * The file is parsed in two passes.
- * The first pass tests the file format and collects statistical data needed for the second pass.
- * The second pass then collects the actual file data and compiles it into a Result.
+ * The file is split into chunks of complete lines that are parsed in two passes, where each pass processes the chunks in parallel (if enabled).
+ * The first pass tests the file format and counts the transitions and choices of each chunk. From these counts, the position of each chunk in the
+ * matrix is derived. The second pass then collects the actual file data and writes it directly to the resulting matrix.
  */
 template<typename ValueType = double>
 class NondeterministicSparseTransitionParser {
@@ -61,25 +61,82 @@ class NondeterministicSparseTransitionParser {
 
    private:
     /*!
-     * This method does the first pass through the buffer containing the content of some transition file.
+     * A structure representing the result of the first pass on a chunk of the input together with the information about the preceding chunks that
+     * is needed for the second pass.
+     */
+    struct ChunkInformation {
+        //! The number of transitions given in the chunk.
+        uint_fast64_t numberOfTransitions = 0;
+
+        //! The number of choices (i.e. matrix rows) that begin in the chunk, where the choice of the first transition is always counted.
+        uint_fast64_t numberOfChoices = 0;
+
+        //! The source state, choice and target state of the first and the last transition of the chunk.
+        uint_fast64_t firstSource = 0;
+        uint_fast64_t firstChoice = 0;
+        uint_fast64_t firstTarget = 0;
+        uint_fast64_t lastSource = 0;
+        uint_fast64_t lastChoice = 0;
+        uint_fast64_t lastTarget = 0;
+
+        //! The number of states between the first and the last source state of the chunk that do not have a transition as well as the first of them.
+        uint_fast64_t numberOfSkippedStates = 0;
+        uint_fast64_t firstSkippedState = 0;
+
+        //! The highest state index that appears in the chunk.
+        uint_fast64_t highestStateIndex = 0;
+
+        //! A flag indicating whether the transitions of some choice are not ordered by their target state.
+        bool hasUnorderedRow = false;
+
+        //! The positions in the matrix at which the entries and the new rows of this chunk begin.
+        uint_fast64_t entryOffset = 0;
+        uint_fast64_t rowOffset = 0;
+
+        //! A flag indicating whether some preceding chunk contains a transition and, if so, the source state and choice of the last such transition.
+        bool hasPreviousTransition = false;
+        uint_fast64_t previousSource = 0;
+        uint_fast64_t previousChoice = 0;
+    };
+
+    /*!
+     * This method does the first pass through the given chunk of the content of some transition file.
      *
-     * It computes the overall number of nondeterministic choices, i.e. the
-     * number of rows in the matrix that should be created.
-     * It also calculates the overall number of non-zero cells, i.e. the number
-     * of elements the matrix has to hold, and the maximum node id, i.e. the
-     * number of columns of the matrix.
+     * It computes the number of nondeterministic choices that begin in the chunk as well as the number of non-zero cells, i.e. the number
+     * of elements the matrix has to hold for the chunk, and the maximum node id, i.e. the number of columns of the matrix.
      *
-     * @param buffer Buffer containing the data to scan. This is expected to be some char array.
-     * @param insertDiagonalEntriesIfMissing A flag set iff entries on the primary diagonal of the matrix should be added in case they are missing in the parsed
-     * file.
+     * @param begin The first character of the chunk.
+     * @param end The first position after the chunk.
+     * @param isRewardFile A flag set iff the file contains transition rewards.
+     * @param modelInformation The transition matrix of the model (this is only meaningful if isRewardFile is set to true).
      * @return A structure representing the result of the first pass.
      */
     template<typename MatrixValueType>
-    static FirstPassResult firstPass(char const* buffer, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation);
+    static ChunkInformation firstPass(char const* begin, char const* end, bool isRewardFile, storm::storage::SparseMatrix<MatrixValueType> const& modelInformation);
+
+    /*!
+     * This method does the second pass through the given chunk, i.e., it writes the transitions of the chunk to the given matrix contents.
+     *
+     * @param begin The first character of the chunk.
+     * @param end The first position after the chunk.
+     * @param chunk The information obtained for the chunk in the first pass.
+     * @param isRewardFile A flag set iff the file contains transition rewards.
+     * @param modelInformation The transition matrix of the model (this is only meaningful if isRewardFile is set to true).
+     * @param rowIndications The row indications of the matrix.
+     * @param columnsAndValues The entries of the matrix.
+     * @param rowGroupIndices The row group indices of the matrix. These are only written if isRewardFile is not set.
+     */
+    template<typename MatrixValueType>
+    static void secondPass(char const* begin, char const* end, ChunkInformation const& chunk, bool isRewardFile,
+                           storm::storage::SparseMatrix<MatrixValueType> const& modelInformation,
+                           std::vector<storm::storage::SparseMatrixIndexType>& rowIndications,
+                           std::vector<storm::storage::MatrixEntry<storm::storage::SparseMatrixIndexType, ValueType>>& columnsAndValues,
+                           std::vector<storm::storage::SparseMatrixIndexType>& rowGroupIndices);
 
     /*!
      * The main parsing routine.
-     * Opens the given file, calls the first pass and performs the second pass, parsing the content of the file into a SparseMatrix.
+     * Opens the given file, performs the first pass on all chunks, combines their results and performs the second pass on all chunks, parsing
+     * the content of the file into a SparseMatrix.
      *
      * @param filename The path and name of file to be parsed.
      * @param rewardFile A flag set iff the file to be parsed contains transition rewards.
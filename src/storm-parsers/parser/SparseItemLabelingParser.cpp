@@ -1,13 +1,18 @@
 #include "storm-parsers/parser/SparseItemLabelingParser.h"
 
+#include <algorithm>
 #include <cstring>
 #include <iostream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 
+#include "storm-parsers/parser/FileChunks.h"
 #include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/util/cstring.h"
 
 #include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/utility/macros.h"
 
@@ -30,7 +35,7 @@ storm::models::sparse::StateLabeling SparseItemLabelingParser::parseAtomicPropos
     parseLabelNames(filename, labeling, buf);
 
     // Now parse the assignments of labels to states.
-    parseDeterministicLabelAssignments(filename, labeling, buf);
+    parseDeterministicLabelAssignments(filename, labeling, std::min(buf, file.getDataEnd()), file.getDataEnd());
 
     return labeling;
 }
@@ -53,7 +58,7 @@ storm::models::sparse::ChoiceLabeling SparseItemLabelingParser::parseChoiceLabel
     if (nondeterministicChoiceIndices) {
         parseNonDeterministicLabelAssignments(filename, labeling, nondeterministicChoiceIndices.get(), buf);
     } else {
-        parseDeterministicLabelAssignments(filename, labeling, buf);
+        parseDeterministicLabelAssignments(filename, labeling, std::min(buf, file.getDataEnd()), file.getDataEnd());
     }
 
     return labeling;
@@ -141,56 +146,110 @@ void SparseItemLabelingParser::parseLabelNames(std::string const& filename, stor
 }
 
 void SparseItemLabelingParser::parseDeterministicLabelAssignments(std::string const& filename, storm::models::sparse::ItemLabeling& labeling,
-                                                                  char const*& buf) {
-    uint_fast64_t state = 0;
-    uint_fast64_t lastState = (uint_fast64_t)-1;
-    uint_fast64_t const startIndexComparison = lastState;
-    size_t cnt = 0;
-    char proposition[128];
-
-    while (buf[0] != '\0') {
-        // Parse the state number and iterate over its labels (atomic propositions).
-        // Stop at the end of the line.
-        state = checked_strtol(buf, &buf);
-
-        // If the state has already been read or skipped once there might be a problem with the file (doubled lines, or blocks).
-        if (state <= lastState && lastState != startIndexComparison) {
-            STORM_LOG_ERROR("Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.");
-            throw storm::exceptions::WrongFormatException()
-                << "Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.";
-        }
-
-        while ((buf[0] != '\r') && (buf[0] != '\n') && (buf[0] != '\0')) {
-            cnt = skipWord(buf) - buf;
-            if (cnt == 0) {
-                // The next character is a separator.
-                // If it is a line separator, we continue with next node.
-                // Otherwise, we skip it and try again.
-                if (buf[0] == '\n' || buf[0] == '\r')
-                    break;
-                buf++;
-            } else {
-                // Copy the label to the buffer, null terminate it and add it to labeling.
-                strncpy(proposition, buf, cnt);
-                proposition[cnt] = '\0';
-
-                // Has the label been declared in the header?
-                if (!labeling.containsLabel(proposition)) {
-                    STORM_LOG_ERROR("Error while parsing " << filename << ": Atomic proposition" << proposition << " was found but not declared.");
-                    throw storm::exceptions::WrongFormatException()
-                        << "Error while parsing " << filename << ": Atomic proposition" << proposition << " was found but not declared.";
-                }
-                if (labeling.isStateLabeling()) {
-                    labeling.asStateLabeling().addLabelToState(proposition, state);
+                                                                  char const* begin, char const* end) {
+    // Assign an index to every declared label such that the chunks can look up labels without accessing the labeling.
+    std::vector<std::string> labelNames;
+    std::unordered_map<std::string, uint_fast64_t> labelIndices;
+    for (auto const& label : labeling.getLabels()) {
+        labelIndices.emplace(label, labelNames.size());
+        labelNames.push_back(label);
+    }
+    uint_fast64_t const itemCount = labeling.getNumberOfItems();
+
+    // Parse the assignments of all chunks of the file. Every assignment is stored as a pair of the item and the index of the label.
+    FileChunks chunks(begin, end);
+    std::vector<std::vector<std::pair<uint_fast64_t, uint_fast64_t>>> assignmentsOfChunks(chunks.size());
+    std::vector<std::pair<uint_fast64_t, uint_fast64_t>> itemRangeOfChunks(chunks.size(), {1, 0});
+    chunks.forEach([&](uint64_t chunk) {
+        auto& assignments = assignmentsOfChunks[chunk];
+        auto& itemRange = itemRangeOfChunks[chunk];
+        uint_fast64_t state = 0;
+        bool hasState = false;
+        size_t cnt = 0;
+
+        char const* buf = trimWhitespaces(chunks.getBegin(chunk));
+        char const* chunkEnd = chunks.getEnd(chunk);
+        while (buf < chunkEnd) {
+            // Parse the state number and iterate over its labels (atomic propositions).
+            // Stop at the end of the line.
+            uint_fast64_t lastState = state;
+            state = checked_strtol(buf, &buf, chunkEnd);
+
+            // If the state has already been read or skipped once there might be a problem with the file (doubled lines, or blocks).
+            if (hasState && state <= lastState) {
+                STORM_LOG_ERROR("Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.");
+                throw storm::exceptions::WrongFormatException()
+                    << "Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.";
+            }
+            if (!hasState) {
+                itemRange.first = state;
+            }
+            itemRange.second = state;
+            hasState = true;
+
+            while (buf < chunkEnd && (buf[0] != '\r') && (buf[0] != '\n') && (buf[0] != '\0')) {
+                cnt = skipWord(buf) - buf;
+                if (cnt == 0) {
+                    // The next character is a separator.
+                    // If it is a line separator, we continue with next node.
+                    // Otherwise, we skip it and try again.
+                    if (buf[0] == '\n' || buf[0] == '\r')
+                        break;
+                    buf++;
                 } else {
-                    STORM_LOG_ASSERT(labeling.isChoiceLabeling(), "Unexpected labeling type");
-                    labeling.asChoiceLabeling().addLabelToChoice(proposition, state);
+                    // Has the label been declared in the header?
+                    std::string proposition(buf, cnt);
+                    auto labelIt = labelIndices.find(proposition);
+                    if (labelIt == labelIndices.end()) {
+                        STORM_LOG_ERROR("Error while parsing " << filename << ": Atomic proposition" << proposition << " was found but not declared.");
+                        throw storm::exceptions::WrongFormatException()
+                            << "Error while parsing " << filename << ": Atomic proposition" << proposition << " was found but not declared.";
+                    }
+                    STORM_LOG_THROW(state < itemCount, storm::exceptions::OutOfRangeException, "Item index out of range.");
+                    assignments.emplace_back(state, labelIt->second);
+                    buf += cnt;
                 }
-                buf += cnt;
             }
+            buf = trimWhitespaces(buf);
+        }
+    });
+
+    // Check the order of the states at the borders of the chunks.
+    bool hasState = false;
+    uint_fast64_t lastState = 0;
+    for (auto const& itemRange : itemRangeOfChunks) {
+        if (itemRange.first > itemRange.second) {
+            // The chunk does not contain any state.
+            continue;
+        }
+        if (hasState && itemRange.first <= lastState) {
+            STORM_LOG_ERROR("Error while parsing " << filename << ": State " << itemRange.first
+                                                   << " was found but has already been read or skipped previously.");
+            throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": State " << itemRange.first
+                                                            << " was found but has already been read or skipped previously.";
+        }
+        hasState = true;
+        lastState = itemRange.second;
+    }
+
+    // Finally, add the assignments to the labeling.
+    std::vector<storm::storage::BitVector> itemsOfLabels;
+    itemsOfLabels.reserve(labelNames.size());
+    for (auto const& label : labelNames) {
+        itemsOfLabels.push_back(labeling.isStateLabeling() ? labeling.asStateLabeling().getStates(label) : labeling.asChoiceLabeling().getChoices(label));
+    }
+    for (auto const& assignments : assignmentsOfChunks) {
+        for (auto const& assignment : assignments) {
+            itemsOfLabels[assignment.second].set(assignment.first, true);
+        }
+    }
+    for (uint_fast64_t labelIndex = 0; labelIndex < labelNames.size(); ++labelIndex) {
+        if (labeling.isStateLabeling()) {
+            labeling.asStateLabeling().setStates(labelNames[labelIndex], std::move(itemsOfLabels[labelIndex]));
+        } else {
+            STORM_LOG_ASSERT(labeling.isChoiceLabeling(), "Unexpected labeling type");
+            labeling.asChoiceLabeling().setChoices(labelNames[labelIndex], std::move(itemsOfLabels[labelIndex]));
         }
-        buf = trimWhitespaces(buf);
-        lastState = state;
     }
 }
 
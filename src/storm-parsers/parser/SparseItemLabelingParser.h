@@ -55,11 +55,14 @@ class SparseItemLabelingParser {
     /*!
      * Parses the label assignments assuming that each item is uniquely specified by a single index, e.g.,
      *  * 42 label1 label2 label3
+     * The assignments are split into chunks of lines that are parsed in parallel (if enabled).
      *
      * @param labeling the labeling to which file assignments are added
-     * @param buf the reference to the file contents
+     * @param begin the beginning of the assignments in the file contents
+     * @param end the end of the file contents
      */
-    static void parseDeterministicLabelAssignments(std::string const& filename, storm::models::sparse::ItemLabeling& labeling, char const*& buf);
+    static void parseDeterministicLabelAssignments(std::string const& filename, storm::models::sparse::ItemLabeling& labeling, char const* begin,
+                                                   char const* end);
 
     /*!
      * Parses the label assignments assuming that each item is specified by a tuple of indices, e.g.,
@@ -1,6 +1,8 @@
 #include "storm-parsers/parser/SparseStateRewardParser.h"
 #include <iostream>
+#include <utility>
 
+#include "storm-parsers/parser/FileChunks.h"
 #include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/util/cstring.h"
 #include "storm/exceptions/FileIoException.h"
@@ -18,51 +20,74 @@ template<typename ValueType>
 std::vector<ValueType> SparseStateRewardParser<ValueType>::parseSparseStateReward(uint_fast64_t stateCount, std::string const& filename) {
     // Open file.
     MappedFile file(filename.c_str());
-    char const* buf = file.getData();
 
-    // Create state reward vector with given state count.
-    std::vector<ValueType> stateRewards(stateCount);
-
-    // Now parse state reward assignments.
-    uint_fast64_t state = 0;
-    uint_fast64_t lastState = (uint_fast64_t)-1;
-    uint_fast64_t const startIndexComparison = lastState;
-    double reward;
-
-    // Iterate over states.
-    while (buf[0] != '\0') {
-        // Parse state.
-        state = checked_strtol(buf, &buf);
-
-        // If the state has already been read or skipped once there might be a problem with the file (doubled lines, or blocks).
-        // Note: The value -1 shows that lastState has not yet been set, i.e. this is the first run of the loop (state index (2^64)-1 is a really bad starting
-        // index).
-        if (state <= lastState && lastState != startIndexComparison) {
-            STORM_LOG_ERROR("Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.");
-            throw storm::exceptions::WrongFormatException()
-                << "Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.";
+    // Parse the state reward assignments of all chunks of the file. As the chunks are parsed independently, the assignments are collected and
+    // only written to the reward vector once their order has been checked over the whole file.
+    FileChunks chunks(file.getData(), file.getDataEnd());
+    std::vector<std::vector<std::pair<uint_fast64_t, double>>> assignmentsOfChunks(chunks.size());
+    chunks.forEach([&](uint64_t chunk) {
+        auto& assignments = assignmentsOfChunks[chunk];
+        uint_fast64_t state = 0;
+        double reward;
+
+        // Iterate over states.
+        char const* buf = trimWhitespaces(chunks.getBegin(chunk));
+        char const* chunkEnd = chunks.getEnd(chunk);
+        while (buf < chunkEnd) {
+            // Parse state.
+            state = checked_strtol(buf, &buf, chunkEnd);
+
+            // If the state has already been read or skipped once there might be a problem with the file (doubled lines, or blocks).
+            if (!assignments.empty() && state <= assignments.back().first) {
+                STORM_LOG_ERROR("Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.");
+                throw storm::exceptions::WrongFormatException()
+                    << "Error while parsing " << filename << ": State " << state << " was found but has already been read or skipped previously.";
+            }
+
+            if (stateCount <= state) {
+                STORM_LOG_ERROR("Error while parsing " << filename << ": Found reward for a state of an invalid index \"" << state << "\". The model has only "
+                                                       << stateCount << " states.");
+                throw storm::exceptions::OutOfRangeException()
+                    << "Error while parsing " << filename << ": Found reward for a state of an invalid index \"" << state << "\"";
+            }
+
+            // Parse reward value.
+            reward = checked_strtod(buf, &buf, chunkEnd);
+
+            if (reward < 0.0) {
+                STORM_LOG_ERROR("Error while parsing " << filename << ": Expected positive reward value but got \"" << reward << "\".");
+                throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": State reward file specifies illegal reward value.";
+            }
+
+            assignments.emplace_back(state, reward);
+            buf = trimWhitespaces(buf);
         }
-
-        if (stateCount <= state) {
-            STORM_LOG_ERROR("Error while parsing " << filename << ": Found reward for a state of an invalid index \"" << state << "\". The model has only "
-                                                   << stateCount << " states.");
-            throw storm::exceptions::OutOfRangeException()
-                << "Error while parsing " << filename << ": Found reward for a state of an invalid index \"" << state << "\"";
+    });
+
+    // Check the order of the states at the borders of the chunks.
+    bool hasState = false;
+    uint_fast64_t lastState = 0;
+    for (auto const& assignments : assignmentsOfChunks) {
+        if (assignments.empty()) {
+            continue;
         }
-
-        // Parse reward value.
-        reward = checked_strtod(buf, &buf);
-
-        if (reward < 0.0) {
-            STORM_LOG_ERROR("Error while parsing " << filename << ": Expected positive reward value but got \"" << reward << "\".");
-            throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": State reward file specifies illegal reward value.";
+        if (hasState && assignments.front().first <= lastState) {
+            STORM_LOG_ERROR("Error while parsing " << filename << ": State " << assignments.front().first
+                                                   << " was found but has already been read or skipped previously.");
+            throw storm::exceptions::WrongFormatException() << "Error while parsing " << filename << ": State " << assignments.front().first
+                                                            << " was found but has already been read or skipped previously.";
         }
-
-        stateRewards[state] = reward;
-
-        buf = trimWhitespaces(buf);
-        lastState = state;
+        hasState = true;
+        lastState = assignments.back().first;
     }
+
+    // Create state reward vector with given state count and insert the rewards.
+    std::vector<ValueType> stateRewards(stateCount);
+    chunks.forEach([&](uint64_t chunk) {
+        for (auto const& assignment : assignmentsOfChunks[chunk]) {
+            stateRewards[assignment.first] = assignment.second;
+        }
+    });
     return stateRewards;
 }
 
@@ -1,5 +1,6 @@
 #include "storm-parsers/util/cstring.h"
 
+#include <charconv>
 #include <cstring>
 
 #include "storm/exceptions/WrongFormatException.h"
@@ -10,16 +11,57 @@ namespace utility {
 
 namespace cstring {
 
+namespace {
 /*!
- *	Calls strtol() internally and checks if the new pointer is different
- *	from the original one, i.e. if str != *end. If they are the same, a
- *	storm::exceptions::WrongFormatException will be thrown.
+ * Tries to parse the whitespace-delimited token at the given position with std::from_chars, which is considerably faster than the strto*
+ * functions as it neither depends on the locale nor accepts as many formats. The parsing only succeeds if the complete token is consumed.
+ * Otherwise, the caller falls back to the corresponding strto* function, which therefore still determines the accepted formats.
+ *
+ * @param str String to parse
+ * @param dataEnd If given, no character at or after this position is read. Otherwise, the string has to be terminated by a null character.
+ * @param end If the parsing succeeded, the position after the token is written there
+ * @param result If the parsing succeeded, the parsed number is written there
+ * @return True iff the parsing succeeded.
+ */
+template<typename NumberType>
+bool fastParse(char const* str, char const* dataEnd, char const** end, NumberType& result) {
+    auto isInData = [dataEnd](char const* position) { return dataEnd == nullptr || position < dataEnd; };
+    char const* tokenBegin = str;
+    while (isInData(tokenBegin) && isspace(*tokenBegin)) {
+        ++tokenBegin;
+    }
+    char const* tokenEnd = tokenBegin;
+    while (isInData(tokenEnd) && !isspace(*tokenEnd) && *tokenEnd != '\0') {
+        ++tokenEnd;
+    }
+    // A leading '+' is accepted by the strto* functions, but not by std::from_chars. The character after the '+' is only inspected if it belongs to
+    // the token.
+    if (tokenEnd - tokenBegin > 1 && *tokenBegin == '+' && tokenBegin[1] != '-') {
+        ++tokenBegin;
+    }
+    auto parseResult = std::from_chars(tokenBegin, tokenEnd, result);
+    if (parseResult.ec != std::errc() || parseResult.ptr != tokenEnd) {
+        return false;
+    }
+    *end = tokenEnd;
+    return true;
+}
+}  // namespace
+
+/*!
+ *	Parses the next token with std::from_chars if possible and calls strtol() otherwise. In the latter case, it checks if the new pointer is
+ *	different from the original one, i.e. if str != *end. If they are the same, a storm::exceptions::WrongFormatException will be thrown.
  *	@param str String to parse
  *	@param end New pointer will be written there
- *	@return Result of strtol()
+ *	@param dataEnd If given, the fast path does not read at or after this position
+ *	@return The parsed number
  */
-uint_fast64_t checked_strtol(char const* str, char const** end) {
-    uint_fast64_t res = strtol(str, const_cast<char**>(end), 10);
+uint_fast64_t checked_strtol(char const* str, char const** end, char const* dataEnd) {
+    uint_fast64_t res;
+    if (fastParse(str, dataEnd, end, res)) {
+        return res;
+    }
+    res = strtol(str, const_cast<char**>(end), 10);
     if (str == *end) {
         STORM_LOG_ERROR("Error while parsing integer. Next input token is not a number.");
         STORM_LOG_ERROR("\tUpcoming input is: \"" << std::string(str, 0, 16) << "\"");
@@ -29,15 +71,22 @@ uint_fast64_t checked_strtol(char const* str, char const** end) {
 }
 
 /*!
- *	Calls strtod() internally and checks if the new pointer is different
- *	from the original one, i.e. if str != *end. If they are the same, a
+ *	Parses the next token with std::from_chars if possible (and supported by the standard library) and calls strtod() otherwise. In the
+ *	latter case, it checks if the new pointer is different from the original one, i.e. if str != *end. If they are the same, a
  *	storm::exceptions::WrongFormatException will be thrown.
  *	@param str String to parse
  *	@param end New pointer will be written there
- *	@return Result of strtod()
+ *	@param dataEnd If given, the fast path does not read at or after this position
+ *	@return The parsed number
  */
-double checked_strtod(char const* str, char const** end) {
-    double res = strtod(str, const_cast<char**>(end));
+double checked_strtod(char const* str, char const** end, char const* dataEnd) {
+    double res;
+#ifdef __cpp_lib_to_chars
+    if (fastParse(str, dataEnd, end, res)) {
+        return res;
+    }
+#endif
+    res = strtod(str, const_cast<char**>(end));
     if (str == *end) {
         STORM_LOG_ERROR("Error while parsing floating point. Next input token is not a number.");
         STORM_LOG_ERROR("\tUpcoming input is: \"" << std::string(str, 0, 16) << "\"");
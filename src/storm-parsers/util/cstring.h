@@ -8,13 +8,15 @@ namespace cstring {
 
 /*!
  *	@brief Parses integer and checks, if something has been parsed.
+ *	If the end of the data is given, the common case of a plain number is parsed without reading beyond it.
  */
-uint_fast64_t checked_strtol(const char* str, char const** end);
+uint_fast64_t checked_strtol(const char* str, char const** end, char const* dataEnd = nullptr);
 
 /*!
  *	@brief Parses floating point and checks, if something has been parsed.
+ *	If the end of the data is given, the common case of a plain number is parsed without reading beyond it.
  */
-double checked_strtod(const char* str, char const** end);
+double checked_strtod(const char* str, char const** end, char const* dataEnd = nullptr);
 
 /*!
  * @brief Skips all non whitespace characters until the next whitespace.
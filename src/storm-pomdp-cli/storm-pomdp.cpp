@@ -156,6 +156,7 @@ namespace storm {
                 storm::storage::BitVector surelyNotAlmostSurelyReachTarget = qualitativeAnalysis.analyseProbSmaller1(
                         formula.asProbabilityOperatorFormula());
                 pomdp.getTransitionMatrix().makeRowGroupsAbsorbing(surelyNotAlmostSurelyReachTarget);
+                pomdp.clearQualitativeAnalysisCache();
                 storm::storage::BitVector targetStates = qualitativeAnalysis.analyseProb1(formula.asProbabilityOperatorFormula());
                 bool computedSomething = false;
                 if (qualSettings.isMemlessSearchSet()) {
@@ -11,6 +11,7 @@
 #include "storm/modelchecker/csl/SparseCtmcCslModelChecker.h"
 #include "storm/modelchecker/csl/SparseMarkovAutomatonCslModelChecker.h"
 #include "storm/modelchecker/exploration/SparseExplorationModelChecker.h"
+#include "storm/modelchecker/smc/SmcModelChecker.h"
 #include "storm/modelchecker/prctl/HybridDtmcPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/HybridMdpPrctlModelChecker.h"
 #include "storm/modelchecker/prctl/SparseDtmcPrctlModelChecker.h"
@@ -183,6 +184,51 @@ std::unique_ptr<storm::modelchecker::CheckResult> verifyWithExplorationEngine(st
     return verifyWithExplorationEngine(env, model, task);
 }
 
+//
+// Verifying with statistical model checking engine
+//
+template<typename ValueType>
+typename std::enable_if<std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSmcEngine(
+    storm::Environment const& env, storm::storage::SymbolicModelDescription const& model,
+    storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    std::unique_ptr<storm::modelchecker::CheckResult> result;
+    storm::storage::SymbolicModelDescription::ModelType modelType = model.getModelType();
+    if (modelType == storm::storage::SymbolicModelDescription::ModelType::DTMC) {
+        storm::modelchecker::SmcModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(model);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else if (modelType == storm::storage::SymbolicModelDescription::ModelType::CTMC) {
+        storm::modelchecker::SmcModelChecker<storm::models::sparse::Ctmc<ValueType>> checker(model);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else if (modelType == storm::storage::SymbolicModelDescription::ModelType::MDP) {
+        storm::modelchecker::SmcModelChecker<storm::models::sparse::Mdp<ValueType>> checker(model);
+        if (checker.canHandle(task)) {
+            result = checker.check(env, task);
+        }
+    } else {
+        STORM_LOG_THROW(false, storm::exceptions::NotSupportedException,
+                        "The model type " << modelType << " is not supported by the statistical model checking engine.");
+    }
+
+    return result;
+}
+
+template<typename ValueType>
+typename std::enable_if<!std::is_same<ValueType, double>::value, std::unique_ptr<storm::modelchecker::CheckResult>>::type verifyWithSmcEngine(
+    storm::Environment const&, storm::storage::SymbolicModelDescription const&, storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const&) {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "Statistical model checking engine does not support data type.");
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::modelchecker::CheckResult> verifyWithSmcEngine(storm::storage::SymbolicModelDescription const& model,
+                                                                      storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> const& task) {
+    Environment env;
+    return verifyWithSmcEngine(env, model, task);
+}
+
 //
 // Verifying with Sparse engine
 //
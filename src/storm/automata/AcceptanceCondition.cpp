@@ -79,6 +79,42 @@ bool AcceptanceCondition::isAccepting(const storm::storage::StateBlock& scc, acc
     throw std::runtime_error("Missing case statement");
 }
 
+bool AcceptanceCondition::isPossiblyAccepting(const storm::storage::BitVector& states) const {
+    return isAcceptingBound(states, acceptance, true);
+}
+
+bool AcceptanceCondition::isAcceptingBound(const storm::storage::BitVector& states, acceptance_expr::ptr expr, bool possibly) const {
+    switch (expr->getType()) {
+        case acceptance_expr::EXP_AND:
+            return isAcceptingBound(states, expr->getLeft(), possibly) && isAcceptingBound(states, expr->getRight(), possibly);
+        case acceptance_expr::EXP_OR:
+            return isAcceptingBound(states, expr->getLeft(), possibly) || isAcceptingBound(states, expr->getRight(), possibly);
+        case acceptance_expr::EXP_NOT:
+            return !isAcceptingBound(states, expr->getLeft(), !possibly);
+        case acceptance_expr::EXP_TRUE:
+            return true;
+        case acceptance_expr::EXP_FALSE:
+            return false;
+        case acceptance_expr::EXP_ATOM: {
+            const cpphoafparser::AtomAcceptance& atom = expr->getAtom();
+            const storm::storage::BitVector& acceptanceSet = acceptanceSets.at(atom.getAcceptanceSet());
+            // A negated Inf is a Fin and vice versa
+            bool inf = (atom.getType() == cpphoafparser::AtomAcceptance::TEMPORAL_INF) != atom.isNegated();
+            bool intersects = !acceptanceSet.isDisjointFrom(states);
+            bool contained = states.isSubsetOf(acceptanceSet);
+            if (inf) {
+                // Some cycle might visit the set / every cycle visits the set
+                return possibly ? intersects : contained;
+            } else {
+                // Some cycle might avoid the set / every cycle avoids the set
+                return possibly ? !contained : !intersects;
+            }
+        }
+    }
+
+    throw std::runtime_error("Missing case statement");
+}
+
 std::vector<std::vector<AcceptanceCondition::acceptance_expr::ptr>> AcceptanceCondition::extractFromDNF() const {
     std::vector<std::vector<AcceptanceCondition::acceptance_expr::ptr>> dnf;
 
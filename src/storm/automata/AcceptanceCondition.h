@@ -17,6 +17,12 @@ class AcceptanceCondition {
     AcceptanceCondition(std::size_t numberOfStates, unsigned int numberOfAcceptanceSets, acceptance_expr::ptr acceptance);
     bool isAccepting(const storm::storage::StateBlock& scc) const;
 
+    /*!
+     * Over-approximates whether some cycle visiting only the given states satisfies the acceptance condition.
+     * If false is returned, no such cycle is accepting.
+     */
+    bool isPossiblyAccepting(const storm::storage::BitVector& states) const;
+
     unsigned int getNumberOfAcceptanceSets() const;
     storm::storage::BitVector& getAcceptanceSet(unsigned int index);
     const storm::storage::BitVector& getAcceptanceSet(unsigned int index) const;
@@ -29,6 +35,10 @@ class AcceptanceCondition {
 
    private:
     bool isAccepting(const storm::storage::StateBlock& scc, acceptance_expr::ptr expr) const;
+    /*!
+     * If possibly is true, over-approximates whether a cycle within the given states satisfies expr. Otherwise, under-approximates it.
+     */
+    bool isAcceptingBound(const storm::storage::BitVector& states, acceptance_expr::ptr expr, bool possibly) const;
     void extractFromDNFRecursion(acceptance_expr::ptr e, std::vector<std::vector<acceptance_expr::ptr>>& dnf, bool topLevel) const;
 
     unsigned int numberOfAcceptanceSets;
@@ -1,11 +1,16 @@
 #include "storm/automata/DeterministicAutomaton.h"
 
+#include <algorithm>
+
 #include "cpphoafparser/consumer/hoa_intermediate_check_validity.hh"
 #include "cpphoafparser/parser/hoa_parser.hh"
 #include "cpphoafparser/parser/hoa_parser_helper.hh"
 
 #include "storm/automata/AcceptanceCondition.h"
 #include "storm/automata/HOAConsumerDA.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/FileIoException.h"
@@ -50,6 +55,37 @@ AcceptanceCondition::ptr DeterministicAutomaton::getAcceptance() const {
     return acceptance;
 }
 
+storm::storage::BitVector DeterministicAutomaton::getPossiblyAcceptingStates() const {
+    // Build the graph of the automaton, ignoring the labels
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfStates, numberOfStates);
+    std::vector<std::size_t> stateSuccessors;
+    for (std::size_t state = 0; state < numberOfStates; ++state) {
+        stateSuccessors.assign(successors.begin() + state * edgesPerState, successors.begin() + (state + 1) * edgesPerState);
+        std::sort(stateSuccessors.begin(), stateSuccessors.end());
+        stateSuccessors.erase(std::unique(stateSuccessors.begin(), stateSuccessors.end()), stateSuccessors.end());
+        for (auto successor : stateSuccessors) {
+            builder.addNextValue(state, successor, 1.0);
+        }
+    }
+    storm::storage::SparseMatrix<double> graph = builder.build();
+
+    // Every accepting run eventually stays in a non-trivial SCC. Collect the states of SCCs that might contain an accepting cycle.
+    storm::storage::BitVector acceptingSccStates(numberOfStates, false);
+    storm::storage::StronglyConnectedComponentDecomposition<double> sccs(graph,
+                                                                         storm::storage::StronglyConnectedComponentDecompositionOptions().dropNaiveSccs());
+    for (auto const& scc : sccs) {
+        storm::storage::BitVector sccStates(numberOfStates, false);
+        for (auto state : scc) {
+            sccStates.set(state);
+        }
+        if (acceptance->isPossiblyAccepting(sccStates)) {
+            acceptingSccStates |= sccStates;
+        }
+    }
+
+    return storm::utility::graph::performProbGreater0(graph.transpose(true), storm::storage::BitVector(numberOfStates, true), acceptingSccStates);
+}
+
 void DeterministicAutomaton::printHOA(std::ostream& out) const {
     out << "HOA: v1\n";
 
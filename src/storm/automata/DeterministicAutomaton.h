@@ -3,6 +3,7 @@
 #include <iostream>
 #include <memory>
 #include "storm/automata/APSet.h"
+#include "storm/storage/BitVector.h"
 
 namespace storm {
 namespace automata {
@@ -27,6 +28,12 @@ class DeterministicAutomaton {
 
     std::shared_ptr<AcceptanceCondition> getAcceptance() const;
 
+    /*!
+     * Computes the states from which an accepting run might start, i.e., the states that can reach a strongly connected component
+     * that possibly contains an accepting cycle. From all other states, no accepting run exists.
+     */
+    storm::storage::BitVector getPossiblyAcceptingStates() const;
+
     void printHOA(std::ostream& out) const;
 
     static DeterministicAutomaton::ptr parse(std::istream& in);
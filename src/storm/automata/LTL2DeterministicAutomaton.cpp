@@ -8,6 +8,9 @@
 #include "storm/utility/macros.h"
 
 #include <sys/wait.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
 
 #ifdef STORM_HAVE_SPOT
 #include "spot/tl/formula.hh"
@@ -65,16 +68,27 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daSpot(s
 std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExternalTool(storm::logic::Formula const& f, std::string ltl2daTool) {
     std::string prefixLtl = f.toPrefixString();
 
-    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' da.hoa");
+    // Every call uses its own file for the automaton as several automata might be constructed concurrently.
+    char const* temporaryDirectory = std::getenv("TMPDIR");
+    std::string automatonFile = std::string(temporaryDirectory != nullptr ? temporaryDirectory : "/tmp") + "/storm-da-XXXXXX.hoa";
+    int fileDescriptor = mkstemps(&automatonFile[0], 4);
+    STORM_LOG_THROW(fileDescriptor >= 0, storm::exceptions::FileIoException,
+                    "Could not construct deterministic automaton, creating a temporary file failed: " << strerror(errno));
+    close(fileDescriptor);
+
+    STORM_LOG_INFO("Calling external LTL->DA tool:   " << ltl2daTool << " '" << prefixLtl << "' " << automatonFile);
 
     pid_t pid;
 
     pid = fork();
-    STORM_LOG_THROW(pid >= 0, storm::exceptions::FileIoException, "Could not construct deterministic automaton, fork failed");
+    if (pid < 0) {
+        std::remove(automatonFile.c_str());
+        STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Could not construct deterministic automaton, fork failed");
+    }
 
     if (pid == 0) {
         // we are in the child process
-        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), "da.hoa", NULL) < 0) {
+        if (execlp(ltl2daTool.c_str(), ltl2daTool.c_str(), prefixLtl.c_str(), automatonFile.c_str(), NULL) < 0) {
             std::cerr << "ERROR: exec failed: " << strerror(errno) << '\n';
             std::exit(1);
         }
@@ -83,22 +97,32 @@ std::shared_ptr<DeterministicAutomaton> LTL2DeterministicAutomaton::ltl2daExtern
     } else {  // in the parent
         int status;
 
-        // wait for completion
-        while (wait(&status) != pid)
+        // wait for completion of this child only, other threads might wait for their own children
+        while (waitpid(pid, &status, 0) < 0 && errno == EINTR)
             ;
 
-        int rv;
+        int rv = -1;
         if (WIFEXITED(status)) {
             rv = WEXITSTATUS(status);
-        } else {
-            STORM_LOG_THROW(false, storm::exceptions::FileIoException, "Could not construct deterministic automaton: process aborted");
         }
-        STORM_LOG_THROW(rv == 0, storm::exceptions::FileIoException,
-                        "Could not construct deterministic automaton for " << prefixLtl << ", return code = " << rv);
+        if (rv != 0) {
+            std::remove(automatonFile.c_str());
+            STORM_LOG_THROW(WIFEXITED(status), storm::exceptions::FileIoException, "Could not construct deterministic automaton: process aborted");
+            STORM_LOG_THROW(false, storm::exceptions::FileIoException,
+                            "Could not construct deterministic automaton for " << prefixLtl << ", return code = " << rv);
+        }
 
-        STORM_LOG_INFO("Reading automaton for " << prefixLtl << " from da.hoa");
+        STORM_LOG_INFO("Reading automaton for " << prefixLtl << " from " << automatonFile);
 
-        return DeterministicAutomaton::parseFromFile("da.hoa");
+        std::shared_ptr<DeterministicAutomaton> da;
+        try {
+            da = DeterministicAutomaton::parseFromFile(automatonFile);
+        } catch (...) {
+            std::remove(automatonFile.c_str());
+            throw;
+        }
+        std::remove(automatonFile.c_str());
+        return da;
     }
 }
 
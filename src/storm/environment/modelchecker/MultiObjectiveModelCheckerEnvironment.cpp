@@ -43,6 +43,7 @@ MultiObjectiveModelCheckerEnvironment::MultiObjectiveModelCheckerEnvironment() {
 
     printResults = multiobjectiveSettings.isPrintResultsSet();
     useLexicographicModelChecking = multiobjectiveSettings.isLexicographicModelCheckingSet();
+    weightVectorBatchSize = multiobjectiveSettings.getWeightVectorBatchSize();
 }
 
 MultiObjectiveModelCheckerEnvironment::~MultiObjectiveModelCheckerEnvironment() {
@@ -168,4 +169,13 @@ bool MultiObjectiveModelCheckerEnvironment::isLexicographicModelCheckingSet() co
 void MultiObjectiveModelCheckerEnvironment::setLexicographicModelChecking(bool value) {
     useLexicographicModelChecking = value;
 }
+
+uint64_t const& MultiObjectiveModelCheckerEnvironment::getWeightVectorBatchSize() const {
+    return weightVectorBatchSize;
+}
+
+void MultiObjectiveModelCheckerEnvironment::setWeightVectorBatchSize(uint64_t const& value) {
+    STORM_LOG_THROW(value > 0, storm::exceptions::IllegalArgumentException, "The weight vector batch size must be positive.");
+    weightVectorBatchSize = value;
+}
 }  // namespace storm
\ No newline at end of file
@@ -25,6 +25,7 @@ MinMaxSolverEnvironment::MinMaxSolverEnvironment() {
                      "Unknown convergence criterion");
     multiplicationStyle = minMaxSettings.getValueIterationMultiplicationStyle();
     symmetricUpdates = minMaxSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    policyIterationInPlaceUpdates = minMaxSettings.isPolicyIterationInPlaceUpdatesSet();
 }
 
 MinMaxSolverEnvironment::~MinMaxSolverEnvironment() {
@@ -84,4 +85,12 @@ void MinMaxSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+bool MinMaxSolverEnvironment::isPolicyIterationInPlaceUpdatesSet() const {
+    return policyIterationInPlaceUpdates;
+}
+
+void MinMaxSolverEnvironment::setPolicyIterationInPlaceUpdates(bool value) {
+    policyIterationInPlaceUpdates = value;
+}
+
 }  // namespace storm
@@ -26,6 +26,8 @@ class MinMaxSolverEnvironment {
     void setMultiplicationStyle(storm::solver::MultiplicationStyle value);
     bool isSymmetricUpdatesSet() const;
     void setSymmetricUpdates(bool value);
+    bool isPolicyIterationInPlaceUpdatesSet() const;
+    void setPolicyIterationInPlaceUpdates(bool value);
 
    private:
     storm::solver::MinMaxMethod minMaxMethod;
@@ -35,5 +37,6 @@ class MinMaxSolverEnvironment {
     bool considerRelativeTerminationCriterion;
     storm::solver::MultiplicationStyle multiplicationStyle;
     bool symmetricUpdates;
+    bool policyIterationInPlaceUpdates;
 };
 }  // namespace storm
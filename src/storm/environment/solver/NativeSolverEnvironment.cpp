@@ -26,6 +26,8 @@ NativeSolverEnvironment::NativeSolverEnvironment() {
     powerMethodMultiplicationStyle = nativeSettings.getPowerMethodMultiplicationStyle();
     sorOmega = storm::utility::convertNumber<storm::RationalNumber>(nativeSettings.getOmega());
     symmetricUpdates = nativeSettings.isForceIntervalIterationSymmetricUpdatesSet();
+    preconditioner = nativeSettings.getPreconditioningMethod();
+    restartThreshold = nativeSettings.getRestartIterationCount();
 }
 
 NativeSolverEnvironment::~NativeSolverEnvironment() {
@@ -93,4 +95,20 @@ void NativeSolverEnvironment::setSymmetricUpdates(bool value) {
     symmetricUpdates = value;
 }
 
+storm::solver::NativeLinearEquationSolverPreconditioner const& NativeSolverEnvironment::getPreconditioner() const {
+    return preconditioner;
+}
+
+void NativeSolverEnvironment::setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value) {
+    preconditioner = value;
+}
+
+uint64_t const& NativeSolverEnvironment::getRestartThreshold() const {
+    return restartThreshold;
+}
+
+void NativeSolverEnvironment::setRestartThreshold(uint64_t value) {
+    restartThreshold = value;
+}
+
 }  // namespace storm
@@ -28,6 +28,10 @@ class NativeSolverEnvironment {
     void setSorOmega(storm::RationalNumber const& value);
     bool isSymmetricUpdatesSet() const;
     void setSymmetricUpdates(bool value);
+    storm::solver::NativeLinearEquationSolverPreconditioner const& getPreconditioner() const;
+    void setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner value);
+    uint64_t const& getRestartThreshold() const;
+    void setRestartThreshold(uint64_t value);
 
    private:
     storm::solver::NativeLinearEquationSolverMethod method;
@@ -38,5 +42,7 @@ class NativeSolverEnvironment {
     storm::solver::MultiplicationStyle powerMethodMultiplicationStyle;
     storm::RationalNumber sorOmega;
     bool symmetricUpdates;
+    storm::solver::NativeLinearEquationSolverPreconditioner preconditioner;
+    uint64_t restartThreshold;
 };
 }  // namespace storm
@@ -5,6 +5,7 @@
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/settings/modules/ResourceSettings.h"
 #include "storm/utility/macros.h"
 
 #include "storm/exceptions/InvalidEnvironmentException.h"
@@ -15,9 +16,21 @@ namespace storm {
 SolverEnvironment::SolverEnvironment() {
     auto generalSettings = storm::settings::getModule<storm::settings::modules::GeneralSettings>();
     forceSoundness = generalSettings.isSoundSet();
+    forceDirectedRounding = generalSettings.isSoundWithDirectedRoundingSet();
     forceExact = generalSettings.isExactSet() || generalSettings.isExactFinitePrecisionSet();
     linearEquationSolverType = storm::settings::getModule<storm::settings::modules::CoreSettings>().getEquationSolver();
     linearEquationSolverTypeSetFromDefault = storm::settings::getModule<storm::settings::modules::CoreSettings>().isEquationSolverSetFromDefaultValue();
+    checkpointInterval = 0;
+    if (storm::settings::manager().hasModule(storm::settings::modules::ResourceSettings::moduleName)) {
+        auto const& resourceSettings = storm::settings::getModule<storm::settings::modules::ResourceSettings>();
+        if (resourceSettings.isCheckpointSet()) {
+            checkpointFilename = resourceSettings.getCheckpointFilename();
+            checkpointInterval = resourceSettings.getCheckpointIntervalInSeconds();
+        }
+        if (resourceSettings.isResumeSet()) {
+            resumeFilename = resourceSettings.getResumeFilename();
+        }
+    }
 }
 
 SolverEnvironment::~SolverEnvironment() {
@@ -112,6 +125,14 @@ void SolverEnvironment::setForceSoundness(bool value) {
     SolverEnvironment::forceSoundness = value;
 }
 
+bool SolverEnvironment::isForceDirectedRounding() const {
+    return forceDirectedRounding;
+}
+
+void SolverEnvironment::setForceDirectedRounding(bool value) {
+    SolverEnvironment::forceDirectedRounding = value;
+}
+
 bool SolverEnvironment::isForceExact() const {
     return forceExact;
 }
@@ -148,6 +169,7 @@ std::pair<boost::optional<storm::RationalNumber>, boost::optional<bool>> SolverE
             result.second = native().getRelativeTerminationCriterion();
             break;
         case storm::solver::EquationSolverType::Elimination:
+        case storm::solver::EquationSolverType::Modular:
             break;
         case storm::solver::EquationSolverType::Topological:
             result = getPrecisionOfLinearEquationSolver(topological().getUnderlyingEquationSolverType());
@@ -165,17 +187,42 @@ void SolverEnvironment::setLinearEquationSolverPrecision(boost::optional<storm::
                          getLinearEquationSolverType() == storm::solver::EquationSolverType::Gmmxx ||
                          getLinearEquationSolverType() == storm::solver::EquationSolverType::Eigen ||
                          getLinearEquationSolverType() == storm::solver::EquationSolverType::Elimination ||
+                         getLinearEquationSolverType() == storm::solver::EquationSolverType::Modular ||
                          getLinearEquationSolverType() == storm::solver::EquationSolverType::Topological,
                      "The current solver type is not respected in this method.");
     if (newPrecision) {
         native().setPrecision(newPrecision.get());
         gmmxx().setPrecision(newPrecision.get());
         eigen().setPrecision(newPrecision.get());
-        // Elimination and Topological solver do not have a precision
+        // Elimination, Modular and Topological solver do not have a precision
     }
     if (relativePrecision) {
         native().setRelativeTerminationCriterion(relativePrecision.get());
-        // gmm, eigen, elimination, and topological solvers do not have a precision
+        // gmm, eigen, elimination, modular, and topological solvers do not have a precision
     }
 }
+
+boost::optional<std::string> const& SolverEnvironment::getCheckpointFilename() const {
+    return checkpointFilename;
+}
+
+void SolverEnvironment::setCheckpointFilename(boost::optional<std::string> const& value) {
+    checkpointFilename = value;
+}
+
+uint64_t SolverEnvironment::getCheckpointInterval() const {
+    return checkpointInterval;
+}
+
+void SolverEnvironment::setCheckpointInterval(uint64_t value) {
+    checkpointInterval = value;
+}
+
+boost::optional<std::string> const& SolverEnvironment::getResumeFilename() const {
+    return resumeFilename;
+}
+
+void SolverEnvironment::setResumeFilename(boost::optional<std::string> const& value) {
+    resumeFilename = value;
+}
 }  // namespace storm
@@ -2,6 +2,7 @@
 
 #include <boost/optional.hpp>
 #include <memory>
+#include <string>
 
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/Environment.h"
@@ -50,6 +51,8 @@ class SolverEnvironment {
 
     bool isForceSoundness() const;
     void setForceSoundness(bool value);
+    bool isForceDirectedRounding() const;
+    void setForceDirectedRounding(bool value);
     bool isForceExact() const;
     void setForceExact(bool value);
 
@@ -62,6 +65,13 @@ class SolverEnvironment {
     void setLinearEquationSolverPrecision(boost::optional<storm::RationalNumber> const& newPrecision,
                                           boost::optional<bool> const& relativePrecision = boost::none);
 
+    boost::optional<std::string> const& getCheckpointFilename() const;
+    void setCheckpointFilename(boost::optional<std::string> const& value);
+    uint64_t getCheckpointInterval() const;
+    void setCheckpointInterval(uint64_t value);
+    boost::optional<std::string> const& getResumeFilename() const;
+    void setResumeFilename(boost::optional<std::string> const& value);
+
    private:
     SubEnvironment<EigenSolverEnvironment> eigenSolverEnvironment;
     SubEnvironment<GmmxxSolverEnvironment> gmmxxSolverEnvironment;
@@ -77,6 +87,10 @@ class SolverEnvironment {
     storm::solver::EquationSolverType linearEquationSolverType;
     bool linearEquationSolverTypeSetFromDefault;
     bool forceSoundness;
+    bool forceDirectedRounding;
     bool forceExact;
+    boost::optional<std::string> checkpointFilename;
+    uint64_t checkpointInterval;
+    boost::optional<std::string> resumeFilename;
 };
 }  // namespace storm
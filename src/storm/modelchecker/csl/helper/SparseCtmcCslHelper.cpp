@@ -10,6 +10,7 @@
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/multiplier/Multiplier.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
 
 #include "storm/storage/StronglyConnectedComponentDecomposition.h"
 
@@ -683,10 +684,23 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
 
     STORM_LOG_DEBUG("Starting iterations with " << uniformizedMatrix.getRowCount() << " x " << uniformizedMatrix.getColumnCount() << " matrix.");
 
+    // The checkpoint is identified by the truncation points, the matrix and the initial values.
+    storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env,
+                                                                  "ctmc-transient-" + std::string(useMixedPoissonProbabilities ? "mixed-" : "") +
+                                                                      std::to_string(foxGlynnResult.left) + "-" + std::to_string(foxGlynnResult.right),
+                                                                  uniformizedMatrix, {addVector, &values});
+    typename storm::solver::helper::SolverCheckpoint<ValueType>::State checkpointState;
+    bool resumed = checkpoint.restore(checkpointState, 2, values.size());
+
     // Initialize result.
     std::vector<ValueType> result;
     uint_fast64_t startingIteration = foxGlynnResult.left;
-    if (startingIteration == 0) {
+    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
+    if (resumed) {
+        values = std::move(checkpointState.vectors[0]);
+        result = std::move(checkpointState.vectors[1]);
+        startingIteration = checkpointState.iterations;
+    } else if (startingIteration == 0) {
         result = values;
         storm::utility::vector::scaleVectorInPlace(result, foxGlynnResult.weights.front());
         ++startingIteration;
@@ -702,11 +716,11 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
         }
     }
 
-    auto multiplier = storm::solver::MultiplierFactory<ValueType>().create(env, uniformizedMatrix);
-    if (!useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
+    // If the computation was resumed, the iterations below the left truncation point have already been performed.
+    if (!resumed && !useMixedPoissonProbabilities && foxGlynnResult.left > 1) {
         // Perform the matrix-vector multiplications (without adding).
         multiplier->repeatedMultiply(env, values, addVector, foxGlynnResult.left - 1);
-    } else if (useMixedPoissonProbabilities) {
+    } else if (!resumed && useMixedPoissonProbabilities) {
         std::function<ValueType(ValueType const&, ValueType const&)> addAndScale = [&uniformizationRate](ValueType const& a, ValueType const& b) {
             return a + b / uniformizationRate;
         };
@@ -731,6 +745,10 @@ std::vector<ValueType> SparseCtmcCslHelper::computeTransientProbabilities(Enviro
 
         weight = foxGlynnResult.weights[index - foxGlynnResult.left];
         storm::utility::vector::applyPointwise(result, values, result, addAndScale);
+
+        if (index < foxGlynnResult.right) {
+            checkpoint.writeIfDue(index + 1, {&values, &result});
+        }
     }
 
     // Finally, divide the result by the total weight
@@ -87,7 +87,8 @@ storm::storage::BitVector SparseLTLHelper<ValueType, Nondeterministic>::computeA
 
     for (auto const& conjunction : dnf) {
         // Determine the set of states of the subMDP that can satisfy the condition, remove all states that would violate Fins in the conjunction.
-        storm::storage::BitVector allowed(transitionMatrix.getRowGroupCount(), true);
+        // Unexplored states are absorbing placeholders and never part of an accepting EC.
+        storm::storage::BitVector allowed = ~product->getUnexploredStates();
 
         for (auto const& literal : conjunction) {
             if (literal->isTRUE()) {
@@ -222,7 +223,8 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
                    << statesOfInterest.getNumberOfSetBits() << " model states...");
     transformer::DAProductBuilder productBuilder(da, statesForAP);
 
-    auto product = productBuilder.build<productModelType>(this->_transitionMatrix, statesOfInterest);
+    // Product states from which the automaton can not accept anymore are not explored further
+    auto product = productBuilder.build<productModelType>(this->_transitionMatrix, statesOfInterest, true);
 
     STORM_LOG_INFO("Product " + (Nondeterministic ? std::string("MDP-DA") : std::string("DTMC-DA")) + " has "
                    << product->getProductModel().getNumberOfStates() << " states and " << product->getProductModel().getNumberOfTransitions()
@@ -244,6 +246,7 @@ std::vector<ValueType> SparseLTLHelper<ValueType, Nondeterministic>::computeDAPr
     } else {
         STORM_LOG_INFO("Computing BSCCs and checking for acceptance...");
         acceptingStates = computeAcceptingBCCs(*product->getAcceptance(), product->getProductModel().getTransitionMatrix());
+        acceptingStates &= ~product->getUnexploredStates();
     }
 
     if (acceptingStates.empty()) {
@@ -69,6 +69,13 @@ class PcaaWeightVectorChecker {
      */
     virtual storm::storage::Scheduler<ValueType> computeScheduler() const;
 
+    /*!
+     * Uses the results of the most recent check of the given weight vector checker to obtain an initial guess for the next call of check(..).
+     * The given checker needs to consider the same preprocessed model and objectives. It may also be this checker.
+     * Checkers that do not support warm-starting ignore the provided results.
+     */
+    virtual void setWarmStart(PcaaWeightVectorChecker<ModelType> const& other);
+
    protected:
     /*!
      * Computes the weighted lower or upper bounds for the provided set of objectives.
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaParetoQuery.h"
 
+#include <algorithm>
+#include <numeric>
+
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/modelchecker/multiobjective/MultiObjectivePostprocessing.h"
@@ -64,37 +67,52 @@ void SparsePcaaParetoQuery<SparseModelType, GeometryValueType>::exploreSetOfAchi
                     storm::exceptions::IllegalArgumentException, "Unhandled multiobjective precision type.");
 
     // First consider the objectives individually
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env); ++objIndex) {
-        WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
-        direction[objIndex] = storm::utility::one<GeometryValueType>();
-        this->performRefinementStep(env, std::move(direction));
+    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size() && !this->maxStepsPerformed(env);) {
+        std::vector<WeightVector> directions;
+        for (uint64_t batchSize = this->getRefinementBatchSize(env); directions.size() < batchSize && objIndex < this->objectives.size(); ++objIndex) {
+            WeightVector direction(this->objectives.size(), storm::utility::zero<GeometryValueType>());
+            direction[objIndex] = storm::utility::one<GeometryValueType>();
+            directions.push_back(std::move(direction));
+        }
+        this->performRefinementSteps(env, std::move(directions));
         if (storm::utility::resources::isTerminate()) {
             break;
         }
     }
 
+    GeometryValueType const precision = storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision());
     while (!this->maxStepsPerformed(env) && !storm::utility::resources::isTerminate()) {
-        // Get the halfspace of the underApproximation with maximal distance to a vertex of the overApproximation
+        // Get the halfspaces of the underApproximation with maximal distance to a vertex of the overApproximation
         std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> underApproxHalfspaces = this->underApproximation->getHalfspaces();
         std::vector<Point> overApproxVertices = this->overApproximation->getVertices();
-        uint_fast64_t farestHalfspaceIndex = underApproxHalfspaces.size();
-        GeometryValueType farestDistance = storm::utility::zero<GeometryValueType>();
+        std::vector<GeometryValueType> halfspaceDistances(underApproxHalfspaces.size(), storm::utility::zero<GeometryValueType>());
         for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < underApproxHalfspaces.size(); ++halfspaceIndex) {
             for (auto const& vertex : overApproxVertices) {
                 GeometryValueType distance = underApproxHalfspaces[halfspaceIndex].euclideanDistance(vertex);
-                if (distance > farestDistance) {
-                    farestHalfspaceIndex = halfspaceIndex;
-                    farestDistance = distance;
+                if (distance > halfspaceDistances[halfspaceIndex]) {
+                    halfspaceDistances[halfspaceIndex] = distance;
                 }
             }
         }
-        if (farestDistance < storm::utility::convertNumber<GeometryValueType>(env.modelchecker().multi().getPrecision())) {
+        std::vector<uint_fast64_t> halfspaceOrder(underApproxHalfspaces.size());
+        std::iota(halfspaceOrder.begin(), halfspaceOrder.end(), 0);
+        std::stable_sort(halfspaceOrder.begin(), halfspaceOrder.end(),
+                         [&halfspaceDistances](uint_fast64_t lhs, uint_fast64_t rhs) { return halfspaceDistances[lhs] > halfspaceDistances[rhs]; });
+        if (halfspaceOrder.empty() || halfspaceDistances[halfspaceOrder.front()] < precision) {
             // Goal precision reached!
             return;
         }
-        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~" << storm::utility::convertNumber<double>(farestDistance));
-        WeightVector direction = underApproxHalfspaces[farestHalfspaceIndex].normalVector();
-        this->performRefinementStep(env, std::move(direction));
+        STORM_LOG_INFO("Current precision of the approximation of the pareto curve is ~"
+                       << storm::utility::convertNumber<double>(halfspaceDistances[halfspaceOrder.front()]));
+        // Refine in the directions of the farest halfspaces that do not yet meet the precision
+        std::vector<WeightVector> directions;
+        uint64_t const batchSize = this->getRefinementBatchSize(env);
+        for (auto halfspaceIndexIt = halfspaceOrder.begin();
+             directions.size() < batchSize && halfspaceIndexIt != halfspaceOrder.end() && halfspaceDistances[*halfspaceIndexIt] >= precision;
+             ++halfspaceIndexIt) {
+            directions.push_back(underApproxHalfspaces[*halfspaceIndexIt].normalVector());
+        }
+        this->performRefinementSteps(env, std::move(directions));
     }
     STORM_LOG_ERROR("Could not reach the desired precision: Termination requested or maximum number of refinement steps exceeded.");
 }
@@ -1,5 +1,8 @@
 #include "storm/modelchecker/multiobjective/pcaa/SparsePcaaQuery.h"
 
+#include <numeric>
+
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 #include "storm/environment/modelchecker/MultiObjectiveModelCheckerEnvironment.h"
 #include "storm/io/export.h"
@@ -12,6 +15,7 @@
 #include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/geometry/Hyperrectangle.h"
 #include "storm/utility/constants.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 #include "storm/exceptions/UnexpectedException.h"
@@ -29,8 +33,12 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::~SparsePcaaQuery() {
 
 template<class SparseModelType, typename GeometryValueType>
 SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType>& preprocessorResult)
-    : originalModel(preprocessorResult.originalModel), originalFormula(preprocessorResult.originalFormula), objectives(preprocessorResult.objectives) {
+    : originalModel(preprocessorResult.originalModel),
+      originalFormula(preprocessorResult.originalFormula),
+      objectives(preprocessorResult.objectives),
+      preprocessorResult(preprocessorResult) {
     this->weightVectorChecker = WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult);
+    this->lastCheckedWeightVectors.emplace_back();
 
     this->diracWeightVectorsToBeChecked = storm::storage::BitVector(this->objectives.size(), true);
     this->overApproximation = storm::storage::geometry::Polytope<GeometryValueType>::createUniversalPolytope();
@@ -40,15 +48,26 @@ SparsePcaaQuery<SparseModelType, GeometryValueType>::SparsePcaaQuery(preprocessi
 template<class SparseModelType, typename GeometryValueType>
 typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVector(
     Point const& pointToBeSeparated) {
-    STORM_LOG_DEBUG("Searching a weight vector to seperate the point given by "
-                    << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(pointToBeSeparated)) << ".");
+    return std::move(findSeparatingVectors(pointToBeSeparated, 1).front());
+}
+
+template<class SparseModelType, typename GeometryValueType>
+std::vector<typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector>
+SparsePcaaQuery<SparseModelType, GeometryValueType>::findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors) {
+    STORM_LOG_ASSERT(maxNumberOfVectors > 0, "Expected to search for at least one separating vector.");
+    STORM_LOG_DEBUG("Searching " << maxNumberOfVectors << " weight vector(s) to seperate the point given by "
+                                 << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(pointToBeSeparated)) << ".");
+    std::vector<WeightVector> result;
 
     if (underApproximation->isEmpty()) {
         // In this case, every weight vector is separating
-        uint_fast64_t objIndex = diracWeightVectorsToBeChecked.getNextSetIndex(0) % pointToBeSeparated.size();
-        WeightVector result(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
-        result[objIndex] = storm::utility::one<GeometryValueType>();
-        diracWeightVectorsToBeChecked.set(objIndex, false);
+        while (result.size() < maxNumberOfVectors && (result.empty() || !diracWeightVectorsToBeChecked.empty())) {
+            uint_fast64_t objIndex = diracWeightVectorsToBeChecked.getNextSetIndex(0) % pointToBeSeparated.size();
+            WeightVector dirac(pointToBeSeparated.size(), storm::utility::zero<GeometryValueType>());
+            dirac[objIndex] = storm::utility::one<GeometryValueType>();
+            diracWeightVectorsToBeChecked.set(objIndex, false);
+            result.push_back(std::move(dirac));
+        }
         return result;
     }
 
@@ -58,60 +77,160 @@ typename SparsePcaaQuery<SparseModelType, GeometryValueType>::WeightVector Spars
     STORM_LOG_ASSERT(!underApproximation->contains(pointToBeSeparated),
                      "Tried to find a separating point but the point is already contained in the underApproximation");
     std::vector<storm::storage::geometry::Halfspace<GeometryValueType>> halfspaces = underApproximation->getHalfspaces();
-    uint_fast64_t farestHalfspaceIndex = halfspaces.size();
-    GeometryValueType farestDistance = -storm::utility::one<GeometryValueType>();
-    bool foundSeparatingDiracVector = false;
-    for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < halfspaces.size(); ++halfspaceIndex) {
-        GeometryValueType distance = halfspaces[halfspaceIndex].euclideanDistance(pointToBeSeparated);
-        if (!storm::utility::isZero(distance)) {
-            storm::storage::BitVector nonZeroVectorEntries = ~storm::utility::vector::filterZero<GeometryValueType>(halfspaces[halfspaceIndex].normalVector());
-            bool isSingleObjectiveVector =
-                nonZeroVectorEntries.getNumberOfSetBits() == 1 && diracWeightVectorsToBeChecked.get(nonZeroVectorEntries.getNextSetIndex(0));
-            // Check if this halfspace is a better candidate than the current one
-            if ((!foundSeparatingDiracVector && isSingleObjectiveVector) ||
-                (foundSeparatingDiracVector == isSingleObjectiveVector && distance > farestDistance)) {
-                foundSeparatingDiracVector = foundSeparatingDiracVector || isSingleObjectiveVector;
-                farestHalfspaceIndex = halfspaceIndex;
-                farestDistance = distance;
+    std::vector<GeometryValueType> distances;
+    distances.reserve(halfspaces.size());
+    for (auto const& halfspace : halfspaces) {
+        distances.push_back(halfspace.euclideanDistance(pointToBeSeparated));
+    }
+    storm::storage::BitVector selectedHalfspaces(halfspaces.size(), false);
+    while (result.size() < maxNumberOfVectors) {
+        uint_fast64_t farestHalfspaceIndex = halfspaces.size();
+        GeometryValueType farestDistance = -storm::utility::one<GeometryValueType>();
+        bool foundSeparatingDiracVector = false;
+        for (uint_fast64_t halfspaceIndex = 0; halfspaceIndex < halfspaces.size(); ++halfspaceIndex) {
+            GeometryValueType const& distance = distances[halfspaceIndex];
+            if (!storm::utility::isZero(distance) && !selectedHalfspaces.get(halfspaceIndex)) {
+                storm::storage::BitVector nonZeroVectorEntries = ~storm::utility::vector::filterZero<GeometryValueType>(halfspaces[halfspaceIndex].normalVector());
+                bool isSingleObjectiveVector =
+                    nonZeroVectorEntries.getNumberOfSetBits() == 1 && diracWeightVectorsToBeChecked.get(nonZeroVectorEntries.getNextSetIndex(0));
+                // Check if this halfspace is a better candidate than the current one
+                if ((!foundSeparatingDiracVector && isSingleObjectiveVector) ||
+                    (foundSeparatingDiracVector == isSingleObjectiveVector && distance > farestDistance)) {
+                    foundSeparatingDiracVector = foundSeparatingDiracVector || isSingleObjectiveVector;
+                    farestHalfspaceIndex = halfspaceIndex;
+                    farestDistance = distance;
+                }
             }
         }
-    }
-    if (foundSeparatingDiracVector) {
-        diracWeightVectorsToBeChecked &= storm::utility::vector::filterZero<GeometryValueType>(halfspaces[farestHalfspaceIndex].normalVector());
+        if (farestHalfspaceIndex == halfspaces.size()) {
+            // No further separating halfspace
+            break;
+        }
+        if (foundSeparatingDiracVector) {
+            diracWeightVectorsToBeChecked &= storm::utility::vector::filterZero<GeometryValueType>(halfspaces[farestHalfspaceIndex].normalVector());
+        }
+        selectedHalfspaces.set(farestHalfspaceIndex, true);
+        STORM_LOG_DEBUG("Found separating weight vector: "
+                        << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(halfspaces[farestHalfspaceIndex].normalVector()))
+                        << ".");
+        result.push_back(halfspaces[farestHalfspaceIndex].normalVector());
     }
 
-    STORM_LOG_THROW(farestHalfspaceIndex < halfspaces.size(), storm::exceptions::UnexpectedException, "There is no seperating vector.");
-    STORM_LOG_DEBUG("Found separating weight vector: "
-                    << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(halfspaces[farestHalfspaceIndex].normalVector()))
-                    << ".");
-    return halfspaces[farestHalfspaceIndex].normalVector();
+    STORM_LOG_THROW(!result.empty(), storm::exceptions::UnexpectedException, "There is no seperating vector.");
+    return result;
 }
 
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementStep(Environment const& env, WeightVector&& direction) {
-    // Normalize the direction vector so that the entries sum up to one
-    storm::utility::vector::scaleVectorInPlace(
-        direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(), storm::utility::zero<GeometryValueType>()));
-    weightVectorChecker->check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(direction));
-    STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is " << storm::utility::vector::toString(
-                        storm::utility::vector::convertNumericVector<double>(weightVectorChecker->getUnderApproximationOfInitialStateResults())));
-    RefinementStep step;
-    step.weightVector = direction;
-    step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getUnderApproximationOfInitialStateResults());
-    step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(weightVectorChecker->getOverApproximationOfInitialStateResults());
-    // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
-    for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-        if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
-            step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
-            step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+    std::vector<WeightVector> directions;
+    directions.push_back(std::move(direction));
+    performRefinementSteps(env, std::move(directions));
+}
+
+template<class SparseModelType, typename GeometryValueType>
+void SparsePcaaQuery<SparseModelType, GeometryValueType>::performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions) {
+    STORM_LOG_ASSERT(!directions.empty(), "Expected at least one direction.");
+    bool const useBatches = env.modelchecker().multi().getWeightVectorBatchSize() > 1;
+    STORM_LOG_ASSERT(useBatches || directions.size() == 1, "Multiple directions given but weight vector batches are disabled.");
+
+    // Normalize the direction vectors so that the entries sum up to one
+    for (auto& direction : directions) {
+        storm::utility::vector::scaleVectorInPlace(direction, storm::utility::one<GeometryValueType>() / std::accumulate(direction.begin(), direction.end(),
+                                                                                                                        storm::utility::zero<GeometryValueType>()));
+    }
+
+    // Create the required weight vector checkers
+    while (additionalWeightVectorCheckers.size() + 1 < directions.size()) {
+        additionalWeightVectorCheckers.push_back(WeightVectorCheckerFactory<SparseModelType>::create(preprocessorResult));
+        lastCheckedWeightVectors.emplace_back();
+    }
+    auto getChecker = [this](uint64_t checkerIndex) -> PcaaWeightVectorChecker<SparseModelType>& {
+        return checkerIndex == 0 ? *weightVectorChecker : *additionalWeightVectorCheckers[checkerIndex - 1];
+    };
+
+    if (useBatches) {
+        // Warm-start each check with the results of the checker whose most recent weight vector is closest to the direction.
+        // This is done before any check is invoked so that the results of this round do not interfere.
+        for (uint64_t checkerIndex = 0; checkerIndex < directions.size(); ++checkerIndex) {
+            uint64_t closestChecker = lastCheckedWeightVectors.size();
+            GeometryValueType closestDistance = storm::utility::zero<GeometryValueType>();
+            for (uint64_t otherIndex = 0; otherIndex < lastCheckedWeightVectors.size(); ++otherIndex) {
+                auto const& otherWeightVector = lastCheckedWeightVectors[otherIndex];
+                if (otherWeightVector.empty()) {
+                    continue;
+                }
+                GeometryValueType distance = storm::utility::zero<GeometryValueType>();
+                for (uint64_t objIndex = 0; objIndex < otherWeightVector.size(); ++objIndex) {
+                    GeometryValueType difference = otherWeightVector[objIndex] - directions[checkerIndex][objIndex];
+                    distance += difference * difference;
+                }
+                if (closestChecker == lastCheckedWeightVectors.size() || distance < closestDistance) {
+                    closestChecker = otherIndex;
+                    closestDistance = distance;
+                }
+            }
+            if (closestChecker < lastCheckedWeightVectors.size()) {
+                getChecker(checkerIndex).setWarmStart(getChecker(closestChecker));
+            }
+        }
+        for (uint64_t checkerIndex = 1; checkerIndex < directions.size(); ++checkerIndex) {
+            getChecker(checkerIndex).setWeightedPrecision(weightVectorChecker->getWeightedPrecision());
+        }
+    }
+
+    auto checkDirection = [&](uint64_t checkerIndex) {
+        getChecker(checkerIndex).check(env, storm::utility::vector::convertNumericVector<typename SparseModelType::ValueType>(directions[checkerIndex]));
+    };
+    bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+    parallelize = directions.size() > 1 && storm::utility::parallel::isIntelTbbEnabled();
+    if (parallelize) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, directions.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t checkerIndex = range.begin(); checkerIndex < range.end(); ++checkerIndex) {
+                checkDirection(checkerIndex);
+            }
+        });
+    }
+#endif
+    if (!parallelize) {
+        for (uint64_t checkerIndex = 0; checkerIndex < directions.size(); ++checkerIndex) {
+            checkDirection(checkerIndex);
         }
     }
-    refinementSteps.push_back(std::move(step));
 
-    updateOverApproximation();
+    // Gather the results in the order of the given directions
+    for (uint64_t checkerIndex = 0; checkerIndex < directions.size(); ++checkerIndex) {
+        auto const& checker = getChecker(checkerIndex);
+        STORM_LOG_DEBUG("weighted objectives checker result (under approximation) is "
+                        << storm::utility::vector::toString(storm::utility::vector::convertNumericVector<double>(checker.getUnderApproximationOfInitialStateResults())));
+        RefinementStep step;
+        step.weightVector = directions[checkerIndex];
+        step.lowerBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getUnderApproximationOfInitialStateResults());
+        step.upperBoundPoint = storm::utility::vector::convertNumericVector<GeometryValueType>(checker.getOverApproximationOfInitialStateResults());
+        // For the minimizing objectives, we need to scale the corresponding entries with -1 as we want to consider the downward closure
+        for (uint_fast64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
+            if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                step.lowerBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+                step.upperBoundPoint[objIndex] *= -storm::utility::one<GeometryValueType>();
+            }
+        }
+        lastCheckedWeightVectors[checkerIndex] = std::move(directions[checkerIndex]);
+        refinementSteps.push_back(std::move(step));
+        updateOverApproximation();
+    }
     updateUnderApproximation();
 }
 
+template<class SparseModelType, typename GeometryValueType>
+uint64_t SparsePcaaQuery<SparseModelType, GeometryValueType>::getRefinementBatchSize(Environment const& env) const {
+    uint64_t result = env.modelchecker().multi().getWeightVectorBatchSize();
+    if (env.modelchecker().multi().isMaxStepsSet()) {
+        uint64_t const maxSteps = env.modelchecker().multi().getMaxSteps();
+        result = std::min<uint64_t>(result, maxSteps > refinementSteps.size() ? maxSteps - refinementSteps.size() : 0);
+    }
+    return std::max<uint64_t>(result, 1);
+}
+
 template<class SparseModelType, typename GeometryValueType>
 void SparsePcaaQuery<SparseModelType, GeometryValueType>::updateOverApproximation() {
     storm::storage::geometry::Halfspace<GeometryValueType> h(
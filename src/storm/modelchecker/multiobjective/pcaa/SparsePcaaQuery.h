@@ -63,11 +63,34 @@ class SparsePcaaQuery {
      */
     WeightVector findSeparatingVector(Point const& pointToBeSeparated);
 
+    /*
+     * Returns up to maxNumberOfVectors distinct weight vectors that separate the under approximation from the given point.
+     * The vectors are ordered by their priority, i.e., the first vector coincides with the result of findSeparatingVector.
+     *
+     * @param pointToBeSeparated the point that is to be seperated
+     * @param maxNumberOfVectors the maximal number of vectors to return. Has to be positive.
+     */
+    std::vector<WeightVector> findSeparatingVectors(Point const& pointToBeSeparated, uint64_t maxNumberOfVectors);
+
     /*
      * Refines the current result w.r.t. the given direction vector.
      */
     void performRefinementStep(Environment const& env, WeightVector&& direction);
 
+    /*
+     * Refines the current result w.r.t. the given direction vectors.
+     * If the environment specifies a weight vector batch size greater than one, each direction is checked on a separate weight vector checker
+     * (in parallel if Intel TBB is enabled) and each check is warm-started with the most recent result of the checker whose last weight vector
+     * is closest to the direction.
+     */
+    void performRefinementSteps(Environment const& env, std::vector<WeightVector>&& directions);
+
+    /*
+     * Returns the number of direction vectors that should be considered in the next call of performRefinementSteps, taking
+     * the batch size and the maximum number of refinement steps (as possibly specified in the settings) into account.
+     */
+    uint64_t getRefinementBatchSize(Environment const& env) const;
+
     /*
      * Updates the overapproximation after a refinement step has been performed
      *
@@ -95,6 +118,12 @@ class SparsePcaaQuery {
     // The corresponding weight vector checker
     std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>> weightVectorChecker;
 
+    // Data for checking several weight vectors at once. The checkers are created on demand.
+    preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> preprocessorResult;
+    std::vector<std::unique_ptr<PcaaWeightVectorChecker<SparseModelType>>> additionalWeightVectorCheckers;
+    // For each checker (starting with weightVectorChecker) the weight vector of the most recent check (empty if not checked yet)
+    std::vector<WeightVector> lastCheckedWeightVectors;
+
     // The results in each iteration of the algorithm
     std::vector<RefinementStep> refinementSteps;
     // Overapproximation of the set of achievable values
@@ -173,6 +173,9 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::check(Environment const&
     }
     unboundedWeightedPhase(env, weightedRewardVector, weightVector);
 
+    // The warm start is only used once
+    warmStartObjectiveResults.clear();
+
     unboundedIndividualPhase(env, weightVector);
     // Only invoke boundedPhase if necessarry, i.e., if there is at least one objective with a time bound
     for (auto const& obj : this->objectives) {
@@ -235,6 +238,16 @@ StandardPcaaWeightVectorChecker<SparseModelType>::computeScheduler() const {
     return result;
 }
 
+template<class SparseModelType>
+void StandardPcaaWeightVectorChecker<SparseModelType>::setWarmStart(PcaaWeightVectorChecker<SparseModelType> const& other) {
+    auto const* otherChecker = dynamic_cast<StandardPcaaWeightVectorChecker<SparseModelType> const*>(&other);
+    if (otherChecker != nullptr && otherChecker->checkHasBeenCalled) {
+        warmStartObjectiveResults = otherChecker->objectiveResults;
+    } else {
+        warmStartObjectiveResults.clear();
+    }
+}
+
 template<typename ValueType>
 void computeSchedulerProb1(storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                            storm::storage::BitVector const& consideredStates, storm::storage::BitVector const& statesToReach, std::vector<uint64_t>& choices,
@@ -452,8 +465,27 @@ void StandardPcaaWeightVectorChecker<SparseModelType>::unboundedWeightedPhase(En
                     "Solver requirements " + req.getEnabledRequirementsAsString() + " not checked.");
     solver->setRequirementsChecked(true);
 
-    // Use the (0...0) vector as initial guess for the solution.
-    std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    if (warmStartObjectiveResults.empty() || !lraObjectives.empty()) {
+        // Use the (0...0) vector as initial guess for the solution.
+        // With LRA objectives, the weighted results of the previous scheduler are not necessarily achievable in the EC quotient (where staying in an
+        // eliminated EC is rewarded with the LRA value of a single MEC), so they are not used as initial guess.
+        std::fill(ecQuotient->auxStateValues.begin(), ecQuotient->auxStateValues.end(), storm::utility::zero<ValueType>());
+    } else {
+        // Use the values that the previously computed scheduler achieves w.r.t. the current weight vector as initial guess for the solution.
+        // These are given by Sum_{i=1}^{n} w_i * objectiveResult_i and (up to the precision of the previous computation) do not exceed the optimal values.
+        for (uint64_t ecqState = 0; ecqState < ecQuotient->auxStateValues.size(); ++ecqState) {
+            uint64_t origState = *ecQuotient->ecqToOriginalStateMapping[ecqState].begin();
+            ValueType value = storm::utility::zero<ValueType>();
+            for (auto objIndex : objectivesWithNoUpperTimeBound) {
+                if (storm::solver::minimize(this->objectives[objIndex].formula->getOptimalityType())) {
+                    value -= weightVector[objIndex] * warmStartObjectiveResults[objIndex][origState];
+                } else {
+                    value += weightVector[objIndex] * warmStartObjectiveResults[objIndex][origState];
+                }
+            }
+            ecQuotient->auxStateValues[ecqState] = std::move(value);
+        }
+    }
 
     solver->solveEquations(env, ecQuotient->auxStateValues, ecQuotient->auxChoiceValues);
     this->weightedResult = std::vector<ValueType>(transitionMatrix.getRowGroupCount());
@@ -67,6 +67,12 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
      */
     virtual storm::storage::Scheduler<ValueType> computeScheduler() const override;
 
+    /*!
+     * The next call of check(..) uses the values that the scheduler of the most recent check of the given checker achieves w.r.t. the new weight vector
+     * as initial guess for the weighted phase.
+     */
+    virtual void setWarmStart(PcaaWeightVectorChecker<SparseModelType> const& other) override;
+
    protected:
     void initialize(preprocessing::SparseMultiObjectivePreprocessorResult<SparseModelType> const& preprocessorResult);
     virtual void initializeModelTypeSpecificData(SparseModelType const& model) = 0;
@@ -157,6 +163,8 @@ class StandardPcaaWeightVectorChecker : public PcaaWeightVectorChecker<SparseMod
     std::vector<ValueType> offsetsToOverApproximation;
     // The scheduler choices that optimize the weighted rewards of undounded objectives.
     std::vector<uint64_t> optimalChoices;
+    // The results for the individual objectives that are used to obtain an initial guess in the next call of check(..) (empty if there is none)
+    std::vector<std::vector<ValueType>> warmStartObjectiveResults;
 
     struct EcQuotient {
         storm::storage::SparseMatrix<ValueType> matrix;
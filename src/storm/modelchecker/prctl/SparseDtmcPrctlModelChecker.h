@@ -69,6 +69,12 @@ class SparseDtmcPrctlModelChecker : public SparsePropositionalModelChecker<Spars
      * Assumes a uniform distribution over initial states.
      */
     std::unique_ptr<CheckResult> computeExpectedVisitingTimes(Environment const& env);
+
+   private:
+    /*!
+     * Retrieves the backward transitions of the model. If the model has a qualitative analysis cache, they are only computed once per model.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions() const;
 };
 
 }  // namespace modelchecker
@@ -61,6 +61,12 @@ class SparseMdpPrctlModelChecker : public SparsePropositionalModelChecker<Sparse
                                                                   CheckTask<storm::logic::MultiObjectiveFormula, ValueType> const& checkTask) override;
     virtual std::unique_ptr<CheckResult> checkQuantileFormula(Environment const& env,
                                                               CheckTask<storm::logic::QuantileFormula, ValueType> const& checkTask) override;
+
+   private:
+    /*!
+     * Retrieves the backward transitions of the model. If the model has a qualitative analysis cache, they are only computed once per model.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions() const;
 };
 }  // namespace modelchecker
 }  // namespace storm
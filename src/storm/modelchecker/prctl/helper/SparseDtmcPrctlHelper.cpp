@@ -65,11 +65,16 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
 
     // Initialize epoch models
     auto initEpoch = rewardUnfolding.getStartEpoch();
-    auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+    auto epochWavefronts = rewardUnfolding.getEpochComputationWavefronts(initEpoch);
+    uint64_t numEpochs = 0;
+    for (auto const& wavefront : epochWavefronts) {
+        numEpochs += wavefront.size();
+    }
 
-    // initialize data that will be needed for each epoch
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;
+    // initialize data that will be needed for each epoch. Each worker that analyzes epochs gets its own copy.
+    uint64_t const numWorkers = rewardUnfolding.getNumberOfEpochWorkers();
+    std::vector<std::vector<ValueType>> x(numWorkers), b(numWorkers);
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numWorkers);
 
     Environment preciseEnv = env;
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
@@ -84,29 +89,36 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
     rewardUnfolding.setEquationSystemFormatForEpochModel(linearEquationSolverFactory.getEquationProblemFormat(preciseEnv));
 
     storm::utility::ProgressMeasurement progress("epochs");
-    progress.setMaxCount(epochOrder.size());
+    progress.setMaxCount(numEpochs);
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, x, b, linEqSolver, lowerBound, upperBound));
-        swCheck.stop();
-        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-            !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-            std::vector<ValueType> cdfEntry;
-            for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                   rewardUnfolding.getDimension(i).scalingFactor);
+    for (auto const& wavefront : epochWavefronts) {
+        // The epochs of a wavefront are independent of each other. Building and checking their epoch models is interleaved.
+        uint64_t const numAnalyzedEpochs = rewardUnfolding.analyzeEpochs(
+            wavefront,
+            [&](auto& epochModel, uint64_t workerIndex) {
+                return epochModel.analyzeSingleObjective(preciseEnv, x[workerIndex], b[workerIndex], linEqSolvers[workerIndex], lowerBound, upperBound);
+            },
+            &swBuild, &swCheck);
+        numCheckedEpochs += numAnalyzedEpochs;
+        progress.updateProgress(numCheckedEpochs);
+        if (numAnalyzedEpochs < wavefront.size()) {
+            // The computation has been aborted.
+            break;
+        }
+        for (auto const& epoch : wavefront) {
+            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
+                !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                std::vector<ValueType> cdfEntry;
+                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                       rewardUnfolding.getDimension(i).scalingFactor);
+                }
+                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                cdfData.push_back(std::move(cdfEntry));
             }
-            cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
         }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
         if (storm::utility::resources::isTerminate()) {
             break;
         }
@@ -133,7 +145,8 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseDtmcPrctlHelper<Va
         STORM_PRINT_AND_LOG("---------------------------------\n");
         STORM_PRINT_AND_LOG("Statistics:\n");
         STORM_PRINT_AND_LOG("---------------------------------\n");
-        STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << ".\n");
+        STORM_PRINT_AND_LOG("          #checked epochs: " << numCheckedEpochs << ".\n");
+        STORM_PRINT_AND_LOG("        #epoch wavefronts: " << epochWavefronts.size() << ".\n");
         STORM_PRINT_AND_LOG("             overall Time: " << swAll << ".\n");
         STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << ".\n");
         STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << ".\n");
@@ -147,7 +160,7 @@ template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, ModelCheckerHint const& hint) {
+    bool qualitative, ModelCheckerHint const& hint, storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
 
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
@@ -176,7 +189,8 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
     } else {
         // Get all states that have probability 0 and 1 of satisfying the until-formula.
         std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01 =
-            storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+            qualitativeAnalysisCache ? qualitativeAnalysisCache->performProb01(backwardTransitions, phiStates, psiStates)
+                                     : storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
         storm::storage::BitVector statesWithProbability0 = std::move(statesWithProbability01.first);
         statesWithProbability1 = std::move(statesWithProbability01.second);
         maybeStates = ~(statesWithProbability0 | statesWithProbability1);
@@ -381,13 +395,13 @@ template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
-    bool qualitative, ModelCheckerHint const& hint) {
+    bool qualitative, ModelCheckerHint const& hint, storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     return computeReachabilityRewards(
         env, std::move(goal), transitionMatrix, backwardTransitions,
         [&](uint_fast64_t numberOfRows, storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::BitVector const& maybeStates) {
             return rewardModel.getTotalRewardVector(numberOfRows, transitionMatrix, maybeStates);
         },
-        targetStates, qualitative, [&]() { return rewardModel.getStatesWithZeroReward(transitionMatrix); }, hint);
+        targetStates, qualitative, [&]() { return rewardModel.getStatesWithZeroReward(transitionMatrix); }, hint, qualitativeAnalysisCache);
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -409,13 +423,14 @@ template<typename ValueType, typename RewardModelType>
 std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::computeReachabilityTimes(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative,
-    ModelCheckerHint const& hint) {
+    ModelCheckerHint const& hint, storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     return computeReachabilityRewards(
         env, std::move(goal), transitionMatrix, backwardTransitions,
         [&](uint_fast64_t numberOfRows, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&) {
             return std::vector<ValueType>(numberOfRows, storm::utility::one<ValueType>());
         },
-        targetStates, qualitative, [&]() { return storm::storage::BitVector(transitionMatrix.getRowGroupCount(), false); }, hint);
+        targetStates, qualitative, [&]() { return storm::storage::BitVector(transitionMatrix.getRowGroupCount(), false); }, hint,
+        qualitativeAnalysisCache);
 }
 
 // This function computes an upper bound on the reachability rewards (see Baier et al, CAV'17).
@@ -441,7 +456,7 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
     std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const&
         totalStateRewardVectorGetter,
     storm::storage::BitVector const& targetStates, bool qualitative, std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter,
-    ModelCheckerHint const& hint) {
+    ModelCheckerHint const& hint, storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     std::vector<ValueType> result(transitionMatrix.getRowCount(), storm::utility::zero<ValueType>());
 
     // Determine which states have reward zero
@@ -462,7 +477,10 @@ std::vector<ValueType> SparseDtmcPrctlHelper<ValueType, RewardModelType>::comput
                                          << " states remaining).");
     } else {
         storm::storage::BitVector trueStates(transitionMatrix.getRowCount(), true);
-        storm::storage::BitVector infinityStates = storm::utility::graph::performProb1(backwardTransitions, trueStates, rew0States);
+        // The states that reach the states with reward zero almost surely are those with probability one of satisfying 'true U rew0States'.
+        storm::storage::BitVector infinityStates = qualitativeAnalysisCache
+                                                       ? qualitativeAnalysisCache->performProb01(backwardTransitions, trueStates, rew0States).second
+                                                       : storm::utility::graph::performProb1(backwardTransitions, trueStates, rew0States);
         infinityStates.complement();
         maybeStates = ~(rew0States | infinityStates);
 
@@ -11,6 +11,7 @@
 
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/QualitativeAnalysisCache.h"
 
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/SolveGoal.h"
@@ -36,7 +37,8 @@ class SparseDtmcPrctlHelper {
                                                             storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                             storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                             storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+                                                            bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                            storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr);
 
     static std::vector<ValueType> computeAllUntilProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -65,7 +67,8 @@ class SparseDtmcPrctlHelper {
                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                              storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                              RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
-                                                             bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint());
+                                                             bool qualitative, ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                             storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr);
 
     static std::vector<ValueType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                              storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -78,7 +81,8 @@ class SparseDtmcPrctlHelper {
                                                            storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                            storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                            storm::storage::BitVector const& targetStates, bool qualitative,
-                                                           ModelCheckerHint const& hint = ModelCheckerHint());
+                                                           ModelCheckerHint const& hint = ModelCheckerHint(),
+                                                           storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr);
 
     static std::vector<ValueType> computeConditionalProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                   storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -99,7 +103,7 @@ class SparseDtmcPrctlHelper {
         std::function<std::vector<ValueType>(uint_fast64_t, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&)> const&
             totalStateRewardVectorGetter,
         storm::storage::BitVector const& targetStates, bool qualitative, std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter,
-        ModelCheckerHint const& hint = ModelCheckerHint());
+        ModelCheckerHint const& hint = ModelCheckerHint(), storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr);
 
     struct BaierTransformedModel {
         BaierTransformedModel() : noTargetStates(false) {
@@ -64,11 +64,16 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
 
     // Initialize epoch models
     auto initEpoch = rewardUnfolding.getStartEpoch();
-    auto epochOrder = rewardUnfolding.getEpochComputationOrder(initEpoch);
+    auto epochWavefronts = rewardUnfolding.getEpochComputationWavefronts(initEpoch);
+    uint64_t numEpochs = 0;
+    for (auto const& wavefront : epochWavefronts) {
+        numEpochs += wavefront.size();
+    }
 
-    // initialize data that will be needed for each epoch
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;
+    // initialize data that will be needed for each epoch. Each worker that analyzes epochs gets its own copy.
+    uint64_t const numWorkers = rewardUnfolding.getNumberOfEpochWorkers();
+    std::vector<std::vector<ValueType>> x(numWorkers), b(numWorkers);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numWorkers);
 
     ValueType precision = rewardUnfolding.getRequiredEpochModelPrecision(
         initEpoch, storm::utility::convertNumber<ValueType>(storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision()));
@@ -79,29 +84,36 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
     std::vector<std::vector<ValueType>> cdfData;
 
     storm::utility::ProgressMeasurement progress("epochs");
-    progress.setMaxCount(epochOrder.size());
+    progress.setMaxCount(numEpochs);
     progress.startNewMeasurement(0);
     uint64_t numCheckedEpochs = 0;
-    for (auto const& epoch : epochOrder) {
-        swBuild.start();
-        auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-        swBuild.stop();
-        swCheck.start();
-        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(preciseEnv, dir, x, b, minMaxSolver, lowerBound, upperBound));
-        swCheck.stop();
-        if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
-            !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
-            std::vector<ValueType> cdfEntry;
-            for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
-                uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
-                cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
-                                   rewardUnfolding.getDimension(i).scalingFactor);
+    for (auto const& wavefront : epochWavefronts) {
+        // The epochs of a wavefront are independent of each other. Building and checking their epoch models is interleaved.
+        uint64_t const numAnalyzedEpochs = rewardUnfolding.analyzeEpochs(
+            wavefront,
+            [&](auto& epochModel, uint64_t workerIndex) {
+                return epochModel.analyzeSingleObjective(preciseEnv, dir, x[workerIndex], b[workerIndex], minMaxSolvers[workerIndex], lowerBound, upperBound);
+            },
+            &swBuild, &swCheck);
+        numCheckedEpochs += numAnalyzedEpochs;
+        progress.updateProgress(numCheckedEpochs);
+        if (numAnalyzedEpochs < wavefront.size()) {
+            // The computation has been aborted.
+            break;
+        }
+        for (auto const& epoch : wavefront) {
+            if (storm::settings::getModule<storm::settings::modules::IOSettings>().isExportCdfSet() &&
+                !rewardUnfolding.getEpochManager().hasBottomDimension(epoch)) {
+                std::vector<ValueType> cdfEntry;
+                for (uint64_t i = 0; i < rewardUnfolding.getEpochManager().getDimensionCount(); ++i) {
+                    uint64_t offset = rewardUnfolding.getDimension(i).boundType == helper::rewardbounded::DimensionBoundType::LowerBound ? 1 : 0;
+                    cdfEntry.push_back(storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getDimensionOfEpoch(epoch, i) + offset) *
+                                       rewardUnfolding.getDimension(i).scalingFactor);
+                }
+                cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
+                cdfData.push_back(std::move(cdfEntry));
             }
-            cdfEntry.push_back(rewardUnfolding.getInitialStateResult(epoch));
-            cdfData.push_back(std::move(cdfEntry));
         }
-        ++numCheckedEpochs;
-        progress.updateProgress(numCheckedEpochs);
         if (storm::utility::resources::isTerminate()) {
             break;
         }
@@ -128,7 +140,8 @@ std::map<storm::storage::sparse::state_type, ValueType> SparseMdpPrctlHelper<Val
         STORM_PRINT_AND_LOG("---------------------------------\n");
         STORM_PRINT_AND_LOG("Statistics:\n");
         STORM_PRINT_AND_LOG("---------------------------------\n");
-        STORM_PRINT_AND_LOG("          #checked epochs: " << epochOrder.size() << ".\n");
+        STORM_PRINT_AND_LOG("          #checked epochs: " << numCheckedEpochs << ".\n");
+        STORM_PRINT_AND_LOG("        #epoch wavefronts: " << epochWavefronts.size() << ".\n");
         STORM_PRINT_AND_LOG("             overall Time: " << swAll << ".\n");
         STORM_PRINT_AND_LOG("Epoch Model building Time: " << swBuild << ".\n");
         STORM_PRINT_AND_LOG("Epoch Model checking Time: " << swCheck << ".\n");
@@ -511,12 +524,16 @@ QualitativeStateSetsUntilProbabilities computeQualitativeStateSetsUntilProbabili
                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                      storm::storage::BitVector const& phiStates,
-                                                                                     storm::storage::BitVector const& psiStates) {
+                                                                                     storm::storage::BitVector const& psiStates,
+                                                                                     storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     QualitativeStateSetsUntilProbabilities result;
 
     // Get all states that have probability 0 and 1 of satisfying the until-formula.
     std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
-    if (goal.minimize()) {
+    if (qualitativeAnalysisCache) {
+        statesWithProbability01 = goal.minimize() ? qualitativeAnalysisCache->performProb01Min(transitionMatrix, backwardTransitions, phiStates, psiStates)
+                                                  : qualitativeAnalysisCache->performProb01Max(transitionMatrix, backwardTransitions, phiStates, psiStates);
+    } else if (goal.minimize()) {
         statesWithProbability01 =
             storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
     } else {
@@ -535,11 +552,12 @@ QualitativeStateSetsUntilProbabilities getQualitativeStateSetsUntilProbabilities
                                                                                  storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
                                                                                  storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
                                                                                  storm::storage::BitVector const& phiStates,
-                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint) {
+                                                                                 storm::storage::BitVector const& psiStates, ModelCheckerHint const& hint,
+                                                                                 storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsUntilProbabilitiesFromHint<ValueType>(hint);
     } else {
-        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates);
+        return computeQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, qualitativeAnalysisCache);
     }
 }
 
@@ -642,7 +660,7 @@ template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeUntilProbabilities(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates,
-    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint, storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     STORM_LOG_THROW(!qualitative || !produceScheduler, storm::exceptions::InvalidSettingsException,
                     "Cannot produce scheduler when performing qualitative model checking only.");
 
@@ -652,7 +670,7 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
     // We need to identify the maybe states (states which have a probability for satisfying the until formula
     // that is strictly between 0 and 1) and the states that satisfy the formula with probablity 1 and 0, respectively.
     QualitativeStateSetsUntilProbabilities qualitativeStateSets =
-        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint);
+        getQualitativeStateSetsUntilProbabilities(goal, transitionMatrix, backwardTransitions, phiStates, psiStates, hint, qualitativeAnalysisCache);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.statesWithProbability1.getNumberOfSetBits() << " states with probability 1, "
                                      << qualitativeStateSets.statesWithProbability0.getNumberOfSetBits() << " with probability 0 ("
@@ -905,7 +923,8 @@ template<typename RewardModelType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
-    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint) {
+    bool qualitative, bool produceScheduler, ModelCheckerHint const& hint,
+    storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     // Only compute the result if the model has at least one reward this->getModel().
     STORM_LOG_THROW(!rewardModel.empty(), storm::exceptions::InvalidPropertyException, "Reward model for formula is empty. Skipping formula.");
     return computeReachabilityRewardsHelper(
@@ -914,21 +933,21 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
             return rewardModel.getTotalRewardVector(rowCount, transitionMatrix, maybeStates);
         },
         targetStates, qualitative, produceScheduler, [&]() { return rewardModel.getStatesWithZeroReward(transitionMatrix); },
-        [&]() { return rewardModel.getChoicesWithZeroReward(transitionMatrix); }, hint);
+        [&]() { return rewardModel.getChoicesWithZeroReward(transitionMatrix); }, hint, qualitativeAnalysisCache);
 }
 
 template<typename ValueType>
 MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType>::computeReachabilityTimes(
     Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
-    ModelCheckerHint const& hint) {
+    ModelCheckerHint const& hint, storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     return computeReachabilityRewardsHelper(
         env, std::move(goal), transitionMatrix, backwardTransitions,
         [](uint_fast64_t rowCount, storm::storage::SparseMatrix<ValueType> const&, storm::storage::BitVector const&) {
             return std::vector<ValueType>(rowCount, storm::utility::one<ValueType>());
         },
         targetStates, qualitative, produceScheduler, [&]() { return storm::storage::BitVector(transitionMatrix.getRowGroupCount(), false); },
-        [&]() { return storm::storage::BitVector(transitionMatrix.getRowCount(), false); }, hint);
+        [&]() { return storm::storage::BitVector(transitionMatrix.getRowCount(), false); }, hint, qualitativeAnalysisCache);
 }
 
 #ifdef STORM_HAVE_CARL
@@ -1004,10 +1023,17 @@ template<typename ValueType>
 QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityRewards(
     storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
     storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates,
-    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
+    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
+    storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     QualitativeStateSetsReachabilityRewards result;
     storm::storage::BitVector trueStates(transitionMatrix.getRowGroupCount(), true);
-    if (goal.minimize()) {
+    if (qualitativeAnalysisCache) {
+        // The states that reach the target almost surely under some (all) schedulers are those with maximal (minimal) probability one of
+        // satisfying 'true U targetStates'.
+        result.infinityStates = goal.minimize()
+                                    ? qualitativeAnalysisCache->performProb01Max(transitionMatrix, backwardTransitions, trueStates, targetStates).second
+                                    : qualitativeAnalysisCache->performProb01Min(transitionMatrix, backwardTransitions, trueStates, targetStates).second;
+    } else if (goal.minimize()) {
         result.infinityStates =
             storm::utility::graph::performProb1E(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, trueStates, targetStates);
     } else {
@@ -1032,17 +1058,16 @@ QualitativeStateSetsReachabilityRewards computeQualitativeStateSetsReachabilityR
 }
 
 template<typename ValueType>
-QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewards(storm::solver::SolveGoal<ValueType> const& goal,
-                                                                                   storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                   storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
-                                                                                   storm::storage::BitVector const& targetStates, ModelCheckerHint const& hint,
-                                                                                   std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter,
-                                                                                   std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter) {
+QualitativeStateSetsReachabilityRewards getQualitativeStateSetsReachabilityRewards(
+    storm::solver::SolveGoal<ValueType> const& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, ModelCheckerHint const& hint,
+    std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
+    storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     if (hint.isExplicitModelCheckerHint() && hint.template asExplicitModelCheckerHint<ValueType>().getComputeOnlyMaybeStates()) {
         return getQualitativeStateSetsReachabilityRewardsFromHint<ValueType>(hint, targetStates);
     } else {
         return computeQualitativeStateSetsReachabilityRewards(goal, transitionMatrix, backwardTransitions, targetStates, zeroRewardStatesGetter,
-                                                              zeroRewardChoicesGetter);
+                                                              zeroRewardChoicesGetter, qualitativeAnalysisCache);
     }
 }
 
@@ -1228,13 +1253,13 @@ MDPSparseModelCheckingHelperReturnType<ValueType> SparseMdpPrctlHelper<ValueType
         totalStateRewardVectorGetter,
     storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
     std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
-    ModelCheckerHint const& hint) {
+    ModelCheckerHint const& hint, storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
     // Prepare resulting vector.
     std::vector<ValueType> result(transitionMatrix.getRowGroupCount(), storm::utility::zero<ValueType>());
 
     // Determine which states have a reward that is infinity or less than infinity.
     QualitativeStateSetsReachabilityRewards qualitativeStateSets = getQualitativeStateSetsReachabilityRewards(
-        goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter);
+        goal, transitionMatrix, backwardTransitions, targetStates, hint, zeroRewardStatesGetter, zeroRewardChoicesGetter, qualitativeAnalysisCache);
 
     STORM_LOG_INFO("Preprocessing: " << qualitativeStateSets.infinityStates.getNumberOfSetBits() << " states with reward infinity, "
                                      << qualitativeStateSets.rewardZeroStates.getNumberOfSetBits() << " states with reward zero ("
@@ -1517,7 +1542,8 @@ template std::vector<double> SparseMdpPrctlHelper<double>::computeCumulativeRewa
 template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeReachabilityRewards(
     Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel,
-    storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint);
+    storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint,
+    storm::storage::sparse::QualitativeAnalysisCache<double>* qualitativeAnalysisCache);
 template MDPSparseModelCheckingHelperReturnType<double> SparseMdpPrctlHelper<double>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<double>&& goal, storm::storage::SparseMatrix<double> const& transitionMatrix,
     storm::storage::SparseMatrix<double> const& backwardTransitions, storm::models::sparse::StandardRewardModel<double> const& rewardModel, bool qualitative,
@@ -1535,7 +1561,7 @@ template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdp
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
     storm::models::sparse::StandardRewardModel<storm::RationalNumber> const& rewardModel, storm::storage::BitVector const& targetStates, bool qualitative,
-    bool produceScheduler, ModelCheckerHint const& hint);
+    bool produceScheduler, ModelCheckerHint const& hint, storm::storage::sparse::QualitativeAnalysisCache<storm::RationalNumber>* qualitativeAnalysisCache);
 template MDPSparseModelCheckingHelperReturnType<storm::RationalNumber> SparseMdpPrctlHelper<storm::RationalNumber>::computeTotalRewards(
     Environment const& env, storm::solver::SolveGoal<storm::RationalNumber>&& goal, storm::storage::SparseMatrix<storm::RationalNumber> const& transitionMatrix,
     storm::storage::SparseMatrix<storm::RationalNumber> const& backwardTransitions,
@@ -9,6 +9,7 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 #include "storm/storage/MaximalEndComponent.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/QualitativeAnalysisCache.h"
 
 #include "storm/solver/SolveGoal.h"
 #include "storm/utility/solver.h"
@@ -49,7 +50,8 @@ class SparseMdpPrctlHelper {
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeUntilProbabilities(
         Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
-        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+        storm::storage::BitVector const& psiStates, bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr);
 
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeGloballyProbabilities(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
                                                                                           storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
@@ -78,13 +80,14 @@ class SparseMdpPrctlHelper {
     static MDPSparseModelCheckingHelperReturnType<ValueType> computeReachabilityRewards(
         Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
         storm::storage::SparseMatrix<ValueType> const& backwardTransitions, RewardModelType const& rewardModel, storm::storage::BitVector const& targetStates,
-        bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+        bool qualitative, bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr);
 
-    static MDPSparseModelCheckingHelperReturnType<ValueType> computeReachabilityTimes(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
-                                                                                      storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
-                                                                                      storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
-                                                                                      storm::storage::BitVector const& targetStates, bool qualitative,
-                                                                                      bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint());
+    static MDPSparseModelCheckingHelperReturnType<ValueType> computeReachabilityTimes(
+        Environment const& env, storm::solver::SolveGoal<ValueType>&& goal, storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+        storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& targetStates, bool qualitative,
+        bool produceScheduler, ModelCheckerHint const& hint = ModelCheckerHint(),
+        storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr);
 
 #ifdef STORM_HAVE_CARL
     static std::vector<ValueType> computeReachabilityRewards(Environment const& env, storm::solver::SolveGoal<ValueType>&& goal,
@@ -108,7 +111,7 @@ class SparseMdpPrctlHelper {
             totalStateRewardVectorGetter,
         storm::storage::BitVector const& targetStates, bool qualitative, bool produceScheduler,
         std::function<storm::storage::BitVector()> const& zeroRewardStatesGetter, std::function<storm::storage::BitVector()> const& zeroRewardChoicesGetter,
-        ModelCheckerHint const& hint = ModelCheckerHint());
+        ModelCheckerHint const& hint = ModelCheckerHint(), storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr);
 };
 
 }  // namespace helper
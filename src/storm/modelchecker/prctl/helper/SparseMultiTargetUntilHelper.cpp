@@ -0,0 +1,75 @@
+#include "storm/modelchecker/prctl/helper/SparseMultiTargetUntilHelper.h"
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/solver/helper/MultiRhsValueIterationHelper.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace helper {
+
+template<typename ValueType>
+typename SparseMultiTargetUntilHelper<ValueType>::Result SparseMultiTargetUntilHelper<ValueType>::computeUntilProbabilities(
+    Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir,
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> const& phiPsiStates,
+    storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache) {
+    uint64_t const numberOfFormulas = phiPsiStates.size();
+    uint64_t const numberOfStates = transitionMatrix.getRowGroupCount();
+
+    // Perform the qualitative analysis of each formula and initialize the interleaved solution vector with the known values.
+    std::vector<ValueType> x(numberOfStates * numberOfFormulas, storm::utility::zero<ValueType>());
+    std::vector<storm::storage::BitVector> maybeStates;
+    maybeStates.reserve(numberOfFormulas);
+    for (uint64_t k = 0; k < numberOfFormulas; ++k) {
+        auto const& phiStates = phiPsiStates[k].first;
+        auto const& psiStates = phiPsiStates[k].second;
+        std::pair<storm::storage::BitVector, storm::storage::BitVector> statesWithProbability01;
+        if (!dir) {
+            statesWithProbability01 = qualitativeAnalysisCache ? qualitativeAnalysisCache->performProb01(backwardTransitions, phiStates, psiStates)
+                                                               : storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates);
+        } else if (qualitativeAnalysisCache) {
+            statesWithProbability01 = storm::solver::minimize(*dir)
+                                          ? qualitativeAnalysisCache->performProb01Min(transitionMatrix, backwardTransitions, phiStates, psiStates)
+                                          : qualitativeAnalysisCache->performProb01Max(transitionMatrix, backwardTransitions, phiStates, psiStates);
+        } else {
+            auto const& rowGroupIndices = transitionMatrix.getRowGroupIndices();
+            statesWithProbability01 =
+                storm::solver::minimize(*dir)
+                    ? storm::utility::graph::performProb01Min(transitionMatrix, rowGroupIndices, backwardTransitions, phiStates, psiStates)
+                    : storm::utility::graph::performProb01Max(transitionMatrix, rowGroupIndices, backwardTransitions, phiStates, psiStates);
+        }
+        for (auto state : statesWithProbability01.second) {
+            x[state * numberOfFormulas + k] = storm::utility::one<ValueType>();
+        }
+        maybeStates.push_back(~(statesWithProbability01.first | statesWithProbability01.second));
+        STORM_LOG_INFO("Preprocessing of formula " << k << ": " << statesWithProbability01.second.getNumberOfSetBits() << " states with probability 1, "
+                                                   << statesWithProbability01.first.getNumberOfSetBits() << " with probability 0 ("
+                                                   << maybeStates.back().getNumberOfSetBits() << " states remaining).");
+    }
+
+    // Starting from zero for the maybe states, value iteration converges to the least fixed point, which coincides with the (optimal)
+    // reachability probabilities as the states with (optimal) probability zero are fixed.
+    storm::solver::helper::MultiRhsValueIterationHelper<ValueType> solver(transitionMatrix);
+    Result result;
+    result.statuses = solver.solve(env, dir, x, {}, maybeStates);
+
+    // De-interleave the solution.
+    result.values.assign(numberOfFormulas, std::vector<ValueType>(numberOfStates));
+    auto xIt = x.begin();
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        for (uint64_t k = 0; k < numberOfFormulas; ++k, ++xIt) {
+            result.values[k][state] = std::move(*xIt);
+        }
+    }
+    return result;
+}
+
+template class SparseMultiTargetUntilHelper<double>;
+template class SparseMultiTargetUntilHelper<storm::RationalNumber>;
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
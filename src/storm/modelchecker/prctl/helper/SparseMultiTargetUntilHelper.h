@@ -0,0 +1,49 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <utility>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/storage/sparse/QualitativeAnalysisCache.h"
+
+namespace storm {
+class Environment;
+
+namespace modelchecker {
+namespace helper {
+
+/*!
+ * Computes the (optimal) probabilities of several unbounded until formulas phi_k U psi_k on the same DTMC or MDP.
+ * After the qualitative analysis of every formula, the resulting equation systems share the transition matrix and are solved
+ * jointly by a single value iteration (see storm::solver::helper::MultiRhsValueIterationHelper).
+ */
+template<typename ValueType>
+class SparseMultiTargetUntilHelper {
+   public:
+    struct Result {
+        // For each formula the probabilities for all states
+        std::vector<std::vector<ValueType>> values;
+        // For each formula the status of the value iteration. The probabilities of formulas whose status is not 'Converged' are imprecise.
+        std::vector<storm::solver::SolverStatus> statuses;
+    };
+
+    /*!
+     * @param dir The optimization direction. Must be given iff the transition matrix has non-trivial row groups.
+     * @param phiPsiStates For each formula the phi and psi states.
+     * @param qualitativeAnalysisCache If given, the prob0/prob1 states are taken from this cache.
+     * @return For each formula the probabilities for all states and whether they have been computed precisely.
+     */
+    static Result computeUntilProbabilities(
+        Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir,
+        storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+        std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> const& phiPsiStates,
+        storm::storage::sparse::QualitativeAnalysisCache<ValueType>* qualitativeAnalysisCache = nullptr);
+};
+
+}  // namespace helper
+}  // namespace modelchecker
+}  // namespace storm
@@ -1,11 +1,16 @@
 #include "storm/modelchecker/prctl/helper/rewardbounded/MultiDimensionalRewardUnfolding.h"
 
+#include <algorithm>
 #include <functional>
 #include <set>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/logic/Formulas.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/ThreadOutputBuffer.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "storm/modelchecker/prctl/helper/BaierUpperRewardBoundsComputer.h"
 #include "storm/modelchecker/propositional/SparsePropositionalModelChecker.h"
@@ -80,6 +85,9 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::initialize
     for (auto const& step : epochSteps) {
         possibleEpochSteps.insert(step);
     }
+
+    // The first epoch model buffer is used by setCurrentEpoch
+    epochModelBuffers.resize(1);
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -397,21 +405,151 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputa
     return std::vector<Epoch>(collectedEpochs.begin(), collectedEpochs.end());
 }
 
+template<typename ValueType, bool SingleObjectiveMode>
+std::vector<std::vector<typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::Epoch>>
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochComputationWavefronts(Epoch const& startEpoch, bool stopAtComputedEpochs) {
+    std::vector<Epoch> epochOrder = getEpochComputationOrder(startEpoch, stopAtComputedEpochs);
+
+    // The computation order is a topological order, i.e., the successors of an epoch appear before the epoch itself.
+    // An epoch is assigned to the wavefront succeeding the last wavefront that contains one of its successors.
+    std::vector<std::vector<Epoch>> result;
+    std::map<Epoch, uint64_t> epochToWavefrontMap;
+    for (auto& epoch : epochOrder) {
+        uint64_t wavefront = 0;
+        for (auto const& step : possibleEpochSteps) {
+            Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, step);
+            if (successorEpoch != epoch) {
+                auto successorIt = epochToWavefrontMap.find(successorEpoch);
+                if (successorIt != epochToWavefrontMap.end()) {
+                    wavefront = std::max(wavefront, successorIt->second + 1);
+                } else {
+                    STORM_LOG_ASSERT(epochSolutions.count(successorEpoch) > 0, "Successor epoch is neither computed nor scheduled for computation.");
+                }
+            }
+        }
+        epochToWavefrontMap.emplace(epoch, wavefront);
+        if (wavefront >= result.size()) {
+            result.resize(wavefront + 1);
+        }
+        // Epochs within a wavefront remain in computation order so that epochs of the same epoch class stay close to each other.
+        result[wavefront].push_back(std::move(epoch));
+    }
+    STORM_LOG_DEBUG("Partitioned " << epochToWavefrontMap.size() << " epochs into " << result.size() << " wavefronts.");
+    return result;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getNumberOfEpochWorkers() const {
+    return storm::utility::parallel::getNumberOfThreads();
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+uint64_t MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::analyzeEpochs(
+    std::vector<Epoch> const& epochs, std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, uint64_t)> const& analyzeEpochModel,
+    storm::utility::Stopwatch* buildingTime, storm::utility::Stopwatch* checkingTime) {
+    if (epochs.empty()) {
+        return 0;
+    }
+    // The epochs are distributed in contiguous chunks over the workers. Since epochs of the same epoch class tend to be adjacent,
+    // this avoids rebuilding the epoch matrix in most cases.
+    uint64_t const numberOfWorkers = std::min<uint64_t>(epochs.size(), getNumberOfEpochWorkers());
+    bool const parallelize = numberOfWorkers > 1 && storm::utility::parallel::isIntelTbbEnabled();
+    while (epochModelBuffers.size() < numberOfWorkers) {
+        epochModelBuffers.emplace_back();
+        epochModelBuffers.back().epochModel.equationSolverProblemFormat = equationSolverProblemFormat;
+    }
+
+    std::vector<std::shared_ptr<std::vector<uint64_t> const>> solutionVectorMaps(epochs.size());
+    std::vector<std::vector<SolutionType>> solutions(epochs.size());
+    // The output of concurrently analyzed epochs is collected and printed in the order of the epochs afterwards.
+    std::vector<std::string> epochOutputs(parallelize ? epochs.size() : 0);
+    std::vector<storm::utility::Stopwatch> workerBuildingTimes(numberOfWorkers), workerCheckingTimes(numberOfWorkers);
+    auto analyzeChunk = [&](uint64_t workerIndex) {
+        auto& buffer = epochModelBuffers[workerIndex];
+        uint64_t const chunkEnd = (workerIndex + 1) * epochs.size() / numberOfWorkers;
+        for (uint64_t epochIndex = workerIndex * epochs.size() / numberOfWorkers; epochIndex < chunkEnd; ++epochIndex) {
+            if (storm::utility::resources::isTerminate()) {
+                break;
+            }
+            boost::optional<storm::utility::ThreadOutputBuffer> outputBuffer;
+            if (parallelize) {
+                outputBuffer.emplace();
+            }
+            // Building the epoch model only reads the solutions of previously analyzed epochs.
+            workerBuildingTimes[workerIndex].start();
+            buildEpochModel(buffer, epochs[epochIndex]);
+            workerBuildingTimes[workerIndex].stop();
+            workerCheckingTimes[workerIndex].start();
+            solutions[epochIndex] = analyzeEpochModel(buffer.epochModel, workerIndex);
+            workerCheckingTimes[workerIndex].stop();
+            STORM_LOG_ASSERT(solutions[epochIndex].size() == buffer.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+            solutionVectorMaps[epochIndex] = buffer.productStateToEpochModelInStateMap;
+            if (parallelize) {
+                epochOutputs[epochIndex] = outputBuffer->getOutput();
+            }
+        }
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    if (parallelize) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfWorkers, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t workerIndex = range.begin(); workerIndex < range.end(); ++workerIndex) {
+                analyzeChunk(workerIndex);
+            }
+        });
+    }
+#endif
+    if (!parallelize) {
+        for (uint64_t workerIndex = 0; workerIndex < numberOfWorkers; ++workerIndex) {
+            analyzeChunk(workerIndex);
+        }
+    }
+    for (uint64_t workerIndex = 0; workerIndex < numberOfWorkers; ++workerIndex) {
+        if (buildingTime) {
+            buildingTime->add(workerBuildingTimes[workerIndex]);
+        }
+        if (checkingTime) {
+            checkingTime->add(workerCheckingTimes[workerIndex]);
+        }
+    }
+
+    // Store the solutions in the given order. This also releases solutions that are not needed anymore.
+    // Epochs that have been skipped due to an abort are not stored.
+    uint64_t numberOfAnalyzedEpochs = 0;
+    for (uint64_t epochIndex = 0; epochIndex < epochs.size(); ++epochIndex) {
+        if (parallelize && !epochOutputs[epochIndex].empty()) {
+            STORM_PRINT(epochOutputs[epochIndex]);
+        }
+        if (solutionVectorMaps[epochIndex]) {
+            storeEpochSolution(epochs[epochIndex], solutionVectorMaps[epochIndex], std::move(solutions[epochIndex]));
+            ++numberOfAnalyzedEpochs;
+        }
+    }
+    return numberOfAnalyzedEpochs;
+}
+
 template<typename ValueType, bool SingleObjectiveMode>
 EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpoch(Epoch const& epoch) {
+    auto& buffer = epochModelBuffers.front();
+    buildEpochModel(buffer, epoch);
+    return buffer.epochModel;
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::buildEpochModel(EpochModelBuffer& buffer, Epoch const& epoch) const {
     STORM_LOG_DEBUG("Setting model for epoch " << epochManager.toString(epoch));
 
     // Check if we need to update the current epoch class
-    if (!currentEpoch || !epochManager.compareEpochClass(epoch, currentEpoch.get())) {
-        setCurrentEpochClass(epoch);
-        epochModel.epochMatrixChanged = true;
+    if (!buffer.currentEpoch || !epochManager.compareEpochClass(epoch, buffer.currentEpoch.get())) {
+        setEpochClass(buffer, epoch);
+        buffer.epochModel.epochMatrixChanged = true;
         if (storm::settings::getModule<storm::settings::modules::CoreSettings>().isShowStatisticsSet()) {
-            if (storm::utility::graph::hasCycle(epochModel.epochMatrix)) {
-                std::cout << "Epoch model for epoch " << epochManager.toString(epoch) << " is cyclic.\n";
+            if (storm::utility::graph::hasCycle(buffer.epochModel.epochMatrix)) {
+                STORM_PRINT("Epoch model for epoch " << epochManager.toString(epoch) << " is cyclic.\n");
             }
         }
     } else {
-        epochModel.epochMatrixChanged = false;
+        buffer.epochModel.epochMatrixChanged = false;
     }
 
     bool containsLowerBoundedObjective = false;
@@ -430,10 +568,10 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
             subSolutions.emplace(successorEpoch, &successorSolIt->second);
         }
     }
-    epochModel.stepSolutions.resize(epochModel.stepChoices.getNumberOfSetBits());
-    auto stepSolIt = epochModel.stepSolutions.begin();
-    for (auto reducedChoice : epochModel.stepChoices) {
-        uint64_t productChoice = epochModelToProductChoiceMap[reducedChoice];
+    buffer.epochModel.stepSolutions.resize(buffer.epochModel.stepChoices.getNumberOfSetBits());
+    auto stepSolIt = buffer.epochModel.stepSolutions.begin();
+    for (auto reducedChoice : buffer.epochModel.stepChoices) {
+        uint64_t productChoice = buffer.epochModelToProductChoiceMap[reducedChoice];
         uint64_t productState = productModel->getProductStateFromChoice(productChoice);
         auto const& memoryState = productModel->getMemoryState(productState);
         Epoch successorEpoch = epochManager.getSuccessorEpoch(epoch, productModel->getSteps()[productChoice]);
@@ -443,7 +581,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         // a) there is an upper bounded subObjective that is __still_relevant__ but the corresponding reward bound is passed after taking the choice
         // b) there is a lower bounded subObjective and the corresponding reward bound is not passed yet.
         for (uint64_t objIndex = 0; objIndex < this->objectives.size(); ++objIndex) {
-            bool rewardEarned = !storm::utility::isZero(epochModel.objectiveRewards[objIndex][reducedChoice]);
+            bool rewardEarned = !storm::utility::isZero(buffer.epochModel.objectiveRewards[objIndex][reducedChoice]);
             if (rewardEarned) {
                 for (auto dim : objectiveDimensions[objIndex]) {
                     if ((dimensions[dim].boundType == DimensionBoundType::UpperBound) == epochManager.isBottomDimension(successorEpoch, dim) &&
@@ -453,7 +591,7 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
                     }
                 }
             }
-            epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
+            buffer.epochModel.objectiveRewardFilter[objIndex].set(reducedChoice, rewardEarned);
         }
         // compute the solution for the stepChoices
         // For optimization purposes, we distinguish the case where the memory state does not have to be transformed
@@ -486,32 +624,31 @@ EpochModel<ValueType, SingleObjectiveMode>& MultiDimensionalRewardUnfolding<Valu
         ++stepSolIt;
     }
 
-    assert(epochModel.objectiveRewards.size() == objectives.size());
-    assert(epochModel.objectiveRewardFilter.size() == objectives.size());
-    assert(epochModel.epochMatrix.getRowCount() == epochModel.stepChoices.size());
-    assert(epochModel.stepChoices.size() == epochModel.objectiveRewards.front().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewards.back().size());
-    assert(epochModel.objectiveRewards.front().size() == epochModel.objectiveRewardFilter.front().size());
-    assert(epochModel.objectiveRewards.back().size() == epochModel.objectiveRewardFilter.back().size());
-    assert(epochModel.stepChoices.getNumberOfSetBits() == epochModel.stepSolutions.size());
+    assert(buffer.epochModel.objectiveRewards.size() == objectives.size());
+    assert(buffer.epochModel.objectiveRewardFilter.size() == objectives.size());
+    assert(buffer.epochModel.epochMatrix.getRowCount() == buffer.epochModel.stepChoices.size());
+    assert(buffer.epochModel.stepChoices.size() == buffer.epochModel.objectiveRewards.front().size());
+    assert(buffer.epochModel.objectiveRewards.front().size() == buffer.epochModel.objectiveRewards.back().size());
+    assert(buffer.epochModel.objectiveRewards.front().size() == buffer.epochModel.objectiveRewardFilter.front().size());
+    assert(buffer.epochModel.objectiveRewards.back().size() == buffer.epochModel.objectiveRewardFilter.back().size());
+    assert(buffer.epochModel.stepChoices.getNumberOfSetBits() == buffer.epochModel.stepSolutions.size());
 
-    currentEpoch = epoch;
+    buffer.currentEpoch = epoch;
     /*
     std::cout << "Epoch model for epoch " << storm::utility::vector::toString(epoch) << '\n';
-    std::cout << "Matrix: \n" << epochModel.epochMatrix << '\n';
-    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(epochModel.objectiveRewards[0]) << '\n';
-    std::cout << "steps: " << epochModel.stepChoices << '\n';
+    std::cout << "Matrix: \n" << buffer.epochModel.epochMatrix << '\n';
+    std::cout << "ObjectiveRewards: " << storm::utility::vector::toString(buffer.epochModel.objectiveRewards[0]) << '\n';
+    std::cout << "steps: " << buffer.epochModel.stepChoices << '\n';
     std::cout << "step solutions: ";
-    for (int i = 0; i < epochModel.stepSolutions.size(); ++i) {
-        std::cout << "   " << epochModel.stepSolutions[i].weightedValue;
+    for (int i = 0; i < buffer.epochModel.stepSolutions.size(); ++i) {
+        std::cout << "   " << buffer.epochModel.stepSolutions[i].weightedValue;
     }
     std::cout << '\n';
     */
-    return epochModel;
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
-void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrentEpochClass(Epoch const& epoch) {
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEpochClass(EpochModelBuffer& buffer, Epoch const& epoch) const {
     EpochClass epochClass = epochManager.getEpochClass(epoch);
     // std::cout << "Setting epoch class for epoch " << epochManager.toString(epoch) << '\n';
     auto productObjectiveRewards = productModel->computeObjectiveRewards(epochClass, objectives);
@@ -524,7 +661,7 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         }
         ++choice;
     }
-    epochModel.epochMatrix = productModel->getProduct().getTransitionMatrix().filterEntries(~stepChoices);
+    buffer.epochModel.epochMatrix = productModel->getProduct().getTransitionMatrix().filterEntries(~stepChoices);
     // redirect transitions for the case where the lower reward bounds are not met yet
     storm::storage::BitVector violatedLowerBoundedDimensions(dimensions.size(), false);
     for (uint64_t dim = 0; dim < dimensions.size(); ++dim) {
@@ -533,9 +670,9 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         }
     }
     if (!violatedLowerBoundedDimensions.empty()) {
-        for (uint64_t state = 0; state < epochModel.epochMatrix.getRowGroupCount(); ++state) {
+        for (uint64_t state = 0; state < buffer.epochModel.epochMatrix.getRowGroupCount(); ++state) {
             auto const& memoryState = productModel->getMemoryState(state);
-            for (auto& entry : epochModel.epochMatrix.getRowGroup(state)) {
+            for (auto& entry : buffer.epochModel.epochMatrix.getRowGroup(state)) {
                 entry.setColumn(productModel->transformProductState(entry.getColumn(), epochClass, memoryState));
             }
         }
@@ -553,11 +690,11 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     storm::storage::BitVector productInStates = productModel->getInStates(epochClass);
     // The epoch model only needs to consider the states that are reachable from a relevant state
     storm::storage::BitVector consideredStates =
-        storm::utility::graph::getReachableStates(epochModel.epochMatrix, productInStates, allProductStates, ~allProductStates);
+        storm::utility::graph::getReachableStates(buffer.epochModel.epochMatrix, productInStates, allProductStates, ~allProductStates);
 
     // We assume that there is no end component in which objective reward is earned
-    STORM_LOG_ASSERT(!storm::utility::graph::checkIfECWithChoiceExists(epochModel.epochMatrix, epochModel.epochMatrix.transpose(true), allProductStates,
-                                                                       ~zeroObjRewardChoices & ~stepChoices),
+    STORM_LOG_ASSERT(!storm::utility::graph::checkIfECWithChoiceExists(buffer.epochModel.epochMatrix, buffer.epochModel.epochMatrix.transpose(true),
+                                                                       allProductStates, ~zeroObjRewardChoices & ~stepChoices),
                      "There is a scheduler that yields infinite reward for one objective. This case should be excluded");
 
     // Create the epoch model matrix
@@ -565,11 +702,11 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
     if (model.isOfType(storm::models::ModelType::Dtmc)) {
         assert(zeroObjRewardChoices.size() == productModel->getProduct().getNumberOfStates());
         assert(stepChoices.size() == productModel->getProduct().getNumberOfStates());
-        STORM_LOG_ASSERT(epochModel.equationSolverProblemFormat.is_initialized(), "Linear equation problem format was not set.");
-        bool convertToEquationSystem = epochModel.equationSolverProblemFormat.get() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
+        STORM_LOG_ASSERT(buffer.epochModel.equationSolverProblemFormat.is_initialized(), "Linear equation problem format was not set.");
+        bool convertToEquationSystem = buffer.epochModel.equationSolverProblemFormat.get() == storm::solver::LinearEquationSolverProblemFormat::EquationSystem;
         // For DTMCs we consider the subsystem induced by the considered states.
         // The transitions for states with zero reward are filtered out to guarantee a unique solution of the eq-system.
-        auto backwardTransitions = epochModel.epochMatrix.transpose(true);
+        auto backwardTransitions = buffer.epochModel.epochMatrix.transpose(true);
         storm::storage::BitVector nonZeroRewardStates =
             storm::utility::graph::performProbGreater0(backwardTransitions, consideredStates, consideredStates & (~zeroObjRewardChoices | stepChoices));
         // If there is at least one considered state with reward zero, we have to add a 'zero-reward-state' to the epoch model.
@@ -582,85 +719,85 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setCurrent
         storm::storage::SparseMatrixBuilder<ValueType> builder;
         if (!nonZeroRewardStates.empty()) {
             builder = storm::storage::SparseMatrixBuilder<ValueType>(
-                epochModel.epochMatrix.getSubmatrix(true, nonZeroRewardStates, nonZeroRewardStates, convertToEquationSystem));
+                buffer.epochModel.epochMatrix.getSubmatrix(true, nonZeroRewardStates, nonZeroRewardStates, convertToEquationSystem));
         }
         if (requiresZeroRewardState) {
             if (convertToEquationSystem) {
                 // add a diagonal entry
                 builder.addNextValue(zeroRewardInState, zeroRewardInState, storm::utility::zero<ValueType>());
             }
-            epochModel.epochMatrix = builder.build(numEpochModelStates, numEpochModelStates);
+            buffer.epochModel.epochMatrix = builder.build(numEpochModelStates, numEpochModelStates);
         } else {
             assert(!nonZeroRewardStates.empty());
-            epochModel.epochMatrix = builder.build();
+            buffer.epochModel.epochMatrix = builder.build();
         }
         if (convertToEquationSystem) {
-            epochModel.epochMatrix.convertToEquationSystem();
+            buffer.epochModel.epochMatrix.convertToEquationSystem();
         }
 
-        epochModelToProductChoiceMap.clear();
-        epochModelToProductChoiceMap.reserve(numEpochModelStates);
+        buffer.epochModelToProductChoiceMap.clear();
+        buffer.epochModelToProductChoiceMap.reserve(numEpochModelStates);
         productToEpochModelStateMapping.assign(nonZeroRewardStates.size(), zeroRewardInState);
         for (auto productState : nonZeroRewardStates) {
-            productToEpochModelStateMapping[productState] = epochModelToProductChoiceMap.size();
-            epochModelToProductChoiceMap.push_back(productState);
+            productToEpochModelStateMapping[productState] = buffer.epochModelToProductChoiceMap.size();
+            buffer.epochModelToProductChoiceMap.push_back(productState);
         }
         if (requiresZeroRewardState) {
             uint64_t zeroRewardProductState = (consideredStates & ~nonZeroRewardStates).getNextSetIndex(0);
             assert(zeroRewardProductState < consideredStates.size());
-            epochModelToProductChoiceMap.push_back(zeroRewardProductState);
+            buffer.epochModelToProductChoiceMap.push_back(zeroRewardProductState);
         }
     } else if (model.isOfType(storm::models::ModelType::Mdp)) {
         // Eliminate zero-reward end components
-        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(epochModel.epochMatrix, consideredStates,
+        auto ecElimResult = storm::transformer::EndComponentEliminator<ValueType>::transform(buffer.epochModel.epochMatrix, consideredStates,
                                                                                              zeroObjRewardChoices & ~stepChoices, consideredStates);
-        epochModel.epochMatrix = std::move(ecElimResult.matrix);
-        epochModelToProductChoiceMap = std::move(ecElimResult.newToOldRowMapping);
+        buffer.epochModel.epochMatrix = std::move(ecElimResult.matrix);
+        buffer.epochModelToProductChoiceMap = std::move(ecElimResult.newToOldRowMapping);
         productToEpochModelStateMapping = std::move(ecElimResult.oldToNewStateMapping);
     } else {
         STORM_LOG_THROW(false, storm::exceptions::UnexpectedException, "Unsupported model type.");
     }
 
-    epochModel.stepChoices = storm::storage::BitVector(epochModel.epochMatrix.getRowCount(), false);
-    for (uint64_t choice = 0; choice < epochModel.epochMatrix.getRowCount(); ++choice) {
-        if (stepChoices.get(epochModelToProductChoiceMap[choice])) {
-            epochModel.stepChoices.set(choice, true);
+    buffer.epochModel.stepChoices = storm::storage::BitVector(buffer.epochModel.epochMatrix.getRowCount(), false);
+    for (uint64_t choice = 0; choice < buffer.epochModel.epochMatrix.getRowCount(); ++choice) {
+        if (stepChoices.get(buffer.epochModelToProductChoiceMap[choice])) {
+            buffer.epochModel.stepChoices.set(choice, true);
         }
     }
 
-    epochModel.objectiveRewards.clear();
+    buffer.epochModel.objectiveRewards.clear();
     for (uint64_t objIndex = 0; objIndex < objectives.size(); ++objIndex) {
         std::vector<ValueType> const& productObjRew = productObjectiveRewards[objIndex];
         std::vector<ValueType> reducedModelObjRewards;
-        reducedModelObjRewards.reserve(epochModel.epochMatrix.getRowCount());
-        for (auto const& productChoice : epochModelToProductChoiceMap) {
+        reducedModelObjRewards.reserve(buffer.epochModel.epochMatrix.getRowCount());
+        for (auto const& productChoice : buffer.epochModelToProductChoiceMap) {
             reducedModelObjRewards.push_back(productObjRew[productChoice]);
         }
         // Check if the objective is violated in the current epoch
         if (!violatedLowerBoundedDimensions.isDisjointFrom(objectiveDimensions[objIndex])) {
-            storm::utility::vector::setVectorValues(reducedModelObjRewards, ~epochModel.stepChoices, storm::utility::zero<ValueType>());
+            storm::utility::vector::setVectorValues(reducedModelObjRewards, ~buffer.epochModel.stepChoices, storm::utility::zero<ValueType>());
         }
-        epochModel.objectiveRewards.push_back(std::move(reducedModelObjRewards));
+        buffer.epochModel.objectiveRewards.push_back(std::move(reducedModelObjRewards));
     }
 
-    epochModel.epochInStates = storm::storage::BitVector(epochModel.epochMatrix.getRowGroupCount(), false);
+    buffer.epochModel.epochInStates = storm::storage::BitVector(buffer.epochModel.epochMatrix.getRowGroupCount(), false);
     for (auto productState : productInStates) {
-        STORM_LOG_ASSERT(productToEpochModelStateMapping[productState] < epochModel.epochMatrix.getRowGroupCount(),
+        STORM_LOG_ASSERT(productToEpochModelStateMapping[productState] < buffer.epochModel.epochMatrix.getRowGroupCount(),
                          "Selected product state does not exist in the epoch model.");
-        epochModel.epochInStates.set(productToEpochModelStateMapping[productState], true);
+        buffer.epochModel.epochInStates.set(productToEpochModelStateMapping[productState], true);
     }
 
     std::vector<uint64_t> toEpochModelInStatesMap(productModel->getProduct().getNumberOfStates(), std::numeric_limits<uint64_t>::max());
-    std::vector<uint64_t> epochModelStateToInStateMap = epochModel.epochInStates.getNumberOfSetBitsBeforeIndices();
+    std::vector<uint64_t> epochModelStateToInStateMap = buffer.epochModel.epochInStates.getNumberOfSetBitsBeforeIndices();
     for (auto productState : productInStates) {
         toEpochModelInStatesMap[productState] = epochModelStateToInStateMap[productToEpochModelStateMapping[productState]];
     }
-    productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
+    buffer.productStateToEpochModelInStateMap = std::make_shared<std::vector<uint64_t> const>(std::move(toEpochModelInStatesMap));
 
-    epochModel.objectiveRewardFilter.clear();
-    for (auto const& objRewards : epochModel.objectiveRewards) {
-        epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
-        epochModel.objectiveRewardFilter.back().complement();
+    buffer.epochModel.objectiveRewardFilter.clear();
+    for (auto const& objRewards : buffer.epochModel.objectiveRewards) {
+        buffer.epochModel.objectiveRewardFilter.push_back(storm::utility::vector::filterZero(objRewards));
+        buffer.epochModel.objectiveRewardFilter.back().complement();
     }
 }
 
@@ -668,7 +805,10 @@ template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setEquationSystemFormatForEpochModel(
     storm::solver::LinearEquationSolverProblemFormat eqSysFormat) {
     STORM_LOG_ASSERT(model.isOfType(storm::models::ModelType::Dtmc), "Trying to set the equation problem format although the model is not deterministic.");
-    epochModel.equationSolverProblemFormat = eqSysFormat;
+    equationSolverProblemFormat = eqSysFormat;
+    for (auto& buffer : epochModelBuffers) {
+        buffer.epochModel.equationSolverProblemFormat = eqSysFormat;
+    }
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -859,16 +999,23 @@ boost::optional<ValueType> MultiDimensionalRewardUnfolding<ValueType, SingleObje
 
 template<typename ValueType, bool SingleObjectiveMode>
 void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutionForCurrentEpoch(std::vector<SolutionType>&& inStateSolutions) {
-    STORM_LOG_ASSERT(currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
-    STORM_LOG_ASSERT(inStateSolutions.size() == epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    auto const& buffer = epochModelBuffers.front();
+    STORM_LOG_ASSERT(buffer.currentEpoch, "Tried to set a solution for the current epoch, but no epoch was specified before.");
+    STORM_LOG_ASSERT(inStateSolutions.size() == buffer.epochModel.epochInStates.getNumberOfSetBits(), "Invalid number of solutions.");
+    storeEpochSolution(buffer.currentEpoch.get(), buffer.productStateToEpochModelInStateMap, std::move(inStateSolutions));
+}
+
+template<typename ValueType, bool SingleObjectiveMode>
+void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::storeEpochSolution(
+    Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap, std::vector<SolutionType>&& inStateSolutions) {
 
     std::set<Epoch> predecessorEpochs, successorEpochs;
     for (auto const& step : possibleEpochSteps) {
-        epochManager.gatherPredecessorEpochs(predecessorEpochs, currentEpoch.get(), step);
-        successorEpochs.insert(epochManager.getSuccessorEpoch(currentEpoch.get(), step));
+        epochManager.gatherPredecessorEpochs(predecessorEpochs, epoch, step);
+        successorEpochs.insert(epochManager.getSuccessorEpoch(epoch, step));
     }
-    predecessorEpochs.erase(currentEpoch.get());
-    successorEpochs.erase(currentEpoch.get());
+    predecessorEpochs.erase(epoch);
+    successorEpochs.erase(epoch);
 
     // clean up solutions that are not needed anymore
     for (auto const& successorEpoch : successorEpochs) {
@@ -883,9 +1030,9 @@ void MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::setSolutio
     // add the new solution
     EpochSolution solution;
     solution.count = predecessorEpochs.size();
-    solution.productStateToSolutionVectorMap = productStateToEpochModelInStateMap;
+    solution.productStateToSolutionVectorMap = productStateToSolutionVectorMap;
     solution.solutions = std::move(inStateSolutions);
-    epochSolutions[currentEpoch.get()] = std::move(solution);
+    epochSolutions[epoch] = std::move(solution);
 }
 
 template<typename ValueType, bool SingleObjectiveMode>
@@ -898,7 +1045,8 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::EpochSolution const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions,
+                                                                                  Epoch const& epoch) const {
     auto epochSolutionIt = solutions.find(epoch);
     STORM_LOG_ASSERT(epochSolutionIt != solutions.end(), "Requested unexisting solution for epoch " << epochManager.toString(epoch) << ".");
     return *epochSolutionIt->second;
@@ -906,7 +1054,8 @@ MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getEpochSolutio
 
 template<typename ValueType, bool SingleObjectiveMode>
 typename MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::SolutionType const&
-MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) {
+MultiDimensionalRewardUnfolding<ValueType, SingleObjectiveMode>::getStateSolution(EpochSolution const& epochSolution,
+                                                                                  uint64_t const& productState) const {
     STORM_LOG_ASSERT(productState < epochSolution.productStateToSolutionVectorMap->size(), "Requested solution at an unexisting product state.");
     STORM_LOG_ASSERT((*epochSolution.productStateToSolutionVectorMap)[productState] < epochSolution.solutions.size(),
                      "Requested solution for epoch at product state " << productState << " for which no solution was stored.");
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <boost/optional.hpp>
+#include <functional>
 
 #include "storm/modelchecker/multiobjective/Objective.h"
 #include "storm/modelchecker/prctl/helper/rewardbounded/Dimension.h"
@@ -62,6 +63,32 @@ class MultiDimensionalRewardUnfolding {
      */
     std::vector<Epoch> getEpochComputationOrder(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
 
+    /*!
+     * Partitions the epochs that need to be analyzed to get a result at the start epoch into wavefronts.
+     * Epochs of the same wavefront only depend on epochs of previous wavefronts. Hence, they can be analyzed independently of each other.
+     * @param stopAtComputedEpochs if set, the search for epochs that need to be computed is stopped at epochs that already have been computed earlier.
+     */
+    std::vector<std::vector<Epoch>> getEpochComputationWavefronts(Epoch const& startEpoch, bool stopAtComputedEpochs = false);
+
+    /*!
+     * Returns the number of workers that analyzeEpochs uses at most. Callers can use this to maintain solver data for each worker.
+     */
+    uint64_t getNumberOfEpochWorkers() const;
+
+    /*!
+     * Builds and analyzes the epoch models for the given epochs and stores the obtained solutions.
+     * The given epochs need to be independent of each other (e.g. the epochs of a single wavefront) and all their successor epochs need to be solved.
+     * The epochs are distributed over several workers that each have their own epoch model. If Intel TBB is enabled, the workers run in parallel.
+     * Output that is printed while analyzing an epoch is printed in the order of the given epochs.
+     * @param analyzeEpochModel Analyzes the given epoch model. The second argument is the index of the worker which is smaller than getNumberOfEpochWorkers().
+     * @param buildingTime if given, the time spent on building epoch models (summed over all workers) is added to this stopwatch.
+     * @param checkingTime if given, the time spent on analyzing epoch models (summed over all workers) is added to this stopwatch.
+     * @return the number of analyzed epochs. This is smaller than the number of given epochs if the computation has been aborted.
+     */
+    uint64_t analyzeEpochs(std::vector<Epoch> const& epochs,
+                           std::function<std::vector<SolutionType>(EpochModel<ValueType, SingleObjectiveMode>&, uint64_t)> const& analyzeEpochModel,
+                           storm::utility::Stopwatch* buildingTime = nullptr, storm::utility::Stopwatch* checkingTime = nullptr);
+
     EpochModel<ValueType, SingleObjectiveMode>& setCurrentEpoch(Epoch const& epoch);
 
     void setEquationSystemFormatForEpochModel(storm::solver::LinearEquationSolverProblemFormat eqSysFormat);
@@ -85,7 +112,19 @@ class MultiDimensionalRewardUnfolding {
     Dimension<ValueType> const& getDimension(uint64_t dim) const;
 
    private:
-    void setCurrentEpochClass(Epoch const& epoch);
+    /*!
+     * Data for building epoch models. Workers that build epoch models concurrently each use their own buffer.
+     */
+    struct EpochModelBuffer {
+        EpochModel<ValueType, SingleObjectiveMode> epochModel;
+        // The epoch for which the epoch model has been built most recently
+        boost::optional<Epoch> currentEpoch;
+        std::vector<uint64_t> epochModelToProductChoiceMap;
+        std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
+    };
+
+    void buildEpochModel(EpochModelBuffer& buffer, Epoch const& epoch) const;
+    void setEpochClass(EpochModelBuffer& buffer, Epoch const& epoch) const;
     void initialize(std::set<storm::expressions::Variable> const& infinityBoundVariables = {});
 
     void initializeObjectives(std::vector<Epoch>& epochSteps, std::set<storm::expressions::Variable> const& infinityBoundVariables);
@@ -121,20 +160,21 @@ class MultiDimensionalRewardUnfolding {
         std::vector<SolutionType> solutions;
     };
     std::map<Epoch, EpochSolution> epochSolutions;
-    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch);
-    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState);
+    EpochSolution const& getEpochSolution(std::map<Epoch, EpochSolution const*> const& solutions, Epoch const& epoch) const;
+    SolutionType const& getStateSolution(EpochSolution const& epochSolution, uint64_t const& productState) const;
+    void storeEpochSolution(Epoch const& epoch, std::shared_ptr<std::vector<uint64_t> const> const& productStateToSolutionVectorMap,
+                            std::vector<SolutionType>&& inStateSolutions);
 
     storm::models::sparse::Model<ValueType> const& model;
     std::vector<storm::modelchecker::multiobjective::Objective<ValueType>> objectives;
 
     std::unique_ptr<ProductModel<ValueType>> productModel;
 
-    std::vector<uint64_t> epochModelToProductChoiceMap;
-    std::shared_ptr<std::vector<uint64_t> const> productStateToEpochModelInStateMap;
     std::set<Epoch> possibleEpochSteps;
 
-    EpochModel<ValueType, SingleObjectiveMode> epochModel;
-    boost::optional<Epoch> currentEpoch;
+    // The first buffer is used for the epoch models obtained via setCurrentEpoch
+    std::vector<EpochModelBuffer> epochModelBuffers;
+    boost::optional<storm::solver::LinearEquationSolverProblemFormat> equationSolverProblemFormat;
 
     EpochManager epochManager;
 
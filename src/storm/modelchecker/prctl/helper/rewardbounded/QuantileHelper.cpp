@@ -21,6 +21,7 @@
 #include "storm/logic/BoundedUntilFormula.h"
 #include "storm/logic/ProbabilityOperatorFormula.h"
 
+#include "storm/exceptions/AbortException.h"
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/UnexpectedException.h"
 
@@ -395,9 +396,11 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                                                 CostLimitClosure& unsatCostLimits, MultiDimensionalRewardUnfolding<ValueType, true>& rewardUnfolding) {
     auto lowerBound = rewardUnfolding.getLowerObjectiveBound();
     auto upperBound = rewardUnfolding.getUpperObjectiveBound();
-    std::vector<ValueType> x, b;
-    std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>> minMaxSolver;  // Needed for MDP
-    std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> linEqSolver;         // Needed for DTMC
+    // Each worker that analyzes epochs gets its own solver data
+    uint64_t const numWorkers = rewardUnfolding.getNumberOfEpochWorkers();
+    std::vector<std::vector<ValueType>> x(numWorkers), b(numWorkers);
+    std::vector<std::unique_ptr<storm::solver::MinMaxLinearEquationSolver<ValueType>>> minMaxSolvers(numWorkers);  // Needed for MDP
+    std::vector<std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>>> linEqSolvers(numWorkers);         // Needed for DTMC
     if (!model.isNondeterministicModel()) {
         rewardUnfolding.setEquationSystemFormatForEpochModel(storm::solver::GeneralLinearEquationSolverFactory<ValueType>().getEquationProblemFormat(env));
     }
@@ -431,41 +434,45 @@ bool QuantileHelper<ModelType>::computeQuantile(Environment& env, storm::storage
                     ++costLimitIt;
                 }
                 STORM_LOG_DEBUG("Checking start epoch " << rewardUnfolding.getEpochManager().toString(startEpoch) << ".");
-                auto epochSequence = rewardUnfolding.getEpochComputationOrder(startEpoch, true);
-                for (auto const& epoch : epochSequence) {
-                    ++numCheckedEpochs;
+                auto epochWavefronts = rewardUnfolding.getEpochComputationWavefronts(startEpoch, true);
+                for (auto const& wavefront : epochWavefronts) {
                     swEpochAnalysis.start();
-                    auto& epochModel = rewardUnfolding.setCurrentEpoch(epoch);
-                    if (model.isNondeterministicModel()) {
-                        rewardUnfolding.setSolutionForCurrentEpoch(
-                            epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x, b, minMaxSolver, lowerBound, upperBound));
-                    } else {
-                        rewardUnfolding.setSolutionForCurrentEpoch(epochModel.analyzeSingleObjective(env, x, b, linEqSolver, lowerBound, upperBound));
-                    }
+                    uint64_t const numAnalyzedEpochs = rewardUnfolding.analyzeEpochs(wavefront, [&](auto& epochModel, uint64_t workerIndex) {
+                        if (model.isNondeterministicModel()) {
+                            return epochModel.analyzeSingleObjective(env, boundedUntilOperator.getOptimalityType(), x[workerIndex], b[workerIndex],
+                                                                     minMaxSolvers[workerIndex], lowerBound, upperBound);
+                        } else {
+                            return epochModel.analyzeSingleObjective(env, x[workerIndex], b[workerIndex], linEqSolvers[workerIndex], lowerBound, upperBound);
+                        }
+                    });
                     swEpochAnalysis.stop();
+                    numCheckedEpochs += numAnalyzedEpochs;
+                    STORM_LOG_THROW(numAnalyzedEpochs == wavefront.size(), storm::exceptions::AbortException, "Aborted quantile computation.");
 
-                    CostLimits epochAsCostLimits;
-                    if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
-                                                   epochAsCostLimits)) {
-                        ValueType currValue = rewardUnfolding.getInitialStateResult(epoch);
-                        bool propertySatisfied;
-                        if (env.solver().isForceSoundness()) {
-                            ValueType sumOfEpochDimensions =
-                                storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getSumOfDimensions(epoch) + 1);
-                            auto lowerUpperValue = getLowerUpperBound(env, sumOfEpochDimensions, currValue);
-                            propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
-                            if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
-                                // unclear result due to insufficient precision.
-                                swExploration.stop();
-                                return false;
+                    for (auto const& epoch : wavefront) {
+                        CostLimits epochAsCostLimits;
+                        if (translateEpochToCostLimits(epoch, startEpoch, consideredDimensions, lowerBoundedDimensions, rewardUnfolding.getEpochManager(),
+                                                       epochAsCostLimits)) {
+                            ValueType currValue = rewardUnfolding.getInitialStateResult(epoch);
+                            bool propertySatisfied;
+                            if (env.solver().isForceSoundness()) {
+                                ValueType sumOfEpochDimensions =
+                                    storm::utility::convertNumber<ValueType>(rewardUnfolding.getEpochManager().getSumOfDimensions(epoch) + 1);
+                                auto lowerUpperValue = getLowerUpperBound(env, sumOfEpochDimensions, currValue);
+                                propertySatisfied = boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.first);
+                                if (propertySatisfied != boundedUntilOperator.getBound().isSatisfied(lowerUpperValue.second)) {
+                                    // unclear result due to insufficient precision.
+                                    swExploration.stop();
+                                    return false;
+                                }
+                            } else {
+                                propertySatisfied = boundedUntilOperator.getBound().isSatisfied(currValue);
+                            }
+                            if (propertySatisfied) {
+                                satCostLimits.insert(epochAsCostLimits);
+                            } else {
+                                unsatCostLimits.insert(epochAsCostLimits);
                             }
-                        } else {
-                            propertySatisfied = boundedUntilOperator.getBound().isSatisfied(currValue);
-                        }
-                        if (propertySatisfied) {
-                            satCostLimits.insert(epochAsCostLimits);
-                        } else {
-                            unsatCostLimits.insert(epochAsCostLimits);
                         }
                     }
                 }
@@ -0,0 +1,223 @@
+#include "storm/modelchecker/smc/PathSampler.h"
+
+#include <algorithm>
+
+#include "storm/generator/JaniNextStateGenerator.h"
+#include "storm/generator/PrismNextStateGenerator.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+#include "storm/exceptions/InvalidPropertyException.h"
+#include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace smc_detail {
+
+namespace {
+std::unique_ptr<storm::generator::NextStateGenerator<double, uint32_t>> createGenerator(storm::storage::SymbolicModelDescription const& model,
+                                                                                      SamplingObjective const& objective) {
+    storm::generator::NextStateGeneratorOptions options(false, false);
+    if (objective.type != SamplingObjective::Type::BoundedUntil) {
+        if (objective.rewardModelName) {
+            options.addRewardModel(objective.rewardModelName.get());
+        } else {
+            options.setBuildAllRewardModels();
+        }
+    }
+
+    std::unique_ptr<storm::generator::NextStateGenerator<double, uint32_t>> result;
+    if (model.isPrismProgram()) {
+        result = std::make_unique<storm::generator::PrismNextStateGenerator<double, uint32_t>>(model.asPrismProgram(), options);
+    } else {
+        STORM_LOG_THROW(model.isJaniModel(), storm::exceptions::NotSupportedException, "Unsupported model description.");
+        result = std::make_unique<storm::generator::JaniNextStateGenerator<double, uint32_t>>(model.asJaniModel(), options);
+    }
+    STORM_LOG_THROW(objective.type == SamplingObjective::Type::BoundedUntil || result->getNumberOfRewardModels() == 1,
+                    storm::exceptions::InvalidPropertyException, "The reward model of the property is not uniquely specified.");
+    STORM_LOG_THROW(result->getModelType() == storm::generator::ModelType::DTMC || result->getModelType() == storm::generator::ModelType::CTMC ||
+                        result->getModelType() == storm::generator::ModelType::MDP,
+                    storm::exceptions::NotSupportedException, "Statistical model checking is only supported for DTMCs, CTMCs and MDPs.");
+    return result;
+}
+}  // namespace
+
+PathSampler::PathSampler(storm::storage::SymbolicModelDescription const& model, SamplingObjective const& objective, SchedulerType scheduler,
+                         uint64_t seed, uint64_t stream, uint64_t cacheSize)
+    : objective(objective),
+      scheduler(scheduler),
+      generator(createGenerator(model, objective)),
+      hasRewardModel(objective.type != SamplingObjective::Type::BoundedUntil),
+      randomGenerator(seed, stream),
+      cache(generator->getStateSize(), cacheSize) {
+    std::vector<uint32_t> initialStates = generator->getInitialStates([this](storm::generator::CompressedState const& state) {
+        expandedStates.push_back(state);
+        return static_cast<uint32_t>(expandedStates.size() - 1);
+    });
+    STORM_LOG_THROW(initialStates.size() == 1, storm::exceptions::NotSupportedException,
+                    "Statistical model checking requires a unique initial state.");
+    initialState = expandedStates[initialStates.front()];
+    expandedStates.clear();
+}
+
+double PathSampler::sample() {
+    switch (objective.type) {
+        case SamplingObjective::Type::BoundedUntil:
+            return sampleBoundedUntil();
+        case SamplingObjective::Type::CumulativeReward:
+            return sampleCumulativeReward();
+        case SamplingObjective::Type::InstantaneousReward:
+            return sampleInstantaneousReward();
+    }
+    STORM_LOG_ASSERT(false, "Unknown objective type.");
+    return 0.0;
+}
+
+bool PathSampler::isDiscreteTimeModel() const {
+    return generator->isDiscreteTimeModel();
+}
+
+StateCache const& PathSampler::getStateCache() const {
+    return cache;
+}
+
+double PathSampler::sampleBoundedUntil() {
+    storm::generator::CompressedState currentState = initialState;
+    uint64_t step = 0;
+    double time = 0.0;
+    while (true) {
+        StateCache::Entry const& entry = getEntry(currentState);
+        if (entry.target) {
+            return 1.0;
+        }
+        if (!entry.constraint || entry.absorbing || (objective.stepBounded && step == objective.stepBound)) {
+            return 0.0;
+        }
+        StateCache::Choice const& choice = chooseChoice(entry);
+        if (!objective.stepBounded) {
+            time += randomGenerator.random_exponential(choice.exitRate);
+            if (time > objective.timeBound) {
+                return 0.0;
+            }
+        }
+        currentState = sampleSuccessor(choice);
+        ++step;
+    }
+}
+
+double PathSampler::sampleCumulativeReward() {
+    storm::generator::CompressedState currentState = initialState;
+    double reward = 0.0;
+    if (objective.stepBounded) {
+        for (uint64_t step = 0; step < objective.stepBound; ++step) {
+            StateCache::Entry const& entry = getEntry(currentState);
+            if (entry.absorbing) {
+                // The path stays in this state and only collects its state reward.
+                return reward + (objective.stepBound - step) * entry.stateReward;
+            }
+            StateCache::Choice const& choice = chooseChoice(entry);
+            reward += entry.stateReward + choice.reward;
+            currentState = sampleSuccessor(choice);
+        }
+    } else {
+        double time = 0.0;
+        while (true) {
+            StateCache::Entry const& entry = getEntry(currentState);
+            if (entry.absorbing) {
+                return reward + (objective.timeBound - time) * entry.stateReward;
+            }
+            StateCache::Choice const& choice = chooseChoice(entry);
+            double sojournTime = randomGenerator.random_exponential(choice.exitRate);
+            if (time + sojournTime > objective.timeBound) {
+                return reward + (objective.timeBound - time) * entry.stateReward;
+            }
+            // State rewards are collected per time unit, the rewards of the choice upon leaving the state.
+            reward += sojournTime * entry.stateReward + choice.reward;
+            time += sojournTime;
+            currentState = sampleSuccessor(choice);
+        }
+    }
+    return reward;
+}
+
+double PathSampler::sampleInstantaneousReward() {
+    storm::generator::CompressedState currentState = initialState;
+    uint64_t step = 0;
+    double time = 0.0;
+    while (true) {
+        StateCache::Entry const& entry = getEntry(currentState);
+        if (entry.absorbing || (objective.stepBounded && step == objective.stepBound)) {
+            return entry.stateReward;
+        }
+        StateCache::Choice const& choice = chooseChoice(entry);
+        if (!objective.stepBounded) {
+            time += randomGenerator.random_exponential(choice.exitRate);
+            if (time > objective.timeBound) {
+                return entry.stateReward;
+            }
+        }
+        currentState = sampleSuccessor(choice);
+        ++step;
+    }
+}
+
+StateCache::Entry const& PathSampler::getEntry(storm::generator::CompressedState const& state) {
+    StateCache::Entry const* cachedEntry = cache.find(state);
+    if (cachedEntry) {
+        return *cachedEntry;
+    }
+
+    StateCache::Entry entry;
+    generator->load(state);
+    entry.target = objective.target.isInitialized() && generator->satisfies(objective.target);
+    entry.constraint = !objective.constraint.isInitialized() || generator->satisfies(objective.constraint);
+
+    expandedStates.clear();
+    storm::generator::StateBehavior<double, uint32_t> behavior = generator->expand([this](storm::generator::CompressedState const& successor) {
+        expandedStates.push_back(successor);
+        return static_cast<uint32_t>(expandedStates.size() - 1);
+    });
+    entry.stateReward = hasRewardModel && !behavior.getStateRewards().empty() ? behavior.getStateRewards().front() : 0.0;
+
+    entry.absorbing = true;
+    entry.choices.reserve(behavior.getNumberOfChoices());
+    for (auto const& generatedChoice : behavior.getChoices()) {
+        StateCache::Choice choice;
+        choice.exitRate = generatedChoice.getTotalMass();
+        choice.reward = hasRewardModel && !generatedChoice.getRewards().empty() ? generatedChoice.getRewards().front() : 0.0;
+        choice.successors.reserve(generatedChoice.size());
+        choice.cumulativeProbabilities.reserve(generatedChoice.size());
+        double cumulativeProbability = 0.0;
+        for (auto const& successorProbabilityPair : generatedChoice) {
+            cumulativeProbability += successorProbabilityPair.second / choice.exitRate;
+            choice.successors.push_back(expandedStates[successorProbabilityPair.first]);
+            choice.cumulativeProbabilities.push_back(cumulativeProbability);
+            entry.absorbing &= choice.successors.back() == state;
+        }
+        if (!choice.cumulativeProbabilities.empty()) {
+            // Guard against rounding errors when sampling the last successor.
+            choice.cumulativeProbabilities.back() = 1.0;
+        }
+        entry.absorbing &= choice.reward == 0.0;
+        entry.choices.push_back(std::move(choice));
+    }
+    return cache.insert(state, std::move(entry));
+}
+
+StateCache::Choice const& PathSampler::chooseChoice(StateCache::Entry const& entry) {
+    STORM_LOG_ASSERT(!entry.choices.empty(), "Cannot choose from a state without choices.");
+    if (entry.choices.size() == 1 || scheduler == SchedulerType::First) {
+        return entry.choices.front();
+    }
+    return entry.choices[randomGenerator.random_uint(0, entry.choices.size() - 1)];
+}
+
+storm::generator::CompressedState const& PathSampler::sampleSuccessor(StateCache::Choice const& choice) {
+    double quantile = randomGenerator.random();
+    auto it = std::upper_bound(choice.cumulativeProbabilities.begin(), choice.cumulativeProbabilities.end(), quantile);
+    return choice.successors[std::min<uint64_t>(std::distance(choice.cumulativeProbabilities.begin(), it), choice.successors.size() - 1)];
+}
+
+}  // namespace smc_detail
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,105 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include <boost/optional.hpp>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/generator/NextStateGenerator.h"
+#include "storm/modelchecker/smc/StateCache.h"
+#include "storm/settings/modules/SmcSettings.h"
+#include "storm/storage/expressions/Expression.h"
+#include "storm/utility/random.h"
+
+namespace storm {
+namespace storage {
+class SymbolicModelDescription;
+}
+
+namespace modelchecker {
+namespace smc_detail {
+
+/*!
+ * Describes the random variable that is observed on a sampled path.
+ */
+struct SamplingObjective {
+    enum class Type { BoundedUntil, CumulativeReward, InstantaneousReward };
+
+    Type type;
+
+    // The constraint and target of a bounded until objective. For reward objectives, these are not initialized.
+    storm::expressions::Expression constraint;
+    storm::expressions::Expression target;
+
+    // Whether the bound refers to the number of steps. Otherwise, it refers to the time of a continuous-time model.
+    bool stepBounded;
+    uint64_t stepBound;
+    double timeBound;
+
+    // The reward model of a reward objective. If not given, the model needs to have a unique reward model.
+    boost::optional<std::string> rewardModelName;
+};
+
+/*!
+ * Samples paths of a PRISM program or JANI model from its unique initial state. The states are generated on the fly using the next-state
+ * generators that are also used by the simulators and the explicit model builder. Nondeterminism is resolved by a fixed memoryless scheduler.
+ *
+ * Each sampler owns its generator, random number generator and state cache, so distinct samplers can be used concurrently. They must, however,
+ * be constructed sequentially as the generators may declare variables in the expression manager of the model.
+ */
+class PathSampler {
+   public:
+    typedef storm::settings::modules::SmcSettings::SchedulerType SchedulerType;
+
+    /*!
+     * @param model The PRISM program or JANI model. Its constants need to be defined.
+     * @param objective The objective that is evaluated on the sampled paths.
+     * @param scheduler The scheduler resolving nondeterministic choices.
+     * @param seed The seed of the random number generator.
+     * @param stream The stream of the random number generator. Samplers with the same seed but different streams sample independently.
+     * @param cacheSize The number of bytes that the cache of explored states may occupy.
+     */
+    PathSampler(storm::storage::SymbolicModelDescription const& model, SamplingObjective const& objective, SchedulerType scheduler, uint64_t seed,
+                uint64_t stream, uint64_t cacheSize);
+
+    /*!
+     * Samples a path and evaluates the objective on it. For bounded until objectives, the result is one if the path satisfies the formula and
+     * zero otherwise.
+     */
+    double sample();
+
+    bool isDiscreteTimeModel() const;
+
+    StateCache const& getStateCache() const;
+
+   private:
+    double sampleBoundedUntil();
+    double sampleCumulativeReward();
+    double sampleInstantaneousReward();
+
+    /*!
+     * Retrieves the cached behavior of the given state, exploring the state if necessary.
+     */
+    StateCache::Entry const& getEntry(storm::generator::CompressedState const& state);
+
+    StateCache::Choice const& chooseChoice(StateCache::Entry const& entry);
+    storm::generator::CompressedState const& sampleSuccessor(StateCache::Choice const& choice);
+
+    SamplingObjective objective;
+    SchedulerType scheduler;
+
+    std::unique_ptr<storm::generator::NextStateGenerator<double, uint32_t>> generator;
+    bool hasRewardModel;
+    storm::generator::CompressedState initialState;
+
+    // The states that were reached while expanding the currently loaded state. Their position serves as their index.
+    std::vector<storm::generator::CompressedState> expandedStates;
+
+    storm::utility::RandomProbabilityGenerator<double> randomGenerator;
+    StateCache cache;
+};
+
+}  // namespace smc_detail
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,303 @@
+#include "storm/modelchecker/smc/SmcModelChecker.h"
+
+#include <cmath>
+#include <random>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include "storm/logic/FragmentSpecification.h"
+#include "storm/logic/Formulas.h"
+
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/smc/PathSampler.h"
+#include "storm/modelchecker/smc/StatisticalTests.h"
+
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/SmcSettings.h"
+
+#include "storm/storage/jani/Model.h"
+#include "storm/storage/prism/Program.h"
+
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace modelchecker {
+
+template<typename ModelType>
+SmcModelChecker<ModelType>::SmcModelChecker(storm::storage::SymbolicModelDescription const& model) {
+    if (model.isPrismProgram()) {
+        // Labels may refer to formulas, so we substitute them before translating labels to expressions.
+        this->model = model.asPrismProgram().substituteConstantsFormulas();
+        labelToExpressionMapping = this->model.asPrismProgram().getLabelToExpressionMapping();
+        discreteTime = this->model.asPrismProgram().getModelType() != storm::prism::Program::ModelType::CTMC;
+    } else {
+        this->model = model;
+        storm::jani::Model const& janiModel = this->model.asJaniModel();
+        discreteTime = janiModel.getModelType() != storm::jani::ModelType::CTMC;
+        for (auto const& variable : janiModel.getGlobalVariables().getBooleanVariables()) {
+            if (variable.isTransient()) {
+                labelToExpressionMapping[variable.getName()] = janiModel.getLabelExpression(variable);
+            }
+        }
+    }
+
+    auto const& smcSettings = storm::settings::getModule<storm::settings::modules::SmcSettings>();
+    if (smcSettings.isSeedSet()) {
+        seed = smcSettings.getSeed();
+    } else {
+        seed = std::random_device()();
+        STORM_LOG_INFO("Using seed " << seed << " for statistical model checking.");
+    }
+}
+
+template<typename ModelType>
+bool SmcModelChecker<ModelType>::canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const {
+    storm::logic::Formula const& formula = checkTask.getFormula();
+    storm::logic::FragmentSpecification fragment = storm::logic::propositional();
+    fragment.setProbabilityOperatorsAllowed(true).setRewardOperatorsAllowed(true);
+    fragment.setOperatorAtTopLevelRequired(true).setNestedOperatorsAllowed(false);
+    fragment.setBoundedUntilFormulasAllowed(true).setStepBoundedUntilFormulasAllowed(true).setTimeBoundedUntilFormulasAllowed(true);
+    fragment.setCumulativeRewardFormulasAllowed(true).setStepBoundedCumulativeRewardFormulasAllowed(true).setTimeBoundedCumulativeRewardFormulasAllowed(
+        true);
+    fragment.setInstantaneousFormulasAllowed(true);
+    return formula.isInFragment(fragment) && checkTask.isOnlyInitialStatesRelevantSet();
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SmcModelChecker<ModelType>::checkProbabilityOperatorFormula(
+    Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) {
+    storm::logic::Formula const& subformula = checkTask.getFormula().getSubformula();
+    if (checkTask.isBoundSet() && subformula.isBoundedUntilFormula() &&
+        storm::settings::getModule<storm::settings::modules::SmcSettings>().getHypothesisTestingMethod() ==
+            storm::settings::modules::SmcSettings::HypothesisTestingMethod::Sprt) {
+        STORM_LOG_WARN_COND(!checkTask.isOptimizationDirectionSet(),
+                            "Statistical model checking ignores the optimization direction and resolves nondeterminism with a fixed scheduler.");
+        return decide(getBoundedUntilObjective(subformula.asBoundedUntilFormula()), checkTask.getBoundComparisonType(), checkTask.getBoundThreshold());
+    }
+    return AbstractModelChecker<ModelType>::checkProbabilityOperatorFormula(env, checkTask);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SmcModelChecker<ModelType>::computeBoundedUntilProbabilities(
+    Environment const&, CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) {
+    STORM_LOG_WARN_COND(!checkTask.isOptimizationDirectionSet(),
+                        "Statistical model checking ignores the optimization direction and resolves nondeterminism with a fixed scheduler.");
+    return estimate(getBoundedUntilObjective(checkTask.getFormula()));
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SmcModelChecker<ModelType>::computeCumulativeRewards(
+    Environment const&, storm::logic::RewardMeasureType, CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) {
+    storm::logic::CumulativeRewardFormula const& formula = checkTask.getFormula();
+    STORM_LOG_THROW(!formula.isMultiDimensional() && !formula.getTimeBoundReference().isRewardBound(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support reward-bounded or multi-dimensional cumulative rewards.");
+    STORM_LOG_THROW(!formula.hasRewardAccumulation(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support reward accumulations.");
+    STORM_LOG_WARN_COND(!checkTask.isOptimizationDirectionSet(),
+                        "Statistical model checking ignores the optimization direction and resolves nondeterminism with a fixed scheduler.");
+
+    smc_detail::SamplingObjective objective = getRewardObjective(checkTask);
+    objective.type = smc_detail::SamplingObjective::Type::CumulativeReward;
+    objective.stepBounded = objective.stepBounded || formula.getTimeBoundReference().isStepBound();
+    if (objective.stepBounded) {
+        objective.stepBound = formula.template getNonStrictBound<uint64_t>();
+    } else {
+        objective.timeBound = formula.template getBound<double>();
+    }
+    return estimate(objective);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SmcModelChecker<ModelType>::computeInstantaneousRewards(
+    Environment const&, storm::logic::RewardMeasureType, CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) {
+    storm::logic::InstantaneousRewardFormula const& formula = checkTask.getFormula();
+    STORM_LOG_WARN_COND(!checkTask.isOptimizationDirectionSet(),
+                        "Statistical model checking ignores the optimization direction and resolves nondeterminism with a fixed scheduler.");
+
+    smc_detail::SamplingObjective objective = getRewardObjective(checkTask);
+    objective.type = smc_detail::SamplingObjective::Type::InstantaneousReward;
+    objective.stepBounded = objective.stepBounded || formula.isStepBounded();
+    if (objective.stepBounded) {
+        objective.stepBound = formula.template getBound<uint64_t>();
+    } else {
+        objective.timeBound = formula.template getBound<double>();
+    }
+    return estimate(objective);
+}
+
+template<typename ModelType>
+smc_detail::SamplingObjective SmcModelChecker<ModelType>::getBoundedUntilObjective(storm::logic::BoundedUntilFormula const& formula) const {
+    STORM_LOG_THROW(!formula.isMultiDimensional(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support multi-dimensional bounded until formulas.");
+    STORM_LOG_THROW(!formula.getTimeBoundReference().isRewardBound(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support reward-bounded until formulas.");
+    STORM_LOG_THROW(!formula.hasLowerBound(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking does not support lower bounds in until formulas.");
+    STORM_LOG_THROW(formula.hasUpperBound(), storm::exceptions::NotSupportedException,
+                    "Statistical model checking requires an upper bound in until formulas.");
+
+    smc_detail::SamplingObjective objective;
+    objective.type = smc_detail::SamplingObjective::Type::BoundedUntil;
+    objective.constraint = formula.getLeftSubformula().toExpression(model.getManager(), labelToExpressionMapping);
+    objective.target = formula.getRightSubformula().toExpression(model.getManager(), labelToExpressionMapping);
+    objective.stepBounded = discreteTime || formula.getTimeBoundReference().isStepBound();
+    objective.stepBound = 0;
+    objective.timeBound = 0.0;
+    if (objective.stepBounded) {
+        objective.stepBound = formula.template getNonStrictUpperBound<uint64_t>();
+    } else {
+        objective.timeBound = formula.template getUpperBound<double>();
+    }
+    return objective;
+}
+
+template<typename ModelType>
+template<typename FormulaType>
+smc_detail::SamplingObjective SmcModelChecker<ModelType>::getRewardObjective(CheckTask<FormulaType, ValueType> const& checkTask) const {
+    smc_detail::SamplingObjective objective;
+    objective.stepBounded = discreteTime;
+    objective.stepBound = 0;
+    objective.timeBound = 0.0;
+    if (checkTask.isRewardModelSet()) {
+        objective.rewardModelName = checkTask.getRewardModel();
+    }
+    return objective;
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SmcModelChecker<ModelType>::estimate(smc_detail::SamplingObjective const& objective) const {
+    auto const& smcSettings = storm::settings::getModule<storm::settings::modules::SmcSettings>();
+    uint64_t numberOfSamples = smc_detail::computeChernoffSampleCount(smcSettings.getEpsilon(), smcSettings.getDelta());
+    std::vector<smc_detail::PathSampler> samplers = createSamplers(objective);
+    uint64_t numberOfWorkers = samplers.size();
+    STORM_LOG_INFO("Estimating the value from " << numberOfSamples << " samples using " << numberOfWorkers << " worker(s).");
+
+    // Every worker draws a fixed share of the samples, so the result only depends on the seed and the number of workers.
+    std::vector<double> sums(numberOfWorkers, 0.0);
+    std::vector<double> squareSums(numberOfWorkers, 0.0);
+    forEachWorker(numberOfWorkers, [&](uint64_t workerIndex) {
+        uint64_t share = numberOfSamples / numberOfWorkers + (workerIndex < numberOfSamples % numberOfWorkers ? 1 : 0);
+        for (uint64_t sample = 0; sample < share; ++sample) {
+            double value = samplers[workerIndex].sample();
+            sums[workerIndex] += value;
+            squareSums[workerIndex] += value * value;
+        }
+    });
+    logStatistics(samplers);
+
+    double sum = 0.0;
+    double squareSum = 0.0;
+    for (uint64_t workerIndex = 0; workerIndex < numberOfWorkers; ++workerIndex) {
+        sum += sums[workerIndex];
+        squareSum += squareSums[workerIndex];
+    }
+    double mean = sum / numberOfSamples;
+    if (objective.type != smc_detail::SamplingObjective::Type::BoundedUntil) {
+        // Rewards are not bounded by one, so the Chernoff bound does not apply. Instead, we report the normal approximation of the error.
+        double variance = numberOfSamples > 1 ? std::max(0.0, (squareSum - sum * mean) / (numberOfSamples - 1)) : 0.0;
+        double halfWidth = 1.959963984540054 * std::sqrt(variance / numberOfSamples);
+        STORM_LOG_INFO("Estimated expected reward " << mean << " with approximate 95% confidence interval [" << mean - halfWidth << ", " << mean + halfWidth
+                                                    << "].");
+    }
+    return std::make_unique<ExplicitQuantitativeCheckResult<ValueType>>(0, mean);
+}
+
+template<typename ModelType>
+std::unique_ptr<CheckResult> SmcModelChecker<ModelType>::decide(smc_detail::SamplingObjective const& objective,
+                                                                storm::logic::ComparisonType comparisonType, double threshold) const {
+    auto const& smcSettings = storm::settings::getModule<storm::settings::modules::SmcSettings>();
+    smc_detail::SequentialProbabilityRatioTest test(threshold, smcSettings.getIndifference(), smcSettings.getSprtAlpha(), smcSettings.getSprtBeta());
+    std::vector<smc_detail::PathSampler> samplers = createSamplers(objective);
+    uint64_t numberOfWorkers = samplers.size();
+
+    // The test is fed with the outcomes of whole rounds in which every worker draws the same number of samples. Hence, the decision only depends
+    // on the seed and the number of workers.
+    uint64_t const samplesPerRound = 64;
+    std::vector<uint64_t> successes(numberOfWorkers);
+    while (test.getDecision() == smc_detail::SequentialProbabilityRatioTest::Decision::Undecided) {
+        forEachWorker(numberOfWorkers, [&](uint64_t workerIndex) {
+            successes[workerIndex] = 0;
+            for (uint64_t sample = 0; sample < samplesPerRound; ++sample) {
+                if (samplers[workerIndex].sample() > 0.0) {
+                    ++successes[workerIndex];
+                }
+            }
+        });
+        for (uint64_t workerIndex = 0; workerIndex < numberOfWorkers && test.getDecision() == smc_detail::SequentialProbabilityRatioTest::Decision::Undecided;
+             ++workerIndex) {
+            test.addSamples(successes[workerIndex], samplesPerRound);
+        }
+    }
+    logStatistics(samplers);
+    STORM_LOG_INFO("Sequential probability ratio test decided after " << test.getNumberOfSamples() << " samples.");
+
+    bool above = test.getDecision() == smc_detail::SequentialProbabilityRatioTest::Decision::Above;
+    return std::make_unique<ExplicitQualitativeCheckResult>(0, storm::logic::isLowerBound(comparisonType) ? above : !above);
+}
+
+template<typename ModelType>
+std::vector<smc_detail::PathSampler> SmcModelChecker<ModelType>::createSamplers(smc_detail::SamplingObjective const& objective) const {
+    auto const& smcSettings = storm::settings::getModule<storm::settings::modules::SmcSettings>();
+    uint64_t numberOfWorkers = smcSettings.getNumberOfWorkers();
+    if (numberOfWorkers == 0) {
+        numberOfWorkers = storm::utility::parallel::getNumberOfThreads();
+    }
+    uint64_t cacheSizePerWorker = smcSettings.getStateCacheSize() * 1024 * 1024 / numberOfWorkers;
+
+    // The samplers are created sequentially as their generators may modify the expression manager of the model.
+    std::vector<smc_detail::PathSampler> samplers;
+    samplers.reserve(numberOfWorkers);
+    for (uint64_t workerIndex = 0; workerIndex < numberOfWorkers; ++workerIndex) {
+        samplers.emplace_back(model, objective, smcSettings.getSchedulerType(), seed, workerIndex, cacheSizePerWorker);
+    }
+    return samplers;
+}
+
+template<typename ModelType>
+void SmcModelChecker<ModelType>::forEachWorker(uint64_t numberOfWorkers, std::function<void(uint64_t)> const& callback) const {
+    bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+    parallelize = numberOfWorkers > 1 && storm::utility::parallel::isIntelTbbEnabled();
+    if (parallelize) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfWorkers, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t workerIndex = range.begin(); workerIndex < range.end(); ++workerIndex) {
+                callback(workerIndex);
+            }
+        });
+    }
+#endif
+    if (!parallelize) {
+        for (uint64_t workerIndex = 0; workerIndex < numberOfWorkers; ++workerIndex) {
+            callback(workerIndex);
+        }
+    }
+}
+
+template<typename ModelType>
+void SmcModelChecker<ModelType>::logStatistics(std::vector<smc_detail::PathSampler> const& samplers) const {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t flushes = 0;
+    for (auto const& sampler : samplers) {
+        hits += sampler.getStateCache().getNumberOfHits();
+        misses += sampler.getStateCache().getNumberOfMisses();
+        flushes += sampler.getStateCache().getNumberOfFlushes();
+    }
+    STORM_LOG_INFO("State cache: " << hits << " hits, " << misses << " misses, " << flushes << " flushes.");
+}
+
+template class SmcModelChecker<storm::models::sparse::Dtmc<double>>;
+template class SmcModelChecker<storm::models::sparse::Ctmc<double>>;
+template class SmcModelChecker<storm::models::sparse::Mdp<double>>;
+
+}  // namespace modelchecker
+}  // namespace storm
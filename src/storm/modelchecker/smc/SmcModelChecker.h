@@ -0,0 +1,83 @@
+#pragma once
+
+#include <functional>
+#include <map>
+
+#include "storm/modelchecker/AbstractModelChecker.h"
+#include "storm/storage/SymbolicModelDescription.h"
+
+namespace storm {
+namespace modelchecker {
+namespace smc_detail {
+struct SamplingObjective;
+class PathSampler;
+}  // namespace smc_detail
+
+/*!
+ * A statistical model checker that estimates the values of time- and step-bounded properties by sampling paths of the model. Paths are
+ * generated on the fly, so the state space is never built. Nondeterministic choices (of MDPs) are resolved by the scheduler selected in the
+ * statistical model checking settings.
+ *
+ * Probabilities are estimated from a number of samples determined by the Chernoff-Hoeffding bound, such that the estimate deviates by at most
+ * epsilon with probability at least 1-delta. Properties with a probability bound are (by default) decided using Wald's sequential
+ * probability ratio test, which typically requires much fewer samples if the probability is not close to the bound.
+ */
+template<typename ModelType>
+class SmcModelChecker : public AbstractModelChecker<ModelType> {
+   public:
+    typedef typename ModelType::ValueType ValueType;
+
+    /*!
+     * Creates a model checker for the given PRISM program or JANI model. All constants of the model need to be defined.
+     */
+    explicit SmcModelChecker(storm::storage::SymbolicModelDescription const& model);
+
+    virtual bool canHandle(CheckTask<storm::logic::Formula, ValueType> const& checkTask) const override;
+
+    virtual std::unique_ptr<CheckResult> checkProbabilityOperatorFormula(
+        Environment const& env, CheckTask<storm::logic::ProbabilityOperatorFormula, ValueType> const& checkTask) override;
+
+    virtual std::unique_ptr<CheckResult> computeBoundedUntilProbabilities(Environment const& env,
+                                                                          CheckTask<storm::logic::BoundedUntilFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeCumulativeRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                  CheckTask<storm::logic::CumulativeRewardFormula, ValueType> const& checkTask) override;
+    virtual std::unique_ptr<CheckResult> computeInstantaneousRewards(Environment const& env, storm::logic::RewardMeasureType rewardMeasureType,
+                                                                     CheckTask<storm::logic::InstantaneousRewardFormula, ValueType> const& checkTask) override;
+
+   private:
+    smc_detail::SamplingObjective getBoundedUntilObjective(storm::logic::BoundedUntilFormula const& formula) const;
+    template<typename FormulaType>
+    smc_detail::SamplingObjective getRewardObjective(CheckTask<FormulaType, ValueType> const& checkTask) const;
+
+    /*!
+     * Estimates the expected value of the objective in the initial state.
+     */
+    std::unique_ptr<CheckResult> estimate(smc_detail::SamplingObjective const& objective) const;
+
+    /*!
+     * Decides whether the probability of the (bounded until) objective in the initial state meets the given bound.
+     */
+    std::unique_ptr<CheckResult> decide(smc_detail::SamplingObjective const& objective, storm::logic::ComparisonType comparisonType,
+                                        double threshold) const;
+
+    /*!
+     * Creates one path sampler per worker.
+     */
+    std::vector<smc_detail::PathSampler> createSamplers(smc_detail::SamplingObjective const& objective) const;
+
+    /*!
+     * Invokes the given callback for each worker index, in parallel if Intel TBB is enabled.
+     */
+    void forEachWorker(uint64_t numberOfWorkers, std::function<void(uint64_t)> const& callback) const;
+
+    void logStatistics(std::vector<smc_detail::PathSampler> const& samplers) const;
+
+    storm::storage::SymbolicModelDescription model;
+    std::map<std::string, storm::expressions::Expression> labelToExpressionMapping;
+    // Whether bounds refer to steps by default, i.e., whether the model is not a CTMC.
+    bool discreteTime;
+    uint64_t seed;
+};
+
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,59 @@
+#include "storm/modelchecker/smc/StateCache.h"
+
+namespace storm {
+namespace modelchecker {
+namespace smc_detail {
+
+StateCache::StateCache(uint64_t bitsPerState, uint64_t memoryBudget)
+    : bitsPerState(bitsPerState), memoryBudget(memoryBudget), usedMemory(0), stateToIndex(bitsPerState), hits(0), misses(0), flushes(0) {
+    // Intentionally left empty.
+}
+
+StateCache::Entry const* StateCache::find(storm::generator::CompressedState const& state) const {
+    if (stateToIndex.contains(state)) {
+        ++hits;
+        return &entries[stateToIndex.getValue(state)];
+    }
+    ++misses;
+    return nullptr;
+}
+
+StateCache::Entry const& StateCache::insert(storm::generator::CompressedState const& state, Entry&& entry) {
+    uint64_t entryMemory = estimateMemory(entry);
+    if (usedMemory + entryMemory > memoryBudget && !entries.empty()) {
+        stateToIndex = storm::storage::BitVectorHashMap<uint64_t>(bitsPerState);
+        entries.clear();
+        usedMemory = 0;
+        ++flushes;
+    }
+    usedMemory += entryMemory;
+    stateToIndex.findOrAdd(state, entries.size());
+    entries.push_back(std::move(entry));
+    return entries.back();
+}
+
+uint64_t StateCache::estimateMemory(Entry const& entry) const {
+    // A compressed state occupies its (64 bit aligned) buckets plus the vector header, both in the hash map and as successor.
+    uint64_t stateMemory = ((bitsPerState + 63) / 64) * 8 + sizeof(storm::generator::CompressedState);
+    uint64_t result = sizeof(Entry) + stateMemory + sizeof(uint64_t);
+    for (auto const& choice : entry.choices) {
+        result += sizeof(Choice) + choice.successors.size() * (stateMemory + sizeof(double));
+    }
+    return result;
+}
+
+uint64_t StateCache::getNumberOfHits() const {
+    return hits;
+}
+
+uint64_t StateCache::getNumberOfMisses() const {
+    return misses;
+}
+
+uint64_t StateCache::getNumberOfFlushes() const {
+    return flushes;
+}
+
+}  // namespace smc_detail
+}  // namespace modelchecker
+}  // namespace storm
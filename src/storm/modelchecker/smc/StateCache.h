@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+
+#include "storm/generator/CompressedState.h"
+#include "storm/storage/BitVectorHashMap.h"
+
+namespace storm {
+namespace modelchecker {
+namespace smc_detail {
+
+/*!
+ * Stores the behavior of states that were explored while sampling paths, such that revisited states need not be expanded again. The
+ * cache is bounded in memory: if adding a state would exceed the memory budget, all cached states are dropped first.
+ */
+class StateCache {
+   public:
+    struct Choice {
+        // The successors and their cumulative (normalized) probabilities.
+        std::vector<storm::generator::CompressedState> successors;
+        std::vector<double> cumulativeProbabilities;
+        // The total mass of the choice, i.e., the exit rate for continuous-time models.
+        double exitRate;
+        double reward;
+    };
+
+    struct Entry {
+        std::vector<Choice> choices;
+        double stateReward;
+        // Whether the state satisfies the constraint and target expression, respectively.
+        bool constraint;
+        bool target;
+        // Whether the state is never left and no action rewards are collected in it.
+        bool absorbing;
+    };
+
+    /*!
+     * @param bitsPerState The number of bits of a compressed state.
+     * @param memoryBudget The number of bytes the cache may occupy.
+     */
+    StateCache(uint64_t bitsPerState, uint64_t memoryBudget);
+
+    /*!
+     * Retrieves the entry of the given state or null if the state is not cached.
+     */
+    Entry const* find(storm::generator::CompressedState const& state) const;
+
+    /*!
+     * Adds the entry for the given (uncached) state. The returned reference stays valid until the next insertion.
+     */
+    Entry const& insert(storm::generator::CompressedState const& state, Entry&& entry);
+
+    uint64_t getNumberOfHits() const;
+    uint64_t getNumberOfMisses() const;
+    uint64_t getNumberOfFlushes() const;
+
+   private:
+    uint64_t estimateMemory(Entry const& entry) const;
+
+    uint64_t bitsPerState;
+    uint64_t memoryBudget;
+    uint64_t usedMemory;
+
+    storm::storage::BitVectorHashMap<uint64_t> stateToIndex;
+    std::vector<Entry> entries;
+
+    mutable uint64_t hits;
+    mutable uint64_t misses;
+    uint64_t flushes;
+};
+
+}  // namespace smc_detail
+}  // namespace modelchecker
+}  // namespace storm
@@ -0,0 +1,59 @@
+#include "storm/modelchecker/smc/StatisticalTests.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace modelchecker {
+namespace smc_detail {
+
+uint64_t computeChernoffSampleCount(double epsilon, double delta) {
+    STORM_LOG_THROW(epsilon > 0.0 && delta > 0.0 && delta < 1.0, storm::exceptions::InvalidArgumentException,
+                    "Invalid error bounds (epsilon=" << epsilon << ", delta=" << delta << ").");
+    return static_cast<uint64_t>(std::ceil(std::log(2.0 / delta) / (2.0 * epsilon * epsilon)));
+}
+
+SequentialProbabilityRatioTest::SequentialProbabilityRatioTest(double threshold, double indifference, double alpha, double beta)
+    : logLikelihoodRatio(0.0), numberOfSamples(0), decision(Decision::Undecided) {
+    STORM_LOG_THROW(alpha > 0.0 && alpha < 1.0 && beta > 0.0 && beta < 1.0, storm::exceptions::InvalidArgumentException,
+                    "Invalid error bounds (alpha=" << alpha << ", beta=" << beta << ").");
+    // Keep the probabilities of both hypotheses away from 0 and 1 such that all log-likelihoods are finite.
+    double const margin = 1e-9;
+    double aboveProbability = std::min(std::max(threshold + indifference, 2 * margin), 1.0 - margin);
+    double belowProbability = std::max(std::min(threshold - indifference, aboveProbability - margin), margin);
+
+    // We track the log-likelihood ratio of 'below' against 'above'.
+    successStep = std::log(belowProbability / aboveProbability);
+    failureStep = std::log((1.0 - belowProbability) / (1.0 - aboveProbability));
+    belowLimit = std::log((1.0 - beta) / alpha);
+    aboveLimit = std::log(beta / (1.0 - alpha));
+}
+
+SequentialProbabilityRatioTest::Decision SequentialProbabilityRatioTest::addSamples(uint64_t successes, uint64_t samples) {
+    STORM_LOG_ASSERT(successes <= samples, "More successes than samples.");
+    if (decision == Decision::Undecided) {
+        logLikelihoodRatio += successes * successStep + (samples - successes) * failureStep;
+        numberOfSamples += samples;
+        if (logLikelihoodRatio >= belowLimit) {
+            decision = Decision::Below;
+        } else if (logLikelihoodRatio <= aboveLimit) {
+            decision = Decision::Above;
+        }
+    }
+    return decision;
+}
+
+SequentialProbabilityRatioTest::Decision SequentialProbabilityRatioTest::getDecision() const {
+    return decision;
+}
+
+uint64_t SequentialProbabilityRatioTest::getNumberOfSamples() const {
+    return numberOfSamples;
+}
+
+}  // namespace smc_detail
+}  // namespace modelchecker
+}  // namespace storm
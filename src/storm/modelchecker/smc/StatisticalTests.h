@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+
+namespace storm {
+namespace modelchecker {
+namespace smc_detail {
+
+/*!
+ * Computes the number of samples that suffices to estimate the mean of a [0,1]-valued random variable up to the given absolute error with
+ * probability at least 1-delta. This is the Chernoff-Hoeffding bound (also known as the Okamoto bound) n >= ln(2/delta) / (2 epsilon^2).
+ *
+ * @param epsilon The maximal absolute error.
+ * @param delta The probability with which the error may be exceeded.
+ */
+uint64_t computeChernoffSampleCount(double epsilon, double delta);
+
+/*!
+ * Wald's sequential probability ratio test that decides whether the success probability p of a Bernoulli variable lies above or below a
+ * threshold. The test distinguishes the hypotheses p >= threshold + indifference and p <= threshold - indifference. It wrongly decides
+ * 'below' with probability at most alpha if the former holds, and wrongly decides 'above' with probability at most beta if the latter holds.
+ * Inside the indifference region, either decision may be taken.
+ */
+class SequentialProbabilityRatioTest {
+   public:
+    enum class Decision { Undecided, Above, Below };
+
+    SequentialProbabilityRatioTest(double threshold, double indifference, double alpha, double beta);
+
+    /*!
+     * Adds the outcome of the given number of samples and updates the decision. Once a decision is taken, further samples are ignored.
+     *
+     * @param successes The number of successful samples.
+     * @param samples The total number of samples (including the successful ones).
+     * @return The decision after considering the samples.
+     */
+    Decision addSamples(uint64_t successes, uint64_t samples);
+
+    Decision getDecision() const;
+
+    /*!
+     * Retrieves the number of samples that were considered until the decision was taken.
+     */
+    uint64_t getNumberOfSamples() const;
+
+   private:
+    // The change of the log-likelihood ratio for a successful and a failed sample, respectively.
+    double successStep;
+    double failureStep;
+
+    // The ratio is compared against these limits to decide.
+    double aboveLimit;
+    double belowLimit;
+
+    double logLikelihoodRatio;
+    uint64_t numberOfSamples;
+    Decision decision;
+};
+
+}  // namespace smc_detail
+}  // namespace modelchecker
+}  // namespace storm
@@ -146,6 +146,21 @@ storm::storage::SparseMatrix<ValueType> Model<ValueType, RewardModelType>::getBa
     return this->getTransitionMatrix().transpose(true);
 }
 
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::enableQualitativeAnalysisCache() {
+    qualitativeAnalysisCache.enable();
+}
+
+template<typename ValueType, typename RewardModelType>
+std::shared_ptr<storm::storage::sparse::QualitativeAnalysisCache<ValueType>> const& Model<ValueType, RewardModelType>::getQualitativeAnalysisCache() const {
+    return qualitativeAnalysisCache.get();
+}
+
+template<typename ValueType, typename RewardModelType>
+void Model<ValueType, RewardModelType>::clearQualitativeAnalysisCache() {
+    qualitativeAnalysisCache.clear();
+}
+
 template<typename ValueType, typename RewardModelType>
 typename storm::storage::SparseMatrix<ValueType>::const_rows Model<ValueType, RewardModelType>::getRows(storm::storage::sparse::state_type state) const {
     return this->getTransitionMatrix().getRowGroup(state);
@@ -249,7 +264,7 @@ void Model<ValueType, RewardModelType>::addRewardModel(std::string const& reward
         STORM_LOG_THROW(!(this->hasRewardModel(rewardModelName)), storm::exceptions::IllegalArgumentException,
                         "A reward model with the given name '" << rewardModelName << "' already exists.");
     }
-    STORM_LOG_ASSERT(newRewardModel.isCompatible(this->getNumberOfStates(), this->getTransitionMatrix().getRowCount()), "New reward model is not compatible.");
+    STORM_LOG_ASSERT(newRewardModel.isCompatible(this->getNumberOfStates(), transitionMatrix.getRowCount()), "New reward model is not compatible.");
     this->rewardModels.emplace(rewardModelName, newRewardModel);
 }
 
@@ -613,11 +628,13 @@ std::set<std::string> Model<ValueType, RewardModelType>::getLabelsOfState(storm:
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
     this->transitionMatrix = transitionMatrix;
+    clearQualitativeAnalysisCache();
 }
 
 template<typename ValueType, typename RewardModelType>
 void Model<ValueType, RewardModelType>::setTransitionMatrix(storm::storage::SparseMatrix<ValueType>&& transitionMatrix) {
     this->transitionMatrix = std::move(transitionMatrix);
+    clearQualitativeAnalysisCache();
 }
 
 template<typename ValueType, typename RewardModelType>
@@ -12,6 +12,7 @@
 #include "storm/storage/SparseMatrix.h"
 #include "storm/storage/sparse/ChoiceOrigins.h"
 #include "storm/storage/sparse/ModelComponents.h"
+#include "storm/storage/sparse/QualitativeAnalysisCache.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/storage/sparse/StateValuations.h"
 #include "storm/utility/OsDetection.h"
@@ -59,6 +60,25 @@ class Model : public storm::models::Model<CValueType> {
      */
     storm::storage::SparseMatrix<ValueType> getBackwardTransitions() const;
 
+    /*!
+     * Enables caching of qualitative analyses (backward transitions and prob0/prob1 state sets) for this model such that they are shared
+     * by all properties checked on this model. Copies of this model get their own, initially empty cache. Code that modifies the transition
+     * matrix of a model with enabled cache has to call clearQualitativeAnalysisCache afterwards.
+     */
+    void enableQualitativeAnalysisCache();
+
+    /*!
+     * Replaces the cache for qualitative analyses (if enabled) by an empty one, e.g. because the transition matrix has been modified.
+     */
+    void clearQualitativeAnalysisCache();
+
+    /*!
+     * Retrieves the cache for qualitative analyses of this model.
+     *
+     * @return The cache or nullptr if caching has not been enabled.
+     */
+    std::shared_ptr<storm::storage::sparse::QualitativeAnalysisCache<ValueType>> const& getQualitativeAnalysisCache() const;
+
     /*!
      * Returns an object representing the matrix rows associated with the given state.
      *
@@ -452,6 +472,9 @@ class Model : public storm::models::Model<CValueType> {
 
     // if set, gives information about where each choice originates w.r.t. the input model description
     boost::optional<std::shared_ptr<storm::storage::sparse::ChoiceOrigins>> choiceOrigins;
+
+    // If enabled, results of qualitative analyses on the transition matrix are cached here.
+    storm::storage::sparse::QualitativeAnalysisCacheHolder<ValueType> qualitativeAnalysisCache;
 };
 
 #ifdef STORM_HAVE_CARL
@@ -15,6 +15,7 @@ namespace modules {
 class BuildSettings;
 class ModuleSettings;
 class AbstractionSettings;
+class CoreSettings;
 }  // namespace modules
 class Option;
 
@@ -321,6 +322,14 @@ storm::settings::modules::BuildSettings& mutableBuildSettings();
  */
 storm::settings::modules::AbstractionSettings& mutableAbstractionSettings();
 
+/*!
+ * Retrieves the core settings in a mutable form. This is only meant to be used for debug purposes or very
+ * rare cases where it is necessary.
+ *
+ * @return An object that allows accessing and modifying the core settings.
+ */
+storm::settings::modules::CoreSettings& mutableCoreSettings();
+
 }  // namespace settings
 }  // namespace storm
 
@@ -47,7 +47,7 @@ CoreSettings::CoreSettings() : ModuleSettings(moduleName), engine(storm::utility
                                          .build())
                         .build());
 
-    std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination", "topological", "acyclic"};
+    std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination", "topological", "acyclic", "modular"};
     this->addOption(
         storm::settings::OptionBuilder(moduleName, eqSolverOptionName, false, "Sets which solver is preferred for solving systems of linear equations.")
             .addArgument(storm::settings::ArgumentBuilder::createStringArgument("name", "The name of the solver to prefer.")
@@ -104,6 +104,8 @@ storm::solver::EquationSolverType CoreSettings::getEquationSolver() const {
         return storm::solver::EquationSolverType::Topological;
     } else if (equationSolverName == "acyclic") {
         return storm::solver::EquationSolverType::Acyclic;
+    } else if (equationSolverName == "modular") {
+        return storm::solver::EquationSolverType::Modular;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown equation solver '" << equationSolverName << "'.");
 }
@@ -164,6 +166,10 @@ bool CoreSettings::isUseIntelTbbSet() const {
     return this->getOption(intelTbbOptionName).getHasOptionBeenSet();
 }
 
+std::unique_ptr<storm::settings::SettingMemento> CoreSettings::overrideUseIntelTbbSet(bool stateToSet) {
+    return this->overrideOption(intelTbbOptionName, stateToSet);
+}
+
 bool CoreSettings::isUseCudaSet() const {
     return this->getOption(cudaOptionName).getHasOptionBeenSet();
 }
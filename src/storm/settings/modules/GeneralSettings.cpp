@@ -84,7 +84,15 @@ GeneralSettings::GeneralSettings() : ModuleSettings(moduleName) {
                              .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator({"rationals", "floats"}))
                              .build())
             .build());
-    this->addOption(storm::settings::OptionBuilder(moduleName, soundOptionName, false, "Sets whether to force sound model checking.").build());
+    this->addOption(
+        storm::settings::OptionBuilder(moduleName, soundOptionName, false, "Sets whether to force sound model checking.")
+            .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                             "rounding", "The rounding of floating point operations. With 'directed', sound methods round bounds outwards.")
+                             .setDefaultValueString("nearest")
+                             .makeOptional()
+                             .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator({"nearest", "directed"}))
+                             .build())
+            .build());
 }
 
 bool GeneralSettings::isHelpSet() const {
@@ -152,6 +160,11 @@ bool GeneralSettings::isSoundSet() const {
     return this->getOption(soundOptionName).getHasOptionBeenSet();
 }
 
+bool GeneralSettings::isSoundWithDirectedRoundingSet() const {
+    return this->getOption(soundOptionName).getHasOptionBeenSet() &&
+           this->getOption(soundOptionName).getArgumentByName("rounding").getValueAsString() == "directed";
+}
+
 void GeneralSettings::finalize() {
     // Intentionally left empty.
 }
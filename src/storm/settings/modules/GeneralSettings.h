@@ -123,6 +123,14 @@ class GeneralSettings : public ModuleSettings {
      */
     bool isSoundSet() const;
 
+    /*!
+     * Retrieves whether the option forcing soundness is set and floating point operations of sound methods are to be rounded
+     * such that computed bounds remain bounds despite round-off errors.
+     *
+     * @return True iff the option was set with directed rounding.
+     */
+    bool isSoundWithDirectedRoundingSet() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -54,6 +54,7 @@ const std::string IOSettings::qvbsInputOptionName = "qvbs";
 const std::string IOSettings::qvbsInputOptionShortName = "qvbs";
 const std::string IOSettings::qvbsRootOptionName = "qvbsroot";
 const std::string IOSettings::propertiesAsMultiOptionName = "propsasmulti";
+const std::string IOSettings::serverOptionName = "server";
 
 std::string preventDRNPlaceholderOptionName = "no-drn-placeholders";
 
@@ -250,6 +251,17 @@ IOSettings::IOSettings() : ModuleSettings(moduleName) {
                         .setIsAdvanced()
                         .build());
 
+    this->addOption(storm::settings::OptionBuilder(
+                        moduleName, serverOptionName, false,
+                        "If set, Storm answers requests (JSON objects, one per line) from stdin on stdout and keeps built models in memory for later requests.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "budget", "The memory budget for resident models in MB. Least recently used models are evicted. 0 means no limit.")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .makeOptional()
+                                         .build())
+                        .build());
+
 #ifdef STORM_HAVE_QVBS
     std::string qvbsRootDefault = STORM_QVBS_ROOT;
 #else
@@ -501,6 +513,14 @@ bool IOSettings::isPropertiesAsMultiSet() const {
     return this->getOption(propertiesAsMultiOptionName).getHasOptionBeenSet();
 }
 
+bool IOSettings::isServerSet() const {
+    return this->getOption(serverOptionName).getHasOptionBeenSet();
+}
+
+uint64_t IOSettings::getServerMemoryBudget() const {
+    return this->getOption(serverOptionName).getArgumentByName("budget").getValueAsUnsignedInteger();
+}
+
 void IOSettings::finalize() {
     STORM_LOG_WARN_COND(!isExportDdSet(), "Option '--" << moduleName << ":" << exportDdOptionName << "' is depreciated. Use '--" << moduleName << ":"
                                                        << exportBuildOptionName << "' instead.");
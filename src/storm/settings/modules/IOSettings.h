@@ -368,6 +368,16 @@ class IOSettings : public ModuleSettings {
      */
     bool isPropertiesAsMultiSet() const;
 
+    /*!
+     * Retrieves whether Storm is to be run as a server that answers requests from stdin.
+     */
+    bool isServerSet() const;
+
+    /*!
+     * Retrieves the memory budget (in MB) for the models kept resident by the server. Zero means no limit.
+     */
+    uint64_t getServerMemoryBudget() const;
+
     bool check() const override;
     void finalize() override;
 
@@ -410,6 +420,7 @@ class IOSettings : public ModuleSettings {
     static const std::string qvbsInputOptionShortName;
     static const std::string qvbsRootOptionName;
     static const std::string propertiesAsMultiOptionName;
+    static const std::string serverOptionName;
 };
 
 }  // namespace modules
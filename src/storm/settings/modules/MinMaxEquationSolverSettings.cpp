@@ -19,6 +19,7 @@ const std::string MinMaxEquationSolverSettings::precisionOptionName = "precision
 const std::string MinMaxEquationSolverSettings::absoluteOptionName = "absolute";
 const std::string MinMaxEquationSolverSettings::valueIterationMultiplicationStyleOptionName = "vimult";
 const std::string MinMaxEquationSolverSettings::intervalIterationSymmetricUpdatesOptionName = "symmetricupdates";
+const std::string MinMaxEquationSolverSettings::policyIterationInPlaceUpdatesOptionName = "piinplace";
 
 MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(moduleName) {
     std::vector<std::string> minMaxSolvingTechniques = {
@@ -68,6 +69,12 @@ MinMaxEquationSolverSettings::MinMaxEquationSolverSettings() : ModuleSettings(mo
                                                    "If set, interval iteration performs an update on both, lower and upper bound in each iteration")
                         .setIsAdvanced()
                         .build());
+
+    this->addOption(storm::settings::OptionBuilder(moduleName, policyIterationInPlaceUpdatesOptionName, false,
+                                                   "If set, policy iteration only updates the rows of the induced equation system whose choices changed and "
+                                                   "improves all choices w.r.t. the same values (in parallel if Intel TBB is enabled).")
+                        .setIsAdvanced()
+                        .build());
 }
 
 storm::solver::MinMaxMethod MinMaxEquationSolverSettings::getMinMaxEquationSolvingMethod() const {
@@ -146,6 +153,10 @@ bool MinMaxEquationSolverSettings::isForceIntervalIterationSymmetricUpdatesSet()
     return this->getOption(intervalIterationSymmetricUpdatesOptionName).getHasOptionBeenSet();
 }
 
+bool MinMaxEquationSolverSettings::isPolicyIterationInPlaceUpdatesSet() const {
+    return this->getOption(policyIterationInPlaceUpdatesOptionName).getHasOptionBeenSet();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -95,6 +95,11 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
      */
     bool isForceIntervalIterationSymmetricUpdatesSet() const;
 
+    /*!
+     * Retrieves whether policy iteration updates the induced equation system in place.
+     */
+    bool isPolicyIterationInPlaceUpdatesSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -106,6 +111,7 @@ class MinMaxEquationSolverSettings : public ModuleSettings {
     static const std::string absoluteOptionName;
     static const std::string valueIterationMultiplicationStyleOptionName;
     static const std::string intervalIterationSymmetricUpdatesOptionName;
+    static const std::string policyIterationInPlaceUpdatesOptionName;
     static const std::string forceBoundsOptionName;
 };
 
@@ -14,6 +14,9 @@ namespace modules {
 const std::string ModelCheckerSettings::moduleName = "modelchecker";
 const std::string ModelCheckerSettings::filterRewZeroOptionName = "filterrewzero";
 const std::string ModelCheckerSettings::ltl2daToolOptionName = "ltl2datool";
+const std::string ModelCheckerSettings::concurrentPropertiesOptionName = "concurrentprops";
+const std::string ModelCheckerSettings::qualitativeCacheOptionName = "qualcache";
+const std::string ModelCheckerSettings::jointUntilOptionName = "jointuntil";
 
 ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, filterRewZeroOptionName, false,
@@ -27,6 +30,28 @@ ModelCheckerSettings::ModelCheckerSettings() : ModuleSettings(moduleName) {
                                          "filename", "A script that can be called with a prefix formula and a name for the output automaton.")
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, concurrentPropertiesOptionName, false,
+                                                   "If set, independent properties are checked concurrently on the same (sparse) model. Properties are "
+                                                   "checked in rounds of at most the given number of properties and each round waits for its slowest "
+                                                   "property. Requires Intel TBB (--enable-tbb).")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "workers", "The maximal number of properties that are checked at the same time.")
+                                         .addValidatorUnsignedInteger(ArgumentValidatorFactory::createUnsignedGreaterValidator(0))
+                                         .setDefaultValueUnsignedInteger(1)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, qualitativeCacheOptionName, false,
+                                                   "If set, backward transitions and prob0/prob1 state sets are cached and reused by all properties checked on "
+                                                   "the same (sparse) model.")
+                        .setIsAdvanced()
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, jointUntilOptionName, false,
+                                                   "If set, unbounded until and reachability probabilities of several properties on the same (sparse) DTMC or "
+                                                   "MDP are computed by a single value iteration that handles all properties with the same optimization "
+                                                   "direction at once. Only applies if the configured solver is a (not necessarily sound) value iteration.")
+                        .setIsAdvanced()
+                        .build());
 }
 
 bool ModelCheckerSettings::isFilterRewZeroSet() const {
@@ -41,6 +66,18 @@ std::string ModelCheckerSettings::getLtl2daTool() const {
     return this->getOption(ltl2daToolOptionName).getArgumentByName("filename").getValueAsString();
 }
 
+bool ModelCheckerSettings::isQualitativeCacheSet() const {
+    return this->getOption(qualitativeCacheOptionName).getHasOptionBeenSet();
+}
+
+bool ModelCheckerSettings::isJointUntilSet() const {
+    return this->getOption(jointUntilOptionName).getHasOptionBeenSet();
+}
+
+uint64_t ModelCheckerSettings::getNumberOfConcurrentProperties() const {
+    return this->getOption(concurrentPropertiesOptionName).getArgumentByName("workers").getValueAsUnsignedInteger();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -35,6 +35,27 @@ class ModelCheckerSettings : public ModuleSettings {
      */
     std::string getLtl2daTool() const;
 
+    /*!
+     * Retrieves the maximal number of properties that are checked concurrently.
+     *
+     * @return The number of properties that are checked at the same time. A value of 1 means that properties are checked one after another.
+     */
+    uint64_t getNumberOfConcurrentProperties() const;
+
+    /*!
+     * Retrieves whether results of qualitative analyses are to be cached across the properties of a model.
+     *
+     * @return True iff the qualitative analysis cache is enabled.
+     */
+    bool isQualitativeCacheSet() const;
+
+    /*!
+     * Retrieves whether until probabilities of several properties are to be computed jointly.
+     *
+     * @return True iff until probabilities are computed jointly.
+     */
+    bool isJointUntilSet() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -42,6 +63,9 @@ class ModelCheckerSettings : public ModuleSettings {
     // Define the string names of the options as constants.
     static const std::string filterRewZeroOptionName;
     static const std::string ltl2daToolOptionName;
+    static const std::string concurrentPropertiesOptionName;
+    static const std::string qualitativeCacheOptionName;
+    static const std::string jointUntilOptionName;
 };
 
 }  // namespace modules
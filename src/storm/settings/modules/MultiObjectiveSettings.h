@@ -101,6 +101,11 @@ class MultiObjectiveSettings : public ModuleSettings {
      */
     bool isLexicographicModelCheckingSet() const;
 
+    /*!
+     * Retrieves the number of weight vectors that are checked together in a single refinement step of the Pareto curve approximation algorithm.
+     */
+    uint64_t getWeightVectorBatchSize() const;
+
     /*!
      * Checks whether the settings are consistent. If they are inconsistent, an exception is thrown.
      *
@@ -119,6 +124,7 @@ class MultiObjectiveSettings : public ModuleSettings {
     const static std::string printResultsOptionName;
     const static std::string encodingOptionName;
     const static std::string lexicographicOptionName;
+    const static std::string weightVectorBatchOptionName;
 };
 
 }  // namespace modules
@@ -16,6 +16,8 @@ const std::string ResourceSettings::timeoutOptionShortName = "t";
 const std::string ResourceSettings::printTimeAndMemoryOptionName = "timemem";
 const std::string ResourceSettings::printTimeAndMemoryOptionShortName = "tm";
 const std::string ResourceSettings::signalWaitingTimeOptionName = "signal-timeout";
+const std::string ResourceSettings::checkpointOptionName = "checkpoint";
+const std::string ResourceSettings::resumeOptionName = "resume";
 
 ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
     this->addOption(storm::settings::OptionBuilder(moduleName, timeoutOptionName, false, "If given, computation will abort after the timeout has been reached.")
@@ -35,6 +37,21 @@ ResourceSettings::ResourceSettings() : ModuleSettings(moduleName) {
                                          .setDefaultValueUnsignedInteger(3)
                                          .build())
                         .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, checkpointOptionName, false,
+                                                   "If given, the state of iterative solvers is periodically written to the given file. A checkpoint is also "
+                                                   "written when the computation is aborted.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the checkpoint file.").build())
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("interval", "Seconds between two checkpoints.")
+                                         .setDefaultValueUnsignedInteger(600)
+                                         .makeOptional()
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, resumeOptionName, false,
+                                                   "If given, iterative solvers resume from the given checkpoint file if it matches their equation system.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument("filename", "The name of the checkpoint file.").build())
+                        .build());
 }
 
 bool ResourceSettings::isTimeoutSet() const {
@@ -53,6 +70,26 @@ uint_fast64_t ResourceSettings::getSignalWaitingTimeInSeconds() const {
     return this->getOption(signalWaitingTimeOptionName).getArgumentByName("time").getValueAsUnsignedInteger();
 }
 
+bool ResourceSettings::isCheckpointSet() const {
+    return this->getOption(checkpointOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getCheckpointFilename() const {
+    return this->getOption(checkpointOptionName).getArgumentByName("filename").getValueAsString();
+}
+
+uint_fast64_t ResourceSettings::getCheckpointIntervalInSeconds() const {
+    return this->getOption(checkpointOptionName).getArgumentByName("interval").getValueAsUnsignedInteger();
+}
+
+bool ResourceSettings::isResumeSet() const {
+    return this->getOption(resumeOptionName).getHasOptionBeenSet();
+}
+
+std::string ResourceSettings::getResumeFilename() const {
+    return this->getOption(resumeOptionName).getArgumentByName("filename").getValueAsString();
+}
+
 }  // namespace modules
 }  // namespace settings
 }  // namespace storm
@@ -47,6 +47,31 @@ class ResourceSettings : public ModuleSettings {
      */
     uint_fast64_t getSignalWaitingTimeInSeconds() const;
 
+    /*!
+     * Retrieves whether the state of iterative solvers is to be checkpointed.
+     */
+    bool isCheckpointSet() const;
+
+    /*!
+     * Retrieves the name of the file to which checkpoints are written.
+     */
+    std::string getCheckpointFilename() const;
+
+    /*!
+     * Retrieves the number of seconds between two checkpoints.
+     */
+    uint_fast64_t getCheckpointIntervalInSeconds() const;
+
+    /*!
+     * Retrieves whether iterative solvers are to be resumed from a checkpoint.
+     */
+    bool isResumeSet() const;
+
+    /*!
+     * Retrieves the name of the checkpoint file from which iterative solvers are resumed.
+     */
+    std::string getResumeFilename() const;
+
     // The name of the module.
     static const std::string moduleName;
 
@@ -57,6 +82,8 @@ class ResourceSettings : public ModuleSettings {
     static const std::string printTimeAndMemoryOptionName;
     static const std::string printTimeAndMemoryOptionShortName;
     static const std::string signalWaitingTimeOptionName;
+    static const std::string checkpointOptionName;
+    static const std::string resumeOptionName;
 };
 }  // namespace modules
 }  // namespace settings
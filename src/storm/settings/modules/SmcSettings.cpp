@@ -0,0 +1,184 @@
+#include "storm/settings/modules/SmcSettings.h"
+#include "storm/settings/Argument.h"
+#include "storm/settings/ArgumentBuilder.h"
+#include "storm/settings/Option.h"
+#include "storm/settings/OptionBuilder.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+
+#include "storm/exceptions/IllegalArgumentValueException.h"
+#include "storm/utility/Engine.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+const std::string SmcSettings::moduleName = "smc";
+const std::string SmcSettings::epsilonOptionName = "epsilon";
+const std::string SmcSettings::deltaOptionName = "delta";
+const std::string SmcSettings::sprtAlphaOptionName = "alpha";
+const std::string SmcSettings::sprtBetaOptionName = "beta";
+const std::string SmcSettings::indifferenceOptionName = "indifference";
+const std::string SmcSettings::methodOptionName = "method";
+const std::string SmcSettings::schedulerOptionName = "scheduler";
+const std::string SmcSettings::workersOptionName = "workers";
+const std::string SmcSettings::seedOptionName = "seed";
+const std::string SmcSettings::stateCacheSizeOptionName = "cachesize";
+
+SmcSettings::SmcSettings() : ModuleSettings(moduleName) {
+    this->addOption(storm::settings::OptionBuilder(moduleName, epsilonOptionName, true, "Sets the maximal absolute error of estimated probabilities.")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The maximal absolute error.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, deltaOptionName, true,
+                                                   "Sets the probability with which a result may violate the error bounds (the confidence is 1-delta).")
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error probability.")
+                                         .setDefaultValueDouble(0.05)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, sprtAlphaOptionName, true,
+                                                   "Sets the probability with which the sequential probability ratio test may wrongly decide that a "
+                                                   "probability is below the bound. Defaults to delta.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error probability.")
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, sprtBetaOptionName, true,
+                                                   "Sets the probability with which the sequential probability ratio test may wrongly decide that a "
+                                                   "probability is above the bound. Defaults to delta.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The error probability.")
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 1.0))
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, indifferenceOptionName, true,
+                                                   "Sets the half-width of the indifference region around probability bounds for the sequential probability "
+                                                   "ratio test.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createDoubleArgument("value", "The half-width of the indifference region.")
+                                         .setDefaultValueDouble(0.01)
+                                         .addValidatorDouble(ArgumentValidatorFactory::createDoubleRangeValidatorExcluding(0.0, 0.5))
+                                         .build())
+                        .build());
+
+    std::vector<std::string> methods = {"sprt", "estimate"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, methodOptionName, true, "Sets how properties with a probability bound are decided.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name",
+                                         "The name of the method to use. 'sprt' uses the sequential probability ratio test and 'estimate' compares an "
+                                         "estimate of the probability against the bound.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(methods))
+                                         .setDefaultValueString("sprt")
+                                         .build())
+                        .build());
+
+    std::vector<std::string> schedulers = {"uniform", "first"};
+    this->addOption(storm::settings::OptionBuilder(moduleName, schedulerOptionName, true, "Sets how nondeterministic choices are resolved.")
+                        .addArgument(storm::settings::ArgumentBuilder::createStringArgument(
+                                         "name",
+                                         "The name of the scheduler. 'uniform' picks a choice uniformly at random and 'first' always picks the first choice.")
+                                         .addValidatorString(ArgumentValidatorFactory::createMultipleChoiceValidator(schedulers))
+                                         .setDefaultValueString("uniform")
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, workersOptionName, true,
+                                                   "Sets the number of simulation workers, which run in parallel if Intel TBB is available.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument(
+                                         "count", "The number of workers. Zero means one worker per thread of Intel TBB (or a single worker if TBB is disabled).")
+                                         .setDefaultValueUnsignedInteger(0)
+                                         .build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, seedOptionName, true,
+                                                   "Sets the seed for the random number generators. Results are reproducible for a fixed seed and number of "
+                                                   "workers.")
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("value", "The seed.").build())
+                        .build());
+    this->addOption(storm::settings::OptionBuilder(moduleName, stateCacheSizeOptionName, true,
+                                                   "Sets the memory that all workers together may use to cache explored states.")
+                        .setIsAdvanced()
+                        .addArgument(storm::settings::ArgumentBuilder::createUnsignedIntegerArgument("mb", "The size of the cache in MB.")
+                                         .setDefaultValueUnsignedInteger(256)
+                                         .build())
+                        .build());
+}
+
+double SmcSettings::getEpsilon() const {
+    return this->getOption(epsilonOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double SmcSettings::getDelta() const {
+    return this->getOption(deltaOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+double SmcSettings::getSprtAlpha() const {
+    if (this->getOption(sprtAlphaOptionName).getHasOptionBeenSet()) {
+        return this->getOption(sprtAlphaOptionName).getArgumentByName("value").getValueAsDouble();
+    }
+    return getDelta();
+}
+
+double SmcSettings::getSprtBeta() const {
+    if (this->getOption(sprtBetaOptionName).getHasOptionBeenSet()) {
+        return this->getOption(sprtBetaOptionName).getArgumentByName("value").getValueAsDouble();
+    }
+    return getDelta();
+}
+
+double SmcSettings::getIndifference() const {
+    return this->getOption(indifferenceOptionName).getArgumentByName("value").getValueAsDouble();
+}
+
+SmcSettings::HypothesisTestingMethod SmcSettings::getHypothesisTestingMethod() const {
+    std::string methodAsString = this->getOption(methodOptionName).getArgumentByName("name").getValueAsString();
+    if (methodAsString == "sprt") {
+        return SmcSettings::HypothesisTestingMethod::Sprt;
+    } else if (methodAsString == "estimate") {
+        return SmcSettings::HypothesisTestingMethod::Estimation;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown hypothesis testing method '" << methodAsString << "'.");
+}
+
+SmcSettings::SchedulerType SmcSettings::getSchedulerType() const {
+    std::string schedulerAsString = this->getOption(schedulerOptionName).getArgumentByName("name").getValueAsString();
+    if (schedulerAsString == "uniform") {
+        return SmcSettings::SchedulerType::Uniform;
+    } else if (schedulerAsString == "first") {
+        return SmcSettings::SchedulerType::First;
+    }
+    STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown scheduler '" << schedulerAsString << "'.");
+}
+
+uint64_t SmcSettings::getNumberOfWorkers() const {
+    return this->getOption(workersOptionName).getArgumentByName("count").getValueAsUnsignedInteger();
+}
+
+bool SmcSettings::isSeedSet() const {
+    return this->getOption(seedOptionName).getHasOptionBeenSet();
+}
+
+uint64_t SmcSettings::getSeed() const {
+    return this->getOption(seedOptionName).getArgumentByName("value").getValueAsUnsignedInteger();
+}
+
+uint64_t SmcSettings::getStateCacheSize() const {
+    return this->getOption(stateCacheSizeOptionName).getArgumentByName("mb").getValueAsUnsignedInteger();
+}
+
+bool SmcSettings::check() const {
+    bool optionsSet = this->getOption(epsilonOptionName).getHasOptionBeenSet() || this->getOption(deltaOptionName).getHasOptionBeenSet() ||
+                      this->getOption(sprtAlphaOptionName).getHasOptionBeenSet() || this->getOption(sprtBetaOptionName).getHasOptionBeenSet() ||
+                      this->getOption(indifferenceOptionName).getHasOptionBeenSet() || this->getOption(methodOptionName).getHasOptionBeenSet() ||
+                      this->getOption(schedulerOptionName).getHasOptionBeenSet() || this->getOption(workersOptionName).getHasOptionBeenSet() ||
+                      this->getOption(seedOptionName).getHasOptionBeenSet() || this->getOption(stateCacheSizeOptionName).getHasOptionBeenSet();
+    STORM_LOG_WARN_COND(storm::settings::getModule<storm::settings::modules::CoreSettings>().getEngine() == storm::utility::Engine::Smc || !optionsSet,
+                        "Statistical model checking engine is not selected, so setting options for it has no effect.");
+    return true;
+}
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
@@ -0,0 +1,102 @@
+#pragma once
+
+#include "storm/settings/modules/ModuleSettings.h"
+
+namespace storm {
+namespace settings {
+namespace modules {
+
+/*!
+ * This class represents the settings of the statistical model checking engine.
+ */
+class SmcSettings : public ModuleSettings {
+   public:
+    // The available methods to decide properties with a probability bound.
+    enum class HypothesisTestingMethod { Sprt, Estimation };
+
+    // The available schedulers to resolve nondeterminism.
+    enum class SchedulerType { Uniform, First };
+
+    /*!
+     * Creates a new set of statistical model checking settings.
+     */
+    SmcSettings();
+
+    /*!
+     * Retrieves the maximal absolute error of estimated probabilities.
+     */
+    double getEpsilon() const;
+
+    /*!
+     * Retrieves the probability with which a result may violate the error bounds.
+     */
+    double getDelta() const;
+
+    /*!
+     * Retrieves the probability with which the sequential probability ratio test may decide that a probability is below the bound although
+     * it lies above the indifference region. If not set explicitly, this is delta.
+     */
+    double getSprtAlpha() const;
+
+    /*!
+     * Retrieves the probability with which the sequential probability ratio test may decide that a probability is above the bound although
+     * it lies below the indifference region. If not set explicitly, this is delta.
+     */
+    double getSprtBeta() const;
+
+    /*!
+     * Retrieves the half-width of the indifference region of the sequential probability ratio test.
+     */
+    double getIndifference() const;
+
+    /*!
+     * Retrieves the method that decides properties with a probability bound.
+     */
+    HypothesisTestingMethod getHypothesisTestingMethod() const;
+
+    /*!
+     * Retrieves the scheduler that resolves nondeterministic choices.
+     */
+    SchedulerType getSchedulerType() const;
+
+    /*!
+     * Retrieves the number of simulation workers. Zero means one worker per thread of Intel TBB (or a single worker if TBB is disabled).
+     */
+    uint64_t getNumberOfWorkers() const;
+
+    /*!
+     * Retrieves whether a seed for the random number generators was given.
+     */
+    bool isSeedSet() const;
+
+    /*!
+     * Retrieves the seed for the random number generators.
+     */
+    uint64_t getSeed() const;
+
+    /*!
+     * Retrieves the memory (in MB) that all workers together may use to cache explored states.
+     */
+    uint64_t getStateCacheSize() const;
+
+    virtual bool check() const override;
+
+    // The name of the module.
+    static const std::string moduleName;
+
+   private:
+    // Define the string names of the options as constants.
+    static const std::string epsilonOptionName;
+    static const std::string deltaOptionName;
+    static const std::string sprtAlphaOptionName;
+    static const std::string sprtBetaOptionName;
+    static const std::string indifferenceOptionName;
+    static const std::string methodOptionName;
+    static const std::string schedulerOptionName;
+    static const std::string workersOptionName;
+    static const std::string seedOptionName;
+    static const std::string stateCacheSizeOptionName;
+};
+}  // namespace modules
+}  // namespace settings
+}  // namespace storm
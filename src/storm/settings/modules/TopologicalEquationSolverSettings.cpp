@@ -25,7 +25,7 @@ const std::string TopologicalEquationSolverSettings::underlyingEquationSolverOpt
 const std::string TopologicalEquationSolverSettings::underlyingMinMaxMethodOptionName = "minmax";
 
 TopologicalEquationSolverSettings::TopologicalEquationSolverSettings() : ModuleSettings(moduleName) {
-    std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination"};
+    std::vector<std::string> linearEquationSolver = {"gmm++", "native", "eigen", "elimination", "modular"};
     this->addOption(storm::settings::OptionBuilder(moduleName, underlyingEquationSolverOptionName, true,
                                                    "Sets which solver is considered for solving the underlying equation systems.")
                         .setIsAdvanced()
@@ -66,6 +66,8 @@ storm::solver::EquationSolverType TopologicalEquationSolverSettings::getUnderlyi
         return storm::solver::EquationSolverType::Eigen;
     } else if (equationSolverName == "elimination") {
         return storm::solver::EquationSolverType::Elimination;
+    } else if (equationSolverName == "modular") {
+        return storm::solver::EquationSolverType::Modular;
     }
     STORM_LOG_THROW(false, storm::exceptions::IllegalArgumentValueException, "Unknown underlying equation solver '" << equationSolverName << "'.");
 }
@@ -242,6 +242,27 @@ void AbstractEquationSolver<ValueType>::clearBounds() {
     upperBounds = boost::none;
 }
 
+template<typename ValueType>
+bool AbstractEquationSolver<ValueType>::hasSolutionEnclosure() const {
+    return solutionEnclosure.is_initialized();
+}
+
+template<typename ValueType>
+std::pair<std::vector<ValueType>, std::vector<ValueType>> const& AbstractEquationSolver<ValueType>::getSolutionEnclosure() const {
+    STORM_LOG_THROW(solutionEnclosure, storm::exceptions::InvalidOperationException, "No enclosure of the solution available but one was requested.");
+    return solutionEnclosure.get();
+}
+
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::setSolutionEnclosure(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper) const {
+    solutionEnclosure = std::make_pair(lower, upper);
+}
+
+template<typename ValueType>
+void AbstractEquationSolver<ValueType>::clearSolutionEnclosure() const {
+    solutionEnclosure = boost::none;
+}
+
 template<typename ValueType>
 void AbstractEquationSolver<ValueType>::createLowerBoundsVector(std::vector<ValueType>& lowerBoundsVector) const {
     if (this->hasLowerBound(BoundType::Local)) {
@@ -5,6 +5,8 @@
 #include <chrono>
 #include <iostream>
 #include <memory>
+#include <utility>
+#include <vector>
 
 #include "storm/solver/SolverStatus.h"
 #include "storm/solver/TerminationCondition.h"
@@ -170,6 +172,18 @@ class AbstractEquationSolver {
      */
     void clearBounds();
 
+    /*!
+     * Retrieves whether the most recent call of the solver computed an enclosure of the solution, i.e., lower and upper bounds whose
+     * round-off errors have been directed outwards (see SolverEnvironment::isForceDirectedRounding). The solution itself is the midpoint
+     * of these bounds, which is not necessarily representable exactly.
+     */
+    bool hasSolutionEnclosure() const;
+
+    /*!
+     * Retrieves the lower and upper bounds of the solution enclosure that was computed by the most recent call of the solver.
+     */
+    std::pair<std::vector<ValueType>, std::vector<ValueType>> const& getSolutionEnclosure() const;
+
     /*!
      * Retrieves whether progress is to be shown.
      */
@@ -232,6 +246,16 @@ class AbstractEquationSolver {
      */
     SolverStatus updateStatus(SolverStatus status, bool earlyTermination, uint64_t iterations, uint64_t maximalNumberOfIterations) const;
 
+    /*!
+     * Stores the given enclosure of the solution such that it can be retrieved after solving.
+     */
+    void setSolutionEnclosure(std::vector<ValueType> const& lower, std::vector<ValueType> const& upper) const;
+
+    /*!
+     * Removes the enclosure of a previously computed solution (if there is any).
+     */
+    void clearSolutionEnclosure() const;
+
     // A termination condition to be used (can be unset).
     std::unique_ptr<TerminationCondition<ValueType>> terminationCondition;
 
@@ -253,6 +277,9 @@ class AbstractEquationSolver {
    private:
     // Indicates the progress of this solver.
     mutable boost::optional<storm::utility::ProgressMeasurement> progressMeasurement;
+
+    // The lower and upper bounds of the most recently computed solution (if they are guaranteed).
+    mutable boost::optional<std::pair<std::vector<ValueType>, std::vector<ValueType>>> solutionEnclosure;
 };
 
 }  // namespace solver
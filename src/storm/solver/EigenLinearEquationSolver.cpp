@@ -78,11 +78,18 @@ bool EigenLinearEquationSolver<storm::RationalNumber>::internalSolveEquations(En
     auto eigenX = Eigen::Matrix<storm::RationalNumber, Eigen::Dynamic, 1>::Map(x.data(), x.size());
     auto eigenB = Eigen::Matrix<storm::RationalNumber, Eigen::Dynamic, 1>::Map(b.data(), b.size());
 
-    Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalNumber>, Eigen::COLAMDOrdering<int>> solver;
-    solver.compute(*eigenA);
-    solver._solve_impl(eigenB, eigenX);
+    if (!sparseLuFactorization) {
+        sparseLuFactorization = std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalNumber>, Eigen::COLAMDOrdering<int>>>();
+        sparseLuFactorization->compute(*eigenA);
+    }
+    sparseLuFactorization->_solve_impl(eigenB, eigenX);
+    bool success = sparseLuFactorization->info() == Eigen::ComputationInfo::Success;
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
 
-    return solver.info() == Eigen::ComputationInfo::Success;
+    return success;
 }
 
 // Specialization for storm::RationalFunction
@@ -97,10 +104,17 @@ bool EigenLinearEquationSolver<storm::RationalFunction>::internalSolveEquations(
     auto eigenX = Eigen::Matrix<storm::RationalFunction, Eigen::Dynamic, 1>::Map(x.data(), x.size());
     auto eigenB = Eigen::Matrix<storm::RationalFunction, Eigen::Dynamic, 1>::Map(b.data(), b.size());
 
-    Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalFunction>, Eigen::COLAMDOrdering<int>> solver;
-    solver.compute(*eigenA);
-    solver._solve_impl(eigenB, eigenX);
-    return solver.info() == Eigen::ComputationInfo::Success;
+    if (!sparseLuFactorization) {
+        sparseLuFactorization = std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<storm::RationalFunction>, Eigen::COLAMDOrdering<int>>>();
+        sparseLuFactorization->compute(*eigenA);
+    }
+    sparseLuFactorization->_solve_impl(eigenB, eigenX);
+    bool success = sparseLuFactorization->info() == Eigen::ComputationInfo::Success;
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+    return success;
 }
 #endif
 
@@ -113,9 +127,15 @@ bool EigenLinearEquationSolver<ValueType>::internalSolveEquations(Environment co
     auto solutionMethod = getMethod(env, env.solver().isForceExact());
     if (solutionMethod == EigenLinearEquationSolverMethod::SparseLU) {
         STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with sparse LU factorization (Eigen library).");
-        Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>> solver;
-        solver.compute(*this->eigenA);
-        solver._solve_impl(eigenB, eigenX);
+        // The factorization only depends on the matrix, so it can be reused for further right-hand sides if caching is enabled.
+        if (!sparseLuFactorization) {
+            sparseLuFactorization = std::make_unique<Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>>>();
+            sparseLuFactorization->compute(*this->eigenA);
+        }
+        sparseLuFactorization->_solve_impl(eigenB, eigenX);
+        if (!this->isCachingEnabled()) {
+            clearCache();
+        }
     } else {
         bool converged = false;
         uint64_t numberOfIterations = 0;
@@ -251,6 +271,12 @@ LinearEquationSolverProblemFormat EigenLinearEquationSolver<ValueType>::getEquat
     return LinearEquationSolverProblemFormat::EquationSystem;
 }
 
+template<typename ValueType>
+void EigenLinearEquationSolver<ValueType>::clearCache() const {
+    sparseLuFactorization.reset();
+    LinearEquationSolver<ValueType>::clearCache();
+}
+
 template<typename ValueType>
 uint64_t EigenLinearEquationSolver<ValueType>::getMatrixRowCount() const {
     return eigenA->rows();
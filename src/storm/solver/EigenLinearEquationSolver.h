@@ -22,6 +22,8 @@ class EigenLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
     virtual LinearEquationSolverProblemFormat getEquationProblemFormat(Environment const& env) const override;
 
+    virtual void clearCache() const override;
+
    protected:
     virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
 
@@ -33,6 +35,9 @@ class EigenLinearEquationSolver : public LinearEquationSolver<ValueType> {
 
     // The (eigen) matrix associated with this equation solver.
     std::unique_ptr<Eigen::SparseMatrix<ValueType>> eigenA;
+
+    // The LU factorization of the matrix. It is kept between calls to solveEquations if caching is enabled.
+    mutable std::unique_ptr<Eigen::SparseLU<Eigen::SparseMatrix<ValueType>, Eigen::COLAMDOrdering<int>>> sparseLuFactorization;
 };
 
 template<typename ValueType>
@@ -89,10 +89,7 @@ bool EliminationLinearEquationSolver<ValueType>::internalSolveEquations(Environm
     PrioritizedStateEliminator<ValueType> eliminator(flexibleMatrix, flexibleBackwardTransitions, priorityQueue, x);
 
     // Eliminate all states.
-    while (priorityQueue->hasNext()) {
-        auto state = priorityQueue->pop();
-        eliminator.eliminateState(state, false);
-    }
+    eliminator.eliminateAll(false);
 
     return true;
 }
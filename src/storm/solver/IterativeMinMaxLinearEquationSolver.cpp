@@ -3,6 +3,7 @@
 
 #include "storm/solver/IterativeMinMaxLinearEquationSolver.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/OviSolverEnvironment.h"
 
@@ -13,8 +14,10 @@
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/RoundingModeGuard.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
@@ -138,6 +141,73 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveInducedEquationSystem(
     return linearEquationSolver->solveEquations(env, x, subB);
 }
 
+template<typename ValueType>
+void IterativeMinMaxLinearEquationSolver<ValueType>::buildInducedEquationSystem(std::vector<uint64_t> const& scheduler, bool convertToEquationSystem,
+                                                                                storm::storage::SparseMatrix<ValueType>& inducedMatrix,
+                                                                                std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
+    inducedMatrix = this->A->selectRowsFromRowGroups(scheduler, convertToEquationSystem);
+    if (convertToEquationSystem) {
+        inducedMatrix.convertToEquationSystem();
+    }
+    storm::utility::vector::selectVectorValues<ValueType>(subB, scheduler, this->A->getRowGroupIndices(), originalB);
+}
+
+template<typename ValueType>
+bool IterativeMinMaxLinearEquationSolver<ValueType>::updateInducedEquationSystem(std::vector<uint64_t> const& scheduler,
+                                                                                 std::vector<uint64_t> const& changedRowGroups, bool convertToEquationSystem,
+                                                                                 storm::storage::SparseMatrix<ValueType>& inducedMatrix,
+                                                                                 std::vector<ValueType>& subB, std::vector<ValueType> const& originalB) const {
+    auto const& rowGroupIndices = this->A->getRowGroupIndices();
+
+    // Check whether all changed rows fit into the slots of the previously selected rows. Equation systems get an entry on the diagonal for every row.
+    for (auto group : changedRowGroups) {
+        uint64_t numberOfEntries = 0;
+        bool hasDiagonalEntry = false;
+        for (auto const& entry : this->A->getRow(rowGroupIndices[group] + scheduler[group])) {
+            hasDiagonalEntry |= entry.getColumn() == group;
+            ++numberOfEntries;
+        }
+        if (convertToEquationSystem && !hasDiagonalEntry) {
+            ++numberOfEntries;
+        }
+        if (numberOfEntries != inducedMatrix.getRow(group).getNumberOfEntries()) {
+            return false;
+        }
+    }
+
+    for (auto group : changedRowGroups) {
+        uint64_t row = rowGroupIndices[group] + scheduler[group];
+        auto inducedEntryIt = inducedMatrix.getRow(group).begin();
+        bool insertDiagonalEntry = convertToEquationSystem;
+        for (auto const& entry : this->A->getRow(row)) {
+            if (insertDiagonalEntry && entry.getColumn() >= group) {
+                insertDiagonalEntry = false;
+                if (entry.getColumn() > group) {
+                    inducedEntryIt->setColumn(group);
+                    inducedEntryIt->setValue(storm::utility::one<ValueType>());
+                    ++inducedEntryIt;
+                }
+            }
+            inducedEntryIt->setColumn(entry.getColumn());
+            if (!convertToEquationSystem) {
+                inducedEntryIt->setValue(entry.getValue());
+            } else if (entry.getColumn() == group) {
+                inducedEntryIt->setValue(storm::utility::one<ValueType>() - entry.getValue());
+            } else {
+                inducedEntryIt->setValue(-entry.getValue());
+            }
+            ++inducedEntryIt;
+        }
+        if (insertDiagonalEntry) {
+            inducedEntryIt->setColumn(group);
+            inducedEntryIt->setValue(storm::utility::one<ValueType>());
+        }
+        subB[group] = originalB[row];
+    }
+    inducedMatrix.updateNonzeroEntryCount();
+    return true;
+}
+
 template<typename ValueType>
 bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x,
                                                                                    std::vector<ValueType> const& b) const {
@@ -157,6 +227,11 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
     }
     std::vector<ValueType>& subB = *auxiliaryRowGroupVector;
 
+    // The induced equation system is kept throughout the procedure such that only the rows whose choices changed need to be updated.
+    storm::storage::SparseMatrix<ValueType> inducedMatrix;
+    std::vector<uint64_t> changedRowGroups;
+    bool inducedSystemBuilt = false;
+
     // The solver that we will use throughout the procedure.
     std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> solver;
     // The linear equation solver should be at least as precise as this solver
@@ -180,17 +255,52 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
     }
     storm::Environment const& environmentOfSolver = environmentOfSolverStorage ? *environmentOfSolverStorage : env;
 
+    // Resume with the checkpointed scheduler, which is at least as good as the given initial scheduler.
+    storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env, std::string("minmax-pi-") + (minimize(dir) ? "min" : "max"), *this->A, {&b});
+    typename storm::solver::helper::SolverCheckpoint<ValueType>::State checkpointState;
+    if (checkpoint.restore(checkpointState, 0, 0) && checkpointState.scheduler.size() == scheduler.size()) {
+        scheduler.assign(checkpointState.scheduler.begin(), checkpointState.scheduler.end());
+    } else {
+        checkpointState.iterations = 0;
+    }
+
     SolverStatus status = SolverStatus::InProgress;
-    uint64_t iterations = 0;
-    this->startMeasureProgress();
+    uint64_t iterations = checkpointState.iterations;
+    this->startMeasureProgress(iterations);
+    bool const inPlaceUpdates = env.solver().minMax().isPolicyIterationInPlaceUpdatesSet();
+    bool convertToEquationSystem =
+        this->linearEquationSolverFactory->getEquationProblemFormat(environmentOfSolver) == LinearEquationSolverProblemFormat::EquationSystem;
+    std::vector<uint64_t> previousScheduler;
+    std::vector<ValueType> improvedX;
+    uint64_t numberOfChangedChoices = 0;
     do {
-        // Solve the equation system for the 'DTMC'.
-        solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+        if (inPlaceUpdates) {
+            // Update the equation system for the 'DTMC' and solve it, starting from the values of the previous scheduler.
+            if (!inducedSystemBuilt || !updateInducedEquationSystem(scheduler, changedRowGroups, convertToEquationSystem, inducedMatrix, subB, b)) {
+                buildInducedEquationSystem(scheduler, convertToEquationSystem, inducedMatrix, subB, b);
+                inducedSystemBuilt = true;
+            }
+            if (!solver) {
+                solver = this->linearEquationSolverFactory->create(environmentOfSolver, inducedMatrix);
+                solver->setBoundsFromOtherSolver(*this);
+                solver->setCachingEnabled(true);
+            } else {
+                solver->setMatrix(inducedMatrix);
+            }
+            solver->solveEquations(environmentOfSolver, x, subB);
+        } else {
+            // Solve the equation system for the 'DTMC'.
+            solveInducedEquationSystem(environmentOfSolver, solver, scheduler, x, subB, b);
+        }
 
-        // Go through the multiplication result and see whether we can improve any of the choices.
-        bool schedulerImproved = false;
-        // Group refers to the state number
-        for (uint_fast64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
+        // Go through the multiplication result and see whether we can improve any of the choices. With in-place updates, the choices are
+        // evaluated w.r.t. the values of the current scheduler, which makes the row groups independent. Otherwise, improved values are used right away.
+        previousScheduler = scheduler;
+        if (inPlaceUpdates) {
+            improvedX = x;
+        }
+        std::vector<ValueType>& updatedX = inPlaceUpdates ? improvedX : x;
+        auto improveChoice = [&](uint64_t group) {
             if (!this->choiceFixedForRowGroup || !this->choiceFixedForRowGroup.get()[group]) {
                 //  Only update when the choice is not fixed
                 uint_fast64_t currentChoice = scheduler[group];
@@ -208,16 +318,47 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
                     choiceValue += b[choice];
 
                     // If the value is strictly better than the solution of the inner system, we need to improve the scheduler.
-                    // TODO: If the underlying solver is not precise, this might run forever (i.e. when a state has two choices where the (exact) values are
-                    // equal). only changing the scheduler if the values are not equal (modulo precision) would make this unsound.
-                    if (valueImproved(dir, x[group], choiceValue)) {
-                        schedulerImproved = true;
+                    // Note that if the underlying solver is not precise, the scheduler might alternate between choices with (exactly) equal values.
+                    // Only changing the scheduler if the values are not equal modulo the precision would be unsound. The maximal number of iterations
+                    // (see --minmax:maxiter) bounds the number of improvement steps in this case.
+                    if (valueImproved(dir, updatedX[group], choiceValue)) {
                         scheduler[group] = choice - this->A->getRowGroupIndices()[group];
-                        x[group] = std::move(choiceValue);
+                        updatedX[group] = std::move(choiceValue);
                     }
                 }
             }
+        };
+
+        // Group refers to the state number
+        bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+        parallelize = inPlaceUpdates && storm::utility::parallel::isIntelTbbEnabled();
+        if (parallelize) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, this->A->getRowGroupCount(), 100), [&improveChoice](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t group = range.begin(); group < range.end(); ++group) {
+                    improveChoice(group);
+                }
+            });
+        }
+#endif
+        if (!parallelize) {
+            for (uint64_t group = 0; group < this->A->getRowGroupCount(); ++group) {
+                improveChoice(group);
+            }
+        }
+        if (inPlaceUpdates) {
+            std::swap(x, improvedX);
+        }
+
+        changedRowGroups.clear();
+        for (uint64_t group = 0; group < scheduler.size(); ++group) {
+            if (scheduler[group] != previousScheduler[group]) {
+                changedRowGroups.push_back(group);
+            }
         }
+        numberOfChangedChoices += changedRowGroups.size();
+        STORM_LOG_DEBUG("Policy iteration step " << iterations + 1 << " changed " << changedRowGroups.size() << " choices.");
+        bool schedulerImproved = !changedRowGroups.empty();
 
         // If the scheduler did not improve, we are done.
         if (!schedulerImproved) {
@@ -231,9 +372,15 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::performPolicyIteration(Envi
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
+
+        if (status != SolverStatus::Converged && checkpoint.isDue()) {
+            std::vector<uint64_t> checkpointScheduler(scheduler.begin(), scheduler.end());
+            checkpoint.write(iterations, {}, &checkpointScheduler);
+        }
     } while (status == SolverStatus::InProgress);
 
     STORM_LOG_INFO("Number of iterations: " << iterations);
+    STORM_LOG_INFO("Number of changed choices: " << numberOfChangedChoices);
     this->reportStatus(status, iterations);
 
     // If requested, we store the scheduler for retrieval.
@@ -331,7 +478,7 @@ template<typename ValueType>
 typename IterativeMinMaxLinearEquationSolver<ValueType>::ValueIterationResult IterativeMinMaxLinearEquationSolver<ValueType>::performValueIteration(
     Environment const& env, OptimizationDirection dir, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b,
     ValueType const& precision, bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t maximalNumberOfIterations,
-    storm::solver::MultiplicationStyle const& multiplicationStyle) const {
+    storm::solver::MultiplicationStyle const& multiplicationStyle, storm::solver::helper::SolverCheckpoint<ValueType>* checkpoint) const {
     STORM_LOG_THROW(!this->choiceFixedForRowGroup, storm::exceptions::NotImplementedException,
                     "Fixing the scheduler choices in which choices are fixed is not implemented for value iteration, please pick a different solver");
     STORM_LOG_ASSERT(currentX != newX, "Vectors must not be aliased.");
@@ -368,6 +515,10 @@ typename IterativeMinMaxLinearEquationSolver<ValueType>::ValueIterationResult It
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
+
+        if (checkpoint && status != SolverStatus::Converged) {
+            checkpoint->writeIfDue(iterations, {currentX});
+        }
     }
 
     return ValueIterationResult(iterations - currentIterations, status);
@@ -504,14 +655,21 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsValueIteratio
         }
     }
 
+    // Resuming from a checkpoint preserves the guarantee as the checkpointed iterate was obtained from a vector with the same guarantee.
+    storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env, std::string("minmax-vi-") + (minimize(dir) ? "min" : "max"), *this->A, {&b});
+    typename storm::solver::helper::SolverCheckpoint<ValueType>::State checkpointState;
+    if (checkpoint.restore(checkpointState, 1, x.size())) {
+        x = std::move(checkpointState.vectors.front());
+    }
+
     std::vector<ValueType>* newX = auxiliaryRowGroupVector.get();
     std::vector<ValueType>* currentX = &x;
 
-    this->startMeasureProgress();
+    this->startMeasureProgress(checkpointState.iterations);
     ValueIterationResult result =
         performValueIteration(env, dir, currentX, newX, b, storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision()),
-                              env.solver().minMax().getRelativeTerminationCriterion(), guarantee, 0, env.solver().minMax().getMaximalNumberOfIterations(),
-                              env.solver().minMax().getMultiplicationStyle());
+                              env.solver().minMax().getRelativeTerminationCriterion(), guarantee, checkpointState.iterations,
+                              env.solver().minMax().getMaximalNumberOfIterations(), env.solver().minMax().getMultiplicationStyle(), &checkpoint);
 
     // Swap the result into the output x.
     if (currentX == auxiliaryRowGroupVector.get()) {
@@ -573,8 +731,16 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
         tmp = auxiliaryRowGroupVector2.get();
     }
 
+    // Resume with the checkpointed bounds, which are still lower and upper bounds.
+    storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env, std::string("minmax-ii-") + (minimize(dir) ? "min" : "max"), *this->A, {&b});
+    typename storm::solver::helper::SolverCheckpoint<ValueType>::State checkpointState;
+    if (checkpoint.restore(checkpointState, 2, lowerX->size())) {
+        *lowerX = std::move(checkpointState.vectors[0]);
+        *upperX = std::move(checkpointState.vectors[1]);
+    }
+
     // Proceed with the iterations as long as the method did not converge or reach the maximum number of iterations.
-    uint64_t iterations = 0;
+    uint64_t iterations = checkpointState.iterations;
 
     SolverStatus status = SolverStatus::InProgress;
     bool doConvergenceCheck = true;
@@ -590,7 +756,10 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
     if (!relative) {
         precision *= storm::utility::convertNumber<ValueType>(2.0);
     }
-    this->startMeasureProgress();
+    // With directed rounding, the bounds are updated such that round-off errors can only widen the enclosure. Everything else (in particular the
+    // convergence check) is computed with the default rounding mode.
+    bool directedRounding = env.solver().isForceDirectedRounding() && !storm::NumberTraits<ValueType>::IsExact;
+    this->startMeasureProgress(iterations);
     while (status == SolverStatus::InProgress && iterations < env.solver().minMax().getMaximalNumberOfIterations()) {
         // Remember in which directions we took steps in this iteration.
         bool lowerStep = false;
@@ -604,22 +773,34 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
                 if (useDiffs) {
                     preserveOldRelevantValues(*lowerX, this->getRelevantValues(), oldValues);
                 }
-                this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *lowerX, &b);
+                {
+                    storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Downward, directedRounding);
+                    this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *lowerX, &b);
+                }
                 if (useDiffs) {
                     maxLowerDiff = computeMaxAbsDiff(*lowerX, this->getRelevantValues(), oldValues);
                     preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldValues);
                 }
-                this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *upperX, &b);
+                {
+                    storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Upward, directedRounding);
+                    this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *upperX, &b);
+                }
                 if (useDiffs) {
                     maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
                 }
             } else {
-                this->multiplierA->multiplyAndReduce(env, dir, *lowerX, &b, *tmp);
+                {
+                    storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Downward, directedRounding);
+                    this->multiplierA->multiplyAndReduce(env, dir, *lowerX, &b, *tmp);
+                }
                 if (useDiffs) {
                     maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
                 }
                 std::swap(lowerX, tmp);
-                this->multiplierA->multiplyAndReduce(env, dir, *upperX, &b, *tmp);
+                {
+                    storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Upward, directedRounding);
+                    this->multiplierA->multiplyAndReduce(env, dir, *upperX, &b, *tmp);
+                }
                 if (useDiffs) {
                     maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
                 }
@@ -632,7 +813,10 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
                     if (useDiffs) {
                         preserveOldRelevantValues(*lowerX, this->getRelevantValues(), oldValues);
                     }
-                    this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *lowerX, &b);
+                    {
+                        storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Downward, directedRounding);
+                        this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *lowerX, &b);
+                    }
                     if (useDiffs) {
                         maxLowerDiff = computeMaxAbsDiff(*lowerX, this->getRelevantValues(), oldValues);
                     }
@@ -641,7 +825,10 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
                     if (useDiffs) {
                         preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldValues);
                     }
-                    this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *upperX, &b);
+                    {
+                        storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Upward, directedRounding);
+                        this->multiplierA->multiplyAndReduceGaussSeidel(env, dir, *upperX, &b);
+                    }
                     if (useDiffs) {
                         maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
                     }
@@ -649,14 +836,20 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
                 }
             } else {
                 if (maxLowerDiff >= maxUpperDiff) {
-                    this->multiplierA->multiplyAndReduce(env, dir, *lowerX, &b, *tmp);
+                    {
+                        storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Downward, directedRounding);
+                        this->multiplierA->multiplyAndReduce(env, dir, *lowerX, &b, *tmp);
+                    }
                     if (useDiffs) {
                         maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
                     }
                     std::swap(tmp, lowerX);
                     lowerStep = true;
                 } else {
-                    this->multiplierA->multiplyAndReduce(env, dir, *upperX, &b, *tmp);
+                    {
+                        storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Upward, directedRounding);
+                        this->multiplierA->multiplyAndReduce(env, dir, *upperX, &b, *tmp);
+                    }
                     if (useDiffs) {
                         maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
                     }
@@ -694,10 +887,19 @@ bool IterativeMinMaxLinearEquationSolver<ValueType>::solveEquationsIntervalItera
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
+
+        if (status != SolverStatus::Converged) {
+            checkpoint.writeIfDue(iterations, {lowerX, upperX});
+        }
     }
 
     this->reportStatus(status, iterations);
 
+    if (directedRounding) {
+        // Only the bounds are guaranteed to enclose the solution.
+        this->setSolutionEnclosure(*lowerX, *upperX);
+    }
+
     // We take the means of the lower and upper bound so we guarantee the desired precision.
     ValueType two = storm::utility::convertNumber<ValueType>(2.0);
     storm::utility::vector::applyPointwise<ValueType, ValueType, ValueType>(
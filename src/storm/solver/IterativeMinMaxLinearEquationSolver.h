@@ -7,6 +7,7 @@
 #include "storm/solver/LinearEquationSolver.h"
 #include "storm/solver/StandardMinMaxLinearEquationSolver.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
 #include "storm/solver/multiplier/Multiplier.h"
 
@@ -42,6 +43,23 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     bool solveInducedEquationSystem(Environment const& env, std::unique_ptr<LinearEquationSolver<ValueType>>& linearEquationSolver,
                                     std::vector<uint64_t> const& scheduler, std::vector<ValueType>& x, std::vector<ValueType>& subB,
                                     std::vector<ValueType> const& originalB) const;
+    /*!
+     * Builds the equation system induced by the given scheduler.
+     */
+    void buildInducedEquationSystem(std::vector<uint64_t> const& scheduler, bool convertToEquationSystem,
+                                    storm::storage::SparseMatrix<ValueType>& inducedMatrix, std::vector<ValueType>& subB,
+                                    std::vector<ValueType> const& originalB) const;
+
+    /*!
+     * Updates the equation system induced by the given scheduler in place, where only the rows of the given row groups (whose choices changed)
+     * are touched.
+     *
+     * @return False iff the update is not possible in place, because the number of entries of a changed row differs. The induced system is then
+     * left unchanged and has to be rebuilt.
+     */
+    bool updateInducedEquationSystem(std::vector<uint64_t> const& scheduler, std::vector<uint64_t> const& changedRowGroups, bool convertToEquationSystem,
+                                     storm::storage::SparseMatrix<ValueType>& inducedMatrix, std::vector<ValueType>& subB,
+                                     std::vector<ValueType> const& originalB) const;
     bool solveEquationsPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     bool performPolicyIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>& x, std::vector<ValueType> const& b,
                                 std::vector<storm::storage::sparse::state_type>&& initialPolicy) const;
@@ -95,7 +113,8 @@ class IterativeMinMaxLinearEquationSolver : public StandardMinMaxLinearEquationS
     ValueIterationResult performValueIteration(Environment const& env, OptimizationDirection dir, std::vector<ValueType>*& currentX,
                                                std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision, bool relative,
                                                SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t maximalNumberOfIterations,
-                                               storm::solver::MultiplicationStyle const& multiplicationStyle) const;
+                                               storm::solver::MultiplicationStyle const& multiplicationStyle,
+                                               storm::solver::helper::SolverCheckpoint<ValueType>* checkpoint = nullptr) const;
 
     void createLinearEquationSolver(Environment const& env) const;
 
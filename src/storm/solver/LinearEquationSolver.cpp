@@ -7,6 +7,7 @@
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/solver/GmmxxLinearEquationSolver.h"
+#include "storm/solver/ModularLinearEquationSolver.h"
 #include "storm/solver/NativeLinearEquationSolver.h"
 #include "storm/solver/TopologicalLinearEquationSolver.h"
 
@@ -28,6 +29,7 @@ LinearEquationSolver<ValueType>::LinearEquationSolver() : cachingEnabled(false)
 
 template<typename ValueType>
 bool LinearEquationSolver<ValueType>::solveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    this->clearSolutionEnclosure();
     return this->internalSolveEquations(env, x, b);
 }
 
@@ -109,6 +111,8 @@ std::unique_ptr<LinearEquationSolver<storm::RationalNumber>> GeneralLinearEquati
             return std::make_unique<TopologicalLinearEquationSolver<storm::RationalNumber>>();
         case EquationSolverType::Acyclic:
             return std::make_unique<AcyclicLinearEquationSolver<storm::RationalNumber>>();
+        case EquationSolverType::Modular:
+            return std::make_unique<ModularLinearEquationSolver<storm::RationalNumber>>();
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solver type.");
             return nullptr;
@@ -121,7 +125,7 @@ std::unique_ptr<LinearEquationSolver<storm::RationalFunction>> GeneralLinearEqua
     EquationSolverType type = env.solver().getLinearEquationSolverType();
 
     // Adjust the solver type if it is not supported by this value type
-    if (type == EquationSolverType::Gmmxx || type == EquationSolverType::Native) {
+    if (type == EquationSolverType::Gmmxx || type == EquationSolverType::Native || type == EquationSolverType::Modular) {
         if (env.solver().isLinearEquationSolverTypeSetFromDefaultValue()) {
             STORM_LOG_INFO("Selecting '" + toString(EquationSolverType::Eigen) + "' as the linear equation solver since the previously selected one ("
                            << toString(type) << ") does not support parametric computations.");
@@ -154,7 +158,7 @@ std::unique_ptr<LinearEquationSolver<ValueType>> GeneralLinearEquationSolverFact
 
     // Adjust the solver type if none was specified and we want sound/exact computations
     if (env.solver().isForceExact() && type != EquationSolverType::Native && type != EquationSolverType::Eigen && type != EquationSolverType::Elimination &&
-        type != EquationSolverType::Topological && type != EquationSolverType::Acyclic) {
+        type != EquationSolverType::Topological && type != EquationSolverType::Acyclic && type != EquationSolverType::Modular) {
         if (env.solver().isLinearEquationSolverTypeSetFromDefaultValue()) {
             type = EquationSolverType::Eigen;
             STORM_LOG_INFO(
@@ -164,7 +168,8 @@ std::unique_ptr<LinearEquationSolver<ValueType>> GeneralLinearEquationSolverFact
             STORM_LOG_WARN("The selected solver does not yield exact results.");
         }
     } else if (env.solver().isForceSoundness() && type != EquationSolverType::Native && type != EquationSolverType::Eigen &&
-               type != EquationSolverType::Elimination && type != EquationSolverType::Topological && type != EquationSolverType::Acyclic) {
+               type != EquationSolverType::Elimination && type != EquationSolverType::Topological && type != EquationSolverType::Acyclic &&
+               type != EquationSolverType::Modular) {
         if (env.solver().isLinearEquationSolverTypeSetFromDefaultValue()) {
             type = EquationSolverType::Native;
             STORM_LOG_INFO(
@@ -188,6 +193,8 @@ std::unique_ptr<LinearEquationSolver<ValueType>> GeneralLinearEquationSolverFact
             return std::make_unique<TopologicalLinearEquationSolver<ValueType>>();
         case EquationSolverType::Acyclic:
             return std::make_unique<AcyclicLinearEquationSolver<ValueType>>();
+        case EquationSolverType::Modular:
+            return std::make_unique<ModularLinearEquationSolver<ValueType>>();
         default:
             STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solver type.");
             return nullptr;
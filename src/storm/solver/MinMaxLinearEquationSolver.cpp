@@ -36,6 +36,7 @@ bool MinMaxLinearEquationSolver<ValueType>::solveEquations(Environment const& en
     STORM_LOG_WARN_COND_DEBUG(this->isRequirementsCheckedSet(),
                               "The requirements of the solver have not been marked as checked. Please provide the appropriate check or mark the requirements "
                               "as checked (if applicable).");
+    this->clearSolutionEnclosure();
     return internalSolveEquations(env, d, x, b);
 }
 
@@ -0,0 +1,401 @@
+#include "storm/solver/ModularLinearEquationSolver.h"
+
+#include <limits>
+#include <queue>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace solver {
+
+namespace {
+// All primes are below 2^31 such that products of two residues fit into 64 bits.
+uint64_t const largestPrimeCandidate = (1ull << 31) - 1;
+
+// The number of consecutive rounds in which all primes fail after which the matrix is considered singular.
+uint64_t const maximalNumberOfFailedRounds = 3;
+
+uint64_t powerModulo(uint64_t base, uint64_t exponent, uint64_t prime) {
+    uint64_t result = 1;
+    base %= prime;
+    while (exponent > 0) {
+        if (exponent & 1) {
+            result = result * base % prime;
+        }
+        base = base * base % prime;
+        exponent >>= 1;
+    }
+    return result;
+}
+
+uint64_t inverseModulo(uint64_t value, uint64_t prime) {
+    return powerModulo(value, prime - 2, prime);
+}
+
+bool isPrime(uint64_t candidate) {
+    if (candidate < 4) {
+        return candidate > 1;
+    }
+    if (candidate % 2 == 0) {
+        return false;
+    }
+    for (uint64_t divisor = 3; divisor * divisor <= candidate; divisor += 2) {
+        if (candidate % divisor == 0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*!
+ * Retrieves the given number of primes, descending from (and including) the given candidate. The candidate is updated such that
+ * subsequent calls yield fresh primes.
+ */
+std::vector<uint64_t> getNextPrimes(uint64_t& candidate, uint64_t count) {
+    std::vector<uint64_t> result;
+    while (result.size() < count) {
+        STORM_LOG_THROW(candidate > 2, storm::exceptions::InvalidArgumentException, "Ran out of primes for modular solving.");
+        if (isPrime(candidate)) {
+            result.push_back(candidate);
+        }
+        --candidate;
+    }
+    return result;
+}
+
+template<typename IntegerType>
+IntegerType toInteger(uint64_t value) {
+    return storm::utility::convertNumber<IntegerType>(value);
+}
+
+template<typename IntegerType>
+uint64_t reduce(IntegerType const& value, IntegerType const& prime) {
+    return storm::utility::convertNumber<uint64_t>(storm::utility::convertNumber<storm::RationalNumber>(storm::utility::mod(value, prime)));
+}
+
+/*!
+ * Reconstructs a fraction n/d with n = value * d (mod modulus) and 2n^2, 2d^2 < modulus (if it exists) using the extended euclidean
+ * algorithm.
+ */
+template<typename IntegerType>
+bool reconstructRational(IntegerType const& value, IntegerType const& modulus, storm::RationalNumber& result) {
+    IntegerType const two = toInteger<IntegerType>(2);
+    IntegerType previousRemainder = modulus;
+    IntegerType remainder = value;
+    IntegerType previousCoefficient = toInteger<IntegerType>(0);
+    IntegerType coefficient = storm::utility::one<IntegerType>();
+    while (two * remainder * remainder >= modulus) {
+        auto quotientAndRemainder = storm::utility::divide(previousRemainder, remainder);
+        previousRemainder = std::move(remainder);
+        remainder = std::move(quotientAndRemainder.second);
+        IntegerType nextCoefficient = previousCoefficient - quotientAndRemainder.first * coefficient;
+        previousCoefficient = std::move(coefficient);
+        coefficient = std::move(nextCoefficient);
+    }
+    if (storm::utility::isZero(coefficient) || two * coefficient * coefficient >= modulus) {
+        return false;
+    }
+    result = storm::utility::convertNumber<storm::RationalNumber>(remainder) / storm::utility::convertNumber<storm::RationalNumber>(coefficient);
+    return true;
+}
+}  // namespace
+
+template<typename ValueType>
+ModularLinearEquationSolver<ValueType>::ModularLinearEquationSolver() : localA(nullptr), A(nullptr) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+ModularLinearEquationSolver<ValueType>::ModularLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A) : localA(nullptr), A(nullptr) {
+    this->setMatrix(A);
+}
+
+template<typename ValueType>
+ModularLinearEquationSolver<ValueType>::ModularLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A) : localA(nullptr), A(nullptr) {
+    this->setMatrix(std::move(A));
+}
+
+template<typename ValueType>
+void ModularLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType> const& A) {
+    this->A = &A;
+    localA.reset();
+    this->clearCache();
+}
+
+template<typename ValueType>
+void ModularLinearEquationSolver<ValueType>::setMatrix(storm::storage::SparseMatrix<ValueType>&& A) {
+    localA = std::make_unique<storm::storage::SparseMatrix<ValueType>>(std::move(A));
+    this->A = localA.get();
+    this->clearCache();
+}
+
+template<typename ValueType>
+bool ModularLinearEquationSolver<ValueType>::internalSolveEquations(Environment const&, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with modular arithmetic.");
+    uint64_t const numberOfRows = A->getRowCount();
+
+    // Split all (rational) coefficients into numerators and denominators once, as they are reduced for every prime.
+    std::vector<RationalType> rationalB;
+    rationalB.reserve(numberOfRows);
+    std::vector<IntegerType> numerators, denominators;
+    numerators.reserve(A->getEntryCount() + numberOfRows);
+    denominators.reserve(A->getEntryCount() + numberOfRows);
+    for (auto const& entry : *A) {
+        RationalType value = storm::utility::convertNumber<RationalType>(entry.getValue());
+        numerators.push_back(storm::utility::numerator(value));
+        denominators.push_back(storm::utility::denominator(value));
+    }
+    for (auto const& value : b) {
+        rationalB.push_back(storm::utility::convertNumber<RationalType>(value));
+        numerators.push_back(storm::utility::numerator(rationalB.back()));
+        denominators.push_back(storm::utility::denominator(rationalB.back()));
+    }
+
+    bool const parallelize = storm::utility::parallel::isIntelTbbEnabled();
+    uint64_t primesPerRound = std::max<uint64_t>(2, storm::utility::parallel::getNumberOfThreads());
+
+    // The solution modulo the product of all (successfully used) primes.
+    std::vector<IntegerType> residues(numberOfRows, toInteger<IntegerType>(0));
+    IntegerType modulus = storm::utility::one<IntegerType>();
+    uint64_t numberOfUsedPrimes = 0;
+
+    uint64_t primeCandidate = largestPrimeCandidate;
+    uint64_t numberOfFailedRounds = 0;
+    std::vector<RationalType> solution(numberOfRows);
+    while (true) {
+        std::vector<uint64_t> primes = getNextPrimes(primeCandidate, std::max(primesPerRound, numberOfUsedPrimes));
+        std::vector<std::vector<uint64_t>> modularSolutions(primes.size());
+        std::vector<char> succeeded(primes.size(), false);
+
+#ifdef STORM_HAVE_INTELTBB
+        if (parallelize) {
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, primes.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                    succeeded[index] = solveModulo(numerators, denominators, primes[index], modularSolutions[index]);
+                }
+            });
+        }
+#endif
+        if (!parallelize) {
+            for (uint64_t index = 0; index < primes.size(); ++index) {
+                succeeded[index] = solveModulo(numerators, denominators, primes[index], modularSolutions[index]);
+            }
+        }
+
+        // Combine the new solutions with the previous ones by Chinese remaindering.
+        bool anySucceeded = false;
+        for (uint64_t index = 0; index < primes.size(); ++index) {
+            if (!succeeded[index]) {
+                STORM_LOG_DEBUG("Discarding prime " << primes[index] << ".");
+                continue;
+            }
+            anySucceeded = true;
+            uint64_t const prime = primes[index];
+            IntegerType const bigPrime = toInteger<IntegerType>(prime);
+            uint64_t const inverseOfModulus = inverseModulo(reduce(modulus, bigPrime), prime);
+            for (uint64_t row = 0; row < numberOfRows; ++row) {
+                uint64_t difference = (modularSolutions[index][row] + prime - reduce(residues[row], bigPrime)) % prime;
+                residues[row] += modulus * toInteger<IntegerType>(difference * inverseOfModulus % prime);
+            }
+            modulus *= bigPrime;
+            ++numberOfUsedPrimes;
+        }
+
+        if (!anySucceeded) {
+            ++numberOfFailedRounds;
+            STORM_LOG_THROW(numberOfFailedRounds < maximalNumberOfFailedRounds, storm::exceptions::InvalidArgumentException,
+                            "The equation system appears to be singular.");
+            continue;
+        }
+        numberOfFailedRounds = 0;
+
+        // Try to reconstruct the rational solution. If it fails for some row, more primes are needed.
+        bool reconstructed = true;
+        for (uint64_t row = 0; row < numberOfRows; ++row) {
+            if (!reconstructRational(residues[row], modulus, solution[row])) {
+                reconstructed = false;
+                break;
+            }
+        }
+        if (reconstructed && isSolution(solution, rationalB)) {
+            break;
+        }
+    }
+    STORM_LOG_INFO("Modular solver used " << numberOfUsedPrimes << " primes.");
+
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        x[row] = storm::utility::convertNumber<ValueType>(solution[row]);
+    }
+    return true;
+}
+
+template<typename ValueType>
+bool ModularLinearEquationSolver<ValueType>::solveModulo(std::vector<IntegerType> const& numerators, std::vector<IntegerType> const& denominators,
+                                                         uint64_t prime, std::vector<uint64_t>& x) const {
+    uint64_t const numberOfRows = A->getRowCount();
+    uint64_t const noPivot = std::numeric_limits<uint64_t>::max();
+    IntegerType const bigPrime = toInteger<IntegerType>(prime);
+    auto reduceCoefficient = [&](uint64_t index, uint64_t& result) {
+        uint64_t denominator = reduce(denominators[index], bigPrime);
+        if (denominator == 0) {
+            return false;
+        }
+        result = reduce(numerators[index], bigPrime) * inverseModulo(denominator, prime) % prime;
+        return true;
+    };
+
+    // The rows are eliminated one after another. The row processed in the i-th step is reduced with the pivot rows of all previous steps and
+    // then normalized such that its pivot entry is one. Its remaining entries thus refer to columns whose pivot is determined in later steps.
+    std::vector<std::vector<std::pair<uint64_t, uint64_t>>> pivotRows(numberOfRows);
+    std::vector<uint64_t> pivotRightHandSides(numberOfRows);
+    std::vector<uint64_t> pivotColumns(numberOfRows);
+    std::vector<uint64_t> stepOfColumn(A->getColumnCount(), noPivot);
+
+    // A dense accumulator for the row that is currently being reduced.
+    std::vector<uint64_t> denseRow(A->getColumnCount(), 0);
+    std::vector<bool> touched(A->getColumnCount(), false);
+    std::vector<uint64_t> touchedColumns;
+    std::priority_queue<uint64_t, std::vector<uint64_t>, std::greater<uint64_t>> pendingSteps;
+    auto touch = [&](uint64_t column) {
+        if (!touched[column]) {
+            touched[column] = true;
+            touchedColumns.push_back(column);
+            if (stepOfColumn[column] != noPivot) {
+                pendingSteps.push(stepOfColumn[column]);
+            }
+        }
+    };
+
+    uint64_t entryIndex = 0;
+    for (uint64_t row = 0; row < numberOfRows; ++row) {
+        for (auto const& entry : A->getRow(row)) {
+            uint64_t value;
+            if (!reduceCoefficient(entryIndex++, value)) {
+                return false;
+            }
+            if (value != 0) {
+                touch(entry.getColumn());
+                denseRow[entry.getColumn()] = (denseRow[entry.getColumn()] + value) % prime;
+            }
+        }
+        uint64_t rightHandSide;
+        if (!reduceCoefficient(A->getEntryCount() + row, rightHandSide)) {
+            return false;
+        }
+
+        // Eliminate all entries in columns that already have a pivot. Since the pivot rows only introduce entries in columns whose pivot
+        // was determined later, processing the steps in ascending order eliminates each column at most once.
+        while (!pendingSteps.empty()) {
+            uint64_t step = pendingSteps.top();
+            pendingSteps.pop();
+            uint64_t factor = denseRow[pivotColumns[step]];
+            if (factor == 0) {
+                continue;
+            }
+            denseRow[pivotColumns[step]] = 0;
+            for (auto const& pivotEntry : pivotRows[step]) {
+                touch(pivotEntry.first);
+                denseRow[pivotEntry.first] = (denseRow[pivotEntry.first] + prime - factor * pivotEntry.second % prime) % prime;
+            }
+            rightHandSide = (rightHandSide + prime - factor * pivotRightHandSides[step] % prime) % prime;
+        }
+
+        // Select the pivot, preferring the diagonal entry to keep the fill-in low for the typical (diagonally dominant) systems.
+        uint64_t pivotColumn = noPivot;
+        if (row < denseRow.size() && denseRow[row] != 0) {
+            pivotColumn = row;
+        } else {
+            for (auto column : touchedColumns) {
+                if (denseRow[column] != 0) {
+                    pivotColumn = column;
+                    break;
+                }
+            }
+        }
+        if (pivotColumn == noPivot) {
+            // The matrix is singular modulo the prime.
+            return false;
+        }
+
+        uint64_t inversePivot = inverseModulo(denseRow[pivotColumn], prime);
+        auto& pivotRow = pivotRows[row];
+        for (auto column : touchedColumns) {
+            if (column != pivotColumn && denseRow[column] != 0) {
+                pivotRow.emplace_back(column, denseRow[column] * inversePivot % prime);
+            }
+            denseRow[column] = 0;
+            touched[column] = false;
+        }
+        touchedColumns.clear();
+        pivotRow.shrink_to_fit();
+        pivotRightHandSides[row] = rightHandSide * inversePivot % prime;
+        pivotColumns[row] = pivotColumn;
+        stepOfColumn[pivotColumn] = row;
+    }
+
+    // Back substitution in reverse order of the steps.
+    x.assign(numberOfRows, 0);
+    for (uint64_t step = numberOfRows; step > 0; --step) {
+        uint64_t value = pivotRightHandSides[step - 1];
+        for (auto const& pivotEntry : pivotRows[step - 1]) {
+            value = (value + prime - pivotEntry.second * x[pivotEntry.first] % prime) % prime;
+        }
+        x[pivotColumns[step - 1]] = value;
+    }
+    return true;
+}
+
+template<typename ValueType>
+bool ModularLinearEquationSolver<ValueType>::isSolution(std::vector<RationalType> const& x, std::vector<RationalType> const& b) const {
+    for (uint64_t row = 0; row < A->getRowCount(); ++row) {
+        RationalType value = storm::utility::zero<RationalType>();
+        for (auto const& entry : A->getRow(row)) {
+            value += storm::utility::convertNumber<RationalType>(entry.getValue()) * x[entry.getColumn()];
+        }
+        if (value != b[row]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+template<typename ValueType>
+LinearEquationSolverProblemFormat ModularLinearEquationSolver<ValueType>::getEquationProblemFormat(Environment const&) const {
+    return LinearEquationSolverProblemFormat::EquationSystem;
+}
+
+template<typename ValueType>
+uint64_t ModularLinearEquationSolver<ValueType>::getMatrixRowCount() const {
+    return this->A->getRowCount();
+}
+
+template<typename ValueType>
+uint64_t ModularLinearEquationSolver<ValueType>::getMatrixColumnCount() const {
+    return this->A->getColumnCount();
+}
+
+template<typename ValueType>
+std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> ModularLinearEquationSolverFactory<ValueType>::create(Environment const&) const {
+    return std::make_unique<storm::solver::ModularLinearEquationSolver<ValueType>>();
+}
+
+template<typename ValueType>
+std::unique_ptr<LinearEquationSolverFactory<ValueType>> ModularLinearEquationSolverFactory<ValueType>::clone() const {
+    return std::make_unique<ModularLinearEquationSolverFactory<ValueType>>(*this);
+}
+
+#ifdef STORM_HAVE_CARL
+template class ModularLinearEquationSolver<double>;
+template class ModularLinearEquationSolverFactory<double>;
+
+template class ModularLinearEquationSolver<storm::RationalNumber>;
+template class ModularLinearEquationSolverFactory<storm::RationalNumber>;
+#endif
+}  // namespace solver
+}  // namespace storm
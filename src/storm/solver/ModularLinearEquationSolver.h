@@ -0,0 +1,76 @@
+#pragma once
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/solver/LinearEquationSolver.h"
+#include "storm/utility/NumberTraits.h"
+
+namespace storm {
+namespace solver {
+
+/*!
+ * A class that solves equation systems exactly using modular arithmetic. The system is solved modulo several word-sized primes (in parallel
+ * if Intel TBB is enabled), the solutions are combined by Chinese remaindering and the rational solution is recovered by rational
+ * reconstruction. As the numbers involved in the modular computations never grow, this avoids the coefficient growth of eliminating with
+ * rational numbers. Each reconstructed solution is verified with exact arithmetic and more primes are used until the verification succeeds.
+ *
+ * Entries of non-exact value types are treated as the rational numbers they represent.
+ */
+template<typename ValueType>
+class ModularLinearEquationSolver : public LinearEquationSolver<ValueType> {
+   public:
+    ModularLinearEquationSolver();
+    ModularLinearEquationSolver(storm::storage::SparseMatrix<ValueType> const& A);
+    ModularLinearEquationSolver(storm::storage::SparseMatrix<ValueType>&& A);
+
+    virtual void setMatrix(storm::storage::SparseMatrix<ValueType> const& A) override;
+    virtual void setMatrix(storm::storage::SparseMatrix<ValueType>&& A) override;
+
+    virtual LinearEquationSolverProblemFormat getEquationProblemFormat(Environment const& env) const override;
+
+   protected:
+    virtual bool internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const override;
+
+   private:
+    typedef storm::RationalNumber RationalType;
+    typedef typename storm::NumberTraits<RationalType>::IntegerType IntegerType;
+
+    /*!
+     * Solves the equation system modulo the given prime using sparse gaussian elimination.
+     *
+     * @param numerators The numerators of the matrix entries (in the order of the entries) followed by the ones of the right-hand side.
+     * @param denominators The corresponding denominators.
+     * @param prime The prime. It must be smaller than 2^32.
+     * @param x The solution modulo the prime (if the method returns true).
+     * @return False if the prime divides one of the denominators or the matrix is singular modulo the prime.
+     */
+    bool solveModulo(std::vector<IntegerType> const& numerators, std::vector<IntegerType> const& denominators, uint64_t prime,
+                     std::vector<uint64_t>& x) const;
+
+    /*!
+     * Checks (with exact arithmetic) whether the given vector solves the equation system.
+     */
+    bool isSolution(std::vector<RationalType> const& x, std::vector<RationalType> const& b) const;
+
+    virtual uint64_t getMatrixRowCount() const override;
+    virtual uint64_t getMatrixColumnCount() const override;
+
+    // If the solver takes posession of the matrix, we store the moved matrix in this member, so it gets deleted
+    // when the solver is destructed.
+    std::unique_ptr<storm::storage::SparseMatrix<ValueType>> localA;
+
+    // A pointer to the original sparse matrix given to this solver. If the solver takes posession of the matrix
+    // the pointer refers to localA.
+    storm::storage::SparseMatrix<ValueType> const* A;
+};
+
+template<typename ValueType>
+class ModularLinearEquationSolverFactory : public LinearEquationSolverFactory<ValueType> {
+   public:
+    using LinearEquationSolverFactory<ValueType>::create;
+
+    virtual std::unique_ptr<storm::solver::LinearEquationSolver<ValueType>> create(Environment const& env) const override;
+
+    virtual std::unique_ptr<LinearEquationSolverFactory<ValueType>> clone() const override;
+};
+}  // namespace solver
+}  // namespace storm
@@ -9,12 +9,15 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/exceptions/PrecisionExceededException.h"
 #include "storm/exceptions/UnmetRequirementException.h"
+#include "storm/solver/helper/KrylovSolverHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
+#include "storm/solver/helper/SparseLUFactorization.h"
 #include "storm/solver/multiplier/Multiplier.h"
 #include "storm/utility/ConstantsComparator.h"
 #include "storm/utility/KwekMehlhorn.h"
 #include "storm/utility/NumberTraits.h"
+#include "storm/utility/RoundingModeGuard.h"
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/vector.h"
@@ -64,11 +67,17 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const&
     uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
     bool relative = env.solver().native().getRelativeTerminationCriterion();
 
+    storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env, "native-sor-" + std::to_string(storm::utility::convertNumber<double>(omega)), *A, {&b});
+    typename storm::solver::helper::SolverCheckpoint<ValueType>::State checkpointState;
+    if (checkpoint.restore(checkpointState, 1, x.size())) {
+        x = std::move(checkpointState.vectors.front());
+    }
+
     // Set up additional environment variables.
-    uint_fast64_t iterations = 0;
+    uint_fast64_t iterations = checkpointState.iterations;
     SolverStatus status = SolverStatus::InProgress;
 
-    this->startMeasureProgress();
+    this->startMeasureProgress(iterations);
     while (status == SolverStatus::InProgress && iterations < maxIter) {
         A->performSuccessiveOverRelaxationStep(omega, x, b);
 
@@ -88,6 +97,10 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsSOR(Environment const&
         ++iterations;
 
         status = this->updateStatus(status, x, SolverGuarantee::None, iterations, maxIter);
+
+        if (status != SolverStatus::Converged) {
+            checkpoint.writeIfDue(iterations, {&x});
+        }
     }
 
     if (!this->isCachingEnabled()) {
@@ -124,14 +137,20 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsJacobi(Environment con
     uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
     bool relative = env.solver().native().getRelativeTerminationCriterion();
 
+    storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env, "native-jacobi", *A, {&b});
+    typename storm::solver::helper::SolverCheckpoint<ValueType>::State checkpointState;
+    if (checkpoint.restore(checkpointState, 1, x.size())) {
+        x = std::move(checkpointState.vectors.front());
+    }
+
     std::vector<ValueType>* currentX = &x;
     std::vector<ValueType>* nextX = this->cachedRowVector.get();
 
     // Set up additional environment variables.
-    uint_fast64_t iterations = 0;
+    uint_fast64_t iterations = checkpointState.iterations;
     SolverStatus status = SolverStatus::InProgress;
 
-    this->startMeasureProgress();
+    this->startMeasureProgress(iterations);
     while (status == SolverStatus::InProgress && iterations < maxIter) {
         // Compute D^-1 * (b - LU * x) and store result in nextX.
         jacobiDecomposition->multiplier->multiply(env, *currentX, nullptr, *nextX);
@@ -152,6 +171,10 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsJacobi(Environment con
         ++iterations;
 
         status = this->updateStatus(status, *currentX, SolverGuarantee::None, iterations, maxIter);
+
+        if (status != SolverStatus::Converged) {
+            checkpoint.writeIfDue(iterations, {currentX});
+        }
     }
 
     // If the last iteration did not write to the original x we have to swap the contents, because the
@@ -317,7 +340,7 @@ template<typename ValueType>
 typename NativeLinearEquationSolver<ValueType>::PowerIterationResult NativeLinearEquationSolver<ValueType>::performPowerIteration(
     Environment const& env, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX, std::vector<ValueType> const& b, ValueType const& precision,
     bool relative, SolverGuarantee const& guarantee, uint64_t currentIterations, uint64_t maxIterations,
-    storm::solver::MultiplicationStyle const& multiplicationStyle) const {
+    storm::solver::MultiplicationStyle const& multiplicationStyle, storm::solver::helper::SolverCheckpoint<ValueType>* checkpoint) const {
     bool useGaussSeidelMultiplication = multiplicationStyle == storm::solver::MultiplicationStyle::GaussSeidel;
 
     uint64_t iterations = currentIterations;
@@ -343,6 +366,10 @@ typename NativeLinearEquationSolver<ValueType>::PowerIterationResult NativeLinea
 
         // Potentially show progress.
         this->showProgressIterative(iterations);
+
+        if (checkpoint && status != SolverStatus::Converged) {
+            checkpoint->writeIfDue(iterations, {currentX});
+        }
     }
 
     return PowerIterationResult(iterations - currentIterations, status);
@@ -372,12 +399,19 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsPower(Environment cons
     }
     std::vector<ValueType>* newX = this->cachedRowVector.get();
 
+    // Resuming from a checkpoint preserves the guarantee as the checkpointed iterate was obtained from a vector with the same guarantee.
+    storm::solver::helper::SolverCheckpoint<ValueType> checkpoint(env, "native-power", *A, {&b});
+    typename storm::solver::helper::SolverCheckpoint<ValueType>::State checkpointState;
+    if (checkpoint.restore(checkpointState, 1, x.size())) {
+        x = std::move(checkpointState.vectors.front());
+    }
+
     // Forward call to power iteration implementation.
-    this->startMeasureProgress();
+    this->startMeasureProgress(checkpointState.iterations);
     ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
-    PowerIterationResult result =
-        this->performPowerIteration(env, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(), guarantee, 0,
-                                    env.solver().native().getMaximalNumberOfIterations(), env.solver().native().getPowerMethodMultiplicationStyle());
+    PowerIterationResult result = this->performPowerIteration(env, currentX, newX, b, precision, env.solver().native().getRelativeTerminationCriterion(),
+                                                              guarantee, checkpointState.iterations, env.solver().native().getMaximalNumberOfIterations(),
+                                                              env.solver().native().getPowerMethodMultiplicationStyle(), &checkpoint);
 
     // Swap the result in place.
     if (currentX == this->cachedRowVector.get()) {
@@ -457,6 +491,9 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
         precision *= storm::utility::convertNumber<ValueType>(2.0);
     }
     uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+    // With directed rounding, the bounds are updated such that round-off errors can only widen the enclosure. Everything else (in particular the
+    // convergence check) is computed with the default rounding mode.
+    bool directedRounding = env.solver().isForceDirectedRounding() && !storm::NumberTraits<ValueType>::IsExact;
     this->startMeasureProgress();
     while (status == SolverStatus::InProgress && iterations < maxIter) {
         // Remember in which directions we took steps in this iteration.
@@ -471,22 +508,34 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
                 if (useDiffs) {
                     preserveOldRelevantValues(*lowerX, this->getRelevantValues(), oldValues);
                 }
-                this->multiplier->multiplyGaussSeidel(env, *lowerX, &b);
+                {
+                    storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Downward, directedRounding);
+                    this->multiplier->multiplyGaussSeidel(env, *lowerX, &b);
+                }
                 if (useDiffs) {
                     maxLowerDiff = computeMaxAbsDiff(*lowerX, this->getRelevantValues(), oldValues);
                     preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldValues);
                 }
-                this->multiplier->multiplyGaussSeidel(env, *upperX, &b);
+                {
+                    storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Upward, directedRounding);
+                    this->multiplier->multiplyGaussSeidel(env, *upperX, &b);
+                }
                 if (useDiffs) {
                     maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
                 }
             } else {
-                this->multiplier->multiply(env, *lowerX, &b, *tmp);
+                {
+                    storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Downward, directedRounding);
+                    this->multiplier->multiply(env, *lowerX, &b, *tmp);
+                }
                 if (useDiffs) {
                     maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
                 }
                 std::swap(tmp, lowerX);
-                this->multiplier->multiply(env, *upperX, &b, *tmp);
+                {
+                    storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Upward, directedRounding);
+                    this->multiplier->multiply(env, *upperX, &b, *tmp);
+                }
                 if (useDiffs) {
                     maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
                 }
@@ -499,7 +548,10 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
                     if (useDiffs) {
                         preserveOldRelevantValues(*lowerX, this->getRelevantValues(), oldValues);
                     }
-                    this->multiplier->multiplyGaussSeidel(env, *lowerX, &b);
+                    {
+                        storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Downward, directedRounding);
+                        this->multiplier->multiplyGaussSeidel(env, *lowerX, &b);
+                    }
                     if (useDiffs) {
                         maxLowerDiff = computeMaxAbsDiff(*lowerX, this->getRelevantValues(), oldValues);
                     }
@@ -508,7 +560,10 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
                     if (useDiffs) {
                         preserveOldRelevantValues(*upperX, this->getRelevantValues(), oldValues);
                     }
-                    this->multiplier->multiplyGaussSeidel(env, *upperX, &b);
+                    {
+                        storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Upward, directedRounding);
+                        this->multiplier->multiplyGaussSeidel(env, *upperX, &b);
+                    }
                     if (useDiffs) {
                         maxUpperDiff = computeMaxAbsDiff(*upperX, this->getRelevantValues(), oldValues);
                     }
@@ -516,14 +571,20 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
                 }
             } else {
                 if (maxLowerDiff >= maxUpperDiff) {
-                    this->multiplier->multiply(env, *lowerX, &b, *tmp);
+                    {
+                        storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Downward, directedRounding);
+                        this->multiplier->multiply(env, *lowerX, &b, *tmp);
+                    }
                     if (useDiffs) {
                         maxLowerDiff = computeMaxAbsDiff(*lowerX, *tmp, this->getRelevantValues());
                     }
                     std::swap(tmp, lowerX);
                     lowerStep = true;
                 } else {
-                    this->multiplier->multiply(env, *upperX, &b, *tmp);
+                    {
+                        storm::utility::RoundingModeGuard rounding(storm::utility::RoundingModeGuard::Direction::Upward, directedRounding);
+                        this->multiplier->multiply(env, *upperX, &b, *tmp);
+                    }
                     if (useDiffs) {
                         maxUpperDiff = computeMaxAbsDiff(*upperX, *tmp, this->getRelevantValues());
                     }
@@ -568,6 +629,11 @@ bool NativeLinearEquationSolver<ValueType>::solveEquationsIntervalIteration(Envi
         status = this->updateStatus(status, false, iterations, maxIter);
     }
 
+    if (directedRounding) {
+        // Only the bounds are guaranteed to enclose the solution.
+        this->setSolutionEnclosure(*lowerX, *upperX);
+    }
+
     // We take the means of the lower and upper bound so we guarantee the desired precision.
     storm::utility::vector::applyPointwise(
         *lowerX, *upperX, *lowerX, [](ValueType const& a, ValueType const& b) -> ValueType { return (a + b) / storm::utility::convertNumber<ValueType>(2.0); });
@@ -984,12 +1050,86 @@ void NativeLinearEquationSolver<ValueType>::logIterations(bool converged, bool t
     }
 }
 
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsSparseLU(Environment const&, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (sparse LU factorization)");
+
+    // The symbolic factorization is shared with all matrices of the same pattern, so only the numeric factorization is computed here.
+    bool success = true;
+    if (!sparseLUFactorization) {
+        sparseLUFactorization = std::make_unique<storm::solver::helper::SparseLUFactorization<ValueType>>(*A);
+        success = sparseLUFactorization->factorize(*A);
+        STORM_LOG_INFO("LU factors have " << sparseLUFactorization->getSymbolicFactorization().getNumberOfNonZerosOfFactors() << " non-zero entries.");
+    }
+    if (success) {
+        sparseLUFactorization->solve(x, b);
+    } else {
+        sparseLUFactorization.reset();
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    return success;
+}
+
+template<typename ValueType>
+bool NativeLinearEquationSolver<ValueType>::solveEquationsKrylov(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                                 NativeLinearEquationSolverMethod method) const {
+    STORM_LOG_INFO("Solving linear equation system (" << x.size() << " rows) with NativeLinearEquationSolver (" << toString(method) << ", preconditioner "
+                                                      << toString(env.solver().native().getPreconditioner()) << ")");
+
+    // The preconditioner is only built once per matrix.
+    if (!krylovSolverHelper) {
+        krylovSolverHelper = std::make_unique<storm::solver::helper::KrylovSolverHelper<ValueType>>(*A, env.solver().native().getPreconditioner());
+    }
+
+    ValueType precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+    uint64_t maxIter = env.solver().native().getMaximalNumberOfIterations();
+    bool relative = env.solver().native().getRelativeTerminationCriterion();
+    uint64_t iterations = 0;
+    auto updateStatus = [&](std::vector<ValueType> const& currentX, uint64_t currentIterations) {
+        this->showProgressIterative(currentIterations);
+        return this->updateStatus(SolverStatus::InProgress, currentX, SolverGuarantee::None, currentIterations, maxIter);
+    };
+
+    this->startMeasureProgress();
+    SolverStatus status;
+    if (method == NativeLinearEquationSolverMethod::Bicgstab) {
+        status = krylovSolverHelper->solveBicgstab(x, b, precision, relative, maxIter, iterations, updateStatus);
+    } else {
+        STORM_LOG_ASSERT(method == NativeLinearEquationSolverMethod::Gmres, "Unexpected Krylov method.");
+        status = krylovSolverHelper->solveGmres(x, b, precision, relative, env.solver().native().getRestartThreshold(), maxIter, iterations, updateStatus);
+    }
+
+    if (!this->isCachingEnabled()) {
+        clearCache();
+    }
+
+    this->reportStatus(status, iterations);
+
+    return status == SolverStatus::Converged || status == SolverStatus::TerminatedEarly;
+}
+
+#ifdef STORM_HAVE_CARL
+template<>
+bool NativeLinearEquationSolver<storm::RationalNumber>::solveEquationsKrylov(Environment const&, std::vector<storm::RationalNumber>&,
+                                                                             std::vector<storm::RationalNumber> const&,
+                                                                             NativeLinearEquationSolverMethod method) const {
+    STORM_LOG_THROW(false, storm::exceptions::NotSupportedException, "The method " << toString(method) << " is not supported for exact computations.");
+    return false;
+}
+#endif
+
 template<typename ValueType>
 NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMethod(Environment const& env, bool isExactMode) const {
     // Adjust the method if none was specified and we want exact or sound computations
     auto method = env.solver().native().getMethod();
 
-    if (isExactMode && method != NativeLinearEquationSolverMethod::RationalSearch) {
+    // LU factorization is exact if the value type is.
+    if (isExactMode && method != NativeLinearEquationSolverMethod::RationalSearch &&
+        !(storm::NumberTraits<ValueType>::IsExact && method == NativeLinearEquationSolverMethod::SparseLU)) {
         if (env.solver().native().isMethodSetFromDefault()) {
             method = NativeLinearEquationSolverMethod::RationalSearch;
             STORM_LOG_INFO(
@@ -1000,7 +1140,7 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
         }
     } else if (env.solver().isForceSoundness() && method != NativeLinearEquationSolverMethod::SoundValueIteration &&
                method != NativeLinearEquationSolverMethod::OptimisticValueIteration && method != NativeLinearEquationSolverMethod::IntervalIteration &&
-               method != NativeLinearEquationSolverMethod::RationalSearch) {
+               method != NativeLinearEquationSolverMethod::RationalSearch && method != NativeLinearEquationSolverMethod::SparseLU) {
         if (env.solver().native().isMethodSetFromDefault()) {
             method = NativeLinearEquationSolverMethod::OptimisticValueIteration;
             STORM_LOG_INFO(
@@ -1015,7 +1155,8 @@ NativeLinearEquationSolverMethod NativeLinearEquationSolver<ValueType>::getMetho
 
 template<typename ValueType>
 bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
-    switch (getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact())) {
+    auto method = getMethod(env, storm::NumberTraits<ValueType>::IsExact || env.solver().isForceExact());
+    switch (method) {
         case NativeLinearEquationSolverMethod::SOR:
             return this->solveEquationsSOR(env, x, b, storm::utility::convertNumber<ValueType>(env.solver().native().getSorOmega()));
         case NativeLinearEquationSolverMethod::GaussSeidel:
@@ -1034,6 +1175,11 @@ bool NativeLinearEquationSolver<ValueType>::internalSolveEquations(Environment c
             return this->solveEquationsIntervalIteration(env, x, b);
         case NativeLinearEquationSolverMethod::RationalSearch:
             return this->solveEquationsRationalSearch(env, x, b);
+        case NativeLinearEquationSolverMethod::SparseLU:
+            return this->solveEquationsSparseLU(env, x, b);
+        case NativeLinearEquationSolverMethod::Bicgstab:
+        case NativeLinearEquationSolverMethod::Gmres:
+            return this->solveEquationsKrylov(env, x, b, method);
     }
     STORM_LOG_THROW(false, storm::exceptions::InvalidEnvironmentException, "Unknown solving technique.");
     return false;
@@ -1073,6 +1219,8 @@ void NativeLinearEquationSolver<ValueType>::clearCache() const {
     multiplier.reset();
     soundValueIterationHelper.reset();
     optimisticValueIterationHelper.reset();
+    sparseLUFactorization.reset();
+    krylovSolverHelper.reset();
     LinearEquationSolver<ValueType>::clearCache();
 }
 
@@ -7,8 +7,11 @@
 
 #include "storm/solver/SolverSelectionOptions.h"
 #include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/KrylovSolverHelper.h"
 #include "storm/solver/helper/OptimisticValueIterationHelper.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
 #include "storm/solver/helper/SoundValueIterationHelper.h"
+#include "storm/solver/helper/SparseLUFactorization.h"
 #include "storm/solver/multiplier/NativeMultiplier.h"
 
 #include "storm/utility/NumberTraits.h"
@@ -56,7 +59,8 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     PowerIterationResult performPowerIteration(Environment const& env, std::vector<ValueType>*& currentX, std::vector<ValueType>*& newX,
                                                std::vector<ValueType> const& b, ValueType const& precision, bool relative, SolverGuarantee const& guarantee,
                                                uint64_t currentIterations, uint64_t maxIterations,
-                                               storm::solver::MultiplicationStyle const& multiplicationStyle) const;
+                                               storm::solver::MultiplicationStyle const& multiplicationStyle,
+                                               storm::solver::helper::SolverCheckpoint<ValueType>* checkpoint = nullptr) const;
 
     void logIterations(bool converged, bool terminate, uint64_t iterations) const;
 
@@ -73,6 +77,9 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     virtual bool solveEquationsOptimisticValueIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsIntervalIteration(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
     virtual bool solveEquationsRationalSearch(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsSparseLU(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+    virtual bool solveEquationsKrylov(storm::Environment const& env, std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                      NativeLinearEquationSolverMethod method) const;
 
     template<typename RationalType, typename ImpreciseType>
     bool solveEquationsRationalSearchHelper(storm::Environment const& env, NativeLinearEquationSolver<ImpreciseType> const& impreciseSolver,
@@ -108,6 +115,8 @@ class NativeLinearEquationSolver : public LinearEquationSolver<ValueType> {
     mutable std::unique_ptr<std::vector<ValueType>> cachedRowVector2;  // A.getRowCount() rows
     mutable std::unique_ptr<storm::solver::helper::SoundValueIterationHelper<ValueType>> soundValueIterationHelper;
     mutable std::unique_ptr<storm::solver::helper::OptimisticValueIterationHelper<ValueType>> optimisticValueIterationHelper;
+    mutable std::unique_ptr<storm::solver::helper::SparseLUFactorization<ValueType>> sparseLUFactorization;
+    mutable std::unique_ptr<storm::solver::helper::KrylovSolverHelper<ValueType>> krylovSolverHelper;
 
     struct JacobiDecomposition {
         JacobiDecomposition(Environment const& env, storm::storage::SparseMatrix<ValueType> const& A);
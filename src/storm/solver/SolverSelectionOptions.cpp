@@ -100,6 +100,8 @@ std::string toString(EquationSolverType t) {
             return "Topological";
         case EquationSolverType::Acyclic:
             return "Acyclic";
+        case EquationSolverType::Modular:
+            return "Modular";
     }
     return "invalid";
 }
@@ -134,6 +136,24 @@ std::string toString(NativeLinearEquationSolverMethod t) {
             return "IntervalIteration";
         case NativeLinearEquationSolverMethod::RationalSearch:
             return "RationalSearch";
+        case NativeLinearEquationSolverMethod::SparseLU:
+            return "SparseLU";
+        case NativeLinearEquationSolverMethod::Bicgstab:
+            return "Bicgstab";
+        case NativeLinearEquationSolverMethod::Gmres:
+            return "Gmres";
+    }
+    return "invalid";
+}
+
+std::string toString(NativeLinearEquationSolverPreconditioner t) {
+    switch (t) {
+        case NativeLinearEquationSolverPreconditioner::Ilu:
+            return "ilu";
+        case NativeLinearEquationSolverPreconditioner::Amg:
+            return "amg";
+        case NativeLinearEquationSolverPreconditioner::None:
+            return "none";
     }
     return "invalid";
 }
@@ -1,10 +1,13 @@
 #include "storm/solver/StandardGameSolver.h"
 
+#include <atomic>
+
 #include "storm/solver/EigenLinearEquationSolver.h"
 #include "storm/solver/EliminationLinearEquationSolver.h"
 #include "storm/solver/GmmxxLinearEquationSolver.h"
 #include "storm/solver/NativeLinearEquationSolver.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/exceptions/InvalidEnvironmentException.h"
 #include "storm/exceptions/InvalidStateException.h"
@@ -15,11 +18,40 @@
 #include "storm/utility/SignalHandler.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/vector.h"
 
 namespace storm {
 namespace solver {
 
+namespace {
+// Applies the given function to the indices 0, ..., size - 1. If enabled, the indices are distributed over multiple threads.
+template<typename Function>
+void forEachIndex(uint64_t size, Function const& function) {
+    bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+    parallelize = storm::utility::parallel::isIntelTbbEnabled();
+    if (parallelize) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, size, 100), [&function](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                function(index);
+            }
+        });
+    }
+#endif
+    if (!parallelize) {
+        for (uint64_t index = 0; index < size; ++index) {
+            function(index);
+        }
+    }
+}
+
+template<typename ValueType>
+bool isStrictlyBetter(OptimizationDirection dir, ValueType const& value, ValueType const& reference) {
+    return dir == OptimizationDirection::Minimize ? value < reference : reference < value;
+}
+}  // namespace
+
 template<typename ValueType>
 StandardGameSolver<ValueType>::StandardGameSolver(storm::storage::SparseMatrix<storm::storage::sparse::state_type> const& player1Matrix,
                                                   storm::storage::SparseMatrix<ValueType> const& player2Matrix,
@@ -410,10 +442,20 @@ void StandardGameSolver<ValueType>::repeatedMultiply(Environment const& env, Opt
     if (!auxiliaryP2RowGroupVector) {
         auxiliaryP2RowGroupVector = std::make_unique<std::vector<ValueType>>(player2Matrix.getRowGroupCount());
     }
+    if (!auxiliaryP1RowGroupVector) {
+        auxiliaryP1RowGroupVector = std::make_unique<std::vector<ValueType>>(this->getNumberOfPlayer1States());
+    }
     std::vector<ValueType>& reducedPlayer2Result = *auxiliaryP2RowGroupVector;
 
+    // Alternate between x and the auxiliary vector, such that the input of a multiplication is never overwritten during the multiplication.
+    std::vector<ValueType>* currentX = &x;
+    std::vector<ValueType>* newX = auxiliaryP1RowGroupVector.get();
     for (uint_fast64_t iteration = 0; iteration < n; ++iteration) {
-        multiplyAndReduce(env, player1Dir, player2Dir, x, b, *multiplierPlayer2Matrix, reducedPlayer2Result, x);
+        multiplyAndReduce(env, player1Dir, player2Dir, *currentX, b, *multiplierPlayer2Matrix, reducedPlayer2Result, *newX);
+        std::swap(currentX, newX);
+    }
+    if (currentX != &x) {
+        std::swap(x, *currentX);
     }
 
     if (!this->isCachingEnabled()) {
@@ -427,6 +469,14 @@ void StandardGameSolver<ValueType>::multiplyAndReduce(Environment const& env, Op
                                                       storm::solver::Multiplier<ValueType> const& multiplier, std::vector<ValueType>& player2ReducedResult,
                                                       std::vector<ValueType>& player1ReducedResult, std::vector<uint64_t>* player1SchedulerChoices,
                                                       std::vector<uint64_t>* player2SchedulerChoices) const {
+    // Note that the parallel variant evaluates the player 2 states itself if player 1 is represented by a grouping, i.e., the given multiplier
+    // (and thus the configured multiplier type) is only used if player 1 is represented by a matrix.
+    if (storm::utility::parallel::isIntelTbbEnabled() && &x != &player1ReducedResult) {
+        multiplyAndReduceParallel(env, player1Dir, player2Dir, x, b, multiplier, player2ReducedResult, player1ReducedResult, player1SchedulerChoices,
+                                  player2SchedulerChoices);
+        return;
+    }
+
     multiplier.multiplyAndReduce(env, player2Dir, x, b, player2ReducedResult, player2SchedulerChoices);
 
     if (this->player1RepresentedByMatrix()) {
@@ -461,6 +511,108 @@ void StandardGameSolver<ValueType>::multiplyAndReduce(Environment const& env, Op
     }
 }
 
+template<typename ValueType>
+void StandardGameSolver<ValueType>::multiplyAndReduceParallel(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
+                                                              std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                              storm::solver::Multiplier<ValueType> const& multiplier,
+                                                              std::vector<ValueType>& player2ReducedResult, std::vector<ValueType>& player1ReducedResult,
+                                                              std::vector<uint64_t>* player1SchedulerChoices,
+                                                              std::vector<uint64_t>* player2SchedulerChoices) const {
+    STORM_LOG_ASSERT(&x != &player1ReducedResult, "The result vector must not alias the input vector.");
+
+    if (this->player1RepresentedByMatrix()) {
+        // Player 2 states might be shared among player 1 states, so we reduce all of them first.
+        multiplier.multiplyAndReduce(env, player2Dir, x, b, player2ReducedResult, player2SchedulerChoices);
+        forEachIndex(this->getNumberOfPlayer1States(), [&](uint64_t player1State) {
+            auto relevantRows = this->getPlayer1Matrix().getRowGroup(player1State);
+            STORM_LOG_ASSERT(relevantRows.getNumberOfEntries() != 0, "There is a choice of player 1 that does not lead to any player 2 choice");
+            auto it = relevantRows.begin();
+            ValueType& result = player1ReducedResult[player1State];
+            result = player2ReducedResult[it->getColumn()];
+            for (++it; it != relevantRows.end(); ++it) {
+                if (isStrictlyBetter(player1Dir, player2ReducedResult[it->getColumn()], result)) {
+                    result = player2ReducedResult[it->getColumn()];
+                }
+            }
+        });
+    } else {
+        // Every player 2 state belongs to exactly one player 1 state. Hence, both reductions can be performed for each player 1 state
+        // without synchronizing the threads in between.
+        std::vector<uint64_t> const& player1Grouping = this->getPlayer1Grouping();
+        forEachIndex(this->getNumberOfPlayer1States(), [&](uint64_t player1State) {
+            uint64_t firstPlayer2State = player1Grouping[player1State];
+            uint64_t endPlayer2State = player1Grouping[player1State + 1];
+            for (uint64_t player2State = firstPlayer2State; player2State < endPlayer2State; ++player2State) {
+                player2ReducedResult[player2State] = multiplyAndReducePlayer2State(
+                    player2Dir, player2State, x, b, player2SchedulerChoices ? &(*player2SchedulerChoices)[player2State] : nullptr);
+            }
+
+            ValueType& result = player1ReducedResult[player1State];
+            if (firstPlayer2State == endPlayer2State) {
+                result = storm::utility::zero<ValueType>();
+                if (player1SchedulerChoices) {
+                    (*player1SchedulerChoices)[player1State] = 0;
+                }
+                return;
+            }
+            // Only update the choice if the new choice is strictly better.
+            uint64_t* choice = player1SchedulerChoices ? &(*player1SchedulerChoices)[player1State] : nullptr;
+            uint64_t selectedChoice = 0;
+            result = player2ReducedResult[firstPlayer2State];
+            ValueType oldSelectedChoiceValue = result;
+            for (uint64_t player2State = firstPlayer2State + 1; player2State < endPlayer2State; ++player2State) {
+                ValueType const& value = player2ReducedResult[player2State];
+                if (choice && player2State - firstPlayer2State == *choice) {
+                    oldSelectedChoiceValue = value;
+                }
+                if (isStrictlyBetter(player1Dir, value, result)) {
+                    result = value;
+                    selectedChoice = player2State - firstPlayer2State;
+                }
+            }
+            if (choice && isStrictlyBetter(player1Dir, result, oldSelectedChoiceValue)) {
+                *choice = selectedChoice;
+            }
+        });
+    }
+}
+
+template<typename ValueType>
+ValueType StandardGameSolver<ValueType>::multiplyAndReducePlayer2State(OptimizationDirection player2Dir, uint64_t player2State,
+                                                                       std::vector<ValueType> const& x, std::vector<ValueType> const* b,
+                                                                       uint64_t* choice) const {
+    uint64_t firstRow = this->player2Matrix.getRowGroupIndices()[player2State];
+    uint64_t endRow = this->player2Matrix.getRowGroupIndices()[player2State + 1];
+    if (firstRow == endRow) {
+        if (choice) {
+            *choice = 0;
+        }
+        return storm::utility::zero<ValueType>();
+    }
+
+    ValueType result;
+    ValueType oldSelectedChoiceValue;
+    uint64_t selectedChoice = 0;
+    for (uint64_t row = firstRow; row < endRow; ++row) {
+        ValueType value = b ? (*b)[row] : storm::utility::zero<ValueType>();
+        for (auto const& entry : this->player2Matrix.getRow(row)) {
+            value += entry.getValue() * x[entry.getColumn()];
+        }
+        if (row == firstRow || (choice && row - firstRow == *choice)) {
+            oldSelectedChoiceValue = value;
+        }
+        if (row == firstRow || isStrictlyBetter(player2Dir, value, result)) {
+            result = std::move(value);
+            selectedChoice = row - firstRow;
+        }
+    }
+    // Only update the choice if the new choice is strictly better.
+    if (choice && isStrictlyBetter(player2Dir, result, oldSelectedChoiceValue)) {
+        *choice = selectedChoice;
+    }
+    return result;
+}
+
 template<typename ValueType>
 bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir,
                                                    std::vector<ValueType> const& x, std::vector<ValueType> const& b,
@@ -472,20 +624,20 @@ bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, Optim
             : storm::utility::convertNumber<ValueType>(env.solver().getPrecisionOfLinearEquationSolver(env.solver().getLinearEquationSolverType()).first.get()),
         false);
 
-    // get the choices of player 2 and the corresponding values.
-    bool schedulerImproved = false;
-    auto currentValueIt = player2ChoiceValues.begin();
-    for (uint_fast64_t p2Group = 0; p2Group < this->player2Matrix.getRowGroupCount(); ++p2Group, ++currentValueIt) {
+    // get the choices of player 2 and the corresponding values. The player 2 states are evaluated independently (possibly in parallel).
+    std::atomic<bool> schedulerImproved(false);
+    forEachIndex(this->player2Matrix.getRowGroupCount(), [&](uint64_t p2Group) {
         uint_fast64_t firstRowInGroup = this->player2Matrix.getRowGroupIndices()[p2Group];
         uint_fast64_t rowGroupSize = this->player2Matrix.getRowGroupIndices()[p2Group + 1] - firstRowInGroup;
+        ValueType& currentValue = player2ChoiceValues[p2Group];
 
         // We need to check whether the scheduler improved. Therefore, we first have to evaluate the current choice.
         uint_fast64_t currentP2Choice = player2Choices[p2Group];
-        *currentValueIt = storm::utility::zero<ValueType>();
+        currentValue = storm::utility::zero<ValueType>();
         for (auto const& entry : this->player2Matrix.getRow(firstRowInGroup + currentP2Choice)) {
-            *currentValueIt += entry.getValue() * x[entry.getColumn()];
+            currentValue += entry.getValue() * x[entry.getColumn()];
         }
-        *currentValueIt += b[firstRowInGroup + currentP2Choice];
+        currentValue += b[firstRowInGroup + currentP2Choice];
 
         // Now check other choices improve the value.
         for (uint_fast64_t p2Choice = 0; p2Choice < rowGroupSize; ++p2Choice) {
@@ -498,18 +650,18 @@ bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, Optim
             }
             choiceValue += b[firstRowInGroup + p2Choice];
 
-            if (valueImproved(player2Dir, comparator, *currentValueIt, choiceValue)) {
+            if (valueImproved(player2Dir, comparator, currentValue, choiceValue)) {
                 schedulerImproved = true;
                 player2Choices[p2Group] = p2Choice;
-                *currentValueIt = std::move(choiceValue);
+                currentValue = std::move(choiceValue);
             }
         }
-    }
+    });
 
     // Now extract the choices of player 1.
     if (this->player1RepresentedByMatrix()) {
         // Player 1 represented by matrix.
-        for (uint_fast64_t p1Group = 0; p1Group < this->getPlayer1Matrix().getRowGroupCount(); ++p1Group) {
+        forEachIndex(this->getPlayer1Matrix().getRowGroupCount(), [&](uint64_t p1Group) {
             uint_fast64_t firstRowInGroup = this->getPlayer1Matrix().getRowGroupIndices()[p1Group];
             uint_fast64_t rowGroupSize = this->getPlayer1Matrix().getRowGroupIndices()[p1Group + 1] - firstRowInGroup;
             uint_fast64_t currentChoice = player1Choices[p1Group];
@@ -526,10 +678,10 @@ bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, Optim
                     currentValue = choiceValue;
                 }
             }
-        }
+        });
     } else {
         // Player 1 represented by grouping of player 2 states (vector).
-        for (uint64_t player1State = 0; player1State < this->getPlayer1Grouping().size() - 1; ++player1State) {
+        forEachIndex(this->getPlayer1Grouping().size() - 1, [&](uint64_t player1State) {
             uint64_t currentChoice = player1Choices[player1State];
             ValueType currentValue = player2ChoiceValues[this->getPlayer1Grouping()[player1State] + currentChoice];
             uint64_t numberOfPlayer2Successors = this->getPlayer1Grouping()[player1State + 1] - this->getPlayer1Grouping()[player1State];
@@ -546,7 +698,7 @@ bool StandardGameSolver<ValueType>::extractChoices(Environment const& env, Optim
                     currentValue = choiceValue;
                 }
             }
-        }
+        });
     }
 
     return schedulerImproved;
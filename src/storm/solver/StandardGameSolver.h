@@ -50,6 +50,18 @@ class StandardGameSolver : public GameSolver<ValueType> {
                            std::vector<ValueType>& player2ReducedResult, std::vector<ValueType>& player1ReducedResult,
                            std::vector<uint64_t>* player1SchedulerChoices = nullptr, std::vector<uint64_t>* player2SchedulerChoices = nullptr) const;
 
+    // Same as multiplyAndReduce, but distributes the player 1 states over multiple threads. The result must not alias x.
+    // If player 1 is represented by a grouping, the rows of player 2 are multiplied directly with x, bypassing the given (configured) multiplier.
+    void multiplyAndReduceParallel(Environment const& env, OptimizationDirection player1Dir, OptimizationDirection player2Dir, std::vector<ValueType> const& x,
+                                   std::vector<ValueType> const* b, storm::solver::Multiplier<ValueType> const& multiplier,
+                                   std::vector<ValueType>& player2ReducedResult, std::vector<ValueType>& player1ReducedResult,
+                                   std::vector<uint64_t>* player1SchedulerChoices, std::vector<uint64_t>* player2SchedulerChoices) const;
+
+    // Computes the extremal value of p2Matrix * x + b over the choices of the given player 2 state. If a choice is given, it is updated
+    // if another choice is strictly better.
+    ValueType multiplyAndReducePlayer2State(OptimizationDirection player2Dir, uint64_t player2State, std::vector<ValueType> const& x,
+                                            std::vector<ValueType> const* b, uint64_t* choice) const;
+
     // Solves the equation system given by the two choice selections
     void getInducedMatrixVector(std::vector<ValueType>& x, std::vector<ValueType> const& b, std::vector<uint_fast64_t> const& player1Choices,
                                 std::vector<uint_fast64_t> const& player2Choices, storm::storage::SparseMatrix<ValueType>& inducedMatrix,
@@ -0,0 +1,277 @@
+#include "storm/solver/helper/KrylovSolverHelper.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+// Vectors are split into blocks of this size for the parallel computation of dot products.
+uint64_t const dotProductBlockSize = 4096;
+}  // namespace
+
+template<typename ValueType>
+KrylovSolverHelper<ValueType>::KrylovSolverHelper(storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                  NativeLinearEquationSolverPreconditioner const& preconditioner)
+    : matrix(matrix), parallel(storm::utility::parallel::isIntelTbbEnabled()) {
+    STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "Krylov methods require a square matrix.");
+    this->preconditioner = NativePreconditioner<ValueType>::create(preconditioner, matrix, parallel);
+}
+
+template<typename ValueType>
+SolverStatus KrylovSolverHelper<ValueType>::solveBicgstab(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision,
+                                                         bool relative, uint64_t maxIterations, uint64_t& iterations,
+                                                         StatusCallback const& updateStatus) const {
+    uint64_t const dimension = x.size();
+    ValueType const target = relative ? precision * norm(b) : precision;
+
+    std::vector<ValueType> r(dimension), rHat, p(dimension, storm::utility::zero<ValueType>()), v(dimension, storm::utility::zero<ValueType>());
+    std::vector<ValueType> pHat(dimension), s(dimension), sHat(dimension), t(dimension);
+    computeResidual(x, b, r);
+    if (norm(r) <= target) {
+        return SolverStatus::Converged;
+    }
+    rHat = r;
+    ValueType rho = storm::utility::one<ValueType>(), alpha = storm::utility::one<ValueType>(), omega = storm::utility::one<ValueType>();
+
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && iterations < maxIterations) {
+        ValueType newRho = dotProduct(rHat, r);
+        if (storm::utility::isZero(newRho) || storm::utility::isZero(omega)) {
+            // The method broke down, so we restart it with the current residual.
+            STORM_LOG_DEBUG("BiCGSTAB broke down after " << iterations << " iterations, restarting.");
+            computeResidual(x, b, r);
+            rHat = r;
+            std::fill(p.begin(), p.end(), storm::utility::zero<ValueType>());
+            std::fill(v.begin(), v.end(), storm::utility::zero<ValueType>());
+            rho = alpha = omega = storm::utility::one<ValueType>();
+            newRho = dotProduct(rHat, r);
+            if (storm::utility::isZero(newRho)) {
+                if (norm(r) <= target) {
+                    return SolverStatus::Converged;
+                }
+                STORM_LOG_WARN("BiCGSTAB broke down after " << iterations << " iterations as the residual is orthogonal to itself.");
+                return SolverStatus::MaximalIterationsExceeded;
+            }
+        }
+        ValueType const beta = (newRho / rho) * (alpha / omega);
+        forEachIndex(dimension, [&](uint64_t index) { p[index] = r[index] + beta * (p[index] - omega * v[index]); });
+        preconditioner->apply(p, pHat);
+        multiply(pHat, v);
+        ValueType const rHatV = dotProduct(rHat, v);
+        if (storm::utility::isZero(rHatV)) {
+            STORM_LOG_WARN("BiCGSTAB broke down after " << iterations << " iterations as the search direction is orthogonal to the shadow residual.");
+            return SolverStatus::MaximalIterationsExceeded;
+        }
+        alpha = newRho / rHatV;
+        forEachIndex(dimension, [&](uint64_t index) { s[index] = r[index] - alpha * v[index]; });
+        ++iterations;
+        if (norm(s) <= target) {
+            forEachIndex(dimension, [&](uint64_t index) { x[index] += alpha * pHat[index]; });
+            status = SolverStatus::Converged;
+            break;
+        }
+        preconditioner->apply(s, sHat);
+        multiply(sHat, t);
+        ValueType const tt = dotProduct(t, t);
+        if (storm::utility::isZero(tt)) {
+            // The stabilization step is not possible, so only the first half of the step is performed.
+            forEachIndex(dimension, [&](uint64_t index) { x[index] += alpha * pHat[index]; });
+            STORM_LOG_WARN("BiCGSTAB broke down after " << iterations << " iterations as the stabilization vector vanishes.");
+            return SolverStatus::MaximalIterationsExceeded;
+        }
+        omega = dotProduct(t, s) / tt;
+        forEachIndex(dimension, [&](uint64_t index) {
+            x[index] += alpha * pHat[index] + omega * sHat[index];
+            r[index] = s[index] - omega * t[index];
+        });
+        rho = newRho;
+        if (norm(r) <= target) {
+            status = SolverStatus::Converged;
+        } else {
+            status = updateStatus(x, iterations);
+        }
+    }
+    return status == SolverStatus::InProgress ? SolverStatus::MaximalIterationsExceeded : status;
+}
+
+template<typename ValueType>
+SolverStatus KrylovSolverHelper<ValueType>::solveGmres(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision,
+                                                      bool relative, uint64_t restart, uint64_t maxIterations, uint64_t& iterations,
+                                                      StatusCallback const& updateStatus) const {
+    STORM_LOG_THROW(restart > 0, storm::exceptions::InvalidArgumentException, "GMRES requires a positive restart threshold.");
+    uint64_t const dimension = x.size();
+    ValueType const target = relative ? precision * norm(b) : precision;
+
+    // The orthonormal basis of the Krylov subspace, the Hessenberg matrix (column-wise) and the Givens rotations that make it triangular.
+    std::vector<std::vector<ValueType>> basis(restart + 1, std::vector<ValueType>(dimension));
+    std::vector<std::vector<ValueType>> hessenberg(restart, std::vector<ValueType>(restart + 1));
+    std::vector<ValueType> cosines(restart), sines(restart), g(restart + 1), y(restart);
+    std::vector<ValueType> preconditioned(dimension), update(dimension);
+
+    SolverStatus status = SolverStatus::InProgress;
+    while (status == SolverStatus::InProgress && iterations < maxIterations) {
+        computeResidual(x, b, basis[0]);
+        ValueType const residualNorm = norm(basis[0]);
+        if (residualNorm <= target) {
+            status = SolverStatus::Converged;
+            break;
+        }
+        forEachIndex(dimension, [&](uint64_t index) { basis[0][index] /= residualNorm; });
+        std::fill(g.begin(), g.end(), storm::utility::zero<ValueType>());
+        g[0] = residualNorm;
+
+        uint64_t columns = 0;
+        bool converged = false, breakdown = false;
+        while (columns < restart && iterations < maxIterations && !converged) {
+            uint64_t const j = columns;
+            auto& h = hessenberg[j];
+            preconditioner->apply(basis[j], preconditioned);
+            multiply(preconditioned, basis[j + 1]);
+
+            // Modified Gram-Schmidt orthogonalization.
+            for (uint64_t i = 0; i <= j; ++i) {
+                h[i] = dotProduct(basis[j + 1], basis[i]);
+                forEachIndex(dimension, [&](uint64_t index) { basis[j + 1][index] -= h[i] * basis[i][index]; });
+            }
+            h[j + 1] = norm(basis[j + 1]);
+            bool const lucky = storm::utility::isZero(h[j + 1]);
+            if (!lucky) {
+                forEachIndex(dimension, [&](uint64_t index) { basis[j + 1][index] /= h[j + 1]; });
+            }
+
+            // Apply the previous rotations to the new column and eliminate its subdiagonal entry.
+            for (uint64_t i = 0; i < j; ++i) {
+                ValueType const first = h[i];
+                h[i] = cosines[i] * first + sines[i] * h[i + 1];
+                h[i + 1] = -sines[i] * first + cosines[i] * h[i + 1];
+            }
+            ValueType const radius = std::sqrt(h[j] * h[j] + h[j + 1] * h[j + 1]);
+            if (storm::utility::isZero(radius)) {
+                // The Hessenberg matrix is singular, so the new column is dropped.
+                breakdown = true;
+                break;
+            }
+            cosines[j] = h[j] / radius;
+            sines[j] = h[j + 1] / radius;
+            h[j] = radius;
+            h[j + 1] = storm::utility::zero<ValueType>();
+            g[j + 1] = -sines[j] * g[j];
+            g[j] = cosines[j] * g[j];
+
+            ++columns;
+            ++iterations;
+            converged = lucky || std::abs(g[j + 1]) <= target;
+        }
+
+        // Solve the triangular system and update the solution.
+        for (uint64_t i = columns; i > 0; --i) {
+            ValueType value = g[i - 1];
+            for (uint64_t k = i; k < columns; ++k) {
+                value -= hessenberg[k][i - 1] * y[k];
+            }
+            y[i - 1] = value / hessenberg[i - 1][i - 1];
+        }
+        forEachIndex(dimension, [&](uint64_t index) {
+            ValueType value = storm::utility::zero<ValueType>();
+            for (uint64_t i = 0; i < columns; ++i) {
+                value += y[i] * basis[i][index];
+            }
+            update[index] = value;
+        });
+        preconditioner->apply(update, preconditioned);
+        forEachIndex(dimension, [&](uint64_t index) { x[index] += preconditioned[index]; });
+
+        if (breakdown) {
+            STORM_LOG_WARN("GMRES broke down after " << iterations << " iterations as the Hessenberg matrix is singular.");
+            return SolverStatus::MaximalIterationsExceeded;
+        }
+
+        // The residual estimate of the rotations may be inaccurate due to rounding errors, so convergence is confirmed with the actual residual.
+        if (converged) {
+            computeResidual(x, b, update);
+            if (norm(update) <= target) {
+                status = SolverStatus::Converged;
+                break;
+            }
+        }
+        status = updateStatus(x, iterations);
+    }
+    return status == SolverStatus::InProgress ? SolverStatus::MaximalIterationsExceeded : status;
+}
+
+template<typename ValueType>
+void KrylovSolverHelper<ValueType>::multiply(std::vector<ValueType> const& x, std::vector<ValueType>& result) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel) {
+        matrix.multiplyWithVectorParallel(x, result);
+        return;
+    }
+#endif
+    matrix.multiplyWithVector(x, result);
+}
+
+template<typename ValueType>
+void KrylovSolverHelper<ValueType>::computeResidual(std::vector<ValueType> const& x, std::vector<ValueType> const& b,
+                                                    std::vector<ValueType>& residual) const {
+    multiply(x, residual);
+    forEachIndex(residual.size(), [&](uint64_t index) { residual[index] = b[index] - residual[index]; });
+}
+
+template<typename ValueType>
+ValueType KrylovSolverHelper<ValueType>::dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const {
+    uint64_t const numberOfBlocks = (first.size() + dotProductBlockSize - 1) / dotProductBlockSize;
+    std::vector<ValueType> blockSums(numberOfBlocks, storm::utility::zero<ValueType>());
+    forEachIndex(numberOfBlocks, [&](uint64_t block) {
+        uint64_t const end = std::min<uint64_t>(first.size(), (block + 1) * dotProductBlockSize);
+        ValueType sum = storm::utility::zero<ValueType>();
+        for (uint64_t index = block * dotProductBlockSize; index < end; ++index) {
+            sum += first[index] * second[index];
+        }
+        blockSums[block] = sum;
+    });
+    ValueType result = storm::utility::zero<ValueType>();
+    for (auto const& sum : blockSums) {
+        result += sum;
+    }
+    return result;
+}
+
+template<typename ValueType>
+ValueType KrylovSolverHelper<ValueType>::norm(std::vector<ValueType> const& vector) const {
+    return std::sqrt(dotProduct(vector, vector));
+}
+
+template<typename ValueType>
+template<typename Function>
+void KrylovSolverHelper<ValueType>::forEachIndex(uint64_t size, Function const& function) const {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, size), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                function(index);
+            }
+        });
+        return;
+    }
+#endif
+    for (uint64_t index = 0; index < size; ++index) {
+        function(index);
+    }
+}
+
+template class KrylovSolverHelper<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
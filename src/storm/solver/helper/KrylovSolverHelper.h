@@ -0,0 +1,64 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/solver/helper/NativePreconditioner.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * Implements the (right-preconditioned) Krylov subspace methods BiCGSTAB and GMRES(m) for equation systems A*x = b on storm's sparse matrices.
+ * Matrix-vector products, vector operations and the preconditioners are parallelized if Intel TBB is enabled. Dot products are summed up in a
+ * fixed order of blocks, so the results do not depend on the number of threads and are the same as without Intel TBB.
+ *
+ * Both methods stop once the norm of the residual b - A*x is at most the precision (absolute criterion) or at most the precision times the
+ * norm of b (relative criterion). If a method breaks down, i.e., it would divide by a vanishing dot product or norm, it stops with the current
+ * solution and returns SolverStatus::MaximalIterationsExceeded as the solution did not converge.
+ */
+template<typename ValueType>
+class KrylovSolverHelper {
+   public:
+    /*!
+     * A function that is called with the current solution and the number of performed iterations. It returns the new status of the solver,
+     * e.g., to abort the computation due to a termination condition.
+     */
+    typedef std::function<SolverStatus(std::vector<ValueType> const& x, uint64_t iterations)> StatusCallback;
+
+    /*!
+     * Prepares solving equation systems with the given matrix. This includes building the preconditioner.
+     */
+    KrylovSolverHelper(storm::storage::SparseMatrix<ValueType> const& matrix, NativeLinearEquationSolverPreconditioner const& preconditioner);
+
+    SolverStatus solveBicgstab(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative,
+                               uint64_t maxIterations, uint64_t& iterations, StatusCallback const& updateStatus) const;
+
+    /*!
+     * @param restart The dimension of the Krylov subspace after which GMRES is restarted.
+     */
+    SolverStatus solveGmres(std::vector<ValueType>& x, std::vector<ValueType> const& b, ValueType const& precision, bool relative, uint64_t restart,
+                            uint64_t maxIterations, uint64_t& iterations, StatusCallback const& updateStatus) const;
+
+   private:
+    void multiply(std::vector<ValueType> const& x, std::vector<ValueType>& result) const;
+    void computeResidual(std::vector<ValueType> const& x, std::vector<ValueType> const& b, std::vector<ValueType>& residual) const;
+    ValueType dotProduct(std::vector<ValueType> const& first, std::vector<ValueType> const& second) const;
+    ValueType norm(std::vector<ValueType> const& vector) const;
+
+    template<typename Function>
+    void forEachIndex(uint64_t size, Function const& function) const;
+
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+    bool parallel;
+    std::unique_ptr<NativePreconditioner<ValueType>> preconditioner;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
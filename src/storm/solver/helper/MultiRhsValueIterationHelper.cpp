@@ -0,0 +1,143 @@
+#include "storm/solver/helper/MultiRhsValueIterationHelper.h"
+
+#include <algorithm>
+
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+template<typename ValueType>
+MultiRhsValueIterationHelper<ValueType>::MultiRhsValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix) : matrix(matrix) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+std::vector<SolverStatus> MultiRhsValueIterationHelper<ValueType>::solve(Environment const& env,
+                                                                         boost::optional<storm::solver::OptimizationDirection> const& dir,
+                                                                         std::vector<ValueType>& x, std::vector<ValueType> const& b,
+                                                                         std::vector<storm::storage::BitVector> const& updatedStates) const {
+    uint64_t const numberOfSystems = updatedStates.size();
+    uint64_t const numberOfStates = matrix.getRowGroupCount();
+    STORM_LOG_THROW(matrix.hasTrivialRowGrouping() || dir, storm::exceptions::InvalidArgumentException,
+                    "An optimization direction is required for matrices with row groups.");
+    STORM_LOG_THROW(x.size() == numberOfStates * numberOfSystems, storm::exceptions::InvalidArgumentException, "Unexpected size of the solution vector.");
+    STORM_LOG_THROW(b.empty() || b.size() == matrix.getRowCount() * numberOfSystems, storm::exceptions::InvalidArgumentException,
+                    "Unexpected size of the right-hand side.");
+
+    ValueType precision;
+    bool relative;
+    uint64_t maxIterations;
+    if (dir) {
+        precision = storm::utility::convertNumber<ValueType>(env.solver().minMax().getPrecision());
+        relative = env.solver().minMax().getRelativeTerminationCriterion();
+        maxIterations = env.solver().minMax().getMaximalNumberOfIterations();
+    } else {
+        precision = storm::utility::convertNumber<ValueType>(env.solver().native().getPrecision());
+        relative = env.solver().native().getRelativeTerminationCriterion();
+        maxIterations = env.solver().native().getMaximalNumberOfIterations();
+    }
+    bool const minimize = dir && storm::solver::minimize(*dir);
+
+    // The systems that have not converged yet.
+    std::vector<uint64_t> activeSystems(numberOfSystems);
+    for (uint64_t k = 0; k < numberOfSystems; ++k) {
+        activeSystems[k] = k;
+    }
+    std::vector<SolverStatus> statuses(numberOfSystems, SolverStatus::InProgress);
+    // The states that are updated for at least one active system.
+    storm::storage::BitVector statesToUpdate(numberOfStates, false);
+    for (auto const& states : updatedStates) {
+        statesToUpdate |= states;
+    }
+
+    auto const& rowGroupIndices = matrix.getRowGroupIndices();
+    std::vector<ValueType> rowValues(numberOfSystems);
+    std::vector<ValueType> groupValues(numberOfSystems);
+    std::vector<ValueType> maxDifferences(numberOfSystems);
+    uint64_t iterations = 0;
+    while (!activeSystems.empty() && iterations < maxIterations) {
+        for (auto k : activeSystems) {
+            maxDifferences[k] = storm::utility::zero<ValueType>();
+        }
+        for (auto state : statesToUpdate) {
+            for (uint64_t row = rowGroupIndices[state]; row < rowGroupIndices[state + 1]; ++row) {
+                // Compute the values of the current row for all active systems.
+                for (auto k : activeSystems) {
+                    rowValues[k] = b.empty() ? storm::utility::zero<ValueType>() : b[row * numberOfSystems + k];
+                }
+                for (auto const& entry : matrix.getRow(row)) {
+                    auto const* columnValues = &x[entry.getColumn() * numberOfSystems];
+                    for (auto k : activeSystems) {
+                        rowValues[k] += entry.getValue() * columnValues[k];
+                    }
+                }
+                for (auto k : activeSystems) {
+                    if (row == rowGroupIndices[state] || (minimize ? rowValues[k] < groupValues[k] : rowValues[k] > groupValues[k])) {
+                        groupValues[k] = rowValues[k];
+                    }
+                }
+            }
+
+            auto* stateValues = &x[state * numberOfSystems];
+            for (auto k : activeSystems) {
+                if (!updatedStates[k].get(state)) {
+                    continue;
+                }
+                ValueType difference = storm::utility::abs<ValueType>(groupValues[k] - stateValues[k]);
+                if (relative && !storm::utility::isZero(groupValues[k])) {
+                    difference /= storm::utility::abs<ValueType>(groupValues[k]);
+                }
+                maxDifferences[k] = std::max(maxDifferences[k], difference);
+                stateValues[k] = groupValues[k];
+            }
+        }
+        ++iterations;
+
+        // Drop the converged systems from the sweep.
+        auto newEnd = std::remove_if(activeSystems.begin(), activeSystems.end(), [&](uint64_t k) {
+            if (maxDifferences[k] <= precision) {
+                statuses[k] = SolverStatus::Converged;
+                STORM_LOG_TRACE("System " << k << " converged after " << iterations << " iterations.");
+                return true;
+            }
+            return false;
+        });
+        if (newEnd != activeSystems.end()) {
+            activeSystems.erase(newEnd, activeSystems.end());
+            statesToUpdate.clear();
+            for (auto k : activeSystems) {
+                statesToUpdate |= updatedStates[k];
+            }
+        }
+
+        if (storm::utility::resources::isTerminate()) {
+            break;
+        }
+    }
+
+    // The remaining systems did not converge.
+    SolverStatus const remainingStatus = storm::utility::resources::isTerminate() ? SolverStatus::Aborted : SolverStatus::MaximalIterationsExceeded;
+    for (auto k : activeSystems) {
+        statuses[k] = remainingStatus;
+    }
+    STORM_LOG_WARN_COND(activeSystems.empty(), "Value iteration did not converge for " << activeSystems.size() << " of " << numberOfSystems
+                                                                                       << " systems within " << iterations << " iterations.");
+    STORM_LOG_INFO("Value iteration for " << numberOfSystems << " systems performed " << iterations << " iterations.");
+    return statuses;
+}
+
+template class MultiRhsValueIterationHelper<double>;
+template class MultiRhsValueIterationHelper<storm::RationalNumber>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <vector>
+
+#include "storm/solver/OptimizationDirection.h"
+#include "storm/solver/SolverStatus.h"
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+class Environment;
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Performs value iteration for several equation systems x_k = A*x_k + b_k (or x_k = min/max (A*x_k + b_k) if the matrix has row groups)
+ * that share the same matrix A. The solution vectors of all systems are stored interleaved, i.e., the value of state s for system k is stored
+ * at x[s * N + k], where N is the number of systems. This way, every matrix entry is read once per sweep for all systems.
+ *
+ * For each system, only the values of a given set of states are updated; the values of all other states are kept.
+ * Convergence is tracked separately for each system and converged systems are no longer updated.
+ */
+template<typename ValueType>
+class MultiRhsValueIterationHelper {
+   public:
+    /*!
+     * @param matrix The shared matrix A. Row groups are considered to be nondeterministic choices.
+     */
+    MultiRhsValueIterationHelper(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Solves all systems using Gauss-Seidel value iteration.
+     * The precision, relative or absolute termination criterion and the maximal number of iterations are taken from the minmax solver
+     * environment if a direction is given and from the native solver environment otherwise.
+     *
+     * @param dir The optimization direction. Must be given iff the matrix has non-trivial row groups.
+     * @param x The interleaved solution vectors whose initial content is used as the starting point.
+     * @param b The interleaved right-hand sides, i.e., the value of row r for system k is stored at b[r * N + k]. If empty, b is assumed to be zero.
+     * @param updatedStates For each system, the states whose values are computed.
+     * @return For each system, the status of the solver, i.e., whether the system converged, the maximal number of iterations was exceeded or
+     * the computation was aborted.
+     */
+    std::vector<SolverStatus> solve(Environment const& env, boost::optional<storm::solver::OptimizationDirection> const& dir, std::vector<ValueType>& x,
+                                    std::vector<ValueType> const& b, std::vector<storm::storage::BitVector> const& updatedStates) const;
+
+   private:
+    storm::storage::SparseMatrix<ValueType> const& matrix;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,442 @@
+#include "storm/solver/helper/NativePreconditioner.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/solver/helper/SparseLUFactorization.h"
+#include "storm/storage/StronglyConnectedComponentDecomposition.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+// Parameters of the multigrid hierarchy.
+uint64_t const maximalNumberOfLevels = 10;
+uint64_t const maximalCoarsestDimension = 500;
+uint64_t const maximalFactorizedDimension = 5000;
+double const minimalCoarseningFactor = 0.75;
+double const strongCouplingThreshold = 0.25;
+double const jacobiDamping = 2.0 / 3.0;
+
+// The minimal (average) number of rows of a level of the ILU triangular solves for the rows to be processed in parallel.
+uint64_t const minimalParallelIluLevelSize = 256;
+
+uint64_t const noAggregate = std::numeric_limits<uint64_t>::max();
+
+template<typename ValueType>
+void multiply(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<ValueType> const& x, std::vector<ValueType>& result, bool parallel) {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel) {
+        matrix.multiplyWithVectorParallel(x, result);
+        return;
+    }
+#endif
+    matrix.multiplyWithVector(x, result);
+}
+
+template<typename Function>
+void forEachIndex(uint64_t size, bool parallel, Function const& function) {
+#ifdef STORM_HAVE_INTELTBB
+    if (parallel) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, size), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index != range.end(); ++index) {
+                function(index);
+            }
+        });
+        return;
+    }
+#endif
+    for (uint64_t index = 0; index < size; ++index) {
+        function(index);
+    }
+}
+}  // namespace
+
+template<typename ValueType>
+std::unique_ptr<NativePreconditioner<ValueType>> NativePreconditioner<ValueType>::create(NativeLinearEquationSolverPreconditioner type,
+                                                                                         storm::storage::SparseMatrix<ValueType> const& matrix,
+                                                                                         bool parallel) {
+    switch (type) {
+        case NativeLinearEquationSolverPreconditioner::Ilu:
+            return std::make_unique<IluPreconditioner<ValueType>>(matrix, parallel);
+        case NativeLinearEquationSolverPreconditioner::Amg:
+            return std::make_unique<AmgPreconditioner<ValueType>>(matrix, parallel);
+        case NativeLinearEquationSolverPreconditioner::None:
+            return std::make_unique<IdentityPreconditioner<ValueType>>();
+    }
+    STORM_LOG_THROW(false, storm::exceptions::InvalidArgumentException, "Unknown preconditioner.");
+    return nullptr;
+}
+
+template<typename ValueType>
+void IdentityPreconditioner<ValueType>::apply(std::vector<ValueType> const& r, std::vector<ValueType>& z) const {
+    z = r;
+}
+
+template<typename ValueType>
+IluPreconditioner<ValueType>::IluPreconditioner(storm::storage::SparseMatrix<ValueType> const& matrix, bool parallel) {
+    STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "ILU preconditioning requires a square matrix.");
+    uint64_t const dimension = matrix.getRowCount();
+    rowStarts.reserve(dimension + 1);
+    lowerEnds.reserve(dimension);
+    upperStarts.reserve(dimension);
+    columns.reserve(matrix.getEntryCount());
+    values.reserve(matrix.getEntryCount());
+    diagonal.assign(dimension, storm::utility::zero<ValueType>());
+    for (uint64_t row = 0; row < dimension; ++row) {
+        rowStarts.push_back(columns.size());
+        for (auto const& entry : matrix.getRow(row)) {
+            if (entry.getColumn() < row) {
+                columns.push_back(entry.getColumn());
+                values.push_back(entry.getValue());
+            }
+        }
+        lowerEnds.push_back(columns.size());
+        for (auto const& entry : matrix.getRow(row)) {
+            if (entry.getColumn() == row) {
+                diagonal[row] += entry.getValue();
+            }
+        }
+        upperStarts.push_back(columns.size());
+        for (auto const& entry : matrix.getRow(row)) {
+            if (entry.getColumn() > row) {
+                columns.push_back(entry.getColumn());
+                values.push_back(entry.getValue());
+            }
+        }
+    }
+    rowStarts.push_back(columns.size());
+
+    // Eliminate row by row, dropping all updates outside of the pattern of the matrix.
+    uint64_t const noPosition = std::numeric_limits<uint64_t>::max();
+    uint64_t const diagonalPosition = noPosition - 1;
+    std::vector<uint64_t> positionOfColumn(dimension, noPosition);
+    uint64_t numberOfReplacedPivots = 0;
+    for (uint64_t row = 0; row < dimension; ++row) {
+        for (uint64_t position = rowStarts[row]; position < rowStarts[row + 1]; ++position) {
+            positionOfColumn[columns[position]] = position;
+        }
+        positionOfColumn[row] = diagonalPosition;
+        for (uint64_t position = rowStarts[row]; position < lowerEnds[row]; ++position) {
+            uint64_t const pivotRow = columns[position];
+            values[position] /= diagonal[pivotRow];
+            for (uint64_t pivotPosition = upperStarts[pivotRow]; pivotPosition < rowStarts[pivotRow + 1]; ++pivotPosition) {
+                uint64_t const target = positionOfColumn[columns[pivotPosition]];
+                if (target == diagonalPosition) {
+                    diagonal[row] -= values[position] * values[pivotPosition];
+                } else if (target != noPosition) {
+                    values[target] -= values[position] * values[pivotPosition];
+                }
+            }
+        }
+        for (uint64_t position = rowStarts[row]; position < rowStarts[row + 1]; ++position) {
+            positionOfColumn[columns[position]] = noPosition;
+        }
+        positionOfColumn[row] = noPosition;
+        if (storm::utility::isZero(diagonal[row])) {
+            diagonal[row] = storm::utility::one<ValueType>();
+            ++numberOfReplacedPivots;
+        }
+    }
+    STORM_LOG_WARN_COND(numberOfReplacedPivots == 0, "ILU preconditioner replaced " << numberOfReplacedPivots << " vanishing pivots.");
+
+    if (parallel) {
+#ifdef STORM_HAVE_INTELTBB
+        computeLevelSchedule(true, forwardLevelStarts, forwardLevelRows);
+        computeLevelSchedule(false, backwardLevelStarts, backwardLevelRows);
+        STORM_LOG_INFO("ILU preconditioner solves " << (forwardLevelStarts.empty() ? "sequentially" : "level-wise") << " with L and "
+                                                    << (backwardLevelStarts.empty() ? "sequentially" : "level-wise") << " with U.");
+#endif
+    }
+}
+
+template<typename ValueType>
+void IluPreconditioner<ValueType>::computeLevelSchedule(bool forward, std::vector<uint64_t>& levelStarts, std::vector<uint64_t>& levelRows) const {
+    uint64_t const dimension = diagonal.size();
+    std::vector<uint64_t> levelOfRow(dimension, 0);
+    uint64_t numberOfLevels = 0;
+    for (uint64_t index = 0; index < dimension; ++index) {
+        uint64_t const row = forward ? index : dimension - 1 - index;
+        uint64_t const begin = forward ? rowStarts[row] : upperStarts[row];
+        uint64_t const end = forward ? lowerEnds[row] : rowStarts[row + 1];
+        uint64_t level = 0;
+        for (uint64_t position = begin; position < end; ++position) {
+            level = std::max(level, levelOfRow[columns[position]] + 1);
+        }
+        levelOfRow[row] = level;
+        numberOfLevels = std::max(numberOfLevels, level + 1);
+    }
+    if (numberOfLevels * minimalParallelIluLevelSize > dimension) {
+        return;
+    }
+
+    // Sort the rows by their level.
+    levelStarts.assign(numberOfLevels + 1, 0);
+    for (auto level : levelOfRow) {
+        ++levelStarts[level + 1];
+    }
+    for (uint64_t level = 0; level < numberOfLevels; ++level) {
+        levelStarts[level + 1] += levelStarts[level];
+    }
+    levelRows.resize(dimension);
+    std::vector<uint64_t> positions(levelStarts.begin(), levelStarts.end() - 1);
+    for (uint64_t row = 0; row < dimension; ++row) {
+        levelRows[positions[levelOfRow[row]]++] = row;
+    }
+}
+
+template<typename ValueType>
+void IluPreconditioner<ValueType>::solveForwardRow(uint64_t row, std::vector<ValueType> const& r, std::vector<ValueType>& z) const {
+    ValueType value = r[row];
+    for (uint64_t position = rowStarts[row]; position < lowerEnds[row]; ++position) {
+        value -= values[position] * z[columns[position]];
+    }
+    z[row] = value;
+}
+
+template<typename ValueType>
+void IluPreconditioner<ValueType>::solveBackwardRow(uint64_t row, std::vector<ValueType>& z) const {
+    ValueType value = z[row];
+    for (uint64_t position = upperStarts[row]; position < rowStarts[row + 1]; ++position) {
+        value -= values[position] * z[columns[position]];
+    }
+    z[row] = value / diagonal[row];
+}
+
+template<typename ValueType>
+void IluPreconditioner<ValueType>::apply(std::vector<ValueType> const& r, std::vector<ValueType>& z) const {
+    uint64_t const dimension = diagonal.size();
+    z.resize(dimension);
+
+    // Processes the rows of every level in parallel. Levels that are too small are processed sequentially.
+    auto solveLevelWise = [](std::vector<uint64_t> const& levelStarts, std::vector<uint64_t> const& levelRows, auto const& solveRow) {
+        for (uint64_t level = 0; level + 1 < levelStarts.size(); ++level) {
+            forEachIndex(levelStarts[level + 1] - levelStarts[level], levelStarts[level + 1] - levelStarts[level] >= minimalParallelIluLevelSize,
+                         [&](uint64_t index) { solveRow(levelRows[levelStarts[level] + index]); });
+        }
+    };
+
+    auto solveForward = [&](uint64_t row) { solveForwardRow(row, r, z); };
+    if (forwardLevelStarts.empty()) {
+        for (uint64_t row = 0; row < dimension; ++row) {
+            solveForward(row);
+        }
+    } else {
+        solveLevelWise(forwardLevelStarts, forwardLevelRows, solveForward);
+    }
+
+    auto solveBackward = [&](uint64_t row) { solveBackwardRow(row, z); };
+    if (backwardLevelStarts.empty()) {
+        for (uint64_t row = dimension; row > 0; --row) {
+            solveBackward(row - 1);
+        }
+    } else {
+        solveLevelWise(backwardLevelStarts, backwardLevelRows, solveBackward);
+    }
+}
+
+template<typename ValueType>
+AmgPreconditioner<ValueType>::AmgPreconditioner(storm::storage::SparseMatrix<ValueType> const& matrix, bool parallel) : parallel(parallel) {
+    STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "AMG preconditioning requires a square matrix.");
+    storm::storage::SparseMatrix<ValueType> const* currentMatrix = &matrix;
+    while (true) {
+        uint64_t const dimension = currentMatrix->getRowCount();
+        Level level;
+        level.matrix = currentMatrix;
+        level.inverseDiagonal.assign(dimension, storm::utility::zero<ValueType>());
+        for (uint64_t row = 0; row < dimension; ++row) {
+            for (auto const& entry : currentMatrix->getRow(row)) {
+                if (entry.getColumn() == row && !storm::utility::isZero(entry.getValue())) {
+                    level.inverseDiagonal[row] = storm::utility::one<ValueType>() / entry.getValue();
+                }
+            }
+        }
+        levels.push_back(std::move(level));
+        if (dimension <= maximalCoarsestDimension || levels.size() >= maximalNumberOfLevels) {
+            break;
+        }
+
+        // Aggregate strongly coupled rows of the same SCC. Seeds are rows with unaggregated strong neighbors. The remaining rows join the
+        // aggregate of their strongest neighbor in the same SCC or form a singleton.
+        std::vector<uint64_t> sccOfRow(dimension);
+        storm::storage::StronglyConnectedComponentDecomposition<ValueType> sccDecomposition(*currentMatrix);
+        for (uint64_t sccIndex = 0; sccIndex < sccDecomposition.size(); ++sccIndex) {
+            for (auto row : sccDecomposition[sccIndex]) {
+                sccOfRow[row] = sccIndex;
+            }
+        }
+        auto& aggregateOfRow = levels.back().aggregateOfRow;
+        aggregateOfRow.assign(dimension, noAggregate);
+        uint64_t numberOfAggregates = 0;
+        std::vector<uint64_t> strongNeighbors;
+        for (uint64_t row = 0; row < dimension; ++row) {
+            if (aggregateOfRow[row] != noAggregate) {
+                continue;
+            }
+            ValueType maximalCoupling = storm::utility::zero<ValueType>();
+            for (auto const& entry : currentMatrix->getRow(row)) {
+                if (entry.getColumn() != row) {
+                    maximalCoupling = std::max<ValueType>(maximalCoupling, std::abs(entry.getValue()));
+                }
+            }
+            strongNeighbors.clear();
+            for (auto const& entry : currentMatrix->getRow(row)) {
+                if (entry.getColumn() != row && aggregateOfRow[entry.getColumn()] == noAggregate && sccOfRow[entry.getColumn()] == sccOfRow[row] &&
+                    std::abs(entry.getValue()) >= strongCouplingThreshold * maximalCoupling && !storm::utility::isZero(entry.getValue())) {
+                    strongNeighbors.push_back(entry.getColumn());
+                }
+            }
+            if (!strongNeighbors.empty()) {
+                aggregateOfRow[row] = numberOfAggregates;
+                for (auto neighbor : strongNeighbors) {
+                    aggregateOfRow[neighbor] = numberOfAggregates;
+                }
+                ++numberOfAggregates;
+            }
+        }
+        for (uint64_t row = 0; row < dimension; ++row) {
+            if (aggregateOfRow[row] != noAggregate) {
+                continue;
+            }
+            uint64_t bestAggregate = noAggregate;
+            ValueType bestCoupling = storm::utility::zero<ValueType>();
+            for (auto const& entry : currentMatrix->getRow(row)) {
+                if (entry.getColumn() != row && aggregateOfRow[entry.getColumn()] != noAggregate && sccOfRow[entry.getColumn()] == sccOfRow[row] &&
+                    std::abs(entry.getValue()) > bestCoupling) {
+                    bestCoupling = std::abs(entry.getValue());
+                    bestAggregate = aggregateOfRow[entry.getColumn()];
+                }
+            }
+            aggregateOfRow[row] = bestAggregate == noAggregate ? numberOfAggregates++ : bestAggregate;
+        }
+        if (numberOfAggregates > minimalCoarseningFactor * dimension) {
+            aggregateOfRow.clear();
+            break;
+        }
+
+        // Build the Galerkin operator P^T * A * P for the piecewise constant prolongation P.
+        std::vector<uint64_t> memberStarts(numberOfAggregates + 1, 0);
+        for (auto aggregate : aggregateOfRow) {
+            ++memberStarts[aggregate + 1];
+        }
+        for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+            memberStarts[aggregate + 1] += memberStarts[aggregate];
+        }
+        std::vector<uint64_t> members(dimension);
+        std::vector<uint64_t> memberPositions(memberStarts.begin(), memberStarts.end() - 1);
+        for (uint64_t row = 0; row < dimension; ++row) {
+            members[memberPositions[aggregateOfRow[row]]++] = row;
+        }
+        storm::storage::SparseMatrixBuilder<ValueType> builder(numberOfAggregates, numberOfAggregates);
+        std::vector<ValueType> coarseRow(numberOfAggregates, storm::utility::zero<ValueType>());
+        std::vector<bool> touched(numberOfAggregates, false);
+        std::vector<uint64_t> touchedColumns;
+        for (uint64_t aggregate = 0; aggregate < numberOfAggregates; ++aggregate) {
+            for (uint64_t memberIndex = memberStarts[aggregate]; memberIndex < memberStarts[aggregate + 1]; ++memberIndex) {
+                for (auto const& entry : currentMatrix->getRow(members[memberIndex])) {
+                    uint64_t const column = aggregateOfRow[entry.getColumn()];
+                    if (!touched[column]) {
+                        touched[column] = true;
+                        touchedColumns.push_back(column);
+                    }
+                    coarseRow[column] += entry.getValue();
+                }
+            }
+            std::sort(touchedColumns.begin(), touchedColumns.end());
+            for (auto column : touchedColumns) {
+                builder.addNextValue(aggregate, column, coarseRow[column]);
+                coarseRow[column] = storm::utility::zero<ValueType>();
+                touched[column] = false;
+            }
+            touchedColumns.clear();
+        }
+        coarseMatrices.push_back(std::make_unique<storm::storage::SparseMatrix<ValueType>>(builder.build()));
+        currentMatrix = coarseMatrices.back().get();
+    }
+
+    // If coarsening stopped early, the coarsest level may be too large to be factorized and is only smoothed.
+    if (levels.back().matrix->getRowCount() <= maximalFactorizedDimension) {
+        coarsestFactorization = std::make_unique<SparseLUFactorization<ValueType>>(*levels.back().matrix);
+        if (!coarsestFactorization->factorize(*levels.back().matrix)) {
+            STORM_LOG_WARN("Could not factorize the coarsest multigrid level. Smoothing is used instead.");
+            coarsestFactorization.reset();
+        }
+    }
+    STORM_LOG_INFO("AMG preconditioner uses " << levels.size() << " levels with " << levels.back().matrix->getRowCount() << " rows on the coarsest one.");
+
+    residuals.resize(levels.size());
+    coarseRightHandSides.resize(levels.size());
+    coarseSolutions.resize(levels.size());
+    for (uint64_t level = 0; level < levels.size(); ++level) {
+        residuals[level].resize(levels[level].matrix->getRowCount());
+        if (level + 1 < levels.size()) {
+            coarseRightHandSides[level].resize(levels[level + 1].matrix->getRowCount());
+            coarseSolutions[level].resize(levels[level + 1].matrix->getRowCount());
+        }
+    }
+}
+
+template<typename ValueType>
+AmgPreconditioner<ValueType>::~AmgPreconditioner() = default;
+
+template<typename ValueType>
+void AmgPreconditioner<ValueType>::apply(std::vector<ValueType> const& r, std::vector<ValueType>& z) const {
+    z.resize(r.size());
+    vCycle(0, r, z);
+}
+
+template<typename ValueType>
+void AmgPreconditioner<ValueType>::vCycle(uint64_t levelIndex, std::vector<ValueType> const& r, std::vector<ValueType>& z) const {
+    Level const& level = levels[levelIndex];
+    if (levelIndex + 1 == levels.size() && coarsestFactorization) {
+        coarsestFactorization->solve(z, r);
+        return;
+    }
+
+    std::fill(z.begin(), z.end(), storm::utility::zero<ValueType>());
+    auto& residual = residuals[levelIndex];
+    smooth(level, r, z, residual);
+    if (levelIndex + 1 == levels.size()) {
+        smooth(level, r, z, residual);
+        return;
+    }
+
+    // Restrict the residual, solve on the coarser level and prolongate the correction.
+    multiply(*level.matrix, z, residual, parallel);
+    auto& coarseRightHandSide = coarseRightHandSides[levelIndex];
+    std::fill(coarseRightHandSide.begin(), coarseRightHandSide.end(), storm::utility::zero<ValueType>());
+    for (uint64_t row = 0; row < z.size(); ++row) {
+        coarseRightHandSide[level.aggregateOfRow[row]] += r[row] - residual[row];
+    }
+    auto& coarseSolution = coarseSolutions[levelIndex];
+    vCycle(levelIndex + 1, coarseRightHandSide, coarseSolution);
+    forEachIndex(z.size(), parallel, [&](uint64_t row) { z[row] += coarseSolution[level.aggregateOfRow[row]]; });
+
+    smooth(level, r, z, residual);
+}
+
+template<typename ValueType>
+void AmgPreconditioner<ValueType>::smooth(Level const& level, std::vector<ValueType> const& r, std::vector<ValueType>& z,
+                                          std::vector<ValueType>& residual) const {
+    multiply(*level.matrix, z, residual, parallel);
+    ValueType const damping = storm::utility::convertNumber<ValueType>(jacobiDamping);
+    forEachIndex(z.size(), parallel, [&](uint64_t row) { z[row] += damping * level.inverseDiagonal[row] * (r[row] - residual[row]); });
+}
+
+template class NativePreconditioner<double>;
+template class IdentityPreconditioner<double>;
+template class IluPreconditioner<double>;
+template class AmgPreconditioner<double>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/solver/SolverSelectionOptions.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+template<typename ValueType>
+class SparseLUFactorization;
+
+/*!
+ * A preconditioner for the Krylov methods of the native linear equation solver, i.e., an operator M^-1 that approximates A^-1.
+ */
+template<typename ValueType>
+class NativePreconditioner {
+   public:
+    virtual ~NativePreconditioner() = default;
+
+    /*!
+     * Computes z = M^-1 * r.
+     */
+    virtual void apply(std::vector<ValueType> const& r, std::vector<ValueType>& z) const = 0;
+
+    /*!
+     * Creates the preconditioner of the given type for the given matrix. The matrix has to outlive the preconditioner.
+     *
+     * @param parallel If set, the preconditioner may use multiple threads (if Intel TBB is available).
+     */
+    static std::unique_ptr<NativePreconditioner<ValueType>> create(NativeLinearEquationSolverPreconditioner type,
+                                                                   storm::storage::SparseMatrix<ValueType> const& matrix, bool parallel);
+};
+
+/*!
+ * The identity, i.e., no preconditioning.
+ */
+template<typename ValueType>
+class IdentityPreconditioner : public NativePreconditioner<ValueType> {
+   public:
+    virtual void apply(std::vector<ValueType> const& r, std::vector<ValueType>& z) const override;
+};
+
+/*!
+ * An incomplete LU factorization without fill-in, i.e., L and U have the pattern of the lower and upper triangular part of the matrix.
+ * If parallelization is requested, the triangular solves are performed level by level: the rows of a level only depend on rows of previous
+ * levels, so they can be processed in parallel. As every row is computed exactly as in the sequential solve, the result is the same.
+ */
+template<typename ValueType>
+class IluPreconditioner : public NativePreconditioner<ValueType> {
+   public:
+    IluPreconditioner(storm::storage::SparseMatrix<ValueType> const& matrix, bool parallel = false);
+
+    virtual void apply(std::vector<ValueType> const& r, std::vector<ValueType>& z) const override;
+
+   private:
+    /*!
+     * Groups the rows into levels such that every row only depends on rows of previous levels in the forward (L) or backward (U) solve.
+     * The schedule is only kept if the levels are large enough on average to make parallel processing worthwhile.
+     */
+    void computeLevelSchedule(bool forward, std::vector<uint64_t>& levelStarts, std::vector<uint64_t>& levelRows) const;
+
+    void solveForwardRow(uint64_t row, std::vector<ValueType> const& r, std::vector<ValueType>& z) const;
+    void solveBackwardRow(uint64_t row, std::vector<ValueType>& z) const;
+
+    // The factors in one matrix with the pattern of the original one. The strictly lower part of a row is L (with an implicit unit diagonal),
+    // the strictly upper part and the separately stored diagonal is U.
+    std::vector<uint64_t> rowStarts;
+    std::vector<uint64_t> lowerEnds;
+    std::vector<uint64_t> upperStarts;
+    std::vector<uint64_t> columns;
+    std::vector<ValueType> values;
+    std::vector<ValueType> diagonal;
+
+    // The level schedules of the forward and backward solve, which are empty if the respective solve is performed sequentially. The rows of
+    // level i are levelRows[levelStarts[i]] to levelRows[levelStarts[i + 1] - 1].
+    std::vector<uint64_t> forwardLevelStarts;
+    std::vector<uint64_t> forwardLevelRows;
+    std::vector<uint64_t> backwardLevelStarts;
+    std::vector<uint64_t> backwardLevelRows;
+};
+
+/*!
+ * An algebraic multigrid preconditioner that performs one V-cycle with damped Jacobi smoothing. The coarse levels are obtained by aggregating
+ * strongly coupled states within the same strongly connected component of the matrix graph, such that the coarse operators keep the
+ * block-triangular structure of the fine one. The system on the coarsest level is solved by sparse LU factorization.
+ */
+template<typename ValueType>
+class AmgPreconditioner : public NativePreconditioner<ValueType> {
+   public:
+    AmgPreconditioner(storm::storage::SparseMatrix<ValueType> const& matrix, bool parallel);
+    ~AmgPreconditioner();
+
+    virtual void apply(std::vector<ValueType> const& r, std::vector<ValueType>& z) const override;
+
+   private:
+    struct Level {
+        // The matrix of this level. For the finest level, this refers to the original matrix.
+        storm::storage::SparseMatrix<ValueType> const* matrix;
+        std::vector<ValueType> inverseDiagonal;
+
+        // For every row, the index of its aggregate, i.e., its row on the next coarser level.
+        std::vector<uint64_t> aggregateOfRow;
+    };
+
+    void vCycle(uint64_t level, std::vector<ValueType> const& r, std::vector<ValueType>& z) const;
+    void smooth(Level const& level, std::vector<ValueType> const& r, std::vector<ValueType>& z, std::vector<ValueType>& residual) const;
+
+    bool parallel;
+    std::vector<Level> levels;
+    std::vector<std::unique_ptr<storm::storage::SparseMatrix<ValueType>>> coarseMatrices;
+    std::unique_ptr<SparseLUFactorization<ValueType>> coarsestFactorization;
+
+    // Auxiliary vectors for every level.
+    mutable std::vector<std::vector<ValueType>> residuals;
+    mutable std::vector<std::vector<ValueType>> coarseRightHandSides;
+    mutable std::vector<std::vector<ValueType>> coarseSolutions;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
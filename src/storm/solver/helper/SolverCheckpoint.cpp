@@ -0,0 +1,319 @@
+#include "storm/solver/helper/SolverCheckpoint.h"
+
+#include <atomic>
+#include <algorithm>
+#include <boost/functional/hash.hpp>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <type_traits>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/utility/SignalHandler.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace checkpointinternal {
+char const magic[] = "STORMCKP";
+uint64_t const version = 2;
+// The number of consecutive values that are summarized by one entry of the value signature.
+uint64_t const valueSignatureBlockSize = 256;
+// The relative difference up to which the value signatures of two equation systems are considered equal.
+double const valueSignatureTolerance = 1e-8;
+
+// Whether a checkpoint has been written since the computation was aborted. As all solvers share the checkpoint file, only the solver that
+// first notices the abort writes a checkpoint. Solvers that are invoked afterwards would otherwise overwrite it with their (barely started) state.
+std::atomic<bool> abortCheckpointWritten(false);
+
+void writeNumber(std::ostream& out, uint64_t value) {
+    out.write(reinterpret_cast<char const*>(&value), sizeof(value));
+}
+
+bool readNumber(std::istream& in, uint64_t& value) {
+    in.read(reinterpret_cast<char*>(&value), sizeof(value));
+    return static_cast<bool>(in);
+}
+
+void writeString(std::ostream& out, std::string const& value) {
+    writeNumber(out, value.size());
+    out.write(value.data(), value.size());
+}
+
+bool readString(std::istream& in, std::string& value) {
+    uint64_t size;
+    if (!readNumber(in, size) || size > 1024) {
+        return false;
+    }
+    value.resize(size);
+    in.read(&value[0], size);
+    return static_cast<bool>(in);
+}
+
+template<typename T>
+void writeVector(std::ostream& out, std::vector<T> const& values) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only vectors of trivially copyable types can be checkpointed.");
+    writeNumber(out, values.size());
+    out.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+}
+
+template<typename T>
+bool readVector(std::istream& in, std::vector<T>& values, uint64_t expectedSize) {
+    static_assert(std::is_trivially_copyable<T>::value, "Only vectors of trivially copyable types can be checkpointed.");
+    uint64_t size;
+    if (!readNumber(in, size) || size != expectedSize) {
+        return false;
+    }
+    values.resize(size);
+    in.read(reinterpret_cast<char*>(values.data()), size * sizeof(T));
+    return static_cast<bool>(in);
+}
+
+template<typename ValueType>
+bool isSupported() {
+    return std::is_same<ValueType, double>::value;
+}
+
+template<typename ValueType>
+uint64_t computeFingerprint(storm::storage::SparseMatrix<ValueType> const& matrix, std::vector<std::vector<ValueType> const*> const& vectors) {
+    // Only the structure is hashed, such that the fingerprint is not affected by rounding the values (e.g. when exporting the model).
+    std::size_t seed = 0;
+    boost::hash_combine(seed, matrix.getRowCount());
+    boost::hash_combine(seed, matrix.getColumnCount());
+    boost::hash_combine(seed, matrix.getEntryCount());
+    if (!matrix.hasTrivialRowGrouping()) {
+        boost::hash_range(seed, matrix.getRowGroupIndices().begin(), matrix.getRowGroupIndices().end());
+    }
+    for (auto const& entry : matrix) {
+        boost::hash_combine(seed, entry.getColumn());
+    }
+    for (auto const& vector : vectors) {
+        boost::hash_combine(seed, vector ? vector->size() : 0);
+    }
+    return seed;
+}
+
+void addToValueSignature(std::vector<double>& signature, uint64_t index, double value) {
+    if (index % valueSignatureBlockSize == 0) {
+        signature.push_back(0.0);
+    }
+    // Weighting the values by their position within the block distinguishes permutations of the values.
+    signature.back() += std::abs(value) * (1.0 + static_cast<double>(index % valueSignatureBlockSize) / valueSignatureBlockSize);
+}
+
+std::vector<double> computeValueSignature(storm::storage::SparseMatrix<double> const& matrix, std::vector<std::vector<double> const*> const& vectors) {
+    // Sums over blocks of values, which are compared with a tolerance.
+    std::vector<double> signature;
+    uint64_t index = 0;
+    for (auto const& entry : matrix) {
+        addToValueSignature(signature, index++, entry.getValue());
+    }
+    for (auto const& vector : vectors) {
+        if (vector) {
+            index = 0;
+            for (auto const& value : *vector) {
+                addToValueSignature(signature, index++, value);
+            }
+        }
+    }
+    return signature;
+}
+
+template<typename ValueType>
+std::vector<double> computeValueSignature(storm::storage::SparseMatrix<ValueType> const&, std::vector<std::vector<ValueType> const*> const&) {
+    STORM_LOG_ASSERT(false, "Checkpoints are only supported for floating point numbers.");
+    return {};
+}
+
+bool valueSignaturesMatch(std::vector<double> const& first, std::vector<double> const& second) {
+    if (first.size() != second.size()) {
+        return false;
+    }
+    for (uint64_t i = 0; i < first.size(); ++i) {
+        if (std::abs(first[i] - second[i]) > valueSignatureTolerance * std::max(first[i], second[i])) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void writeValues(std::ostream& out, std::vector<double> const& values) {
+    writeVector(out, values);
+}
+
+template<typename ValueType>
+void writeValues(std::ostream&, std::vector<ValueType> const&) {
+    STORM_LOG_ASSERT(false, "Checkpoints are only supported for floating point numbers.");
+}
+
+bool readValues(std::istream& in, std::vector<double>& values, uint64_t expectedSize) {
+    return readVector(in, values, expectedSize);
+}
+
+template<typename ValueType>
+bool readValues(std::istream&, std::vector<ValueType>&, uint64_t) {
+    STORM_LOG_ASSERT(false, "Checkpoints are only supported for floating point numbers.");
+    return false;
+}
+}  // namespace checkpointinternal
+
+template<typename ValueType>
+SolverCheckpoint<ValueType>::SolverCheckpoint(Environment const& env, std::string const& method, storm::storage::SparseMatrix<ValueType> const& matrix,
+                                              std::vector<std::vector<ValueType> const*> const& vectors)
+    : method(method),
+      fingerprint(0),
+      interval(env.solver().getCheckpointInterval()),
+      lastCheckpoint(std::chrono::steady_clock::now()) {
+    if (env.solver().getCheckpointFilename() || env.solver().getResumeFilename()) {
+        if (checkpointinternal::isSupported<ValueType>()) {
+            checkpointFilename = env.solver().getCheckpointFilename();
+            resumeFilename = env.solver().getResumeFilename();
+            fingerprint = checkpointinternal::computeFingerprint(matrix, vectors);
+            valueSignature = checkpointinternal::computeValueSignature(matrix, vectors);
+        } else {
+            STORM_LOG_WARN("Checkpoints are only supported for floating point numbers. The solver state is not checkpointed.");
+        }
+    }
+}
+
+template<typename ValueType>
+bool SolverCheckpoint<ValueType>::isCheckpointingEnabled() const {
+    return checkpointFilename.is_initialized();
+}
+
+template<typename ValueType>
+bool SolverCheckpoint<ValueType>::restore(State& state, uint64_t numberOfVectors, uint64_t vectorSize) const {
+    if (!resumeFilename) {
+        return false;
+    }
+    std::ifstream in(resumeFilename.get(), std::ios::binary);
+    if (!in) {
+        STORM_LOG_WARN("Could not open checkpoint file '" << resumeFilename.get() << "'.");
+        return false;
+    }
+
+    // Check the header before reading the (potentially large) vectors.
+    char magic[sizeof(checkpointinternal::magic) - 1];
+    in.read(magic, sizeof(magic));
+    uint64_t fileVersion, fileFingerprint, numberOfFileVectors;
+    std::string fileMethod;
+    std::vector<double> fileValueSignature;
+    if (!in || std::string(magic, sizeof(magic)) != checkpointinternal::magic || !checkpointinternal::readNumber(in, fileVersion) ||
+        fileVersion != checkpointinternal::version) {
+        STORM_LOG_WARN("File '" << resumeFilename.get() << "' is not a valid checkpoint file.");
+        return false;
+    }
+    if (!checkpointinternal::readString(in, fileMethod) || fileMethod != method || !checkpointinternal::readNumber(in, fileFingerprint) ||
+        fileFingerprint != fingerprint || !checkpointinternal::readVector(in, fileValueSignature, valueSignature.size()) ||
+        !checkpointinternal::valueSignaturesMatch(fileValueSignature, valueSignature)) {
+        STORM_LOG_WARN("Checkpoint file '" << resumeFilename.get() << "' does not match the current equation system (" << method
+                                           << "). The computation starts from scratch.");
+        return false;
+    }
+
+    State result;
+    if (!checkpointinternal::readNumber(in, result.iterations) || !checkpointinternal::readNumber(in, numberOfFileVectors) ||
+        numberOfFileVectors != numberOfVectors) {
+        STORM_LOG_WARN("Checkpoint file '" << resumeFilename.get() << "' is corrupted.");
+        return false;
+    }
+    result.vectors.resize(numberOfVectors);
+    for (auto& vector : result.vectors) {
+        if (!checkpointinternal::readValues(in, vector, vectorSize)) {
+            STORM_LOG_WARN("Checkpoint file '" << resumeFilename.get() << "' is corrupted.");
+            return false;
+        }
+    }
+    uint64_t schedulerSize;
+    if (!checkpointinternal::readNumber(in, schedulerSize) || (schedulerSize > 0 && !checkpointinternal::readVector(in, result.scheduler, schedulerSize))) {
+        STORM_LOG_WARN("Checkpoint file '" << resumeFilename.get() << "' is corrupted.");
+        return false;
+    }
+
+    STORM_LOG_INFO("Resuming " << method << " from checkpoint after " << result.iterations << " iterations.");
+    state = std::move(result);
+    return true;
+}
+
+template<typename ValueType>
+bool SolverCheckpoint<ValueType>::isDue() const {
+    if (!checkpointFilename) {
+        return false;
+    }
+    if (storm::utility::resources::isTerminate()) {
+        return !checkpointinternal::abortCheckpointWritten.load();
+    }
+    if (checkpointinternal::abortCheckpointWritten.load(std::memory_order_relaxed)) {
+        // The abort has been revoked, so a future abort requires a new checkpoint.
+        checkpointinternal::abortCheckpointWritten.store(false);
+    }
+    return std::chrono::steady_clock::now() - lastCheckpoint >= interval;
+}
+
+template<typename ValueType>
+void SolverCheckpoint<ValueType>::write(uint64_t iterations, std::vector<std::vector<ValueType> const*> const& vectors,
+                                        std::vector<uint64_t> const* scheduler) {
+    if (!checkpointFilename) {
+        return;
+    }
+    if (storm::utility::resources::isTerminate()) {
+        if (checkpointinternal::abortCheckpointWritten.exchange(true)) {
+            STORM_LOG_DEBUG("Not writing a checkpoint of " << method << " as a checkpoint has already been written after the abort.");
+            return;
+        }
+    } else {
+        checkpointinternal::abortCheckpointWritten.store(false);
+    }
+    // Write to a temporary file first such that an interruption while writing does not destroy the previous checkpoint.
+    std::string temporaryFilename = checkpointFilename.get() + ".tmp";
+    {
+        std::ofstream out(temporaryFilename, std::ios::binary | std::ios::trunc);
+        out.write(checkpointinternal::magic, sizeof(checkpointinternal::magic) - 1);
+        checkpointinternal::writeNumber(out, checkpointinternal::version);
+        checkpointinternal::writeString(out, method);
+        checkpointinternal::writeNumber(out, fingerprint);
+        checkpointinternal::writeVector(out, valueSignature);
+        checkpointinternal::writeNumber(out, iterations);
+        checkpointinternal::writeNumber(out, vectors.size());
+        for (auto const& vector : vectors) {
+            checkpointinternal::writeValues(out, *vector);
+        }
+        if (scheduler) {
+            checkpointinternal::writeVector(out, *scheduler);
+        } else {
+            checkpointinternal::writeNumber(out, 0);
+        }
+        if (!out) {
+            STORM_LOG_WARN("Could not write checkpoint file '" << temporaryFilename << "'.");
+            return;
+        }
+    }
+    if (std::rename(temporaryFilename.c_str(), checkpointFilename.get().c_str()) != 0) {
+        STORM_LOG_WARN("Could not write checkpoint file '" << checkpointFilename.get() << "'.");
+        return;
+    }
+    STORM_LOG_INFO("Wrote checkpoint of " << method << " after " << iterations << " iterations.");
+    lastCheckpoint = std::chrono::steady_clock::now();
+}
+
+template<typename ValueType>
+void SolverCheckpoint<ValueType>::writeIfDue(uint64_t iterations, std::vector<std::vector<ValueType> const*> const& vectors,
+                                             std::vector<uint64_t> const* scheduler) {
+    if (isDue()) {
+        write(iterations, vectors, scheduler);
+    }
+}
+
+template class SolverCheckpoint<double>;
+
+#ifdef STORM_HAVE_CARL
+template class SolverCheckpoint<storm::RationalNumber>;
+template class SolverCheckpoint<storm::RationalFunction>;
+#endif
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
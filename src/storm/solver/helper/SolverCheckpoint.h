@@ -0,0 +1,92 @@
+#pragma once
+
+#include <boost/optional.hpp>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+class Environment;
+
+namespace solver {
+namespace helper {
+
+/*!
+ * Writes the state of an iterative solver (iteration count, iterates and possibly a scheduler) to a binary checkpoint file and restores it.
+ * Checkpoints are written periodically (according to the checkpoint interval of the solver environment) and when the computation is aborted.
+ *
+ * Each checkpoint is tagged with the solving method, a fingerprint of the structure of the equation system (i.e., of the matrix and further
+ * vectors that determine the solution) and a signature of its values. A solver is only resumed from a checkpoint with matching tag and
+ * fingerprint whose value signature coincides up to a small relative tolerance. Hence, a checkpoint can be resumed on a model that was
+ * exported and parsed again, even though the exported values are rounded. As all solvers share the same
+ * checkpoint file, only the most recently checkpointed equation system can be resumed. Once the computation is aborted, only the first solver
+ * that writes a checkpoint does so, such that solvers invoked after the abort do not overwrite it.
+ *
+ * Checkpoints are only supported for floating point numbers. For other value types, no checkpoints are written or restored.
+ */
+template<typename ValueType>
+class SolverCheckpoint {
+   public:
+    /*!
+     * The restorable state of a solver.
+     */
+    struct State {
+        uint64_t iterations = 0;
+        std::vector<std::vector<ValueType>> vectors;
+        std::vector<uint64_t> scheduler;
+    };
+
+    /*!
+     * @param method Identifies the solving method (and its parameters that are not reflected by the fingerprint).
+     * @param matrix The matrix of the equation system.
+     * @param vectors Further vectors (e.g. the right-hand side) that determine the solution.
+     */
+    SolverCheckpoint(Environment const& env, std::string const& method, storm::storage::SparseMatrix<ValueType> const& matrix,
+                     std::vector<std::vector<ValueType> const*> const& vectors = {});
+
+    /*!
+     * Retrieves whether checkpoints are written.
+     */
+    bool isCheckpointingEnabled() const;
+
+    /*!
+     * Restores the state from the resume file of the solver environment.
+     *
+     * @param state The state to restore. It is only modified if the checkpoint matches.
+     * @param numberOfVectors The number of vectors that the state is expected to contain.
+     * @param vectorSize The size of each of these vectors.
+     * @return True iff the checkpoint matches this equation system and the state was restored.
+     */
+    bool restore(State& state, uint64_t numberOfVectors, uint64_t vectorSize) const;
+
+    /*!
+     * Retrieves whether a checkpoint is due, because either the checkpoint interval has passed or the computation is aborted.
+     */
+    bool isDue() const;
+
+    /*!
+     * Writes the given state to the checkpoint file. If the computation is aborted, this does nothing if a checkpoint has already been written
+     * since the abort.
+     */
+    void write(uint64_t iterations, std::vector<std::vector<ValueType> const*> const& vectors, std::vector<uint64_t> const* scheduler = nullptr);
+
+    /*!
+     * Writes the given state if a checkpoint is due.
+     */
+    void writeIfDue(uint64_t iterations, std::vector<std::vector<ValueType> const*> const& vectors, std::vector<uint64_t> const* scheduler = nullptr);
+
+   private:
+    std::string method;
+    uint64_t fingerprint;
+    std::vector<double> valueSignature;
+    boost::optional<std::string> checkpointFilename;
+    boost::optional<std::string> resumeFilename;
+    std::chrono::seconds interval;
+    std::chrono::steady_clock::time_point lastCheckpoint;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,397 @@
+#include "storm/solver/helper/SparseLUFactorization.h"
+
+#include <algorithm>
+#include <atomic>
+#include <list>
+#include <mutex>
+#include <set>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/adapters/RationalNumberAdapter.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+namespace {
+// The number of symbolic factorizations that are kept for later reuse and the maximal number of bytes they may occupy together.
+uint64_t const symbolicFactorizationCacheSize = 4;
+uint64_t const symbolicFactorizationCacheMemoryLimit = 1ull << 28;
+
+std::mutex symbolicFactorizationCacheMutex;
+std::list<std::shared_ptr<SparseLUSymbolicFactorization const>> symbolicFactorizationCache;
+
+// Levels of the elimination tree with fewer columns are factorized sequentially.
+uint64_t const minimalParallelLevelSize = 64;
+
+template<typename ValueType>
+uint64_t computePatternHash(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    uint64_t hash = matrix.getRowCount();
+    for (uint64_t row = 0; row < matrix.getRowCount(); ++row) {
+        hash = hash * 31 + matrix.getRow(row).getNumberOfEntries();
+        for (auto const& entry : matrix.getRow(row)) {
+            hash = hash * 31 + entry.getColumn();
+        }
+    }
+    return hash;
+}
+}  // namespace
+
+template<typename ValueType>
+std::shared_ptr<SparseLUSymbolicFactorization const> SparseLUSymbolicFactorization::get(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    auto& cache = symbolicFactorizationCache;
+    uint64_t hash = computePatternHash(matrix);
+    {
+        std::lock_guard<std::mutex> lock(symbolicFactorizationCacheMutex);
+        for (auto it = cache.begin(); it != cache.end(); ++it) {
+            if ((*it)->patternHash == hash && (*it)->hasPatternOf(matrix)) {
+                STORM_LOG_DEBUG("Reusing the symbolic LU factorization of a matrix with the same pattern.");
+                cache.splice(cache.begin(), cache, it);
+                return cache.front();
+            }
+        }
+    }
+
+    // The analysis is done without holding the lock, so other threads are not blocked by it.
+    std::shared_ptr<SparseLUSymbolicFactorization const> result(new SparseLUSymbolicFactorization(matrix));
+    std::lock_guard<std::mutex> lock(symbolicFactorizationCacheMutex);
+    cache.push_front(result);
+
+    // Drop the least recently used factorizations if there are too many or they occupy too much memory. Factorizations that are still in use
+    // remain valid, as the cache only shares their ownership. The new factorization is only kept if it fits on its own.
+    uint64_t memory = 0;
+    uint64_t numberOfKeptFactorizations = 0;
+    for (auto const& factorization : cache) {
+        uint64_t const factorizationMemory = factorization->getMemoryFootprint();
+        if (numberOfKeptFactorizations == symbolicFactorizationCacheSize || memory + factorizationMemory > symbolicFactorizationCacheMemoryLimit) {
+            break;
+        }
+        memory += factorizationMemory;
+        ++numberOfKeptFactorizations;
+    }
+    cache.resize(numberOfKeptFactorizations);
+    return result;
+}
+
+void SparseLUSymbolicFactorization::clearCache() {
+    std::lock_guard<std::mutex> lock(symbolicFactorizationCacheMutex);
+    symbolicFactorizationCache.clear();
+}
+
+template<typename ValueType>
+bool SparseLUSymbolicFactorization::hasPatternOf(storm::storage::SparseMatrix<ValueType> const& matrix) const {
+    if (matrix.getRowCount() != dimension || matrix.getColumnCount() != dimension || matrix.getEntryCount() != columnIndices.size()) {
+        return false;
+    }
+    for (uint64_t row = 0; row < dimension; ++row) {
+        if (static_cast<uint64_t>(matrix.begin(row + 1) - matrix.begin()) != rowIndications[row + 1]) {
+            return false;
+        }
+    }
+    auto columnIt = columnIndices.begin();
+    for (auto const& entry : matrix) {
+        if (entry.getColumn() != *columnIt) {
+            return false;
+        }
+        ++columnIt;
+    }
+    return true;
+}
+
+uint64_t SparseLUSymbolicFactorization::getNumberOfNonZerosOfFactors() const {
+    return dimension + lowerRows.size() + upperRows.size();
+}
+
+uint64_t SparseLUSymbolicFactorization::getMemoryFootprint() const {
+    uint64_t numberOfIndices = 0;
+    for (auto const* indices : {&rowIndications, &columnIndices, &newToOld, &oldToNew, &matrixColumnStarts, &matrixRows, &matrixEntries, &lowerColumnStarts,
+                                &lowerRows, &upperColumnStarts, &upperRows, &levelStarts, &levelColumns}) {
+        numberOfIndices += indices->size();
+    }
+    return sizeof(SparseLUSymbolicFactorization) + numberOfIndices * sizeof(uint64_t);
+}
+
+template<typename ValueType>
+SparseLUSymbolicFactorization::SparseLUSymbolicFactorization(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : dimension(matrix.getRowCount()), patternHash(computePatternHash(matrix)) {
+    STORM_LOG_THROW(matrix.getRowCount() == matrix.getColumnCount(), storm::exceptions::InvalidArgumentException,
+                    "LU factorization requires a square matrix.");
+
+    // Store the pattern and build the (symmetric) adjacency of A + A^T without the diagonal.
+    rowIndications.reserve(dimension + 1);
+    columnIndices.reserve(matrix.getEntryCount());
+    std::vector<std::vector<uint64_t>> adjacency(dimension);
+    rowIndications.push_back(0);
+    for (uint64_t row = 0; row < dimension; ++row) {
+        for (auto const& entry : matrix.getRow(row)) {
+            columnIndices.push_back(entry.getColumn());
+            if (entry.getColumn() != row) {
+                adjacency[row].push_back(entry.getColumn());
+                adjacency[entry.getColumn()].push_back(row);
+            }
+        }
+        rowIndications.push_back(columnIndices.size());
+    }
+    for (auto& neighbors : adjacency) {
+        std::sort(neighbors.begin(), neighbors.end());
+        neighbors.erase(std::unique(neighbors.begin(), neighbors.end()), neighbors.end());
+    }
+
+    // Compute a minimum degree ordering by eliminating the nodes of the graph. Eliminating a node connects all its (remaining) neighbors,
+    // which are exactly the (old) row indices of the corresponding column of L.
+    newToOld.reserve(dimension);
+    oldToNew.assign(dimension, 0);
+    std::vector<std::vector<uint64_t>> lowerColumnsOld(dimension);
+    std::set<std::pair<uint64_t, uint64_t>> queue;
+    for (uint64_t node = 0; node < dimension; ++node) {
+        queue.emplace(adjacency[node].size(), node);
+    }
+    std::vector<uint64_t> merged;
+    while (!queue.empty()) {
+        uint64_t node = queue.begin()->second;
+        queue.erase(queue.begin());
+        oldToNew[node] = newToOld.size();
+        newToOld.push_back(node);
+
+        auto& nodeNeighbors = adjacency[node];
+        for (auto neighbor : nodeNeighbors) {
+            auto& neighborNeighbors = adjacency[neighbor];
+            queue.erase(std::make_pair(neighborNeighbors.size(), neighbor));
+            merged.clear();
+            std::set_union(neighborNeighbors.begin(), neighborNeighbors.end(), nodeNeighbors.begin(), nodeNeighbors.end(), std::back_inserter(merged));
+            merged.erase(std::remove_if(merged.begin(), merged.end(), [&](uint64_t other) { return other == node || other == neighbor; }), merged.end());
+            neighborNeighbors.swap(merged);
+            queue.emplace(neighborNeighbors.size(), neighbor);
+        }
+        lowerColumnsOld[node] = std::move(nodeNeighbors);
+        nodeNeighbors = std::vector<uint64_t>();
+    }
+
+    // Translate the structure of L to the new indices and derive the structure of U by transposition.
+    lowerColumnStarts.reserve(dimension + 1);
+    lowerColumnStarts.push_back(0);
+    std::vector<uint64_t> upperCounts(dimension, 0);
+    for (uint64_t column = 0; column < dimension; ++column) {
+        uint64_t start = lowerRows.size();
+        for (auto oldRow : lowerColumnsOld[newToOld[column]]) {
+            lowerRows.push_back(oldToNew[oldRow]);
+            ++upperCounts[lowerRows.back()];
+        }
+        std::sort(lowerRows.begin() + start, lowerRows.end());
+        lowerColumnStarts.push_back(lowerRows.size());
+    }
+    lowerColumnsOld.clear();
+    upperColumnStarts.assign(dimension + 1, 0);
+    for (uint64_t column = 0; column < dimension; ++column) {
+        upperColumnStarts[column + 1] = upperColumnStarts[column] + upperCounts[column];
+    }
+    upperRows.resize(lowerRows.size());
+    std::vector<uint64_t> upperPositions(upperColumnStarts.begin(), upperColumnStarts.end() - 1);
+    for (uint64_t column = 0; column < dimension; ++column) {
+        for (uint64_t index = lowerColumnStarts[column]; index < lowerColumnStarts[column + 1]; ++index) {
+            upperRows[upperPositions[lowerRows[index]]++] = column;
+        }
+    }
+
+    // Store the columns of the permuted matrix.
+    matrixColumnStarts.assign(dimension + 1, 0);
+    for (auto column : columnIndices) {
+        ++matrixColumnStarts[oldToNew[column] + 1];
+    }
+    for (uint64_t column = 0; column < dimension; ++column) {
+        matrixColumnStarts[column + 1] += matrixColumnStarts[column];
+    }
+    matrixRows.resize(columnIndices.size());
+    matrixEntries.resize(columnIndices.size());
+    std::vector<uint64_t> matrixPositions(matrixColumnStarts.begin(), matrixColumnStarts.end() - 1);
+    for (uint64_t row = 0; row < dimension; ++row) {
+        for (uint64_t entry = rowIndications[row]; entry < rowIndications[row + 1]; ++entry) {
+            uint64_t position = matrixPositions[oldToNew[columnIndices[entry]]]++;
+            matrixRows[position] = oldToNew[row];
+            matrixEntries[position] = entry;
+        }
+    }
+
+    // The parent of a column in the elimination tree is the smallest row index of its column in L. As parents have larger indices than their
+    // children, the levels can be computed in a single pass.
+    std::vector<uint64_t> levels(dimension, 0);
+    uint64_t numberOfLevels = dimension == 0 ? 0 : 1;
+    for (uint64_t column = 0; column < dimension; ++column) {
+        if (lowerColumnStarts[column] != lowerColumnStarts[column + 1]) {
+            uint64_t parent = lowerRows[lowerColumnStarts[column]];
+            levels[parent] = std::max(levels[parent], levels[column] + 1);
+            numberOfLevels = std::max(numberOfLevels, levels[parent] + 1);
+        }
+    }
+    levelStarts.assign(numberOfLevels + 1, 0);
+    for (auto level : levels) {
+        ++levelStarts[level + 1];
+    }
+    for (uint64_t level = 0; level < numberOfLevels; ++level) {
+        levelStarts[level + 1] += levelStarts[level];
+    }
+    levelColumns.resize(dimension);
+    std::vector<uint64_t> levelPositions(levelStarts.begin(), levelStarts.end() - 1);
+    for (uint64_t column = 0; column < dimension; ++column) {
+        levelColumns[levelPositions[levels[column]]++] = column;
+    }
+
+    STORM_LOG_DEBUG("Symbolic LU factorization of a matrix with " << matrix.getEntryCount() << " entries has " << getNumberOfNonZerosOfFactors()
+                                                                   << " non-zeros in " << numberOfLevels << " levels.");
+}
+
+template<typename ValueType>
+SparseLUFactorization<ValueType>::SparseLUFactorization(storm::storage::SparseMatrix<ValueType> const& matrix)
+    : symbolic(SparseLUSymbolicFactorization::get(matrix)), factorized(false) {
+    // Intentionally left empty.
+}
+
+template<typename ValueType>
+bool SparseLUFactorization<ValueType>::factorize(storm::storage::SparseMatrix<ValueType> const& matrix) {
+    STORM_LOG_ASSERT(symbolic->hasPatternOf(matrix), "The matrix does not have the pattern of the symbolic factorization.");
+    uint64_t const dimension = symbolic->dimension;
+    diagonal.assign(dimension, storm::utility::zero<ValueType>());
+    lowerValues.assign(symbolic->lowerRows.size(), storm::utility::zero<ValueType>());
+    upperValues.assign(symbolic->upperRows.size(), storm::utility::zero<ValueType>());
+
+    // Every task needs its own dense work vector, so we only use as many tasks as there are threads and as there are blocks of the minimal
+    // parallel level size in the largest level.
+    uint64_t numberOfTasks = 1;
+    if (storm::utility::parallel::isIntelTbbEnabled()) {
+        uint64_t largestLevelSize = 0;
+        for (uint64_t level = 0; level + 1 < symbolic->levelStarts.size(); ++level) {
+            largestLevelSize = std::max(largestLevelSize, symbolic->levelStarts[level + 1] - symbolic->levelStarts[level]);
+        }
+        numberOfTasks = std::max<uint64_t>(1, std::min(storm::utility::parallel::getNumberOfThreads(), largestLevelSize / minimalParallelLevelSize));
+    }
+    bool const parallelize = numberOfTasks > 1;
+    std::vector<std::vector<ValueType>> workVectors(numberOfTasks, std::vector<ValueType>(dimension, storm::utility::zero<ValueType>()));
+
+    std::atomic<bool> success(true);
+    for (uint64_t level = 0; level + 1 < symbolic->levelStarts.size() && success; ++level) {
+        uint64_t const levelStart = symbolic->levelStarts[level];
+        uint64_t const levelEnd = symbolic->levelStarts[level + 1];
+#ifdef STORM_HAVE_INTELTBB
+        if (parallelize && levelEnd - levelStart >= minimalParallelLevelSize) {
+            // Split the level into one block of columns per task, such that every task can use its own work vector.
+            uint64_t const blockSize = (levelEnd - levelStart + numberOfTasks - 1) / numberOfTasks;
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfTasks, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t task = range.begin(); task != range.end(); ++task) {
+                    uint64_t const blockEnd = std::min(levelEnd, levelStart + (task + 1) * blockSize);
+                    for (uint64_t index = levelStart + task * blockSize; index < blockEnd; ++index) {
+                        if (!factorizeColumn(matrix, symbolic->levelColumns[index], workVectors[task])) {
+                            success = false;
+                        }
+                    }
+                }
+            });
+            continue;
+        }
+#endif
+        for (uint64_t index = levelStart; index < levelEnd; ++index) {
+            if (!factorizeColumn(matrix, symbolic->levelColumns[index], workVectors.front())) {
+                success = false;
+                break;
+            }
+        }
+    }
+
+    factorized = success;
+    STORM_LOG_WARN_COND(factorized, "LU factorization failed because a pivot vanished.");
+    return factorized;
+}
+
+template<typename ValueType>
+bool SparseLUFactorization<ValueType>::factorizeColumn(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t column,
+                                                       std::vector<ValueType>& workVector) {
+    // Scatter the column of the (permuted) matrix.
+    auto const matrixBegin = matrix.begin();
+    for (uint64_t index = symbolic->matrixColumnStarts[column]; index < symbolic->matrixColumnStarts[column + 1]; ++index) {
+        workVector[symbolic->matrixRows[index]] += matrixBegin[symbolic->matrixEntries[index]].getValue();
+    }
+
+    // Solve with the (unit) lower triangular part computed so far to obtain the column of U. By construction of the symbolic factorization,
+    // only positions that belong to the column of U or L are touched.
+    for (uint64_t index = symbolic->upperColumnStarts[column]; index < symbolic->upperColumnStarts[column + 1]; ++index) {
+        uint64_t const row = symbolic->upperRows[index];
+        ValueType value = std::move(workVector[row]);
+        workVector[row] = storm::utility::zero<ValueType>();
+        if (!storm::utility::isZero(value)) {
+            for (uint64_t lowerIndex = symbolic->lowerColumnStarts[row]; lowerIndex < symbolic->lowerColumnStarts[row + 1]; ++lowerIndex) {
+                workVector[symbolic->lowerRows[lowerIndex]] -= lowerValues[lowerIndex] * value;
+            }
+        }
+        upperValues[index] = std::move(value);
+    }
+
+    ValueType pivot = std::move(workVector[column]);
+    workVector[column] = storm::utility::zero<ValueType>();
+    bool result = !storm::utility::isZero(pivot);
+    for (uint64_t index = symbolic->lowerColumnStarts[column]; index < symbolic->lowerColumnStarts[column + 1]; ++index) {
+        ValueType& value = workVector[symbolic->lowerRows[index]];
+        if (result) {
+            lowerValues[index] = value / pivot;
+        }
+        value = storm::utility::zero<ValueType>();
+    }
+    diagonal[column] = std::move(pivot);
+    return result;
+}
+
+template<typename ValueType>
+void SparseLUFactorization<ValueType>::solve(std::vector<ValueType>& x, std::vector<ValueType> const& b) const {
+    STORM_LOG_ASSERT(factorized, "The matrix has not been factorized.");
+    uint64_t const dimension = symbolic->dimension;
+    std::vector<ValueType> y(dimension);
+    for (uint64_t index = 0; index < dimension; ++index) {
+        y[index] = b[symbolic->newToOld[index]];
+    }
+
+    // Forward substitution with the unit lower triangular L.
+    for (uint64_t column = 0; column < dimension; ++column) {
+        ValueType const& value = y[column];
+        if (!storm::utility::isZero(value)) {
+            for (uint64_t index = symbolic->lowerColumnStarts[column]; index < symbolic->lowerColumnStarts[column + 1]; ++index) {
+                y[symbolic->lowerRows[index]] -= lowerValues[index] * value;
+            }
+        }
+    }
+
+    // Backward substitution with U.
+    for (uint64_t column = dimension; column > 0; --column) {
+        ValueType& value = y[column - 1];
+        value /= diagonal[column - 1];
+        if (!storm::utility::isZero(value)) {
+            for (uint64_t index = symbolic->upperColumnStarts[column - 1]; index < symbolic->upperColumnStarts[column]; ++index) {
+                y[symbolic->upperRows[index]] -= upperValues[index] * value;
+            }
+        }
+    }
+
+    for (uint64_t index = 0; index < dimension; ++index) {
+        x[symbolic->newToOld[index]] = std::move(y[index]);
+    }
+}
+
+template<typename ValueType>
+SparseLUSymbolicFactorization const& SparseLUFactorization<ValueType>::getSymbolicFactorization() const {
+    return *symbolic;
+}
+
+template std::shared_ptr<SparseLUSymbolicFactorization const> SparseLUSymbolicFactorization::get(storm::storage::SparseMatrix<double> const& matrix);
+template bool SparseLUSymbolicFactorization::hasPatternOf(storm::storage::SparseMatrix<double> const& matrix) const;
+template class SparseLUFactorization<double>;
+
+template std::shared_ptr<SparseLUSymbolicFactorization const> SparseLUSymbolicFactorization::get(
+    storm::storage::SparseMatrix<storm::RationalNumber> const& matrix);
+template bool SparseLUSymbolicFactorization::hasPatternOf(storm::storage::SparseMatrix<storm::RationalNumber> const& matrix) const;
+template class SparseLUFactorization<storm::RationalNumber>;
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -0,0 +1,123 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace solver {
+namespace helper {
+
+/*!
+ * The symbolic part of a sparse LU factorization, i.e., everything that only depends on the sparsity pattern of the matrix.
+ *
+ * The rows and columns are reordered symmetrically by a minimum degree ordering of the pattern of A + A^T. The pattern of the factors is the
+ * pattern of the Cholesky factor of the reordered A + A^T, i.e., the structure of U is the transposed structure of L. Columns are grouped in
+ * levels of the elimination tree such that the columns of one level can be factorized independently of each other.
+ */
+class SparseLUSymbolicFactorization {
+   public:
+    /*!
+     * Retrieves the symbolic factorization of the pattern of the given (square) matrix. The most recently analysed patterns are cached, such
+     * that matrices that only differ in their values (e.g., instantiations of a parametric model) are analysed once. The cache holds at most
+     * four symbolic factorizations that occupy at most 256 MiB together.
+     */
+    template<typename ValueType>
+    static std::shared_ptr<SparseLUSymbolicFactorization const> get(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Releases all cached symbolic factorizations. Factorizations that are still in use remain valid.
+     */
+    static void clearCache();
+
+    /*!
+     * Checks whether the given matrix has the pattern this symbolic factorization was computed for.
+     */
+    template<typename ValueType>
+    bool hasPatternOf(storm::storage::SparseMatrix<ValueType> const& matrix) const;
+
+    uint64_t getNumberOfNonZerosOfFactors() const;
+
+    /*!
+     * Retrieves the (approximate) number of bytes occupied by this symbolic factorization.
+     */
+    uint64_t getMemoryFootprint() const;
+
+   private:
+    template<typename ValueType>
+    explicit SparseLUSymbolicFactorization(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    template<typename ValueType>
+    friend class SparseLUFactorization;
+
+    uint64_t dimension;
+    uint64_t patternHash;
+
+    // The pattern of the original matrix (needed to identify matrices with the same pattern).
+    std::vector<uint64_t> rowIndications;
+    std::vector<uint64_t> columnIndices;
+
+    // The symmetric permutation (new index to old index and vice versa).
+    std::vector<uint64_t> newToOld;
+    std::vector<uint64_t> oldToNew;
+
+    // The columns of the permuted matrix. For every entry, we store its (new) row index and the index of the entry in the original matrix.
+    std::vector<uint64_t> matrixColumnStarts;
+    std::vector<uint64_t> matrixRows;
+    std::vector<uint64_t> matrixEntries;
+
+    // The strictly lower triangular part of L and the strictly upper triangular part of U, both column-wise with ascending row indices.
+    std::vector<uint64_t> lowerColumnStarts;
+    std::vector<uint64_t> lowerRows;
+    std::vector<uint64_t> upperColumnStarts;
+    std::vector<uint64_t> upperRows;
+
+    // The columns grouped by their level in the elimination tree (leaves first).
+    std::vector<uint64_t> levelStarts;
+    std::vector<uint64_t> levelColumns;
+};
+
+/*!
+ * A sparse LU factorization without numerical pivoting, i.e., the pivots are taken from the diagonal of the (symmetrically reordered) matrix.
+ * This is stable for the nonsingular M-matrices that arise from Markov models, such as I - P for the probability matrix P of the maybe-states.
+ *
+ * The symbolic factorization is shared among all matrices with the same pattern, so only the numeric factorization needs to be computed if the
+ * values change. The numeric factorization processes the levels of the elimination tree one after another; the columns of a level are
+ * factorized in parallel if Intel TBB is enabled.
+ */
+template<typename ValueType>
+class SparseLUFactorization {
+   public:
+    /*!
+     * Prepares the factorization of matrices with the pattern of the given matrix. The numeric factorization is not yet computed.
+     */
+    explicit SparseLUFactorization(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Computes the numeric factorization of the given matrix which must have the pattern this factorization was prepared for.
+     * @return False if a pivot vanished, in which case the factorization can not be used.
+     */
+    bool factorize(storm::storage::SparseMatrix<ValueType> const& matrix);
+
+    /*!
+     * Solves A*x = b using the most recent (successful) numeric factorization.
+     */
+    void solve(std::vector<ValueType>& x, std::vector<ValueType> const& b) const;
+
+    SparseLUSymbolicFactorization const& getSymbolicFactorization() const;
+
+   private:
+    bool factorizeColumn(storm::storage::SparseMatrix<ValueType> const& matrix, uint64_t column, std::vector<ValueType>& workVector);
+
+    std::shared_ptr<SparseLUSymbolicFactorization const> symbolic;
+    bool factorized;
+
+    std::vector<ValueType> diagonal;
+    std::vector<ValueType> lowerValues;
+    std::vector<ValueType> upperValues;
+};
+
+}  // namespace helper
+}  // namespace solver
+}  // namespace storm
@@ -8,6 +8,7 @@
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/exceptions/NotSupportedException.h"
+#include "storm/utility/RoundingModeGuard.h"
 #include "storm/utility/constants.h"
 
 #include "storm/utility/macros.h"
@@ -36,7 +37,8 @@ void GmmxxMultiplier<ValueType>::clearCache() const {
 template<typename ValueType>
 bool GmmxxMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
-    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    // The rounding mode is thread-local, so a directed rounding mode of the calling thread would not apply to the worker threads.
+    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && storm::utility::isRoundingToNearest();
 #else
     return false;
 #endif
@@ -12,6 +12,7 @@
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/adapters/RationalNumberAdapter.h"
 
+#include "storm/utility/RoundingModeGuard.h"
 #include "storm/utility/macros.h"
 
 namespace storm {
@@ -25,7 +26,8 @@ NativeMultiplier<ValueType>::NativeMultiplier(storm::storage::SparseMatrix<Value
 template<typename ValueType>
 bool NativeMultiplier<ValueType>::parallelize(Environment const& env) const {
 #ifdef STORM_HAVE_INTELTBB
-    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+    // The rounding mode is thread-local, so a directed rounding mode of the calling thread would not apply to the worker threads.
+    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet() && storm::utility::isRoundingToNearest();
 #else
     return false;
 #endif
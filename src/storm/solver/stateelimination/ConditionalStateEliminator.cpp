@@ -20,14 +20,14 @@ ConditionalStateEliminator<ValueType>::ConditionalStateEliminator(storm::storage
 
 template<typename ValueType>
 void ConditionalStateEliminator<ValueType>::updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability) {
-    oneStepProbabilities[state] = storm::utility::simplify((ValueType)(loopProbability * oneStepProbabilities[state]));
+    oneStepProbabilities[state] = this->arithmetic->multiply(loopProbability, oneStepProbabilities[state]);
 }
 
 template<typename ValueType>
 void ConditionalStateEliminator<ValueType>::updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability,
                                                               storm::storage::sparse::state_type const& state) {
-    oneStepProbabilities[predecessor] = storm::utility::simplify(
-        (ValueType)(oneStepProbabilities[predecessor] * storm::utility::simplify((ValueType)(probability * oneStepProbabilities[state]))));
+    oneStepProbabilities[predecessor] =
+        this->arithmetic->multiply(oneStepProbabilities[predecessor], this->arithmetic->multiply(probability, oneStepProbabilities[state]));
 }
 
 template<typename ValueType>
@@ -0,0 +1,105 @@
+#include "storm/solver/stateelimination/EliminationArithmetic.h"
+
+#include "storm/utility/constants.h"
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+template<typename ValueType>
+ValueType EliminationArithmetic<ValueType>::multiply(ValueType const& first, ValueType const& second) {
+    return storm::utility::simplify((ValueType)(first * second));
+}
+
+template<typename ValueType>
+ValueType EliminationArithmetic<ValueType>::add(ValueType const& first, ValueType const& second) {
+    return storm::utility::simplify((ValueType)(first + second));
+}
+
+template<typename ValueType>
+ValueType EliminationArithmetic<ValueType>::inverseOneMinus(ValueType const& value) {
+    return storm::utility::simplify((ValueType)(storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - value)));
+}
+
+template class EliminationArithmetic<double>;
+
+#ifdef STORM_HAVE_CARL
+template class EliminationArithmetic<storm::RationalNumber>;
+
+EliminationArithmetic<storm::RationalFunction>::EliminationArithmetic(uint64_t capacity) : capacity(capacity), hits(0), misses(0) {
+    // Intentionally left empty.
+}
+
+std::size_t EliminationArithmetic<storm::RationalFunction>::OperandPairHash::operator()(OperandPair const& operands) const {
+    std::size_t seed = std::hash<storm::RationalFunction>()(operands.first);
+    seed ^= std::hash<storm::RationalFunction>()(operands.second) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+}
+
+EliminationArithmetic<storm::RationalFunction>::OperandPair EliminationArithmetic<storm::RationalFunction>::makeCommutativeKey(
+    storm::RationalFunction const& first, storm::RationalFunction const& second) {
+    if (std::hash<storm::RationalFunction>()(second) < std::hash<storm::RationalFunction>()(first)) {
+        return OperandPair(second, first);
+    }
+    return OperandPair(first, second);
+}
+
+template<typename KeyType, typename HashType, typename OperationType>
+storm::RationalFunction EliminationArithmetic<storm::RationalFunction>::lookupOrCompute(MemoTable<KeyType, HashType>& table, KeyType const& key,
+                                                                                         OperationType const& operation) {
+    storm::RationalFunction result;
+    if (table.if_contains(key, [&result](storm::RationalFunction const& value) { result = value; })) {
+        ++hits;
+        return result;
+    }
+    ++misses;
+    result = operation();
+    if (table.size() >= capacity) {
+        // Concurrent callers may insert a few entries while the table is cleared, which is harmless.
+        table.clear();
+    }
+    table.emplace(key, result);
+    return result;
+}
+
+storm::RationalFunction EliminationArithmetic<storm::RationalFunction>::multiply(storm::RationalFunction const& first,
+                                                                                 storm::RationalFunction const& second) {
+    // Products with constants are cheap and would only pollute the table.
+    if (first.isConstant() || second.isConstant()) {
+        return storm::utility::simplify((storm::RationalFunction)(first * second));
+    }
+    return lookupOrCompute(products, makeCommutativeKey(first, second),
+                           [&first, &second]() { return storm::utility::simplify((storm::RationalFunction)(first * second)); });
+}
+
+storm::RationalFunction EliminationArithmetic<storm::RationalFunction>::add(storm::RationalFunction const& first, storm::RationalFunction const& second) {
+    if (first.isConstant() || second.isConstant()) {
+        return storm::utility::simplify((storm::RationalFunction)(first + second));
+    }
+    return lookupOrCompute(sums, makeCommutativeKey(first, second),
+                           [&first, &second]() { return storm::utility::simplify((storm::RationalFunction)(first + second)); });
+}
+
+storm::RationalFunction EliminationArithmetic<storm::RationalFunction>::inverseOneMinus(storm::RationalFunction const& value) {
+    auto operation = [&value]() {
+        return storm::utility::simplify(
+            (storm::RationalFunction)(storm::utility::one<storm::RationalFunction>() / (storm::utility::one<storm::RationalFunction>() - value)));
+    };
+    if (value.isConstant()) {
+        return operation();
+    }
+    return lookupOrCompute(inverses, value, operation);
+}
+
+uint64_t EliminationArithmetic<storm::RationalFunction>::getNumberOfHits() const {
+    return hits;
+}
+
+uint64_t EliminationArithmetic<storm::RationalFunction>::getNumberOfMisses() const {
+    return misses;
+}
+#endif
+
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
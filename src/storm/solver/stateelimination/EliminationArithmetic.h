@@ -0,0 +1,75 @@
+#pragma once
+
+#include <atomic>
+#include <mutex>
+
+#include <parallel_hashmap/phmap.h>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+
+namespace storm {
+namespace solver {
+namespace stateelimination {
+
+/*!
+ * Performs the arithmetic of state elimination, i.e., it computes simplified products and sums and the factors 1/(1-p) with which the
+ * successors of a state with self-loop probability p are scaled. All methods may be called concurrently.
+ */
+template<typename ValueType>
+class EliminationArithmetic {
+   public:
+    ValueType multiply(ValueType const& first, ValueType const& second);
+    ValueType add(ValueType const& first, ValueType const& second);
+    ValueType inverseOneMinus(ValueType const& value);
+};
+
+#ifdef STORM_HAVE_CARL
+/*!
+ * For rational functions, every operation involves GCD computations to keep the functions normalized. As eliminating states repeatedly
+ * combines the same operands (e.g. a self-loop probability that is scaled into every predecessor), the results of all operations on
+ * non-constant functions are memoized. The memo tables are flushed once they hold the given number of results.
+ */
+template<>
+class EliminationArithmetic<storm::RationalFunction> {
+   public:
+    explicit EliminationArithmetic(uint64_t capacity = 1ull << 18);
+
+    storm::RationalFunction multiply(storm::RationalFunction const& first, storm::RationalFunction const& second);
+    storm::RationalFunction add(storm::RationalFunction const& first, storm::RationalFunction const& second);
+    storm::RationalFunction inverseOneMinus(storm::RationalFunction const& value);
+
+    uint64_t getNumberOfHits() const;
+    uint64_t getNumberOfMisses() const;
+
+   private:
+    typedef std::pair<storm::RationalFunction, storm::RationalFunction> OperandPair;
+
+    struct OperandPairHash {
+        std::size_t operator()(OperandPair const& operands) const;
+    };
+
+    template<typename KeyType, typename HashType>
+    using MemoTable = phmap::parallel_flat_hash_map<KeyType, storm::RationalFunction, HashType, std::equal_to<KeyType>,
+                                                    std::allocator<std::pair<KeyType const, storm::RationalFunction>>, 4, std::mutex>;
+
+    /*!
+     * Orders the operands of a commutative operation such that both orders share one memo entry.
+     */
+    static OperandPair makeCommutativeKey(storm::RationalFunction const& first, storm::RationalFunction const& second);
+
+    template<typename KeyType, typename HashType, typename OperationType>
+    storm::RationalFunction lookupOrCompute(MemoTable<KeyType, HashType>& table, KeyType const& key, OperationType const& operation);
+
+    uint64_t capacity;
+    MemoTable<OperandPair, OperandPairHash> products;
+    MemoTable<OperandPair, OperandPairHash> sums;
+    MemoTable<storm::RationalFunction, std::hash<storm::RationalFunction>> inverses;
+
+    std::atomic<uint64_t> hits;
+    std::atomic<uint64_t> misses;
+};
+#endif
+
+}  // namespace stateelimination
+}  // namespace solver
+}  // namespace storm
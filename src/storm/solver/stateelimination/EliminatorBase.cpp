@@ -15,7 +15,7 @@ using namespace storm::utility::stateelimination;
 template<typename ValueType, ScalingMode Mode>
 EliminatorBase<ValueType, Mode>::EliminatorBase(storm::storage::FlexibleSparseMatrix<ValueType>& matrix,
                                                 storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix)
-    : matrix(matrix), transposedMatrix(transposedMatrix) {
+    : matrix(matrix), transposedMatrix(transposedMatrix), arithmetic(std::make_shared<EliminationArithmetic<ValueType>>()) {
     // Intentionally left empty.
 }
 
@@ -52,8 +52,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         if (hasEntryInColumn) {
             STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(),
                              "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
-            columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-            columnValue = storm::utility::simplify(columnValue);
+            columnValue = arithmetic->inverseOneMinus(columnValue);
         }
     }
 
@@ -61,7 +60,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Only scale the entries in a different column.
             if (entryIt->getColumn() != column) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(arithmetic->multiply(entryIt->getValue(), columnValue));
             }
         }
         updateValue(row, columnValue);
@@ -150,7 +149,9 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 break;
             }
             if (first2->getColumn() < first1->getColumn()) {
-                auto successorEntry = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                auto successorEntry = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
+                                                                  typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(
+                    first2->getColumn(), arithmetic->multiply(first2->getValue(), multiplyFactor));
                 *result = successorEntry;
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, successorEntry.getValue());
                 ++first2;
@@ -159,9 +160,7 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
                 *result = *first1;
                 ++first1;
             } else {
-                ValueType sprod = multiplyFactor * first2->getValue();
-                ValueType sum = first1->getValue() + storm::utility::simplify(sprod);
-                auto probability = storm::utility::simplify(sum);
+                ValueType probability = arithmetic->add(first1->getValue(), arithmetic->multiply(multiplyFactor, first2->getValue()));
                 *result = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
                                                       typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(first1->getColumn(), probability);
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, probability);
@@ -172,7 +171,9 @@ void EliminatorBase<ValueType, Mode>::eliminate(uint64_t row, uint64_t column, b
         }
         for (; first2 != last2; ++first2) {
             if (first2->getColumn() != column) {
-                auto stateProbability = storm::utility::simplify(std::move(*first2 * multiplyFactor));
+                auto stateProbability = storm::storage::MatrixEntry<typename storm::storage::FlexibleSparseMatrix<ValueType>::index_type,
+                                                                    typename storm::storage::FlexibleSparseMatrix<ValueType>::value_type>(
+                    first2->getColumn(), arithmetic->multiply(first2->getValue(), multiplyFactor));
                 *result = stateProbability;
                 newBackwardEntries[successorOffsetInNewBackwardTransitions].emplace_back(predecessor, stateProbability.getValue());
                 ++successorOffsetInNewBackwardTransitions;
@@ -302,8 +303,7 @@ void EliminatorBase<ValueType, Mode>::eliminateLoop(uint64_t state) {
         if (hasEntryInColumn) {
             STORM_LOG_ASSERT(columnValue != storm::utility::one<ValueType>(),
                              "The scaling mode 'divide-one-minus' requires a non-one value in the given column.");
-            columnValue = storm::utility::one<ValueType>() / (storm::utility::one<ValueType>() - columnValue);
-            columnValue = storm::utility::simplify(columnValue);
+            columnValue = arithmetic->inverseOneMinus(columnValue);
         }
     }
 
@@ -311,7 +311,7 @@ void EliminatorBase<ValueType, Mode>::eliminateLoop(uint64_t state) {
         for (auto entryIt = entriesInRow.begin(), entryIte = entriesInRow.end(); entryIt != entryIte; ++entryIt) {
             // Scale the entries in a different column, set state transition probability to 0.
             if (entryIt->getColumn() != state) {
-                entryIt->setValue(storm::utility::simplify((ValueType)(entryIt->getValue() * columnValue)));
+                entryIt->setValue(arithmetic->multiply(entryIt->getValue(), columnValue));
             } else {
                 entryIt->setValue(storm::utility::zero<ValueType>());
             }
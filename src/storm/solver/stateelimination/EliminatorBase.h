@@ -1,7 +1,10 @@
 #pragma once
 
+#include <memory>
+
 #include "storm/storage/sparse/StateType.h"
 
+#include "storm/solver/stateelimination/EliminationArithmetic.h"
 #include "storm/storage/FlexibleSparseMatrix.h"
 
 namespace storm {
@@ -34,6 +37,9 @@ class EliminatorBase {
    protected:
     storm::storage::FlexibleSparseMatrix<ValueType>& matrix;
     storm::storage::FlexibleSparseMatrix<ValueType>& transposedMatrix;
+
+    // Performs (and possibly memoizes) the arithmetic operations of the elimination.
+    std::shared_ptr<EliminationArithmetic<ValueType>> arithmetic;
 };
 
 }  // namespace stateelimination
@@ -23,14 +23,13 @@ NondeterministicModelStateEliminator<ValueType>::NondeterministicModelStateElimi
 
 template<typename ValueType>
 void NondeterministicModelStateEliminator<ValueType>::updateValue(storm::storage::sparse::state_type const& row, ValueType const& loopProbability) {
-    rowValues[row] = storm::utility::simplify((ValueType)(loopProbability * rowValues[row]));
+    rowValues[row] = this->arithmetic->multiply(loopProbability, rowValues[row]);
 }
 
 template<typename ValueType>
 void NondeterministicModelStateEliminator<ValueType>::updatePredecessor(storm::storage::sparse::state_type const& predecessorRow, ValueType const& probability,
                                                                         storm::storage::sparse::state_type const& row) {
-    rowValues[predecessorRow] =
-        storm::utility::simplify((ValueType)(rowValues[predecessorRow] + storm::utility::simplify((ValueType)(probability * rowValues[row]))));
+    rowValues[predecessorRow] = this->arithmetic->add(rowValues[predecessorRow], this->arithmetic->multiply(probability, rowValues[row]));
 }
 
 template class NondeterministicModelStateEliminator<double>;
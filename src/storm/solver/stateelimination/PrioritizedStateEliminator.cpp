@@ -1,9 +1,15 @@
 #include "storm/solver/stateelimination/PrioritizedStateEliminator.h"
 
+#include <algorithm>
+
 #include "storm/solver/stateelimination/StatePriorityQueue.h"
 
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/storage/BitVector.h"
+#include "storm/utility/NumberTraits.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 #include "StaticStatePriorityQueue.h"
 
@@ -22,36 +28,149 @@ template<typename ValueType>
 PrioritizedStateEliminator<ValueType>::PrioritizedStateEliminator(storm::storage::FlexibleSparseMatrix<ValueType>& transitionMatrix,
                                                                   storm::storage::FlexibleSparseMatrix<ValueType>& backwardTransitions,
                                                                   PriorityQueuePointer priorityQueue, std::vector<ValueType>& stateValues)
-    : StateEliminator<ValueType>(transitionMatrix, backwardTransitions), priorityQueue(priorityQueue), stateValues(stateValues) {}
+    : StateEliminator<ValueType>(transitionMatrix, backwardTransitions), priorityQueue(priorityQueue), stateValues(stateValues), deferPriorityUpdates(false) {}
 
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::updateValue(storm::storage::sparse::state_type const& state, ValueType const& loopProbability) {
-    stateValues[state] = storm::utility::simplify((ValueType)(loopProbability * stateValues[state]));
+    stateValues[state] = this->arithmetic->multiply(loopProbability, stateValues[state]);
 }
 
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::updatePredecessor(storm::storage::sparse::state_type const& predecessor, ValueType const& probability,
                                                               storm::storage::sparse::state_type const& state) {
-    stateValues[predecessor] =
-        storm::utility::simplify((ValueType)(stateValues[predecessor] + storm::utility::simplify((ValueType)(probability * stateValues[state]))));
+    stateValues[predecessor] = this->arithmetic->add(stateValues[predecessor], this->arithmetic->multiply(probability, stateValues[state]));
 }
 
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::updatePriority(storm::storage::sparse::state_type const& state) {
-    priorityQueue->update(state);
+    if (!deferPriorityUpdates) {
+        priorityQueue->update(state);
+    }
 }
 
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::eliminateAll(bool removeForwardTransitions) {
+    eliminateAll([removeForwardTransitions](storm::storage::sparse::state_type const&) { return removeForwardTransitions; });
+}
+
+template<typename ValueType>
+void PrioritizedStateEliminator<ValueType>::eliminateAll(
+    std::function<bool(storm::storage::sparse::state_type const&)> const& removeForwardTransitions) {
+    if (isParallelEliminationEnabled()) {
+        eliminateAllInParallel(removeForwardTransitions);
+        return;
+    }
+
     while (priorityQueue->hasNext()) {
         storm::storage::sparse::state_type state = priorityQueue->pop();
-        this->eliminateState(state, removeForwardTransitions);
-        if (removeForwardTransitions) {
+        bool removeForward = removeForwardTransitions(state);
+        this->eliminateState(state, removeForward);
+        if (removeForward) {
             clearStateValues(state);
         }
     }
 }
 
+template<typename ValueType>
+bool PrioritizedStateEliminator<ValueType>::isParallelEliminationEnabled() const {
+#ifdef STORM_HAVE_INTELTBB
+    // For inexact types, the result would depend on the (nondeterministic) order in which the batches are processed.
+    return storm::NumberTraits<ValueType>::IsExact && this->matrix.hasTrivialRowGrouping() && storm::utility::parallel::isIntelTbbEnabled();
+#else
+    return false;
+#endif
+}
+
+template<typename ValueType>
+void PrioritizedStateEliminator<ValueType>::eliminateAllInParallel(
+    std::function<bool(storm::storage::sparse::state_type const&)> const& removeForwardTransitions) {
+#ifdef STORM_HAVE_INTELTBB
+    // Eliminating a state modifies the forward transitions of the state and its predecessors and the backward transitions of the state and its
+    // successors. Hence, states whose neighborhoods (the state itself, its predecessors and its successors) are disjoint can be eliminated
+    // concurrently. We greedily select such states from a window at the front of the queue, whose size scales with the number of TBB threads.
+    uint64_t const windowSize = std::max<uint64_t>(8, 4 * storm::utility::parallel::getNumberOfThreads());
+    std::vector<storm::storage::sparse::state_type> window;
+    std::vector<storm::storage::sparse::state_type> deferredStates;
+    std::vector<storm::storage::sparse::state_type> batch;
+    std::vector<storm::storage::sparse::state_type> predecessors;
+    std::vector<uint_fast8_t> removeForwardInBatch;
+    storm::storage::BitVector touchedStates(this->matrix.getRowCount());
+    uint64_t numberOfBatches = 0;
+
+    deferPriorityUpdates = true;
+    while (!window.empty() || priorityQueue->hasNext()) {
+        while (window.size() < windowSize && priorityQueue->hasNext()) {
+            window.push_back(priorityQueue->pop());
+        }
+
+        batch.clear();
+        deferredStates.clear();
+        for (auto const& state : window) {
+            auto const& forwardRow = this->matrix.getRow(state);
+            auto const& backwardRow = this->transposedMatrix.getRow(state);
+            auto isTouched = [&touchedStates](typename storm::storage::FlexibleSparseMatrix<ValueType>::row_type::value_type const& entry) {
+                return touchedStates.get(entry.getColumn());
+            };
+            if (touchedStates.get(state) || std::any_of(forwardRow.begin(), forwardRow.end(), isTouched) ||
+                std::any_of(backwardRow.begin(), backwardRow.end(), isTouched)) {
+                deferredStates.push_back(state);
+                continue;
+            }
+            touchedStates.set(state);
+            for (auto const& entry : forwardRow) {
+                touchedStates.set(entry.getColumn());
+            }
+            for (auto const& entry : backwardRow) {
+                touchedStates.set(entry.getColumn());
+            }
+            batch.push_back(state);
+        }
+
+        // Reset the marks of the batch, which is cheaper than clearing the whole bit vector.
+        for (auto const& state : batch) {
+            touchedStates.set(state, false);
+            for (auto const& entry : this->matrix.getRow(state)) {
+                touchedStates.set(entry.getColumn(), false);
+            }
+            for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                touchedStates.set(entry.getColumn(), false);
+            }
+        }
+
+        // The priorities of the predecessors change, so we remember them before eliminating the states.
+        predecessors.clear();
+        removeForwardInBatch.clear();
+        for (auto const& state : batch) {
+            for (auto const& entry : this->transposedMatrix.getRow(state)) {
+                predecessors.push_back(entry.getColumn());
+            }
+            removeForwardInBatch.push_back(removeForwardTransitions(state) ? 1 : 0);
+        }
+
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, batch.size(), 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                this->eliminateState(batch[index], removeForwardInBatch[index] != 0);
+            }
+        });
+
+        for (uint64_t index = 0; index < batch.size(); ++index) {
+            if (removeForwardInBatch[index] != 0) {
+                clearStateValues(batch[index]);
+            }
+        }
+        for (auto const& predecessor : predecessors) {
+            priorityQueue->update(predecessor);
+        }
+        window.swap(deferredStates);
+        ++numberOfBatches;
+    }
+    deferPriorityUpdates = false;
+    STORM_LOG_DEBUG("Eliminated states in " << numberOfBatches << " parallel batches.");
+#else
+    STORM_LOG_ASSERT(false, "Parallel state elimination requires Intel TBB.");
+#endif
+}
+
 template<typename ValueType>
 void PrioritizedStateEliminator<ValueType>::clearStateValues(storm::storage::sparse::state_type const& state) {
     stateValues[state] = storm::utility::zero<ValueType>();
@@ -1,6 +1,8 @@
 #ifndef STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 #define STORM_SOLVER_STATEELIMINATION_PRIORITIZEDSTATEELIMINATOR_H_
 
+#include <functional>
+
 #include "storm/solver/stateelimination/StateEliminator.h"
 
 namespace storm {
@@ -28,11 +30,26 @@ class PrioritizedStateEliminator : public StateEliminator<ValueType> {
     virtual void updatePriority(storm::storage::sparse::state_type const& state) override;
 
     virtual void eliminateAll(bool eliminateForwardTransitions = true);
+
+    /*!
+     * Eliminates all states of the priority queue, where the given function decides for each state whether its forward transitions are
+     * removed. For exact value types, states with disjoint neighborhoods are eliminated in parallel if Intel TBB is enabled. These states
+     * are taken from a small window at the front of the queue, so the elimination order may deviate slightly from the priority order.
+     */
+    void eliminateAll(std::function<bool(storm::storage::sparse::state_type const&)> const& removeForwardTransitions);
+
     virtual void clearStateValues(storm::storage::sparse::state_type const& state);
 
    protected:
     PriorityQueuePointer priorityQueue;
     std::vector<ValueType>& stateValues;
+
+   private:
+    bool isParallelEliminationEnabled() const;
+    void eliminateAllInParallel(std::function<bool(storm::storage::sparse::state_type const&)> const& removeForwardTransitions);
+
+    // If set, priority updates are postponed until the current batch of states has been eliminated.
+    bool deferPriorityUpdates;
 };
 
 }  // namespace stateelimination
@@ -6,6 +6,7 @@
 
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
+#include "storm/storage/dd/FlatOdd.h"
 #include "storm/storage/dd/Odd.h"
 
 #include "storm/storage/BitVector.h"
@@ -712,8 +713,10 @@ storm::storage::SparseMatrix<ValueType> Add<LibraryType, ValueType>::toMatrix(st
     rowIndications[0] = 0;
 
     // Now actually fill the entry vector.
-    internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
-                                   true);
+    storm::dd::FlatOdd flatRowOdd(rowOdd);
+    storm::dd::FlatOdd flatColumnOdd(columnOdd);
+    internalAdd.toMatrixComponents(trivialRowGroupIndices, rowIndications, columnsAndValues, flatRowOdd, flatColumnOdd, ddRowVariableIndices,
+                                   ddColumnVariableIndices, true);
 
     // Since the last call to toMatrixRec modified the rowIndications, we need to restore the correct values.
     for (uint_fast64_t i = rowIndications.size() - 1; i > 0; --i) {
@@ -888,10 +891,12 @@ typename Add<LibraryType, ValueType>::MatrixAndLabeling Add<LibraryType, ValueTy
     rowIndications[0] = 0;
 
     // Now actually fill the entry vector.
+    storm::dd::FlatOdd flatRowOdd(rowOdd);
+    storm::dd::FlatOdd flatColumnOdd(columnOdd);
     for (uint_fast64_t i = 0; i < groups.size(); ++i) {
         auto const& group = groups[i];
 
-        group.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices,
+        group.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, flatRowOdd, flatColumnOdd, ddRowVariableIndices,
                                              ddColumnVariableIndices, true);
 
         statesWithGroupEnabled[i].composeWithExplicitVector(rowOdd, ddRowVariableIndices, rowGroupIndices, std::plus<uint_fast64_t>());
@@ -1113,11 +1118,13 @@ std::pair<storm::storage::SparseMatrix<ValueType>, std::vector<std::vector<Value
     rowIndications[0] = 0;
 
     // Now actually fill the entry vector.
+    storm::dd::FlatOdd flatRowOdd(rowOdd);
+    storm::dd::FlatOdd flatColumnOdd(columnOdd);
     for (uint_fast64_t i = 0; i < groups.size(); ++i) {
         auto const& dd = groups[i].back();
 
-        dd.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, ddRowVariableIndices, ddColumnVariableIndices,
-                                          true);
+        dd.internalAdd.toMatrixComponents(rowGroupIndices, rowIndications, columnsAndValues, flatRowOdd, flatColumnOdd, ddRowVariableIndices,
+                                          ddColumnVariableIndices, true);
         statesWithGroupEnabled[i].composeWithExplicitVector(rowOdd, ddRowVariableIndices, rowGroupIndices, std::plus<uint_fast64_t>());
     }
 
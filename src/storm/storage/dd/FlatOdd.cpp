@@ -0,0 +1,50 @@
+#include "storm/storage/dd/FlatOdd.h"
+
+#include <unordered_map>
+
+#include "storm/storage/dd/Odd.h"
+
+namespace storm {
+namespace dd {
+
+FlatOdd::FlatOdd(Odd const& odd) {
+    // Number the nodes in breadth-first order, such that the nodes of a level are adjacent in memory.
+    std::unordered_map<Odd const*, uint64_t> nodeToIndex;
+    std::vector<Odd const*> queue = {&odd};
+    nodeToIndex.emplace(&odd, 0);
+    for (uint64_t index = 0; index < queue.size(); ++index) {
+        Odd const* current = queue[index];
+        if (!current->isTerminalNode()) {
+            for (Odd const* successor : {&current->getElseSuccessor(), &current->getThenSuccessor()}) {
+                if (nodeToIndex.emplace(successor, queue.size()).second) {
+                    queue.push_back(successor);
+                }
+            }
+        }
+    }
+
+    nodes.resize(queue.size());
+    for (uint64_t index = 0; index < queue.size(); ++index) {
+        Odd const* current = queue[index];
+        Node& node = nodes[index];
+        if (current->isTerminalNode()) {
+            node.elseSuccessor = node.thenSuccessor = index;
+        } else {
+            node.elseSuccessor = nodeToIndex.at(&current->getElseSuccessor());
+            node.thenSuccessor = nodeToIndex.at(&current->getThenSuccessor());
+        }
+        node.elseOffset = current->getElseOffset();
+        node.thenOffset = current->getThenOffset();
+    }
+}
+
+uint64_t FlatOdd::getTotalOffset() const {
+    return getTotalOffset(getRoot());
+}
+
+uint64_t FlatOdd::getNodeCount() const {
+    return nodes.size();
+}
+
+}  // namespace dd
+}  // namespace storm
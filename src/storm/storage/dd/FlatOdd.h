@@ -0,0 +1,83 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace storm {
+namespace dd {
+class Odd;
+
+/*!
+ * An index-based representation of an ODD. The nodes are stored level by level in a single array and successors are referred to by their
+ * index, which avoids chasing pointers when translating DDs to explicit data structures. Nodes that are shared in the original ODD are
+ * also shared in this representation.
+ *
+ * The accessors are defined inline, as they are called for every DD node that is visited during a translation.
+ */
+class FlatOdd {
+   public:
+    /*!
+     * Flattens the given ODD.
+     *
+     * @param odd The ODD to flatten.
+     */
+    explicit FlatOdd(Odd const& odd);
+
+    /*!
+     * Retrieves the index of the root node.
+     */
+    uint64_t getRoot() const {
+        return 0;
+    }
+
+    /*!
+     * Retrieves the index of the else-successor of the given node. For terminal nodes, this is the node itself.
+     */
+    uint64_t getElseSuccessor(uint64_t node) const {
+        return nodes[node].elseSuccessor;
+    }
+
+    /*!
+     * Retrieves the index of the then-successor of the given node. For terminal nodes, this is the node itself.
+     */
+    uint64_t getThenSuccessor(uint64_t node) const {
+        return nodes[node].thenSuccessor;
+    }
+
+    /*!
+     * Retrieves the else-offset of the given node.
+     */
+    uint64_t getElseOffset(uint64_t node) const {
+        return nodes[node].elseOffset;
+    }
+
+    /*!
+     * Retrieves the total offset of the given node, i.e., the sum of the then- and else-offset.
+     */
+    uint64_t getTotalOffset(uint64_t node) const {
+        return nodes[node].elseOffset + nodes[node].thenOffset;
+    }
+
+    /*!
+     * Retrieves the total offset of the root node, i.e., the number of encoded elements.
+     */
+    uint64_t getTotalOffset() const;
+
+    /*!
+     * Retrieves the number of (distinct) nodes.
+     */
+    uint64_t getNodeCount() const;
+
+   private:
+    struct Node {
+        uint64_t elseSuccessor;
+        uint64_t thenSuccessor;
+        uint64_t elseOffset;
+        uint64_t thenOffset;
+    };
+
+    std::vector<Node> nodes;
+};
+
+}  // namespace dd
+}  // namespace storm
@@ -1,5 +1,9 @@
 #include "storm/storage/dd/cudd/InternalCuddAdd.h"
 
+#include <algorithm>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/storage/dd/FlatOdd.h"
 #include "storm/storage/dd/Odd.h"
 #include "storm/storage/dd/cudd/CuddAddIterator.h"
 #include "storm/storage/dd/cudd/InternalCuddBdd.h"
@@ -12,6 +16,7 @@
 #include "storm/exceptions/NotSupportedException.h"
 #include "storm/utility/constants.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 
 namespace storm {
 namespace dd {
@@ -727,26 +732,69 @@ void InternalAdd<DdType::CUDD, ValueType>::splitIntoGroupsRec(std::vector<DdNode
 template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
                                                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
-                                                              Odd const& rowOdd, Odd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                              FlatOdd const& rowOdd, FlatOdd const& columnOdd,
+                                                              std::vector<uint_fast64_t> const& ddRowVariableIndices,
                                                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const {
-    return toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, columnOdd, 0, 0,
-                                 ddRowVariableIndices.size() + ddColumnVariableIndices.size(), 0, 0, ddRowVariableIndices, ddColumnVariableIndices,
-                                 writeValues);
+    uint_fast64_t maxLevel = ddRowVariableIndices.size() + ddColumnVariableIndices.size();
+    bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+    parallelize = !ddRowVariableIndices.empty() && storm::utility::parallel::isIntelTbbEnabled();
+    if (parallelize) {
+        // Split the DD at the topmost row variables. Parts with the same row offset cover the same rows and are processed in their original order,
+        // which keeps the entries of each row sorted. Parts with different row offsets write to disjoint rows and are processed concurrently.
+        // The DD is only read, so no synchronization with CUDD is needed.
+        std::vector<MatrixComponentsTask> tasks;
+        uint_fast64_t splitLevel = std::min<uint_fast64_t>(6, ddRowVariableIndices.size());
+        toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, rowOdd.getRoot(), columnOdd,
+                              columnOdd.getRoot(), 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues, &tasks, splitLevel);
+        std::stable_sort(tasks.begin(), tasks.end(),
+                         [](MatrixComponentsTask const& a, MatrixComponentsTask const& b) { return a.currentRowOffset < b.currentRowOffset; });
+        std::vector<uint64_t> rowBlockStarts;
+        for (uint64_t task = 0; task < tasks.size(); ++task) {
+            if (task == 0 || tasks[task].currentRowOffset != tasks[task - 1].currentRowOffset) {
+                rowBlockStarts.push_back(task);
+            }
+        }
+        rowBlockStarts.push_back(tasks.size());
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, rowBlockStarts.size() - 1, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t rowBlock = range.begin(); rowBlock < range.end(); ++rowBlock) {
+                for (uint64_t taskIndex = rowBlockStarts[rowBlock]; taskIndex < rowBlockStarts[rowBlock + 1]; ++taskIndex) {
+                    MatrixComponentsTask const& task = tasks[taskIndex];
+                    toMatrixComponentsRec(task.dd, rowGroupIndices, rowIndications, columnsAndValues, rowOdd, task.rowOddNode, columnOdd, task.columnOddNode,
+                                          task.currentLevel, task.currentLevel, maxLevel, task.currentRowOffset, task.currentColumnOffset,
+                                          ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+                }
+            }
+        });
+    }
+#endif
+    if (!parallelize) {
+        toMatrixComponentsRec(this->getCuddDdNode(), rowGroupIndices, rowIndications, columnsAndValues, rowOdd, rowOdd.getRoot(), columnOdd,
+                              columnOdd.getRoot(), 0, 0, maxLevel, 0, 0, ddRowVariableIndices, ddColumnVariableIndices, writeValues);
+    }
 }
 
 template<typename ValueType>
 void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets,
                                                                  std::vector<uint_fast64_t>& rowIndications,
                                                                  std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues,
-                                                                 Odd const& rowOdd, Odd const& columnOdd, uint_fast64_t currentRowLevel,
-                                                                 uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
-                                                                 uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues) const {
+                                                                 FlatOdd const& rowOdd, uint_fast64_t rowOddNode, FlatOdd const& columnOdd,
+                                                                 uint_fast64_t columnOddNode, uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel,
+                                                                 uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                                                                 std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                                                                 std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool generateValues,
+                                                                 std::vector<MatrixComponentsTask>* tasks, uint_fast64_t splitLevel) const {
     // For the empty DD, we do not need to add any entries.
     if (dd == Cudd_ReadZero(ddManager->getCuddManager().getManager())) {
         return;
     }
 
+    // If the recursion is to be split, we store the remaining work as a task.
+    if (tasks && currentRowLevel == splitLevel) {
+        tasks->push_back(MatrixComponentsTask{dd, rowOddNode, columnOddNode, currentRowLevel, currentRowOffset, currentColumnOffset});
+        return;
+    }
+
     // If we are at the maximal level, the value to be set is stored as a constant in the DD.
     if (currentRowLevel + currentColumnLevel == maxLevel) {
         if (generateValues) {
@@ -783,22 +831,29 @@ void InternalAdd<DdType::CUDD, ValueType>::toMatrixComponentsRec(DdNode const* d
             }
         }
 
+        uint_fast64_t rowElseNode = rowOdd.getElseSuccessor(rowOddNode);
+        uint_fast64_t rowThenNode = rowOdd.getThenSuccessor(rowOddNode);
+        uint_fast64_t columnElseNode = columnOdd.getElseSuccessor(columnOddNode);
+        uint_fast64_t columnThenNode = columnOdd.getThenSuccessor(columnOddNode);
+        uint_fast64_t rowElseOffset = rowOdd.getElseOffset(rowOddNode);
+        uint_fast64_t columnElseOffset = columnOdd.getElseOffset(columnOddNode);
+
         // Visit else-else.
-        toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getElseSuccessor(),
-                              currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices,
-                              ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(elseElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowElseNode, columnOdd, columnElseNode, currentRowLevel + 1,
+                              currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset, ddRowVariableIndices, ddColumnVariableIndices,
+                              generateValues, tasks, splitLevel);
         // Visit else-then.
-        toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getElseSuccessor(), columnOdd.getThenSuccessor(),
-                              currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnOdd.getElseOffset(),
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(elseThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowElseNode, columnOdd, columnThenNode, currentRowLevel + 1,
+                              currentColumnLevel + 1, maxLevel, currentRowOffset, currentColumnOffset + columnElseOffset, ddRowVariableIndices,
+                              ddColumnVariableIndices, generateValues, tasks, splitLevel);
         // Visit then-else.
-        toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getElseSuccessor(),
-                              currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(), currentColumnOffset,
-                              ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(thenElse, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowThenNode, columnOdd, columnElseNode, currentRowLevel + 1,
+                              currentColumnLevel + 1, maxLevel, currentRowOffset + rowElseOffset, currentColumnOffset, ddRowVariableIndices,
+                              ddColumnVariableIndices, generateValues, tasks, splitLevel);
         // Visit then-then.
-        toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd.getThenSuccessor(), columnOdd.getThenSuccessor(),
-                              currentRowLevel + 1, currentColumnLevel + 1, maxLevel, currentRowOffset + rowOdd.getElseOffset(),
-                              currentColumnOffset + columnOdd.getElseOffset(), ddRowVariableIndices, ddColumnVariableIndices, generateValues);
+        toMatrixComponentsRec(thenThen, rowGroupOffsets, rowIndications, columnsAndValues, rowOdd, rowThenNode, columnOdd, columnThenNode, currentRowLevel + 1,
+                              currentColumnLevel + 1, maxLevel, currentRowOffset + rowElseOffset, currentColumnOffset + columnElseOffset,
+                              ddRowVariableIndices, ddColumnVariableIndices, generateValues, tasks, splitLevel);
     }
 }
 
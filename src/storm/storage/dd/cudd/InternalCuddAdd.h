@@ -9,6 +9,7 @@
 #include "storm/adapters/RationalNumberAdapter.h"
 
 #include "storm/storage/dd/DdType.h"
+#include "storm/storage/dd/FlatOdd.h"
 #include "storm/storage/dd/InternalAdd.h"
 #include "storm/storage/dd/Odd.h"
 
@@ -646,9 +647,9 @@ class InternalAdd<DdType::CUDD, ValueType> {
      * only the row indications are modified.
      */
     void toMatrixComponents(std::vector<uint_fast64_t> const& rowGroupIndices, std::vector<uint_fast64_t>& rowIndications,
-                            std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
-                            std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
-                            bool writeValues) const;
+                            std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, FlatOdd const& rowOdd,
+                            FlatOdd const& columnOdd, std::vector<uint_fast64_t> const& ddRowVariableIndices,
+                            std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
 
     /*!
      * Creates an ADD from the given explicit vector.
@@ -690,6 +691,18 @@ class InternalAdd<DdType::CUDD, ValueType> {
     std::string getStringId() const;
 
    private:
+    /*!
+     * A part of the translation of the DD into matrix components. Parts with different row offsets refer to disjoint sets of rows.
+     */
+    struct MatrixComponentsTask {
+        DdNode const* dd;
+        uint_fast64_t rowOddNode;
+        uint_fast64_t columnOddNode;
+        uint_fast64_t currentLevel;
+        uint_fast64_t currentRowOffset;
+        uint_fast64_t currentColumnOffset;
+    };
+
     /*!
      * Performs a recursive step for forEach.
      *
@@ -775,7 +788,9 @@ class InternalAdd<DdType::CUDD, ValueType> {
      * completion.
      * @param rowGroupOffsets The row offsets at which a given row group starts.
      * @param rowOdd The ODD used for the row translation.
+     * @param rowOddNode The current node in the row ODD.
      * @param columnOdd The ODD used for the column translation.
+     * @param columnOddNode The current node in the column ODD.
      * @param currentRowLevel The currently considered row level in the DD.
      * @param currentColumnLevel The currently considered row level in the DD.
      * @param maxLevel The number of levels that need to be considered.
@@ -786,12 +801,15 @@ class InternalAdd<DdType::CUDD, ValueType> {
      * @param generateValues If set to true, the vector columnsAndValues is filled with the actual entries, which
      * only works if the offsets given in rowIndications are already correct. If they need to be computed first,
      * this flag needs to be false.
+     * @param tasks If given, the recursion stops at the given split level and the remaining parts of the translation are stored in this vector.
+     * @param splitLevel The row level at which the recursion is split into tasks.
      */
     void toMatrixComponentsRec(DdNode const* dd, std::vector<uint_fast64_t> const& rowGroupOffsets, std::vector<uint_fast64_t>& rowIndications,
-                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, Odd const& rowOdd, Odd const& columnOdd,
-                               uint_fast64_t currentRowLevel, uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset,
-                               uint_fast64_t currentColumnOffset, std::vector<uint_fast64_t> const& ddRowVariableIndices,
-                               std::vector<uint_fast64_t> const& ddColumnVariableIndices, bool writeValues) const;
+                               std::vector<storm::storage::MatrixEntry<uint_fast64_t, ValueType>>& columnsAndValues, FlatOdd const& rowOdd,
+                               uint_fast64_t rowOddNode, FlatOdd const& columnOdd, uint_fast64_t columnOddNode, uint_fast64_t currentRowLevel,
+                               uint_fast64_t currentColumnLevel, uint_fast64_t maxLevel, uint_fast64_t currentRowOffset, uint_fast64_t currentColumnOffset,
+                               std::vector<uint_fast64_t> const& ddRowVariableIndices, std::vector<uint_fast64_t> const& ddColumnVariableIndices,
+                               bool writeValues, std::vector<MatrixComponentsTask>* tasks = nullptr, uint_fast64_t splitLevel = 0) const;
 
     /*!
      * Builds an ADD representing the given vector.
@@ -0,0 +1,147 @@
+#include "storm/storage/sparse/QualitativeAnalysisCache.h"
+
+#include <tuple>
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/utility/graph.h"
+#include "storm/utility/macros.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+template<typename ValueType>
+bool QualitativeAnalysisCache<ValueType>::Key::operator<(Key const& other) const {
+    return std::tie(kind, phiStates, psiStates) < std::tie(other.kind, other.phiStates, other.psiStates);
+}
+
+template<typename ValueType>
+std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> QualitativeAnalysisCache<ValueType>::getBackwardTransitions(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (backwardTransitions) {
+        ++backwardTransitionsHits;
+    } else {
+        backwardTransitions = std::make_shared<storm::storage::SparseMatrix<ValueType> const>(transitionMatrix.transpose(true));
+    }
+    STORM_LOG_ASSERT(backwardTransitions->getColumnCount() == transitionMatrix.getRowGroupCount(),
+                     "Cached backward transitions do not match the given transition matrix.");
+    return backwardTransitions;
+}
+
+template<typename ValueType>
+template<typename ComputeFunction>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> QualitativeAnalysisCache<ValueType>::getOrCompute(Key&& key,
+                                                                                                                 ComputeFunction const& compute) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto findRes = prob01States.find(key);
+        if (findRes != prob01States.end()) {
+            ++prob01Hits;
+            STORM_LOG_DEBUG("Reusing cached prob0/prob1 states.");
+            return findRes->second;
+        }
+    }
+    // The analysis is done without holding the lock. If two threads compute the same result concurrently, both results are equal.
+    auto result = compute();
+    std::lock_guard<std::mutex> lock(mutex);
+    ++prob01Misses;
+    prob01States.emplace(std::move(key), result);
+    return result;
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> QualitativeAnalysisCache<ValueType>::performProb01(
+    storm::storage::SparseMatrix<ValueType> const& backwardTransitions, storm::storage::BitVector const& phiStates,
+    storm::storage::BitVector const& psiStates) {
+    return getOrCompute(Key{AnalysisKind::Deterministic, phiStates, psiStates},
+                        [&]() { return storm::utility::graph::performProb01(backwardTransitions, phiStates, psiStates); });
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> QualitativeAnalysisCache<ValueType>::performProb01Max(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    return getOrCompute(Key{AnalysisKind::Maximize, phiStates, psiStates}, [&]() {
+        return storm::utility::graph::performProb01Max(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    });
+}
+
+template<typename ValueType>
+std::pair<storm::storage::BitVector, storm::storage::BitVector> QualitativeAnalysisCache<ValueType>::performProb01Min(
+    storm::storage::SparseMatrix<ValueType> const& transitionMatrix, storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+    storm::storage::BitVector const& phiStates, storm::storage::BitVector const& psiStates) {
+    return getOrCompute(Key{AnalysisKind::Minimize, phiStates, psiStates}, [&]() {
+        return storm::utility::graph::performProb01Min(transitionMatrix, transitionMatrix.getRowGroupIndices(), backwardTransitions, phiStates, psiStates);
+    });
+}
+
+template<typename ValueType>
+uint64_t QualitativeAnalysisCache<ValueType>::getNumberOfHits() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return backwardTransitionsHits + prob01Hits;
+}
+
+template<typename ValueType>
+uint64_t QualitativeAnalysisCache<ValueType>::getNumberOfMisses() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return (backwardTransitions ? 1 : 0) + prob01Misses;
+}
+
+template<typename ValueType>
+void QualitativeAnalysisCache<ValueType>::printStatistics(std::ostream& out) const {
+    std::lock_guard<std::mutex> lock(mutex);
+    out << "Qualitative analysis cache:\n";
+    out << "  backward transitions: " << (backwardTransitions ? 1 : 0) << " computed, " << backwardTransitionsHits << " reused\n";
+    out << "  prob0/prob1 state sets: " << prob01Misses << " computed, " << prob01Hits << " reused (" << prob01States.size() << " stored)\n";
+}
+
+template<typename ValueType>
+QualitativeAnalysisCacheHolder<ValueType>::QualitativeAnalysisCacheHolder(QualitativeAnalysisCacheHolder const& other) {
+    if (other.cache) {
+        enable();
+    }
+}
+
+template<typename ValueType>
+QualitativeAnalysisCacheHolder<ValueType>& QualitativeAnalysisCacheHolder<ValueType>::operator=(QualitativeAnalysisCacheHolder const& other) {
+    if (this != &other) {
+        cache.reset();
+        if (other.cache) {
+            enable();
+        }
+    }
+    return *this;
+}
+
+template<typename ValueType>
+void QualitativeAnalysisCacheHolder<ValueType>::enable() {
+    if (!cache) {
+        cache = std::make_shared<QualitativeAnalysisCache<ValueType>>();
+    }
+}
+
+template<typename ValueType>
+void QualitativeAnalysisCacheHolder<ValueType>::clear() {
+    if (cache) {
+        cache = std::make_shared<QualitativeAnalysisCache<ValueType>>();
+    }
+}
+
+template<typename ValueType>
+std::shared_ptr<QualitativeAnalysisCache<ValueType>> const& QualitativeAnalysisCacheHolder<ValueType>::get() const {
+    return cache;
+}
+
+template class QualitativeAnalysisCache<double>;
+template class QualitativeAnalysisCacheHolder<double>;
+#ifdef STORM_HAVE_CARL
+template class QualitativeAnalysisCache<storm::RationalNumber>;
+template class QualitativeAnalysisCache<storm::RationalFunction>;
+template class QualitativeAnalysisCacheHolder<storm::RationalNumber>;
+template class QualitativeAnalysisCacheHolder<storm::RationalFunction>;
+#endif
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
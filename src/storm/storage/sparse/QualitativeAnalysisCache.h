@@ -0,0 +1,134 @@
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <utility>
+
+#include "storm/storage/BitVector.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace storm {
+namespace storage {
+namespace sparse {
+
+/*!
+ * Caches the results of qualitative (graph-based) analyses on the transition matrix of a single sparse model such that they can be reused by all
+ * properties that are checked on this model. This covers the backward transitions and the prob0/prob1 state sets of until formulas.
+ * The prob0/prob1 state sets are keyed by the phi and psi states and by the kind of the analysis (deterministic, minimizing, maximizing).
+ *
+ * The cache does not store the transition matrix itself. Callers need to make sure that all queries are posed for the same transition matrix.
+ * All functions may be called concurrently.
+ */
+template<typename ValueType>
+class QualitativeAnalysisCache {
+   public:
+    QualitativeAnalysisCache() = default;
+
+    /*!
+     * Retrieves the backward transitions of the given transition matrix, which are only computed upon the first call.
+     */
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> getBackwardTransitions(storm::storage::SparseMatrix<ValueType> const& transitionMatrix);
+
+    /*!
+     * Retrieves the states with probability 0 and 1 of satisfying phi until psi in a deterministic model.
+     * Behaves like storm::utility::graph::performProb01.
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01(storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                 storm::storage::BitVector const& phiStates,
+                                                                                 storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the states with maximal probability 0 and 1 of satisfying phi until psi in a nondeterministic model.
+     * Behaves like storm::utility::graph::performProb01Max.
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Max(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                    storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                    storm::storage::BitVector const& phiStates,
+                                                                                    storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves the states with minimal probability 0 and 1 of satisfying phi until psi in a nondeterministic model.
+     * Behaves like storm::utility::graph::performProb01Min.
+     */
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> performProb01Min(storm::storage::SparseMatrix<ValueType> const& transitionMatrix,
+                                                                                    storm::storage::SparseMatrix<ValueType> const& backwardTransitions,
+                                                                                    storm::storage::BitVector const& phiStates,
+                                                                                    storm::storage::BitVector const& psiStates);
+
+    /*!
+     * Retrieves how often a cached result was reused.
+     */
+    uint64_t getNumberOfHits() const;
+
+    /*!
+     * Retrieves how often a result had to be computed.
+     */
+    uint64_t getNumberOfMisses() const;
+
+    /*!
+     * Prints the number of reused and computed results to the given stream.
+     */
+    void printStatistics(std::ostream& out) const;
+
+   private:
+    enum class AnalysisKind { Deterministic, Minimize, Maximize };
+
+    struct Key {
+        AnalysisKind kind;
+        storm::storage::BitVector phiStates;
+        storm::storage::BitVector psiStates;
+
+        bool operator<(Key const& other) const;
+    };
+
+    template<typename ComputeFunction>
+    std::pair<storm::storage::BitVector, storm::storage::BitVector> getOrCompute(Key&& key, ComputeFunction const& compute);
+
+    std::shared_ptr<storm::storage::SparseMatrix<ValueType> const> backwardTransitions;
+    std::map<Key, std::pair<storm::storage::BitVector, storm::storage::BitVector>> prob01States;
+
+    uint64_t backwardTransitionsHits = 0;
+    uint64_t prob01Hits = 0;
+    uint64_t prob01Misses = 0;
+
+    mutable std::mutex mutex;
+};
+
+/*!
+ * Holds an optional QualitativeAnalysisCache. Copying the holder does not copy the cached results: the copy holds an empty cache if and only if
+ * the original holds a cache. This way, owners of a cache can be copied with defaulted members although the copy might be modified independently.
+ */
+template<typename ValueType>
+class QualitativeAnalysisCacheHolder {
+   public:
+    QualitativeAnalysisCacheHolder() = default;
+    QualitativeAnalysisCacheHolder(QualitativeAnalysisCacheHolder const& other);
+    QualitativeAnalysisCacheHolder& operator=(QualitativeAnalysisCacheHolder const& other);
+    QualitativeAnalysisCacheHolder(QualitativeAnalysisCacheHolder&& other) = default;
+    QualitativeAnalysisCacheHolder& operator=(QualitativeAnalysisCacheHolder&& other) = default;
+
+    /*!
+     * Creates an empty cache unless a cache is already held.
+     */
+    void enable();
+
+    /*!
+     * Replaces the held cache (if any) by an empty one.
+     */
+    void clear();
+
+    /*!
+     * Retrieves the held cache or null if there is none.
+     */
+    std::shared_ptr<QualitativeAnalysisCache<ValueType>> const& get() const;
+
+   private:
+    std::shared_ptr<QualitativeAnalysisCache<ValueType>> cache;
+};
+
+}  // namespace sparse
+}  // namespace storage
+}  // namespace storm
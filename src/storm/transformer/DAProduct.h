@@ -12,7 +12,13 @@ class DAProduct : public Product<Model> {
    public:
     typedef std::shared_ptr<DAProduct<Model>> ptr;
 
-    DAProduct(Product<Model>&& product, storm::automata::AcceptanceCondition::ptr acceptance) : Product<Model>(std::move(product)), acceptance(acceptance) {
+    DAProduct(Product<Model>&& product, storm::automata::AcceptanceCondition::ptr acceptance)
+        : Product<Model>(std::move(product)), acceptance(acceptance), unexploredStates(this->getProductModel().getNumberOfStates(), false) {
+        // Intentionally left blank
+    }
+
+    DAProduct(Product<Model>&& product, storm::automata::AcceptanceCondition::ptr acceptance, storm::storage::BitVector&& unexploredStates)
+        : Product<Model>(std::move(product)), acceptance(acceptance), unexploredStates(std::move(unexploredStates)) {
         // Intentionally left blank
     }
 
@@ -20,8 +26,17 @@ class DAProduct : public Product<Model> {
         return acceptance;
     }
 
+    /*!
+     * Returns the product states whose successors have not been explored because no accepting run passes through them.
+     * These states are absorbing in the product model and must not be considered accepting.
+     */
+    const storm::storage::BitVector& getUnexploredStates() const {
+        return unexploredStates;
+    }
+
    private:
     storm::automata::AcceptanceCondition::ptr acceptance;
+    storm::storage::BitVector unexploredStates;
 };
 }  // namespace transformer
 }  // namespace storm
@@ -0,0 +1,38 @@
+#include "storm/transformer/DAProductBuilder.h"
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/utility/parallel.h"
+
+namespace storm {
+namespace transformer {
+
+void DAProductBuilder::computeStateLabels() {
+    if (statesForAP.empty()) {
+        return;
+    }
+    uint64_t numberOfStates = statesForAP.front().size();
+    stateLabels.assign(numberOfStates, da.getAPSet().elementAllFalse());
+    auto computeLabels = [this](uint64_t begin, uint64_t end) {
+        for (uint64_t s = begin; s < end; ++s) {
+            storm::automata::APSet::alphabet_element label = da.getAPSet().elementAllFalse();
+            for (unsigned int ap = 0; ap < statesForAP.size(); ap++) {
+                if (statesForAP[ap].get(s)) {
+                    label = da.getAPSet().elementAddAP(label, ap);
+                }
+            }
+            stateLabels[s] = label;
+        }
+    };
+
+#ifdef STORM_HAVE_INTELTBB
+    if (storm::utility::parallel::isIntelTbbEnabled()) {
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, numberOfStates),
+                          [&computeLabels](tbb::blocked_range<uint64_t> const& range) { computeLabels(range.begin(), range.end()); });
+        return;
+    }
+#endif
+    computeLabels(0, numberOfStates);
+}
+
+}  // namespace transformer
+}  // namespace storm
@@ -5,7 +5,9 @@
 #include "storm/transformer/DAProduct.h"
 #include "storm/transformer/Product.h"
 #include "storm/transformer/ProductBuilder.h"
+#include "storm/utility/macros.h"
 
+#include <boost/optional.hpp>
 #include <vector>
 
 namespace storm {
@@ -13,21 +15,42 @@ namespace transformer {
 class DAProductBuilder {
    public:
     DAProductBuilder(const storm::automata::DeterministicAutomaton& da, const std::vector<storm::storage::BitVector>& statesForAP)
-        : da(da), statesForAP(statesForAP) {}
+        : da(da), statesForAP(statesForAP) {
+        computeStateLabels();
+    }
 
     template<typename Model>
     typename DAProduct<Model>::ptr build(const Model& originalModel, const storm::storage::BitVector& statesOfInterest) const {
         return build<Model>(originalModel.getTransitionMatrix(), statesOfInterest);
     }
 
+    /*!
+     * Builds the product of the model given by the transition matrix and the automaton.
+     *
+     * @param restrictToPossiblyAcceptingStates If true, the successors of product states whose automaton state can not reach an accepting
+     * SCC of the automaton are not explored. These product states are made absorbing and are reported as unexplored states of the product.
+     */
     template<typename Model>
     typename DAProduct<Model>::ptr build(const storm::storage::SparseMatrix<typename Model::ValueType>& originalMatrix,
-                                         const storm::storage::BitVector& statesOfInterest) const {
-        typename Product<Model>::ptr product = ProductBuilder<Model>::buildProduct(originalMatrix, *this, statesOfInterest);
+                                         const storm::storage::BitVector& statesOfInterest, bool restrictToPossiblyAcceptingStates = false) const {
+        boost::optional<storm::storage::BitVector> automatonStatesToExplore;
+        if (restrictToPossiblyAcceptingStates) {
+            automatonStatesToExplore = da.getPossiblyAcceptingStates();
+            STORM_LOG_INFO("Only " << automatonStatesToExplore->getNumberOfSetBits() << " of " << da.getNumberOfStates()
+                                   << " automaton states can reach an accepting SCC.");
+        }
+
+        typename Product<Model>::ptr product = ProductBuilder<Model>::buildProduct(originalMatrix, *this, statesOfInterest, automatonStatesToExplore);
         storm::automata::AcceptanceCondition::ptr prodAcceptance = da.getAcceptance()->lift(
             product->getProductModel().getNumberOfStates(), [&product](std::size_t prodState) { return product->getAutomatonState(prodState); });
 
-        return typename DAProduct<Model>::ptr(new DAProduct<Model>(std::move(*product), prodAcceptance));
+        storm::storage::BitVector unexploredStates;
+        if (automatonStatesToExplore) {
+            unexploredStates = product->liftFromAutomaton(~automatonStatesToExplore.get());
+        } else {
+            unexploredStates = storm::storage::BitVector(product->getProductModel().getNumberOfStates(), false);
+        }
+        return typename DAProduct<Model>::ptr(new DAProduct<Model>(std::move(*product), prodAcceptance, std::move(unexploredStates)));
     }
 
     storm::storage::sparse::state_type getInitialState(storm::storage::sparse::state_type modelState) const {
@@ -41,15 +64,17 @@ class DAProductBuilder {
    private:
     const storm::automata::DeterministicAutomaton& da;
     const std::vector<storm::storage::BitVector>& statesForAP;
+    // The alphabet element of each model state, computed once upfront so that looking up the successor of a product transition is cheap.
+    std::vector<storm::automata::APSet::alphabet_element> stateLabels;
+
+    // Computes the alphabet element of each model state (in parallel if Intel TBB is enabled).
+    void computeStateLabels();
 
     storm::automata::APSet::alphabet_element getLabelForState(storm::storage::sparse::state_type s) const {
-        storm::automata::APSet::alphabet_element label = da.getAPSet().elementAllFalse();
-        for (unsigned int ap = 0; ap < da.getAPSet().size(); ap++) {
-            if (statesForAP.at(ap).get(s)) {
-                label = da.getAPSet().elementAddAP(label, ap);
-            }
+        if (stateLabels.empty()) {
+            return da.getAPSet().elementAllFalse();
         }
-        return label;
+        return stateLabels[s];
     }
 };
 }  // namespace transformer
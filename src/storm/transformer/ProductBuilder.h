@@ -3,6 +3,9 @@
 #include "storm/models/sparse/StateLabeling.h"
 #include "storm/storage/BitVector.h"
 #include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+
+#include <boost/optional.hpp>
 
 #include <deque>
 #include <map>
@@ -16,9 +19,15 @@ class ProductBuilder {
    public:
     typedef storm::storage::SparseMatrix<typename Model::ValueType> matrix_type;
 
+    /*!
+     * Builds the product of the model and the automaton given by prodOp, restricted to the states reachable from the states of interest.
+     * If automatonStatesToExplore is given, the successors of product states whose automaton state is not contained are not explored.
+     * Instead, such product states are made absorbing (keeping the number of choices).
+     */
     template<typename ProductOperator>
     static typename Product<Model>::ptr buildProduct(const matrix_type& originalMatrix, ProductOperator& prodOp,
-                                                     const storm::storage::BitVector& statesOfInterest) {
+                                                     const storm::storage::BitVector& statesOfInterest,
+                                                     boost::optional<storm::storage::BitVector> const& automatonStatesToExplore = boost::none) {
         bool deterministic = originalMatrix.hasTrivialRowGrouping();
 
         typedef storm::storage::sparse::state_type state_type;
@@ -55,7 +64,18 @@ class ProductBuilder {
 
             product_state_type from = productIndexToProductState.at(prodIndexFrom);
             // std::cout << "Handle " << from.first << "," << from.second << " (prodIndexFrom = " << prodIndexFrom << "):\n";
-            if (deterministic) {
+            if (automatonStatesToExplore && !automatonStatesToExplore->get(from.second)) {
+                if (deterministic) {
+                    builder.addNextValue(prodIndexFrom, prodIndexFrom, storm::utility::one<typename Model::ValueType>());
+                } else {
+                    std::size_t numRows = originalMatrix.getRowGroupSize(from.first);
+                    builder.newRowGroup(curRow);
+                    for (std::size_t i = 0; i < numRows; i++) {
+                        builder.addNextValue(curRow, prodIndexFrom, storm::utility::one<typename Model::ValueType>());
+                        curRow++;
+                    }
+                }
+            } else if (deterministic) {
                 typename matrix_type::const_rows row = originalMatrix.getRow(from.first);
                 for (auto const& entry : row) {
                     state_type t = entry.getColumn();
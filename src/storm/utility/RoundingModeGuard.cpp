@@ -0,0 +1,34 @@
+#include "storm/utility/RoundingModeGuard.h"
+
+#include <cfenv>
+
+#include "storm/utility/macros.h"
+
+#include "storm/exceptions/NotSupportedException.h"
+
+namespace storm {
+namespace utility {
+
+RoundingModeGuard::RoundingModeGuard(Direction direction, bool enabled) : enabled(enabled), previousMode(std::fegetround()) {
+    if (enabled) {
+        if (direction == Direction::Downward) {
+            STORM_LOG_THROW(std::fesetround(FE_DOWNWARD) == 0, storm::exceptions::NotSupportedException,
+                            "Rounding towards negative infinity is not supported.");
+        } else {
+            STORM_LOG_THROW(std::fesetround(FE_UPWARD) == 0, storm::exceptions::NotSupportedException, "Rounding towards positive infinity is not supported.");
+        }
+    }
+}
+
+RoundingModeGuard::~RoundingModeGuard() {
+    if (enabled) {
+        std::fesetround(previousMode);
+    }
+}
+
+bool isRoundingToNearest() {
+    return std::fegetround() == FE_TONEAREST;
+}
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,41 @@
+#pragma once
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Sets the floating point rounding mode of the current thread and restores the previous mode upon destruction. Directed rounding allows
+ * to compute lower (upper) bounds whose round-off errors only ever decrease (increase) the computed values.
+ *
+ * Note that the rounding mode is a property of the calling thread, so computations that are distributed to other threads are not affected.
+ * Translation units that perform arithmetic under a directed rounding mode have to be compiled with -frounding-math (see src/storm/CMakeLists.txt),
+ * as the compiler otherwise assumes rounding to nearest, e.g., when folding constants or moving operations across the change of the mode.
+ */
+class RoundingModeGuard {
+   public:
+    enum class Direction { Downward, Upward };
+
+    /*!
+     * Sets the rounding mode of the current thread.
+     *
+     * @param direction The direction in which all subsequent operations are rounded.
+     * @param enabled If false, the rounding mode is not changed.
+     */
+    RoundingModeGuard(Direction direction, bool enabled = true);
+    ~RoundingModeGuard();
+
+    RoundingModeGuard(RoundingModeGuard const&) = delete;
+    RoundingModeGuard& operator=(RoundingModeGuard const&) = delete;
+
+   private:
+    bool enabled;
+    int previousMode;
+};
+
+/*!
+ * Retrieves whether the current thread rounds to the nearest representable value (which is the default).
+ */
+bool isRoundingToNearest();
+
+}  // namespace utility
+}  // namespace storm
@@ -0,0 +1,32 @@
+#include "storm/utility/ThreadOutputBuffer.h"
+
+#include <iostream>
+
+namespace storm {
+namespace utility {
+
+namespace {
+// The stream to which the current thread writes, or nullptr if it writes to std::cout.
+thread_local std::ostream* currentOutputStream = nullptr;
+}  // namespace
+
+std::ostream& getOutputStream() {
+    return currentOutputStream == nullptr ? std::cout : *currentOutputStream;
+}
+
+ThreadOutputBuffer::ThreadOutputBuffer() : previousStream(currentOutputStream) {
+    // Numbers are printed with the same precision as on the console.
+    buffer.copyfmt(std::cout);
+    currentOutputStream = &buffer;
+}
+
+ThreadOutputBuffer::~ThreadOutputBuffer() {
+    currentOutputStream = previousStream;
+}
+
+std::string ThreadOutputBuffer::getOutput() const {
+    return buffer.str();
+}
+
+}  // namespace utility
+}  // namespace storm
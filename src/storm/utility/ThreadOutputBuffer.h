@@ -0,0 +1,39 @@
+#pragma once
+
+#include <ostream>
+#include <sstream>
+#include <string>
+
+namespace storm {
+namespace utility {
+
+/*!
+ * Retrieves the stream to which the calling thread prints (via STORM_PRINT) and logs console messages. This is the innermost active
+ * ThreadOutputBuffer of the thread or std::cout if there is none.
+ */
+std::ostream& getOutputStream();
+
+/*!
+ * Collects everything the creating thread prints (via STORM_PRINT) or logs to the console while the object exists. This allows to print the
+ * output of concurrent computations one after another. Buffers of a thread have to be destroyed in the reverse order of their creation.
+ */
+class ThreadOutputBuffer {
+   public:
+    ThreadOutputBuffer();
+    ~ThreadOutputBuffer();
+
+    ThreadOutputBuffer(ThreadOutputBuffer const&) = delete;
+    ThreadOutputBuffer& operator=(ThreadOutputBuffer const&) = delete;
+
+    /*!
+     * Retrieves the output collected so far.
+     */
+    std::string getOutput() const;
+
+   private:
+    std::ostringstream buffer;
+    std::ostream* previousStream;
+};
+
+}  // namespace utility
+}  // namespace storm
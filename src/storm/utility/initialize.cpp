@@ -4,13 +4,32 @@
 #include <fstream>
 #include <iostream>
 
+#include "storm/utility/ThreadOutputBuffer.h"
+
 namespace storm {
 namespace utility {
 
+namespace {
+/*!
+ * A sink that writes to std::cout or, if the logging thread buffers its output, to the buffer of the thread.
+ */
+class ConsoleSink : public l3pp::Sink {
+   public:
+    static l3pp::SinkPtr create() {
+        return l3pp::SinkPtr(new ConsoleSink());
+    }
+
+   private:
+    void logEntry(std::string const& entry) const override {
+        getOutputStream() << entry << std::flush;
+    }
+};
+}  // namespace
+
 void initializeLogger() {
     l3pp::Logger::initialize();
     // By default output to std::cout
-    l3pp::SinkPtr sink = l3pp::StreamSink::create(std::cout);
+    l3pp::SinkPtr sink = ConsoleSink::create();
     l3pp::Logger::getRootLogger()->addSink(sink);
     // Default to warn, set by user to something else
     l3pp::Logger::getRootLogger()->setLevel(l3pp::LogLevel::WARN);
@@ -1,6 +1,7 @@
 #ifndef STORM_UTILITY_MACROS_H_
 #define STORM_UTILITY_MACROS_H_
 
+#include "storm/utility/ThreadOutputBuffer.h"
 #include "storm/utility/logging.h"
 
 #include <cassert>
@@ -59,10 +60,10 @@
 /*!
  * Define the macros that print information and optionally also log it.
  */
-#define STORM_PRINT(message)  \
-    {                         \
-        std::cout << message; \
-        std::cout.flush();    \
+#define STORM_PRINT(message)                          \
+    {                                                 \
+        storm::utility::getOutputStream() << message; \
+        storm::utility::getOutputStream().flush();    \
     }
 
 #define STORM_PRINT_AND_LOG(message) \
@@ -0,0 +1,73 @@
+#include "storm/utility/parallel.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "storm/adapters/IntelTbbAdapter.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/ThreadOutputBuffer.h"
+#include "storm/utility/macros.h"
+
+#ifdef STORM_HAVE_INTELTBB
+#include "tbb/task_arena.h"
+#endif
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+bool isIntelTbbEnabled() {
+#ifdef STORM_HAVE_INTELTBB
+    return storm::settings::getModule<storm::settings::modules::CoreSettings>().isUseIntelTbbSet();
+#else
+    return false;
+#endif
+}
+
+uint64_t getNumberOfThreads() {
+#ifdef STORM_HAVE_INTELTBB
+    if (isIntelTbbEnabled()) {
+        return std::max<uint64_t>(1, tbb::this_task_arena::max_concurrency());
+    }
+#endif
+    return 1;
+}
+
+void computeAndReportInOrder(uint64_t numberOfTasks, uint64_t numberOfWorkers, std::function<void(uint64_t)> const& announce,
+                             std::function<void(uint64_t)> const& compute, std::function<void(uint64_t)> const& report) {
+#ifdef STORM_HAVE_INTELTBB
+    if (numberOfWorkers > 1 && numberOfTasks > 1 && isIntelTbbEnabled()) {
+        // Limiting the number of tasks per round bounds the memory that is allocated concurrently.
+        for (uint64_t roundStart = 0; roundStart < numberOfTasks; roundStart += numberOfWorkers) {
+            uint64_t roundEnd = std::min<uint64_t>(roundStart + numberOfWorkers, numberOfTasks);
+            std::vector<std::string> outputs(roundEnd - roundStart);
+            tbb::parallel_for(tbb::blocked_range<uint64_t>(roundStart, roundEnd, 1), [&](tbb::blocked_range<uint64_t> const& range) {
+                for (uint64_t task = range.begin(); task < range.end(); ++task) {
+                    storm::utility::ThreadOutputBuffer buffer;
+                    compute(task);
+                    outputs[task - roundStart] = buffer.getOutput();
+                }
+            });
+            for (uint64_t task = roundStart; task < roundEnd; ++task) {
+                announce(task);
+                STORM_PRINT(outputs[task - roundStart]);
+                report(task);
+            }
+        }
+        return;
+    }
+#else
+    STORM_LOG_WARN_COND(numberOfWorkers <= 1, "Tasks can only be computed concurrently if Storm is built with Intel TBB.");
+#endif
+    for (uint64_t task = 0; task < numberOfTasks; ++task) {
+        announce(task);
+        compute(task);
+        report(task);
+    }
+}
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
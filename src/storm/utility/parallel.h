@@ -0,0 +1,37 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+
+namespace storm {
+namespace utility {
+namespace parallel {
+
+/*!
+ * Retrieves whether Storm was built with Intel TBB and its usage is enabled in the core settings.
+ */
+bool isIntelTbbEnabled();
+
+/*!
+ * Retrieves the number of threads that Intel TBB uses for parallel computations. This is one if Intel TBB is not enabled.
+ */
+uint64_t getNumberOfThreads();
+
+/*!
+ * Performs the given tasks such that the printed output is the same as if they were performed one after another. If Intel TBB is enabled and
+ * more than one worker is requested, the tasks are computed concurrently in rounds of at most numberOfWorkers tasks. Everything a task prints
+ * (via STORM_PRINT) or logs to the console during its computation is buffered and printed once all tasks before it have been reported.
+ * A round only starts after all tasks of the previous round have been computed, i.e., every round waits for its slowest task.
+ *
+ * @param numberOfTasks The number of tasks.
+ * @param numberOfWorkers The maximal number of tasks that are computed concurrently.
+ * @param announce Called (sequentially and in order) right before the output of a task is printed.
+ * @param compute Called (possibly concurrently) to compute a task.
+ * @param report Called (sequentially and in order) right after the output of a task is printed.
+ */
+void computeAndReportInOrder(uint64_t numberOfTasks, uint64_t numberOfWorkers, std::function<void(uint64_t)> const& announce,
+                             std::function<void(uint64_t)> const& compute, std::function<void(uint64_t)> const& report);
+
+}  // namespace parallel
+}  // namespace utility
+}  // namespace storm
@@ -11,6 +11,12 @@ RandomProbabilityGenerator<double>::RandomProbabilityGenerator() : distribution(
 
 RandomProbabilityGenerator<double>::RandomProbabilityGenerator(uint64_t seed) : distribution(0.0, 1.0), engine(seed) {}
 
+RandomProbabilityGenerator<double>::RandomProbabilityGenerator(uint64_t seed, uint64_t stream) : distribution(0.0, 1.0) {
+    // Mixing seed and stream through a seed sequence decorrelates the initial states of the engines of different streams.
+    std::seed_seq sequence{static_cast<uint32_t>(seed), static_cast<uint32_t>(seed >> 32), static_cast<uint32_t>(stream), static_cast<uint32_t>(stream >> 32)};
+    engine.seed(sequence);
+}
+
 double RandomProbabilityGenerator<double>::random() {
     return distribution(engine);
 }
@@ -19,6 +25,10 @@ uint64_t RandomProbabilityGenerator<double>::random_uint(uint64_t min, uint64_t
     return std::uniform_int_distribution<uint64_t>(min, max)(engine);
 }
 
+double RandomProbabilityGenerator<double>::random_exponential(double rate) {
+    return std::exponential_distribution<double>(rate)(engine);
+}
+
 RandomProbabilityGenerator<RationalNumber>::RandomProbabilityGenerator() : distribution(0, std::numeric_limits<uint64_t>::max()) {
     std::random_device rd;
     engine = std::mt19937(rd());
@@ -20,8 +20,16 @@ class RandomProbabilityGenerator<double> {
    public:
     RandomProbabilityGenerator();
     RandomProbabilityGenerator(uint64_t seed);
+    /*!
+     * Creates a generator for the given stream of the given seed. Generators for different streams of the same seed produce independent sequences.
+     */
+    RandomProbabilityGenerator(uint64_t seed, uint64_t stream);
     double random();
     uint64_t random_uint(uint64_t min, uint64_t max);
+    /*!
+     * Samples from the exponential distribution with the given rate.
+     */
+    double random_exponential(double rate);
 
    private:
     std::uniform_real_distribution<double> distribution;
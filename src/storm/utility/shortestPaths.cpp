@@ -1,14 +1,17 @@
+#include <algorithm>
 #include <ostream>
 #include <queue>
 #include <set>
 #include <string>
 
+#include "storm/adapters/IntelTbbAdapter.h"
 #include "storm/exceptions/UnexpectedException.h"
 #include "storm/models/sparse/Model.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/storage/sparse/StateType.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
 #include "storm/utility/shortestPaths.h"
 
 // FIXME: I've accidentally used k=0 *twice* now without realizing that k>=1 is required!
@@ -26,7 +29,9 @@ ShortestPathsGenerator<T>::ShortestPathsGenerator(storage::SparseMatrix<T> const
       metaTarget(transitionMatrix.getColumnCount()),     // first unused state index
       initialStates(initialStates),
       targetProbMap(targetProbMap),
-      matrixFormat(matrixFormat) {
+      matrixFormat(matrixFormat),
+      numberOfEnumeratedPaths(0),
+      enumeratedDistance(zero<T>()) {
     computePredecessors();
 
     // gives us SP-predecessors, SP-distances
@@ -112,6 +117,22 @@ std::vector<state_t> ShortestPathsGenerator<T>::getPathAsList(unsigned long k) {
     return backToFrontList;
 }
 
+template<typename T>
+bool ShortestPathsGenerator<T>::hasPath(unsigned long k) {
+    return tryComputeKSP(k);
+}
+
+template<typename T>
+boost::optional<EnumeratedPath<T>> ShortestPathsGenerator<T>::getNextPath() {
+    if (!tryComputeKSP(numberOfEnumeratedPaths + 1)) {
+        return boost::none;
+    }
+    ++numberOfEnumeratedPaths;
+    T distance = kShortestPaths[metaTarget][numberOfEnumeratedPaths - 1].distance;
+    enumeratedDistance += distance;
+    return EnumeratedPath<T>{numberOfEnumeratedPaths, distance, enumeratedDistance, getPathAsList(numberOfEnumeratedPaths)};
+}
+
 template<typename T>
 void ShortestPathsGenerator<T>::computePredecessors() {
     assert(transitionMatrix.hasTrivialRowGrouping());
@@ -249,29 +270,57 @@ T ShortestPathsGenerator<T>::getEdgeDistance(state_t tailNode, state_t headNode)
     }
 }
 
+template<typename T>
+void ShortestPathsGenerator<T>::insertInitialCandidates(state_t node) {
+    // Step B.1 in J&M paper
+
+    Path<T> shortestPathToNode = kShortestPaths[node][1 - 1];  // never forget index shift :-|
+    OrderedStateList const& predecessors = graphPredecessors[node];
+    std::vector<Path<T>>& candidates = candidatePaths[node];
+
+    // add shortest paths to predecessors plus edge to current node
+    auto pathToPredecessorPlusEdge = [&](state_t predecessor) {
+        return Path<T>{boost::optional<state_t>(predecessor), 1, shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
+    };
+
+    bool parallelize = false;
+#ifdef STORM_HAVE_INTELTBB
+    // finding the edge to the node requires a scan of each predecessor's row, which only pays off to distribute for many predecessors
+    parallelize = predecessors.size() >= 1024 && storm::utility::parallel::isIntelTbbEnabled();
+    if (parallelize) {
+        std::vector<Path<T>> newCandidates(predecessors.size());
+        tbb::parallel_for(tbb::blocked_range<uint64_t>(0, predecessors.size(), 256), [&](tbb::blocked_range<uint64_t> const& range) {
+            for (uint64_t index = range.begin(); index < range.end(); ++index) {
+                newCandidates[index] = pathToPredecessorPlusEdge(predecessors[index]);
+            }
+        });
+        for (auto& candidate : newCandidates) {
+            // ... but not the actual shortest path
+            if (!(candidate == shortestPathToNode)) {
+                candidates.push_back(std::move(candidate));
+            }
+        }
+    }
+#endif
+    if (!parallelize) {
+        for (state_t predecessor : predecessors) {
+            Path<T> candidate = pathToPredecessorPlusEdge(predecessor);
+            // ... but not the actual shortest path
+            if (!(candidate == shortestPathToNode)) {
+                candidates.push_back(std::move(candidate));
+            }
+        }
+    }
+    std::make_heap(candidates.begin(), candidates.end(), isWorseCandidate);
+}
+
 template<typename T>
 void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
     assert(k >= 2);                                // Dijkstra is used for k=1
     assert(kShortestPaths[node].size() == k - 1);  // if not, the previous SP must not exist
 
-    // TODO: I could extract the candidate generation to make this function more succinct
     if (k == 2) {
-        // Step B.1 in J&M paper
-
-        Path<T> shortestPathToNode = kShortestPaths[node][1 - 1];  // never forget index shift :-|
-
-        for (state_t predecessor : graphPredecessors[node]) {
-            // add shortest paths to predecessors plus edge to current node
-            Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), 1,
-                                                 shortestPathDistances[predecessor] * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
-
-            // ... but not the actual shortest path
-            auto it = std::find(candidatePaths[node].begin(), candidatePaths[node].end(), shortestPathToNode);
-            if (it != candidatePaths[node].end()) {
-                candidatePaths[node].erase(it);
-            }
-        }
+        insertInitialCandidates(node);
     }
 
     if (not(k == 2 && isInitialState(node))) {
@@ -297,22 +346,18 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
             // take that path, add an edge to the current node; that's a candidate
             Path<T> pathToPredecessorPlusEdge = {boost::optional<state_t>(predecessor), tailK + 1,
                                                  kShortestPaths[predecessor][tailK + 1 - 1].distance * getEdgeDistance(predecessor, node)};
-            candidatePaths[node].insert(pathToPredecessorPlusEdge);
+            candidatePaths[node].push_back(pathToPredecessorPlusEdge);
+            std::push_heap(candidatePaths[node].begin(), candidatePaths[node].end(), isWorseCandidate);
         }
         // else there was no path; TODO: does this need handling? -- yes, but not here (because the step B.1 may have added candidates)
     }
 
     // Step B.6 in J&M paper
     if (!candidatePaths[node].empty()) {
-        Path<T> minDistanceCandidate = *(candidatePaths[node].begin());
-        for (auto path : candidatePaths[node]) {
-            if (path.distance > minDistanceCandidate.distance) {
-                minDistanceCandidate = path;
-            }
-        }
-
-        candidatePaths[node].erase(std::find(candidatePaths[node].begin(), candidatePaths[node].end(), minDistanceCandidate));
-        kShortestPaths[node].push_back(minDistanceCandidate);
+        // the top of the heap is the candidate with the largest distance (i.e., the "shortest" path)
+        std::pop_heap(candidatePaths[node].begin(), candidatePaths[node].end(), isWorseCandidate);
+        kShortestPaths[node].push_back(std::move(candidatePaths[node].back()));
+        candidatePaths[node].pop_back();
     } else {
         // TODO: kSP does not exist. this is handled later, but it would be nice to catch it as early as possble, wouldn't it?
         STORM_LOG_TRACE("KSP: no candidates, this will trigger nonexisting ksp after exiting these recursions. TODO: handle here");
@@ -320,7 +365,7 @@ void ShortestPathsGenerator<T>::computeNextPath(state_t node, unsigned long k) {
 }
 
 template<typename T>
-void ShortestPathsGenerator<T>::computeKSP(unsigned long k) {
+bool ShortestPathsGenerator<T>::tryComputeKSP(unsigned long k) {
     if (k == 0) {
         throw std::invalid_argument("Index 0 is invalid, since we use 1-based indices (sorry)!");
     }
@@ -328,15 +373,21 @@ void ShortestPathsGenerator<T>::computeKSP(unsigned long k) {
     unsigned long alreadyComputedK = kShortestPaths[metaTarget].size();
 
     for (unsigned long nextK = alreadyComputedK + 1; nextK <= k; nextK++) {
+        // Note that a failed attempt leaves no candidates behind, so it is safe to attempt computing the same path again.
         computeNextPath(metaTarget, nextK);
         if (kShortestPaths[metaTarget].size() < nextK) {
-            unsigned long lastExistingK = nextK - 1;
-            STORM_LOG_DEBUG("KSP throws (as expected) due to nonexistence -- maybe this is unhandled and causes the Python interface to segfault?");
-            STORM_LOG_DEBUG("last existing k-SP has k=" + std::to_string(lastExistingK));
-            STORM_LOG_DEBUG("maybe this is unhandled and causes the Python interface to segfault?");
-            throw std::invalid_argument("k-SP does not exist for k=" + std::to_string(k));
+            STORM_LOG_DEBUG("last existing k-SP has k=" + std::to_string(nextK - 1));
+            return false;
         }
     }
+    return true;
+}
+
+template<typename T>
+void ShortestPathsGenerator<T>::computeKSP(unsigned long k) {
+    if (!tryComputeKSP(k)) {
+        throw std::invalid_argument("k-SP does not exist for k=" + std::to_string(k));
+    }
 }
 
 template<typename T>
@@ -58,6 +58,21 @@ struct Path {
 template<typename T>
 std::ostream& operator<<(std::ostream& out, Path<T> const& p);
 
+/*!
+ * A path as yielded by the lazy enumeration of the shortest paths (see `ShortestPathsGenerator::getNextPath`).
+ */
+template<typename T>
+struct EnumeratedPath {
+    // the path is the k-shortest path (1-based)
+    unsigned long k;
+    // the distance (i.e., probability) of the path
+    T distance;
+    // the sum of the distances of the 1-, ..., k-shortest paths
+    T accumulatedDistance;
+    // the states of the path as back-to-front traversal (see `getPathAsList`)
+    OrderedStateList states;
+};
+
 // when using the raw matrix/vector invocation, this enum parameter
 // forces the caller to declare whether the matrix has the evil I-P
 // format, which requires back-conversion of the entries
@@ -115,6 +130,18 @@ class ShortestPathsGenerator {
      */
     OrderedStateList getPathAsList(unsigned long k);
 
+    /*!
+     * Returns whether the KSP exists. Computes KSP if not yet computed.
+     * In contrast to the getters above, this does not throw if the path does not exist.
+     */
+    bool hasPath(unsigned long k);
+
+    /*!
+     * Lazily enumerates the shortest paths: the first call yields the 1-shortest path, each subsequent call the next one.
+     * Only the paths up to the yielded one are computed. Returns none if no further path exists.
+     */
+    boost::optional<EnumeratedPath<T>> getNextPath();
+
    private:
     Matrix const& transitionMatrix;
     state_t numStates;  // includes meta-target, i.e. states in model + 1
@@ -130,7 +157,12 @@ class ShortestPathsGenerator {
     std::vector<T> shortestPathDistances;
 
     std::vector<std::vector<Path<T>>> kShortestPaths;
-    std::vector<std::set<Path<T>>> candidatePaths;
+    // candidate paths per node, each organized as a binary heap w.r.t. `isWorseCandidate`
+    std::vector<std::vector<Path<T>>> candidatePaths;
+
+    // the number of paths yielded by `getNextPath` and the sum of their distances
+    unsigned long numberOfEnumeratedPaths;
+    T enumeratedDistance;
 
     /*!
      * Computes list of predecessors for all nodes.
@@ -161,11 +193,24 @@ class ShortestPathsGenerator {
      */
     void initializeShortestPaths();
 
+    /*!
+     * Inserts the candidates of step B.1 of the REA algorithm, i.e., the shortest paths to the predecessors of the node extended by the
+     * edge to the node (except for the shortest path to the node itself). For nodes with many predecessors (such as the meta-target if
+     * there are many targets), the candidates are generated in parallel if Intel TBB is enabled.
+     */
+    void insertInitialCandidates(state_t node);
+
     /*!
      * Main step of REA algorithm. TODO: Document further.
      */
     void computeNextPath(state_t node, unsigned long k);
 
+    /*!
+     * Computes k-shortest path if not yet computed.
+     * @return false iff no such k-shortest path exists
+     */
+    bool tryComputeKSP(unsigned long k);
+
     /*!
      * Computes k-shortest path if not yet computed.
      * @throws std::invalid_argument if no such k-shortest path exists
@@ -184,6 +229,17 @@ class ShortestPathsGenerator {
 
     // --- tiny helper fcts ---
 
+    /*!
+     * The order of the candidate heaps: the candidate with the largest distance is taken next, ties are broken by the (arbitrary) order
+     * of paths.
+     */
+    static inline bool isWorseCandidate(Path<T> const& lhs, Path<T> const& rhs) {
+        if (lhs.distance != rhs.distance) {
+            return lhs.distance < rhs.distance;
+        }
+        return rhs < lhs;
+    }
+
     inline bool isInitialState(state_t node) const {
         return std::find(initialStates.begin(), initialStates.end(), node) != initialStates.end();
     }
@@ -0,0 +1,72 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <sstream>
+
+#include "storm-cli-utilities/server.h"
+
+namespace {
+
+// Runs a server on the given requests and returns the parsed responses.
+std::vector<storm::json<double>> serve(std::string const& requests) {
+    storm::cli::ModelServer<double> server(storm::cli::SymbolicInput(), 0);
+    std::istringstream requestStream(requests);
+    std::ostringstream responseStream;
+    server.run(requestStream, responseStream);
+
+    std::vector<storm::json<double>> responses;
+    std::istringstream responseLines(responseStream.str());
+    std::string line;
+    while (std::getline(responseLines, line)) {
+        responses.push_back(storm::json<double>::parse(line));
+    }
+    return responses;
+}
+
+std::string checkRequest(uint64_t id, std::string const& modelFile, std::string const& properties) {
+    storm::json<double> request;
+    request["id"] = id;
+    request["prism"] = modelFile;
+    request["properties"] = properties;
+    return request.dump() + "\n";
+}
+
+TEST(ServerTest, CheckProperties) {
+    std::string die = STORM_TEST_RESOURCES_DIR "/dtmc/die.pm";
+    auto responses = serve(checkRequest(1, die, "P=? [F \"one\"]; R{\"coin_flips\"}=? [F \"done\"]") + checkRequest(2, die, "P=? [F \"two\"]") +
+                           "{\"id\": 3, \"command\": \"quit\"}\n" + checkRequest(4, die, "P=? [F \"three\"]"));
+    ASSERT_EQ(6ul, responses.size());
+
+    // The first request builds the model.
+    EXPECT_EQ(1, responses[0]["id"].get<int>());
+    EXPECT_NEAR(1.0 / 6.0, std::stod(responses[0]["result"].get<std::string>()), 1e-6);
+    EXPECT_NEAR(11.0 / 3.0, std::stod(responses[1]["result"].get<std::string>()), 1e-6);
+    EXPECT_TRUE(responses[2]["done"].get<bool>());
+    EXPECT_FALSE(responses[2]["resident"].get<bool>());
+
+    // The second request reuses the resident model.
+    EXPECT_EQ(2, responses[3]["id"].get<int>());
+    EXPECT_NEAR(1.0 / 6.0, std::stod(responses[3]["result"].get<std::string>()), 1e-6);
+    EXPECT_TRUE(responses[4]["done"].get<bool>());
+    EXPECT_TRUE(responses[4]["resident"].get<bool>());
+
+    // The quit command is acknowledged and later requests are not answered.
+    EXPECT_EQ(3, responses[5]["id"].get<int>());
+    EXPECT_TRUE(responses[5]["done"].get<bool>());
+}
+
+TEST(ServerTest, FailedRequestsAreDone) {
+    std::string missing = STORM_TEST_RESOURCES_DIR "/dtmc/nonexisting.pm";
+    auto responses = serve(checkRequest(1, missing, "P=? [F \"one\"]") + "{\"id\": 2, \"command\": \"unknown\"}\n" + "no json\n");
+    ASSERT_EQ(6ul, responses.size());
+    for (uint64_t request = 0; request < 3; ++request) {
+        EXPECT_EQ(1ul, responses[2 * request].count("error"));
+        EXPECT_TRUE(responses[2 * request + 1]["done"].get<bool>());
+        EXPECT_FALSE(responses[2 * request + 1]["resident"].get<bool>());
+        EXPECT_EQ(1ul, responses[2 * request + 1].count("time-ms"));
+    }
+    EXPECT_EQ(1, responses[0]["id"].get<int>());
+    EXPECT_EQ(2, responses[3]["id"].get<int>());
+}
+
+}  // namespace
@@ -0,0 +1,56 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-counterexamples/counterexamples/SMTMinimalLabelSetGenerator.h"
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/builder/BuilderOptions.h"
+#include "storm/environment/Environment.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/storage/SymbolicModelDescription.h"
+#include "storm/utility/prism.h"
+
+#ifdef STORM_HAVE_Z3
+
+TEST(SMTMinimalLabelSetGeneratorTest, CandidateBatches) {
+    typedef storm::counterexamples::SMTMinimalLabelSetGenerator<double> Generator;
+    storm::prism::Program program = storm::utility::prism::preprocess(storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm"), "");
+    // The probability to roll a one is 1/6.
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P<=0.1 [F \"one\"]", program));
+    storm::storage::SymbolicModelDescription symbolicModel(program);
+    storm::builder::BuilderOptions builderOptions(formulas, symbolicModel);
+    builderOptions.setBuildChoiceOrigins(true);
+    auto model = storm::api::buildSparseModel<double>(symbolicModel, builderOptions);
+
+    storm::Environment env;
+    auto computeLabelSets = [&](uint64_t candidateBatchSize) {
+        Generator::Options options(true);
+        options.silent = true;
+        options.candidateBatchSize = candidateBatchSize;
+        Generator::GeneratorStats stats;
+        auto input = Generator::precompute(env, symbolicModel, *model, formulas[0]);
+        return Generator::computeCounterexampleLabelSet(env, stats, symbolicModel, *model, input, {}, options);
+    };
+
+    auto sequentialLabelSets = computeLabelSets(1);
+    ASSERT_EQ(1ul, sequentialLabelSets.size());
+
+    // Checking several candidates at once yields a counterexample of the same (minimal) size. Whether the candidates are checked in parallel
+    // must not affect the result.
+    std::vector<storm::storage::FlatSet<uint_fast64_t>> batchLabelSets, parallelLabelSets;
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        batchLabelSets = computeLabelSets(4);
+    }
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelLabelSets = computeLabelSets(4);
+    }
+    ASSERT_EQ(1ul, batchLabelSets.size());
+    EXPECT_EQ(sequentialLabelSets.front().size(), batchLabelSets.front().size());
+    EXPECT_EQ(batchLabelSets, parallelLabelSets);
+}
+
+#endif
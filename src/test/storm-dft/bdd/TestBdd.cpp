@@ -102,6 +102,16 @@ TEST_P(SftBddTest, Birnbaum) {
     expectVectorNear(checker->getAllBirnbaumFactorsAtTimebound(1), param.birnbaum);
 }
 
+TEST_P(SftBddTest, BirnbaumAtTimepoints) {
+    std::vector<double> const timepoints{0.5, 1, 2};
+    auto const allBirnbaumFactors{checker->getAllBirnbaumFactorsAtTimepoints(timepoints, 2)};
+    auto const basicElements{checker->getDFT()->getBasicElements()};
+    ASSERT_EQ(allBirnbaumFactors.size(), basicElements.size());
+    for (size_t i{0}; i < basicElements.size(); ++i) {
+        expectVectorNear(allBirnbaumFactors[i], checker->getBirnbaumFactorsAtTimepoints(basicElements[i]->name(), timepoints, 2));
+    }
+}
+
 TEST_P(SftBddTest, CIF) {
     auto const &param{TestWithParam::GetParam()};
     expectVectorNear(checker->getAllCIFsAtTimebound(1), param.CIF);
@@ -83,7 +83,35 @@ static std::vector<ModularizerTestData> modularizerTestData{
         STORM_TEST_RESOURCES_DIR "/dft/mcs.dft",
         0.9984947969,
     },
+    {
+        "ReplicatedModules",
+        STORM_TEST_RESOURCES_DIR "/dft/modules_replicated.dft",
+        0.5616130323,
+    },
 };
+
 INSTANTIATE_TEST_SUITE_P(BddModularizer, BddModularizerTest, testing::ValuesIn(modularizerTestData), [](auto const &info) { return info.param.testname; });
 
+TEST(BddModularizerTest, ReuseModuleResults) {
+    auto dft{storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/modules_replicated.dft")};
+    storm::dft::modelchecker::DftModularizationChecker<double> checker{dft};
+    EXPECT_EQ(checker.getNumberOfDynamicModules(), 3ul);
+    EXPECT_EQ(checker.getNumberOfModuleAnalyses(), 0ul);
+
+    // The two isomorphic modules are analysed only once
+    auto const probabilities{checker.getProbabilitiesAtTimepoints({1, 2})};
+    ASSERT_EQ(probabilities.size(), 2ul);
+    EXPECT_NEAR(probabilities[0], 0.5616130323, 1e-6);
+    EXPECT_EQ(checker.getNumberOfModuleAnalyses(), 2ul);
+
+    // Results for the modules are reused
+    EXPECT_NEAR(checker.getProbabilityAtTimebound(1), probabilities[0], 1e-10);
+    EXPECT_NEAR(checker.getProbabilityAtTimebound(2), probabilities[1], 1e-10);
+    EXPECT_EQ(checker.getNumberOfModuleAnalyses(), 2ul);
+
+    // Only new time points require another analysis
+    checker.getProbabilityAtTimebound(3);
+    EXPECT_EQ(checker.getNumberOfModuleAnalyses(), 4ul);
+}
+
 }  // namespace
@@ -1,8 +1,11 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <cmath>
+
 #include "storm-dft/api/storm-dft.h"
 #include "storm-dft/generator/DftNextStateGenerator.h"
+#include "storm-dft/simulator/DFTMonteCarloSimulator.h"
 #include "storm-dft/simulator/DFTTraceSimulator.h"
 #include "storm-dft/storage/SymmetricUnits.h"
 
@@ -189,4 +192,62 @@ TEST(DftSimulatorTest, HecsUnreliability) {
     EXPECT_NEAR(result, 0.00021997582, 0.001);
 }
 
+TEST(DftSimulatorTest, MonteCarlo) {
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/and.dft")));
+    dft->setRelevantEvents(storm::dft::api::computeRelevantEvents<double>(*dft, {}, {}), false);
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+
+    storm::dft::simulator::DFTMonteCarloSimulator<double> simulator(*dft, stateGenerationInfo, 3, 5u);
+    simulator.setPrecision(5e-3, false);
+    storm::dft::simulator::MonteCarloResult result = simulator.computeUnreliability(2);
+    EXPECT_TRUE(result.converged);
+    EXPECT_NEAR(result.estimate, 0.3995764009, 0.01);
+    EXPECT_LE(result.upperBound - result.lowerBound, 0.01);
+    EXPECT_EQ(result.numberOfTraces % 3000, 0ul);
+
+    // Same seed and number of workers yields the same result
+    storm::dft::simulator::DFTMonteCarloSimulator<double> simulator2(*dft, stateGenerationInfo, 3, 5u);
+    simulator2.setPrecision(5e-3, false);
+    storm::dft::simulator::MonteCarloResult result2 = simulator2.computeUnreliability(2);
+    EXPECT_EQ(result.estimate, result2.estimate);
+    EXPECT_EQ(result.numberOfTraces, result2.numberOfTraces);
+
+    simulator.setPrecision(0.01, true);
+    result = simulator.computeMTTF();
+    EXPECT_TRUE(result.converged);
+    EXPECT_NEAR(result.estimate, 3, 0.1);
+    EXPECT_LE(result.lowerBound, result.estimate);
+    EXPECT_GE(result.upperBound, result.estimate);
+}
+
+TEST(DftSimulatorTest, MonteCarloNonFailing) {
+    std::shared_ptr<storm::dft::storage::DFT<double>> dft =
+        storm::dft::api::prepareForMarkovAnalysis<double>(*(storm::dft::api::loadDFTGalileoFile<double>(STORM_TEST_RESOURCES_DIR "/dft/be_nonfail2.dft")));
+    dft->setRelevantEvents(storm::dft::api::computeRelevantEvents<double>(*dft, {}, {}), false);
+    std::map<size_t, std::vector<std::vector<size_t>>> emptySymmetry;
+    storm::dft::storage::DFTIndependentSymmetries symmetries(emptySymmetry);
+    storm::dft::storage::DFTStateGenerationInfo stateGenerationInfo(dft->buildStateGenerationInfo(symmetries));
+
+    // The DFT never fails, hence the MTTF is unbounded and cannot be estimated with the required precision.
+    storm::dft::simulator::DFTMonteCarloSimulator<double> simulator(*dft, stateGenerationInfo, 2, 5u);
+    storm::dft::simulator::MonteCarloResult result = simulator.computeMTTF();
+    EXPECT_FALSE(result.converged);
+    EXPECT_TRUE(std::isinf(result.estimate));
+    EXPECT_TRUE(std::isinf(result.upperBound));
+    EXPECT_GT(result.numberOfTraces, 0ul);
+
+    result = simulator.computeUnreliability(1);
+    EXPECT_EQ(result.estimate, 0);
+
+    // For an estimate of zero, a relative precision is used as absolute precision.
+    simulator.setPrecision(0.01, true);
+    result = simulator.computeUnreliability(1);
+    EXPECT_TRUE(result.converged);
+    EXPECT_EQ(result.estimate, 0);
+    EXPECT_LE(result.upperBound - result.lowerBound, 0.02);
+}
+
 }  // namespace
@@ -155,6 +155,16 @@ void SparseDerivativeInstantiationModelCheckerTest<TestType>::testModel(std::sha
             auto derivative = derivativeModelChecker.check(env(), instantiation, parameter);
             ASSERT_NEAR(storm::utility::convertNumber<double>(derivative->getValueVector()[0]), storm::utility::convertNumber<double>(expectedResult), 1e-6) << instantiation;
         }
+
+        // Computing the derivatives w.r.t. all parameters at once must yield the same results.
+        std::vector<VariableType<storm::RationalFunction>> instantiationParameters;
+        for (auto const& position : instantiation) {
+            instantiationParameters.push_back(position.first);
+        }
+        auto derivativesAtInstantiation = derivativeModelChecker.checkMultipleParameters(env(), instantiation, instantiationParameters);
+        for (auto const& parameter : instantiationParameters) {
+            ASSERT_NEAR(storm::utility::convertNumber<double>(derivativesAtInstantiation.at(parameter)->getValueVector()[0]), storm::utility::convertNumber<double>(testCase.second.at(parameter)), 1e-6) << instantiation;
+        }
     }
 }
 
@@ -0,0 +1,104 @@
+#include "test/storm_gtest.h"
+#include "storm-config.h"
+
+#ifdef STORM_HAVE_CARL
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include<carl/core/VariablePool.h>
+
+#include "storm/api/storm.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm-parsers/api/storm-parsers.h"
+
+#include "storm-pars/modelchecker/instantiation/SparseDtmcInstantiationModelChecker.h"
+
+TEST(SparseDtmcInstantiationModelCheckerTest, BrpProbCheckMultiple) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size() == 1);
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (auto const& values : std::vector<std::pair<double, double>>({{0.8, 0.9}, {0.3, 0.5}, {0.9, 0.1}, {0.5, 0.5}})) {
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+        valuation.emplace(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(values.first));
+        valuation.emplace(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(values.second));
+        valuations.push_back(std::move(valuation));
+    }
+
+    storm::Environment env;
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> modelchecker(*dtmc);
+    modelchecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas[0], true));
+    modelchecker.setInstantiationsAreGraphPreserving(true);
+
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = modelchecker.checkMultiple(env, valuations);
+    ASSERT_EQ(valuations.size(), results.size());
+    EXPECT_NEAR(0.2989278941, results[0]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        std::unique_ptr<storm::modelchecker::CheckResult> singleResult = modelchecker.check(env, valuations[i]);
+        EXPECT_NEAR(singleResult->asExplicitQuantitativeCheckResult<double>()[initialState], results[i]->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    }
+}
+
+TEST(SparseDtmcInstantiationModelCheckerTest, BrpProbCheckMultipleNoConvergence) {
+    carl::VariablePool::getInstance().clear();
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/pdtmc/brp16_2.pm";
+    std::string formulaAsString = "P=? [F s=5 ]";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulaAsString, program));
+    ASSERT_TRUE(formulas.size() == 1);
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalFunction>> dtmc = storm::api::buildSparseModel<storm::RationalFunction>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalFunction>>();
+    uint64_t initialState = *dtmc->getInitialStates().begin();
+
+    storm::RationalFunctionVariable const& pL = carl::VariablePool::getInstance().findVariableWithName("pL");
+    ASSERT_NE(pL, carl::Variable::NO_VARIABLE);
+    storm::RationalFunctionVariable const& pK = carl::VariablePool::getInstance().findVariableWithName("pK");
+    ASSERT_NE(pK, carl::Variable::NO_VARIABLE);
+
+    std::vector<storm::utility::parametric::Valuation<storm::RationalFunction>> valuations;
+    for (auto const& values : std::vector<std::pair<double, double>>({{0.8, 0.9}, {0.3, 0.5}, {0.9, 0.1}, {0.5, 0.5}})) {
+        storm::utility::parametric::Valuation<storm::RationalFunction> valuation;
+        valuation.emplace(pL, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(values.first));
+        valuation.emplace(pK, storm::utility::convertNumber<storm::RationalFunctionCoefficient>(values.second));
+        valuations.push_back(std::move(valuation));
+    }
+
+    // The simultaneous solution does not converge within a single iteration. The results then have to coincide with the single-valuation checks.
+    storm::Environment env;
+    env.solver().native().setMaximalNumberOfIterations(1);
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> modelchecker(*dtmc);
+    modelchecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas[0], true));
+    modelchecker.setInstantiationsAreGraphPreserving(true);
+
+    std::vector<std::unique_ptr<storm::modelchecker::CheckResult>> results = modelchecker.checkMultiple(env, valuations);
+    ASSERT_EQ(valuations.size(), results.size());
+    // Since results of previous checks are used as hints, we compare against a fresh model checker that checks the valuations in the same order.
+    storm::modelchecker::SparseDtmcInstantiationModelChecker<storm::models::sparse::Dtmc<storm::RationalFunction>, double> singleModelchecker(*dtmc);
+    singleModelchecker.specifyFormula(storm::modelchecker::CheckTask<storm::logic::Formula, storm::RationalFunction>(*formulas[0], true));
+    singleModelchecker.setInstantiationsAreGraphPreserving(true);
+    for (uint64_t i = 0; i < valuations.size(); ++i) {
+        std::unique_ptr<storm::modelchecker::CheckResult> singleResult = singleModelchecker.check(env, valuations[i]);
+        EXPECT_EQ(singleResult->asExplicitQuantitativeCheckResult<double>()[initialState], results[i]->asExplicitQuantitativeCheckResult<double>()[initialState]);
+    }
+}
+
+#endif
@@ -1,5 +1,7 @@
 #include "gtest/gtest.h"
+#include "storm/automata/AcceptanceCondition.h"
 #include "storm/automata/DeterministicAutomaton.h"
+#include "storm/storage/BitVector.h"
 
 #include <sstream>
 #include <string>
@@ -29,3 +31,48 @@ TEST(DeterministicAutomaton, ParseAutomaton) {
     ASSERT_NO_THROW(da = storm::automata::DeterministicAutomaton::parse(in));
     // da->printHOA(std::cout);
 }
+
+TEST(DeterministicAutomaton, PossiblyAcceptingStates) {
+    std::string aUb =
+        "HOA: v1\n"
+        "States: 3\n"
+        "Start: 0\n"
+        "acc-name: Rabin 1\n"
+        "Acceptance: 2 (Fin(0) & Inf(1))\n"
+        "AP: 2 \"a\" \"b\""
+        "--BODY--\n"
+        "State: 0 \"a U b\" { 0 }\n"
+        "  2  /* !a  & !b */\n"
+        "  0  /*  a  & !b */\n"
+        "  1  /* !a  &  b */\n"
+        "  1  /*  a  &  b */\n"
+        "State: 1 { 1 }\n"
+        "  1 1 1 1       /* four transitions on one line */\n"
+        "State: 2 \"sink state\" { 0 }\n"
+        "  2 2 2 2\n"
+        "--END--\n";
+
+    std::istringstream in = std::istringstream(aUb);
+    storm::automata::DeterministicAutomaton::ptr da;
+    ASSERT_NO_THROW(da = storm::automata::DeterministicAutomaton::parse(in));
+
+    auto stateSet = [](std::initializer_list<uint64_t> states) {
+        storm::storage::BitVector result(3, false);
+        for (auto state : states) {
+            result.set(state);
+        }
+        return result;
+    };
+
+    // Only cycles within state 1 are accepting. The sink state and cycles on state 0 violate Fin(0) or Inf(1).
+    auto const& acceptance = *da->getAcceptance();
+    EXPECT_TRUE(acceptance.isPossiblyAccepting(stateSet({1})));
+    EXPECT_FALSE(acceptance.isPossiblyAccepting(stateSet({0})));
+    EXPECT_FALSE(acceptance.isPossiblyAccepting(stateSet({2})));
+    EXPECT_FALSE(acceptance.isPossiblyAccepting(stateSet({0, 2})));
+    // The check over-approximates: some cycle within states 1 and 2 might avoid state 2.
+    EXPECT_TRUE(acceptance.isPossiblyAccepting(stateSet({1, 2})));
+
+    // The sink state can not reach state 1.
+    EXPECT_EQ(stateSet({0, 1}), da->getPossiblyAcceptingStates());
+}
@@ -6,7 +6,9 @@
 #include "storm/environment/Environment.h"
 #include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
 #include "storm/storage/jani/Property.h"
 #include "storm/utility/constants.h"
@@ -118,3 +120,34 @@ TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, cost_bounded_crowds) {
     EXPECT_EQ(storm::utility::convertNumber<storm::RationalNumber>(std::string("620529/1364000")),
               result->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
 }
+
+TEST(SparseDtmcMultiDimensionalRewardUnfoldingTest, parallel_epochs) {
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm";
+    std::string formulasAsString = "P=? [ F{\"num_rounds\"}<=2 \"elected\" ] ";
+    formulasAsString += "; P=? [ F{\"num_rounds\"}>=2,{\"num_rounds\"}<3 \"elected\" ] ";
+
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Dtmc<storm::RationalNumber>> dtmc =
+        storm::api::buildSparseModel<storm::RationalNumber>(program, formulas)->as<storm::models::sparse::Dtmc<storm::RationalNumber>>();
+    uint_fast64_t const initState = *dtmc->getInitialStates().begin();
+
+    // Analyzing the epochs of a wavefront in parallel has to yield exactly the results of the sequential analysis.
+    for (auto const& formula : formulas) {
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult, parallelResult;
+        {
+            auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+            sequentialResult = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formula, true));
+        }
+        {
+            auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+            parallelResult = storm::api::verifyWithSparseEngine(dtmc, storm::api::createTask<storm::RationalNumber>(formula, true));
+        }
+        ASSERT_TRUE(sequentialResult->isExplicitQuantitativeCheckResult());
+        ASSERT_TRUE(parallelResult->isExplicitQuantitativeCheckResult());
+        EXPECT_EQ(sequentialResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState],
+                  parallelResult->asExplicitQuantitativeCheckResult<storm::RationalNumber>()[initState]);
+    }
+}
@@ -18,6 +18,7 @@
 #include "storm/storage/geometry/Hyperrectangle.h"
 #include "storm/storage/geometry/Polytope.h"
 #include "storm/storage/jani/Property.h"
+#include "storm/utility/vector.h"
 
 TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, consensus) {
     if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
@@ -358,6 +359,113 @@ TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, simple_lra) {
     }
 }
 
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, simple_lra_batched) {
+    if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
+        GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
+    }
+    storm::Environment env;
+    env.modelchecker().multi().setMethod(storm::modelchecker::multiobjective::MultiObjectiveMethod::Pcaa);
+    env.modelchecker().multi().setWeightVectorBatchSize(3);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_simple_lra.nm";
+    std::string formulasAsString = "multi(R{\"first\"}max=? [ LRA ], R{\"second\"}max=? [ LRA ]);\n";              // pareto
+    formulasAsString += "multi(R{\"first\"}min=? [ C ], R{\"second\"}max=? [ LRA ], R{\"third\"}max=? [ C ]);\n";  // pareto
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program.checkValidity();
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    storm::generator::NextStateGeneratorOptions options(formulas);
+    auto mdp = storm::builder::ExplicitModelBuilder<double>(program, options).build()->as<storm::models::sparse::Mdp<double>>();
+
+    {
+        std::unique_ptr<storm::modelchecker::CheckResult> result =
+            storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[0]->asMultiObjectiveFormula());
+        ASSERT_TRUE(result->isExplicitParetoCurveCheckResult());
+        std::vector<std::vector<std::string>> expectedPoints;
+        expectedPoints.emplace_back(std::vector<std::string>({"5", "80/11"}));
+        expectedPoints.emplace_back(std::vector<std::string>({"0", "16"}));
+        double eps = 1e-4;
+        EXPECT_TRUE(expectSubset(result->asExplicitParetoCurveCheckResult<double>().getPoints(), convertPointset<double>(expectedPoints), eps))
+            << "Non-Pareto point found.";
+        EXPECT_TRUE(expectSubset(convertPointset<double>(expectedPoints), result->asExplicitParetoCurveCheckResult<double>().getPoints(), eps))
+            << "Pareto point missing.";
+    }
+    {
+        std::unique_ptr<storm::modelchecker::CheckResult> result =
+            storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(env, *mdp, formulas[1]->asMultiObjectiveFormula());
+        ASSERT_TRUE(result->isExplicitParetoCurveCheckResult());
+        std::vector<std::vector<std::string>> expectedPoints;
+        expectedPoints.emplace_back(std::vector<std::string>({"10/8", "0", "10/8"}));
+        expectedPoints.emplace_back(std::vector<std::string>({"7", "16", "2"}));
+        double eps = 1e-4;
+        EXPECT_TRUE(expectSubset(result->asExplicitParetoCurveCheckResult<double>().getPoints(), convertPointset<double>(expectedPoints), eps))
+            << "Non-Pareto point found.";
+        EXPECT_TRUE(expectSubset(convertPointset<double>(expectedPoints), result->asExplicitParetoCurveCheckResult<double>().getPoints(), eps))
+            << "Pareto point missing.";
+    }
+}
+
+TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, consensus_batched) {
+    if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
+        GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
+    }
+    // Without LRA objectives, the checks of a batch are warm-started. The results have to match the ones obtained without batches.
+    storm::Environment coldEnv;
+    coldEnv.modelchecker().multi().setMethod(storm::modelchecker::multiobjective::MultiObjectiveMethod::Pcaa);
+    storm::Environment warmEnv = coldEnv;
+    warmEnv.modelchecker().multi().setWeightVectorBatchSize(3);
+
+    std::string programFile = STORM_TEST_RESOURCES_DIR "/mdp/multiobj_consensus2_3_2.nm";
+    std::string formulasAsString = "multi(Pmax=? [ F \"one_proc_err\" ], Pmax=? [ G \"one_coin_ok\" ])";           // pareto
+    formulasAsString += "; \n multi(P>=0.1 [ F \"one_proc_err\" ], P>=0.8916673903 [ G \"one_coin_ok\" ])";   // achievability (true)
+    formulasAsString += "; \n multi(P>=0.11 [ F \"one_proc_err\" ], P>=0.8916673903 [ G \"one_coin_ok\" ])";  // achievability (false)
+
+    // programm, model,  formula
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    program = storm::utility::prism::preprocess(program, "");
+    std::vector<std::shared_ptr<storm::logic::Formula const>> formulas =
+        storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    std::shared_ptr<storm::models::sparse::Mdp<double>> mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint_fast64_t const initState = *mdp->getInitialStates().begin();
+
+    {
+        std::unique_ptr<storm::modelchecker::CheckResult> coldResult =
+            storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(coldEnv, *mdp, formulas[0]->asMultiObjectiveFormula());
+        std::unique_ptr<storm::modelchecker::CheckResult> warmResult =
+            storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(warmEnv, *mdp, formulas[0]->asMultiObjectiveFormula());
+        ASSERT_TRUE(coldResult->isExplicitParetoCurveCheckResult());
+        ASSERT_TRUE(warmResult->isExplicitParetoCurveCheckResult());
+        auto const& coldCurve = coldResult->asExplicitParetoCurveCheckResult<double>();
+        auto const& warmCurve = warmResult->asExplicitParetoCurveCheckResult<double>();
+        ASSERT_TRUE(coldCurve.hasOverApproximation());
+        ASSERT_TRUE(warmCurve.hasOverApproximation());
+
+        // Every point found in one run is achievable and thus (up to the precision) contained in the over-approximation of the other run.
+        double eps = 1e-4;
+        auto expectAchievable = [eps](std::vector<std::vector<double>> const& points, storm::storage::geometry::Polytope<double> const& overApproximation) {
+            for (auto point : points) {
+                for (auto& value : point) {
+                    value -= eps;
+                }
+                EXPECT_TRUE(overApproximation.contains(point)) << "Point " << storm::utility::vector::toString(point) << " is not achievable.";
+            }
+        };
+        expectAchievable(coldCurve.getPoints(), *warmCurve.getOverApproximation());
+        expectAchievable(warmCurve.getPoints(), *coldCurve.getOverApproximation());
+    }
+    for (uint64_t formulaIndex = 1; formulaIndex < formulas.size(); ++formulaIndex) {
+        std::unique_ptr<storm::modelchecker::CheckResult> coldResult =
+            storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(coldEnv, *mdp, formulas[formulaIndex]->asMultiObjectiveFormula());
+        std::unique_ptr<storm::modelchecker::CheckResult> warmResult =
+            storm::modelchecker::multiobjective::performMultiObjectiveModelChecking(warmEnv, *mdp, formulas[formulaIndex]->asMultiObjectiveFormula());
+        ASSERT_TRUE(coldResult->isExplicitQualitativeCheckResult());
+        ASSERT_TRUE(warmResult->isExplicitQualitativeCheckResult());
+        EXPECT_EQ(coldResult->asExplicitQualitativeCheckResult()[initState], warmResult->asExplicitQualitativeCheckResult()[initState]);
+    }
+}
+
 TEST(SparseMdpPcaaMultiObjectiveModelCheckerTest, resource_gathering) {
     if (!storm::test::z3AtLeastVersion(4, 8, 5)) {
         GTEST_SKIP() << "Test disabled since it triggers a bug in the installed version of z3.";
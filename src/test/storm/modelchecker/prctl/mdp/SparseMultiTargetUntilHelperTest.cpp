@@ -0,0 +1,70 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/MinMaxSolverEnvironment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/prctl/helper/SparseMultiTargetUntilHelper.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+
+TEST(SparseMultiTargetUntilHelperTest, TwoDice) {
+    std::vector<std::string> labels = {"two", "seven", "done"};
+    std::string formulasString = "Pmax=? [F \"two\"];Pmax=? [F \"seven\"];Pmax=? [F \"done\"]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint64_t initialState = *mdp->getInitialStates().begin();
+
+    storm::Environment env;
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-8));
+
+    std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> phiPsiStates;
+    for (auto const& label : labels) {
+        phiPsiStates.emplace_back(storm::storage::BitVector(mdp->getNumberOfStates(), true), mdp->getStates(label));
+    }
+    auto jointResults = storm::modelchecker::helper::SparseMultiTargetUntilHelper<double>::computeUntilProbabilities(
+        env, storm::solver::OptimizationDirection::Maximize, mdp->getTransitionMatrix(), mdp->getBackwardTransitions(), phiPsiStates);
+    ASSERT_EQ(labels.size(), jointResults.values.size());
+    EXPECT_EQ(std::vector<storm::solver::SolverStatus>(labels.size(), storm::solver::SolverStatus::Converged), jointResults.statuses);
+
+    EXPECT_NEAR(1.0 / 36.0, jointResults.values[0][initialState], 1e-6);
+    EXPECT_NEAR(1.0 / 6.0, jointResults.values[1][initialState], 1e-6);
+    EXPECT_NEAR(1.0, jointResults.values[2][initialState], 1e-6);
+
+    // The joint results coincide with the results of the individual computations for all states.
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    for (uint64_t index = 0; index < formulas.size(); ++index) {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[index]));
+        auto const& values = result->asExplicitQuantitativeCheckResult<double>().getValueVector();
+        ASSERT_EQ(values.size(), jointResults.values[index].size());
+        for (uint64_t state = 0; state < values.size(); ++state) {
+            EXPECT_NEAR(values[state], jointResults.values[index][state], 1e-6);
+        }
+    }
+}
+
+TEST(SparseMultiTargetUntilHelperTest, MaximalIterationsExceeded) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmax=? [F \"two\"]", program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+
+    storm::Environment env;
+    env.solver().minMax().setMaximalNumberOfIterations(1);
+
+    // The probabilities to reach "two" are not obtained within a single iteration. For an empty target set, no values need to be computed.
+    std::vector<std::pair<storm::storage::BitVector, storm::storage::BitVector>> phiPsiStates;
+    phiPsiStates.emplace_back(storm::storage::BitVector(mdp->getNumberOfStates(), true), mdp->getStates("two"));
+    phiPsiStates.emplace_back(storm::storage::BitVector(mdp->getNumberOfStates(), true), storm::storage::BitVector(mdp->getNumberOfStates(), false));
+    auto jointResults = storm::modelchecker::helper::SparseMultiTargetUntilHelper<double>::computeUntilProbabilities(
+        env, storm::solver::OptimizationDirection::Maximize, mdp->getTransitionMatrix(), mdp->getBackwardTransitions(), phiPsiStates);
+    ASSERT_EQ(2ul, jointResults.statuses.size());
+    EXPECT_EQ(storm::solver::SolverStatus::MaximalIterationsExceeded, jointResults.statuses[0]);
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, jointResults.statuses[1]);
+}
@@ -8,9 +8,13 @@
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingsManager.h"
 
+#include "storm-parsers/api/storm-parsers.h"
 #include "storm-parsers/parser/AutoParser.h"
+#include "storm/api/builder.h"
 #include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/GeneralSettings.h"
+#include "storm/utility/prism.h"
 
 TEST(SparseDtmcEliminationModelCheckerTest, Die) {
     std::shared_ptr<storm::models::sparse::Model<double>> abstractModel = storm::parser::AutoParser<>::parseModel(
@@ -139,3 +143,30 @@ TEST(SparseDtmcEliminationModelCheckerTest, SynchronousLeader) {
 
     EXPECT_NEAR(1.0448979, quantitativeResult2[0], storm::settings::getModule<storm::settings::modules::GeneralSettings>().getPrecision());
 }
+
+TEST(SparseDtmcEliminationModelCheckerTest, ParallelElimination) {
+    typedef storm::RationalNumber ValueType;
+    std::vector<std::pair<std::string, std::string>> inputs = {{STORM_TEST_RESOURCES_DIR "/dtmc/crowds-4-3.pm", "P=? [F \"observeIGreater1\"]"},
+                                                               {STORM_TEST_RESOURCES_DIR "/dtmc/leader-3-5.pm", "R{\"num_rounds\"}=? [F \"elected\"]"}};
+    for (auto const& input : inputs) {
+        storm::prism::Program program = storm::utility::prism::preprocess(storm::api::parseProgram(input.first), "");
+        auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(input.second, program));
+        auto dtmc = storm::api::buildSparseModel<ValueType>(program, formulas)->as<storm::models::sparse::Dtmc<ValueType>>();
+        storm::modelchecker::SparseDtmcEliminationModelChecker<storm::models::sparse::Dtmc<ValueType>> checker(*dtmc);
+        storm::modelchecker::CheckTask<storm::logic::Formula, ValueType> task(*formulas[0], true);
+        uint64_t const initialState = *dtmc->getInitialStates().begin();
+
+        // For exact values, eliminating states with disjoint neighborhoods concurrently yields exactly the sequential results.
+        std::unique_ptr<storm::modelchecker::CheckResult> sequentialResult, parallelResult;
+        {
+            auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+            sequentialResult = checker.check(task);
+        }
+        {
+            auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+            parallelResult = checker.check(task);
+        }
+        EXPECT_EQ(sequentialResult->asExplicitQuantitativeCheckResult<ValueType>()[initialState],
+                  parallelResult->asExplicitQuantitativeCheckResult<ValueType>()[initialState]);
+    }
+}
@@ -0,0 +1,117 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQualitativeCheckResult.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/modelchecker/smc/StatisticalTests.h"
+#include "storm/models/sparse/Ctmc.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/storage/jani/Property.h"
+#include "storm/utility/prism.h"
+
+#include "storm/exceptions/InvalidArgumentException.h"
+
+namespace {
+
+// The default error bounds yield an error of at most 0.01 with probability 0.95. We allow a larger deviation to keep the tests deterministic in
+// practice.
+double const tolerance = 0.05;
+
+class SmcModelCheckerTest : public ::testing::Test {
+   protected:
+    std::vector<std::shared_ptr<storm::logic::Formula const>> parse(std::string const& formulasAsString) {
+        return storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasAsString, program));
+    }
+
+    double checkSmc(std::shared_ptr<storm::logic::Formula const> const& formula) {
+        auto result = storm::api::verifyWithSmcEngine<double>(program, storm::api::createTask<double>(formula, true));
+        EXPECT_TRUE(result && result->isExplicitQuantitativeCheckResult());
+        return result->asExplicitQuantitativeCheckResult<double>()[0];
+    }
+
+    bool decideSmc(std::shared_ptr<storm::logic::Formula const> const& formula) {
+        auto result = storm::api::verifyWithSmcEngine<double>(program, storm::api::createTask<double>(formula, true));
+        EXPECT_TRUE(result && result->isExplicitQualitativeCheckResult());
+        return result->asExplicitQualitativeCheckResult()[0];
+    }
+
+    template<typename ModelType>
+    double checkSparse(std::shared_ptr<storm::logic::Formula const> const& formula) {
+        auto model = storm::api::buildSparseModel<double>(program, {formula})->template as<ModelType>();
+        auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formula, true));
+        return result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+    }
+
+    void load(std::string const& file) {
+        program = storm::utility::prism::preprocess(storm::api::parseProgram(file), "");
+    }
+
+    storm::prism::Program program;
+};
+
+TEST_F(SmcModelCheckerTest, ChernoffSampleCount) {
+    // ln(2/0.05) / (2 * 0.01^2) = 18444.4...
+    EXPECT_EQ(18445ull, storm::modelchecker::smc_detail::computeChernoffSampleCount(0.01, 0.05));
+    EXPECT_EQ(185ull, storm::modelchecker::smc_detail::computeChernoffSampleCount(0.1, 0.05));
+    STORM_SILENT_EXPECT_THROW(storm::modelchecker::smc_detail::computeChernoffSampleCount(0.0, 0.05), storm::exceptions::InvalidArgumentException);
+}
+
+TEST_F(SmcModelCheckerTest, SprtErrorBounds) {
+    // The hypotheses are p >= 0.6 and p <= 0.4. A small alpha requires more evidence to decide 'below' than a larger beta requires to decide
+    // 'above'.
+    typedef storm::modelchecker::smc_detail::SequentialProbabilityRatioTest Test;
+    Test aboveTest(0.5, 0.1, 0.001, 0.1);
+    while (aboveTest.addSamples(1, 1) == Test::Decision::Undecided) {
+    }
+    EXPECT_EQ(Test::Decision::Above, aboveTest.getDecision());
+    EXPECT_EQ(6ull, aboveTest.getNumberOfSamples());
+
+    Test belowTest(0.5, 0.1, 0.001, 0.1);
+    while (belowTest.addSamples(0, 1) == Test::Decision::Undecided) {
+    }
+    EXPECT_EQ(Test::Decision::Below, belowTest.getDecision());
+    EXPECT_EQ(17ull, belowTest.getNumberOfSamples());
+}
+
+TEST_F(SmcModelCheckerTest, Die) {
+    load(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = parse("P=? [F<=5 \"one\"]; R{\"coin_flips\"}=? [C<=5]; P=? [!\"two\" U<=10 \"done\"]");
+
+    EXPECT_NEAR(checkSparse<storm::models::sparse::Dtmc<double>>(formulas[0]), checkSmc(formulas[0]), tolerance);
+    EXPECT_NEAR(checkSparse<storm::models::sparse::Dtmc<double>>(formulas[1]), checkSmc(formulas[1]), 2 * tolerance);
+    EXPECT_NEAR(checkSparse<storm::models::sparse::Dtmc<double>>(formulas[2]), checkSmc(formulas[2]), tolerance);
+}
+
+TEST_F(SmcModelCheckerTest, DieSprt) {
+    load(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    // The probability to roll a one within five steps is 5/32.
+    auto formulas = parse("P>=0.1 [F<=5 \"one\"]; P>=0.3 [F<=5 \"one\"]; P<0.1 [F<=5 \"one\"]");
+
+    EXPECT_TRUE(decideSmc(formulas[0]));
+    EXPECT_FALSE(decideSmc(formulas[1]));
+    EXPECT_FALSE(decideSmc(formulas[2]));
+}
+
+TEST_F(SmcModelCheckerTest, Simple2) {
+    load(STORM_TEST_RESOURCES_DIR "/ctmc/simple2.sm");
+    auto formulas = parse("P=? [F<=1 s=3]; R{\"rew1\"}=? [C<=2]; R{\"rew1\"}=? [I=0.1]");
+
+    EXPECT_NEAR(checkSparse<storm::models::sparse::Ctmc<double>>(formulas[0]), checkSmc(formulas[0]), tolerance);
+    EXPECT_NEAR(checkSparse<storm::models::sparse::Ctmc<double>>(formulas[1]), checkSmc(formulas[1]), 4 * tolerance);
+    EXPECT_NEAR(checkSparse<storm::models::sparse::Ctmc<double>>(formulas[2]), checkSmc(formulas[2]), 4 * tolerance);
+}
+
+TEST_F(SmcModelCheckerTest, TwoDice) {
+    load(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = parse("Pmin=? [F<=20 \"three\"]; Pmax=? [F<=20 \"three\"]");
+
+    // Any scheduler yields a value between the minimal and the maximal probability.
+    double estimate = checkSmc(formulas[0]);
+    EXPECT_LE(checkSparse<storm::models::sparse::Mdp<double>>(formulas[0]) - tolerance, estimate);
+    EXPECT_GE(checkSparse<storm::models::sparse::Mdp<double>>(formulas[1]) + tolerance, estimate);
+}
+
+}  // namespace
@@ -8,12 +8,17 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
 #include "storm-parsers/parser/DeterministicSparseTransitionParser.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/SparseMatrix.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
@@ -240,3 +245,42 @@ TEST(DeterministicSparseTransitionParserTest, RewardForNonExistentTransition) {
                                   STORM_TEST_RESOURCES_DIR "/rew/dtmc_rewardForNonExTrans.trans.rew", transitionMatrix),
                               storm::exceptions::WrongFormatException);
 }
+
+TEST(DeterministicSparseTransitionParserTest, LargeFile) {
+    // Write a transitions file that is large enough to be split into several chunks and check that the chunks are put together correctly.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_deterministic_transition_parser_test.tra").string();
+    uint64_t const numberOfStates = 100000;
+    {
+        std::ofstream file(filename);
+        file << "dtmc\n";
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            uint64_t successor = (state + 1) % numberOfStates;
+            file << state << " " << std::min(state, successor) << " 0.5\n" << state << " " << std::max(state, successor) << " 0.5\n";
+        }
+    }
+    storm::storage::SparseMatrix<double> transitionMatrix, parallelTransitionMatrix;
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        transitionMatrix = storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(filename);
+    }
+    {
+        // Parsing the chunks in parallel has to yield the same matrix.
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelTransitionMatrix = storm::parser::DeterministicSparseTransitionParser<>::parseDeterministicTransitions(filename);
+    }
+    std::remove(filename.c_str());
+    EXPECT_TRUE(transitionMatrix == parallelTransitionMatrix);
+
+    ASSERT_EQ(numberOfStates, transitionMatrix.getRowCount());
+    ASSERT_EQ(numberOfStates, transitionMatrix.getColumnCount());
+    ASSERT_EQ(2 * numberOfStates, transitionMatrix.getEntryCount());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t successor = (state + 1) % numberOfStates;
+        storm::storage::SparseMatrix<double>::const_iterator cIter = transitionMatrix.begin(state);
+        ASSERT_EQ(std::min(state, successor), cIter->getColumn());
+        ASSERT_EQ(0.5, cIter->getValue());
+        cIter++;
+        ASSERT_EQ(std::max(state, successor), cIter->getColumn());
+        ASSERT_EQ(0.5, cIter->getValue());
+    }
+}
@@ -1,10 +1,18 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
 #include "storm-parsers/parser/DirectEncodingParser.h"
+#include "storm/exceptions/WrongFormatException.h"
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/Mdp.h"
 #include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 TEST(DirectEncodingParserTest, DtmcParsing) {
     std::shared_ptr<storm::models::sparse::Model<double>> modelPtr =
@@ -87,3 +95,75 @@ TEST(DirectEncodingParserTest, MarkovAutomatonParsing) {
     ASSERT_TRUE(modelPtr->hasLabel("one_job_finished"));
     ASSERT_EQ(6ul, modelPtr->getStates("one_job_finished").getNumberOfSetBits());
 }
+
+TEST(DirectEncodingParserTest, ChoicesBeforeFirstState) {
+    // Actions and transitions can only be given for a state. Previously, they were silently attributed to the first choice of the first state.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_direct_encoding_parser_test.drn").string();
+    std::string const header = "@type: MDP\n@nr_states\n1\n@model\n";
+    std::string const state = "state 0 init\n\taction 0\n\t\t0 : 1\n";
+    for (std::string const& choice : {"action 0\n\t0 : 1\n", "\t0 : 1\n"}) {
+        {
+            std::ofstream file(filename);
+            file << header << choice << state;
+        }
+        STORM_SILENT_EXPECT_THROW(storm::parser::DirectEncodingParser<double>::parseModel(filename), storm::exceptions::WrongFormatException);
+    }
+
+    // Without them, the file is parsed.
+    {
+        std::ofstream file(filename);
+        file << header << state;
+    }
+    std::shared_ptr<storm::models::sparse::Model<double>> modelPtr = storm::parser::DirectEncodingParser<double>::parseModel(filename);
+    std::remove(filename.c_str());
+    ASSERT_EQ(1ul, modelPtr->getNumberOfStates());
+    ASSERT_EQ(1ul, modelPtr->getNumberOfTransitions());
+}
+
+TEST(DirectEncodingParserTest, LargeFile) {
+    // Write a Markov automaton that is large enough to be split into several chunks and check that parsing the chunks in parallel yields the
+    // same model as parsing them sequentially.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_direct_encoding_parser_large_test.drn").string();
+    uint64_t const numberOfStates = 40000;
+    {
+        std::ofstream file(filename);
+        file << "@type: Markov Automaton\n@parameters\n\n@reward_models\ncoins\n@nr_states\n" << numberOfStates << "\n@nr_choices\n"
+             << numberOfStates / 2 * 3 << "\n@model\n";
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            uint64_t successor = (state + 1) % numberOfStates;
+            uint64_t jumpSuccessor = (state + 7) % numberOfStates;
+            if (state % 2 == 0) {
+                file << "state " << state << " !2 [" << state % 3 << "] even" << (state == 0 ? " init" : "") << "\n";
+                file << "\taction 0 [1]\n\t\t" << successor << " : 0.5\n\t\t" << jumpSuccessor << " : 0.5\n";
+            } else {
+                file << "state " << state << " !0 [" << state % 3 << "]\n";
+                file << "\taction 0 [0]\n\t\t" << successor << " : 1\n";
+                file << "\taction 1 [2]\n\t\t" << jumpSuccessor << " : 0.25\n\t\t" << successor << " : 0.75\n";
+            }
+        }
+    }
+
+    std::shared_ptr<storm::models::sparse::MarkovAutomaton<double>> sequentialMa, parallelMa;
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        sequentialMa = storm::parser::DirectEncodingParser<double>::parseModel(filename)->as<storm::models::sparse::MarkovAutomaton<double>>();
+    }
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelMa = storm::parser::DirectEncodingParser<double>::parseModel(filename)->as<storm::models::sparse::MarkovAutomaton<double>>();
+    }
+    std::remove(filename.c_str());
+
+    ASSERT_EQ(numberOfStates, sequentialMa->getNumberOfStates());
+    ASSERT_EQ(numberOfStates / 2 * 3, sequentialMa->getNumberOfChoices());
+    ASSERT_EQ(numberOfStates / 2, sequentialMa->getMarkovianStates().getNumberOfSetBits());
+    ASSERT_EQ(numberOfStates / 2, sequentialMa->getStates("even").getNumberOfSetBits());
+    EXPECT_TRUE(sequentialMa->getTransitionMatrix() == parallelMa->getTransitionMatrix());
+    EXPECT_EQ(sequentialMa->getMarkovianStates(), parallelMa->getMarkovianStates());
+    EXPECT_EQ(sequentialMa->getExitRates(), parallelMa->getExitRates());
+    EXPECT_TRUE(sequentialMa->getStateLabeling() == parallelMa->getStateLabeling());
+    auto const& sequentialRewards = sequentialMa->getRewardModel("coins");
+    auto const& parallelRewards = parallelMa->getRewardModel("coins");
+    EXPECT_EQ(sequentialRewards.getStateRewardVector(), parallelRewards.getStateRewardVector());
+    EXPECT_EQ(sequentialRewards.getStateActionRewardVector(), parallelRewards.getStateActionRewardVector());
+}
@@ -0,0 +1,50 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstring>
+#include <string>
+
+#include "storm-parsers/parser/FileChunks.h"
+
+TEST(FileChunksTest, SplitAtLineBoundaries) {
+    std::string content = "0 1 1\n1 2 0.5\n1 3 0.5\n2 2 1\n3 0 0.25\n3 3 0.75\n";
+    char const* begin = content.data();
+    char const* end = begin + content.size();
+
+    storm::parser::FileChunks chunks(begin, end, nullptr, 8);
+    ASSERT_LT(1ul, chunks.size());
+    EXPECT_EQ(begin, chunks.getBegin(0));
+    EXPECT_EQ(end, chunks.getEnd(chunks.size() - 1));
+    for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+        // Every chunk is non-empty, begins at a line and is followed directly by the next one.
+        EXPECT_LT(chunks.getBegin(chunk), chunks.getEnd(chunk));
+        EXPECT_TRUE(chunk == 0 || chunks.getBegin(chunk)[-1] == '\n');
+        if (chunk + 1 < chunks.size()) {
+            EXPECT_EQ(chunks.getEnd(chunk), chunks.getBegin(chunk + 1));
+            EXPECT_LE(8, chunks.getEnd(chunk) - chunks.getBegin(chunk));
+        }
+    }
+
+    // A large minimal chunk size yields a single chunk.
+    storm::parser::FileChunks singleChunk(begin, end);
+    ASSERT_EQ(1ul, singleChunk.size());
+    EXPECT_EQ(begin, singleChunk.getBegin(0));
+    EXPECT_EQ(end, singleChunk.getEnd(0));
+}
+
+TEST(FileChunksTest, RespectsPredicate) {
+    std::string content = "state 0\n  1 : 0.5\n  2 : 0.5\nstate 1\n  1 : 1\nstate 2\n  0 : 0.25\n  1 : 0.25\n  2 : 0.5\n";
+    char const* begin = content.data();
+    char const* end = begin + content.size();
+
+    storm::parser::FileChunks chunks(begin, end, [end](char const* line) { return end - line >= 6 && std::strncmp(line, "state ", 6) == 0; }, 1);
+    ASSERT_EQ(3ul, chunks.size());
+    for (uint64_t chunk = 0; chunk < chunks.size(); ++chunk) {
+        EXPECT_EQ(0, std::strncmp(chunks.getBegin(chunk), "state ", 6));
+    }
+
+    // Every chunk is processed exactly once.
+    std::vector<uint64_t> visits(chunks.size(), 0);
+    chunks.forEach([&visits](uint64_t chunk) { ++visits[chunk]; });
+    EXPECT_EQ(std::vector<uint64_t>(chunks.size(), 1), visits);
+}
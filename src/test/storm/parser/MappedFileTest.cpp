@@ -12,6 +12,7 @@
 #include "storm-parsers/parser/MappedFile.h"
 #include "storm-parsers/util/cstring.h"
 #include "storm/exceptions/FileIoException.h"
+#include "storm/exceptions/WrongFormatException.h"
 #include "storm/io/file.h"
 
 TEST(MappedFileTest, NonExistingFile) {
@@ -48,3 +49,18 @@ TEST(MappedFileTest, ExistsAndReadble) {
     // TODO: Find portable solution to providing a situation in which a file exists but is not readable.
     // ASSERT_FALSE(storm::utility::fileExistsAndIsReadable(STORM_TEST_RESOURCES_DIR "/parser/unreadableFile.txt"));
 }
+
+TEST(MappedFileTest, CheckedNumberParsing) {
+    std::string numbers = " 123456\t+1.5 +-1";
+    char const* buf = numbers.c_str();
+
+    // The end of the data bounds the parsed number.
+    char const* end;
+    EXPECT_EQ(123ul, storm::utility::cstring::checked_strtol(buf, &end, buf + 4));
+    EXPECT_EQ(buf + 4, end);
+    EXPECT_EQ(123456ul, storm::utility::cstring::checked_strtol(buf, &buf));
+
+    // A leading '+' is accepted, but not if it is followed by a sign.
+    EXPECT_EQ(1.5, storm::utility::cstring::checked_strtod(buf, &buf, numbers.c_str() + numbers.size()));
+    STORM_SILENT_EXPECT_THROW(storm::utility::cstring::checked_strtol(buf, &buf, numbers.c_str() + numbers.size()), storm::exceptions::WrongFormatException);
+}
@@ -10,6 +10,9 @@
 #include "storm/settings/modules/BuildSettings.h"
 #include "test/storm_gtest.h"
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <vector>
 
 #include "storm-parsers/parser/MarkovAutomatonParser.h"
@@ -18,6 +21,7 @@
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/settings/SettingMemento.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #define STATE_COUNT 6ul
 #define CHOICE_COUNT 7ul
@@ -215,3 +219,88 @@ TEST(MarkovAutomatonSparseTransitionParserTest, DontFixDeadlocks) {
         storm::parser::MarkovAutomatonSparseTransitionParser<>::parseMarkovAutomatonTransitions(STORM_TEST_RESOURCES_DIR "/tra/ma_deadlock.tra"),
         storm::exceptions::WrongFormatException);
 }
+
+TEST(MarkovAutomatonSparseTransitionParserTest, DontFixDeadlocksWithoutDeadlocks) {
+    // With the fixDeadlocksFlag unset, a Markov Automaton transition file without deadlock states is parsed as usual.
+    std::unique_ptr<storm::settings::SettingMemento> dontFixDeadlocks = storm::settings::mutableBuildSettings().overrideDontFixDeadlocksSet(true);
+
+    typename storm::parser::MarkovAutomatonSparseTransitionParser<>::Result result =
+        storm::parser::MarkovAutomatonSparseTransitionParser<>::parseMarkovAutomatonTransitions(STORM_TEST_RESOURCES_DIR "/tra/ma_general.tra");
+    storm::storage::SparseMatrix<double> transitionMatrix(result.transitionMatrixBuilder.build());
+    ASSERT_EQ(STATE_COUNT, transitionMatrix.getRowGroupCount());
+    ASSERT_EQ(CHOICE_COUNT, transitionMatrix.getRowCount());
+}
+
+TEST(MarkovAutomatonSparseTransitionParserTest, LeadingStatesWithoutChoices) {
+    // The states before the first source state have no choice and get a self-loop, just like the states between or behind the source states.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_markov_automaton_transition_parser_test.tra").string();
+    {
+        std::ofstream file(filename);
+        file << "ma\n2 !\n* 0 1\n* 3 2\n3 a\n* 2 1\n";
+    }
+
+    typename storm::parser::MarkovAutomatonSparseTransitionParser<>::Result result =
+        storm::parser::MarkovAutomatonSparseTransitionParser<>::parseMarkovAutomatonTransitions(filename);
+    storm::storage::SparseMatrix<double> transitionMatrix(result.transitionMatrixBuilder.build());
+    ASSERT_EQ(4ul, transitionMatrix.getRowGroupCount());
+    ASSERT_EQ(4ul, transitionMatrix.getRowCount());
+    ASSERT_EQ(5ul, transitionMatrix.getEntryCount());
+    for (uint_fast64_t state = 0; state < 2; ++state) {
+        ASSERT_EQ(1ul, transitionMatrix.getRow(state).getNumberOfEntries());
+        ASSERT_EQ(state, transitionMatrix.getRow(state).begin()->getColumn());
+        ASSERT_EQ(1, transitionMatrix.getRow(state).begin()->getValue());
+    }
+    ASSERT_EQ(1ul, result.markovianStates.getNumberOfSetBits());
+    ASSERT_TRUE(result.markovianStates.get(2));
+    ASSERT_EQ(3, result.exitRates[2]);
+
+    // If deadlocks are not fixed, the leading states are reported.
+    std::unique_ptr<storm::settings::SettingMemento> dontFixDeadlocks = storm::settings::mutableBuildSettings().overrideDontFixDeadlocksSet(true);
+    STORM_SILENT_EXPECT_THROW(storm::parser::MarkovAutomatonSparseTransitionParser<>::parseMarkovAutomatonTransitions(filename),
+                              storm::exceptions::WrongFormatException);
+    std::remove(filename.c_str());
+}
+
+TEST(MarkovAutomatonSparseTransitionParserTest, LargeFile) {
+    // Write a transitions file that is large enough to be split into several chunks and check that parsing the chunks in parallel yields the
+    // same result as parsing them sequentially.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_markov_automaton_transition_parser_large_test.tra").string();
+    uint_fast64_t const numberOfStates = 50000;
+    {
+        std::ofstream file(filename);
+        file << "ma\n";
+        for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+            uint_fast64_t successor = (state + 1) % numberOfStates;
+            uint_fast64_t jumpSuccessor = (state + 7) % numberOfStates;
+            if (state % 2 == 0) {
+                file << state << " !\n* " << successor << " 2\n* " << jumpSuccessor << " 1\n";
+            } else {
+                file << state << " a\n* " << successor << " 1\n" << state << " b\n* " << jumpSuccessor << " 0.5\n* " << successor << " 0.5\n";
+            }
+        }
+    }
+
+    std::unique_ptr<typename storm::parser::MarkovAutomatonSparseTransitionParser<>::Result> sequentialResult, parallelResult;
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        sequentialResult = std::make_unique<typename storm::parser::MarkovAutomatonSparseTransitionParser<>::Result>(
+            storm::parser::MarkovAutomatonSparseTransitionParser<>::parseMarkovAutomatonTransitions(filename));
+    }
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelResult = std::make_unique<typename storm::parser::MarkovAutomatonSparseTransitionParser<>::Result>(
+            storm::parser::MarkovAutomatonSparseTransitionParser<>::parseMarkovAutomatonTransitions(filename));
+    }
+    std::remove(filename.c_str());
+
+    storm::storage::SparseMatrix<double> sequentialMatrix(sequentialResult->transitionMatrixBuilder.build());
+    storm::storage::SparseMatrix<double> parallelMatrix(parallelResult->transitionMatrixBuilder.build());
+    ASSERT_EQ(numberOfStates, sequentialMatrix.getRowGroupCount());
+    ASSERT_EQ(numberOfStates / 2 * 3, sequentialMatrix.getRowCount());
+    ASSERT_EQ(numberOfStates / 2 * 5, sequentialMatrix.getEntryCount());
+    ASSERT_EQ(numberOfStates / 2, sequentialResult->markovianStates.getNumberOfSetBits());
+    EXPECT_TRUE(sequentialMatrix == parallelMatrix);
+    EXPECT_EQ(sequentialResult->markovianChoices, parallelResult->markovianChoices);
+    EXPECT_EQ(sequentialResult->markovianStates, parallelResult->markovianStates);
+    EXPECT_EQ(sequentialResult->exitRates, parallelResult->exitRates);
+}
@@ -8,6 +8,10 @@
 #include "storm-config.h"
 #include "test/storm_gtest.h"
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
 #include "storm-parsers/parser/NondeterministicSparseTransitionParser.h"
 #include "storm/settings/SettingMemento.h"
 #include "storm/storage/SparseMatrix.h"
@@ -16,6 +20,7 @@
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/settings/SettingsManager.h"
 #include "storm/settings/modules/BuildSettings.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/exceptions/InvalidArgumentException.h"
 
@@ -291,3 +296,48 @@ TEST(NondeterministicSparseTransitionParserTest, RewardForNonExistentTransition)
                                   STORM_TEST_RESOURCES_DIR "/rew/mdp_rewardForNonExTrans.trans.rew", transitionResult),
                               storm::exceptions::WrongFormatException);
 }
+
+TEST(NondeterministicSparseTransitionParserTest, LargeFile) {
+    // Write a transitions file that is large enough to be split into several chunks and check that the chunks are put together correctly.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_nondeterministic_transition_parser_test.tra").string();
+    uint64_t const numberOfStates = 50000;
+    {
+        std::ofstream file(filename);
+        file << "mdp\n";
+        for (uint64_t state = 0; state < numberOfStates; ++state) {
+            uint64_t successor = (state + 1) % numberOfStates;
+            file << state << " 0 " << successor << " 1\n";
+            file << state << " 1 " << std::min(state, successor) << " 0.5\n" << state << " 1 " << std::max(state, successor) << " 0.5\n";
+        }
+    }
+    storm::storage::SparseMatrix<double> result, parallelResult;
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        result = storm::parser::NondeterministicSparseTransitionParser<>::parseNondeterministicTransitions(filename);
+    }
+    {
+        // Parsing the chunks in parallel has to yield the same matrix.
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelResult = storm::parser::NondeterministicSparseTransitionParser<>::parseNondeterministicTransitions(filename);
+    }
+    std::remove(filename.c_str());
+    EXPECT_TRUE(result == parallelResult);
+
+    ASSERT_EQ(numberOfStates, result.getRowGroupCount());
+    ASSERT_EQ(2 * numberOfStates, result.getRowCount());
+    ASSERT_EQ(numberOfStates, result.getColumnCount());
+    ASSERT_EQ(3 * numberOfStates, result.getEntryCount());
+    for (uint64_t state = 0; state < numberOfStates; ++state) {
+        uint64_t successor = (state + 1) % numberOfStates;
+        ASSERT_EQ(2 * state, result.getRowGroupIndices()[state]);
+        storm::storage::SparseMatrix<double>::const_iterator cIter = result.begin(2 * state);
+        ASSERT_EQ(successor, cIter->getColumn());
+        ASSERT_EQ(1, cIter->getValue());
+        cIter++;
+        ASSERT_EQ(std::min(state, successor), cIter->getColumn());
+        ASSERT_EQ(0.5, cIter->getValue());
+        cIter++;
+        ASSERT_EQ(std::max(state, successor), cIter->getColumn());
+        ASSERT_EQ(0.5, cIter->getValue());
+    }
+}
@@ -4,8 +4,14 @@
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/WrongFormatException.h"
 #include "storm/models/sparse/StateLabeling.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "test/storm_gtest.h"
 
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
 #include <memory>
 
 TEST(SparseItemLabelingParserTest, NonExistingFile) {
@@ -182,3 +188,41 @@ TEST(SparseItemLabelingParserTest, Whitespaces) {
         storm::parser::SparseItemLabelingParser::parseAtomicPropositionLabeling(13, STORM_TEST_RESOURCES_DIR "/lab/withWhitespaces.lab");
     ASSERT_TRUE(labeling == labeling2);
 }
+
+TEST(SparseItemLabelingParserTest, LargeFile) {
+    // Write a labeling file that is large enough to be split into several chunks and check that parsing the chunks in parallel yields the same
+    // labeling as parsing them sequentially.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_sparse_item_labeling_parser_test.lab").string();
+    uint_fast64_t const numberOfStates = 150000;
+    {
+        std::ofstream file(filename);
+        file << "#DECLARATION\ninit even third\n#END\n";
+        for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+            if (state % 2 == 0 || state % 3 == 0) {
+                file << state << (state == 0 ? " init" : "") << (state % 2 == 0 ? " even" : "") << (state % 3 == 0 ? " third" : "") << "\n";
+            }
+        }
+    }
+
+    std::unique_ptr<storm::models::sparse::StateLabeling> sequentialLabeling, parallelLabeling;
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        sequentialLabeling = std::make_unique<storm::models::sparse::StateLabeling>(
+            storm::parser::SparseItemLabelingParser::parseAtomicPropositionLabeling(numberOfStates, filename));
+    }
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelLabeling = std::make_unique<storm::models::sparse::StateLabeling>(
+            storm::parser::SparseItemLabelingParser::parseAtomicPropositionLabeling(numberOfStates, filename));
+    }
+    std::remove(filename.c_str());
+
+    EXPECT_EQ(1ull, sequentialLabeling->getStates("init").getNumberOfSetBits());
+    EXPECT_EQ(numberOfStates / 2, sequentialLabeling->getStates("even").getNumberOfSetBits());
+    EXPECT_EQ(numberOfStates / 3, sequentialLabeling->getStates("third").getNumberOfSetBits());
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        ASSERT_EQ(state % 2 == 0, sequentialLabeling->getStateHasLabel("even", state));
+        ASSERT_EQ(state % 3 == 0, sequentialLabeling->getStateHasLabel("third", state));
+    }
+    EXPECT_TRUE(*sequentialLabeling == *parallelLabeling);
+}
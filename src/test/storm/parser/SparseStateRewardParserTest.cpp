@@ -9,11 +9,19 @@
 #include "test/storm_gtest.h"
 
 #include <cmath>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
 
+#include "storm-parsers/parser/FileChunks.h"
 #include "storm-parsers/parser/SparseStateRewardParser.h"
 #include "storm/exceptions/FileIoException.h"
 #include "storm/exceptions/OutOfRangeException.h"
 #include "storm/exceptions/WrongFormatException.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 TEST(SparseStateRewardParserTest, NonExistingFile) {
     // No matter what happens, please do NOT create a file with the name "nonExistingFile.not"!
@@ -68,3 +76,51 @@ TEST(SparseStateRewardParserTest, RewardForNonExistentState) {
         storm::parser::SparseStateRewardParser<>::parseSparseStateReward(99, STORM_TEST_RESOURCES_DIR "/rew/state_reward_parser_basic.state.rew"),
         storm::exceptions::OutOfRangeException);
 }
+
+TEST(SparseStateRewardParserTest, LargeFile) {
+    // Write a reward file that is large enough to be split into several chunks and check that parsing the chunks in parallel yields the same
+    // rewards as parsing them sequentially.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_state_reward_parser_test.state.rew").string();
+    uint_fast64_t const numberOfStates = 200000;
+    std::stringstream contents;
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        if (state % 5 != 0) {
+            contents << state << " " << state * 0.25 << "\n";
+        }
+    }
+    {
+        std::ofstream file(filename);
+        file << contents.str();
+    }
+
+    std::vector<double> sequentialResult, parallelResult;
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        sequentialResult = storm::parser::SparseStateRewardParser<>::parseSparseStateReward(numberOfStates, filename);
+    }
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelResult = storm::parser::SparseStateRewardParser<>::parseSparseStateReward(numberOfStates, filename);
+    }
+
+    ASSERT_EQ(numberOfStates, sequentialResult.size());
+    for (uint_fast64_t state = 0; state < numberOfStates; ++state) {
+        ASSERT_EQ(state % 5 == 0 ? 0.0 : state * 0.25, sequentialResult[state]);
+    }
+    EXPECT_EQ(sequentialResult, parallelResult);
+
+    // A state that was already read is detected in both modes, even if it is the first one of the second chunk.
+    std::string withRepeatedState = contents.str();
+    std::size_t secondChunkBegin = withRepeatedState.find('\n', storm::parser::FileChunks::defaultMinimalChunkSize - 1) + 1;
+    withRepeatedState.insert(secondChunkBegin, "1 1\n");
+    {
+        std::ofstream file(filename);
+        file << withRepeatedState;
+    }
+    for (bool useIntelTbb : {false, true}) {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(useIntelTbb);
+        STORM_SILENT_EXPECT_THROW(storm::parser::SparseStateRewardParser<>::parseSparseStateReward(numberOfStates, filename),
+                                  storm::exceptions::WrongFormatException);
+    }
+    std::remove(filename.c_str());
+}
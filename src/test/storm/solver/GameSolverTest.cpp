@@ -3,7 +3,9 @@
 
 #include "storm/storage/SparseMatrix.h"
 
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 
 #include "storm/environment/solver/GameSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
@@ -132,4 +134,84 @@ TYPED_TEST(GameSolverTest, SolveEquations) {
     EXPECT_NEAR(this->parseNumber("1"), result[0], this->precision());
 }
 
+TYPED_TEST(GameSolverTest, RepeatedMultiplyWithPlayer1Grouping) {
+    typedef typename TestFixture::ValueType ValueType;
+    // Player 1 state 0 chooses between player 2 states 0 and 1, player 1 states 1 and 2 are absorbing.
+    storm::storage::SparseMatrixBuilder<ValueType> player2MatrixBuilder(0, 0, 0, false, true);
+    player2MatrixBuilder.newRowGroup(0);
+    player2MatrixBuilder.addNextValue(0, 1, this->parseNumber("0.5"));
+    player2MatrixBuilder.addNextValue(0, 2, this->parseNumber("0.5"));
+    player2MatrixBuilder.addNextValue(1, 0, this->parseNumber("1"));
+    player2MatrixBuilder.newRowGroup(2);
+    player2MatrixBuilder.addNextValue(2, 1, this->parseNumber("1"));
+    player2MatrixBuilder.newRowGroup(3);
+    player2MatrixBuilder.addNextValue(3, 1, this->parseNumber("1"));
+    player2MatrixBuilder.newRowGroup(4);
+    player2MatrixBuilder.addNextValue(4, 2, this->parseNumber("1"));
+    storm::storage::SparseMatrix<ValueType> player2Matrix = player2MatrixBuilder.build();
+    std::vector<uint64_t> player1Grouping = {0, 2, 3, 4};
+
+    storm::solver::GameSolverFactory<ValueType> factory;
+    auto solver = factory.create(this->env(), player1Grouping, player2Matrix);
+
+    std::vector<ValueType> x = {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")};
+    solver->repeatedMultiply(this->env(), storm::OptimizationDirection::Maximize, storm::OptimizationDirection::Minimize, x, nullptr, 1);
+    EXPECT_NEAR(this->parseNumber("1"), x[0], this->precision());
+    EXPECT_NEAR(this->parseNumber("1"), x[1], this->precision());
+    EXPECT_NEAR(this->parseNumber("0"), x[2], this->precision());
+
+    x = {this->parseNumber("0"), this->parseNumber("1"), this->parseNumber("0")};
+    solver->repeatedMultiply(this->env(), storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize, x, nullptr, 2);
+    EXPECT_NEAR(this->parseNumber("0.5"), x[0], this->precision());
+    EXPECT_NEAR(this->parseNumber("1"), x[1], this->precision());
+    EXPECT_NEAR(this->parseNumber("0"), x[2], this->precision());
+
+    // With Intel TBB, the player 1 states are processed in parallel. This has to yield the same values and schedulers.
+    // Player 1 state 0 chooses between player 2 states 0 and 1, player 1 state 1 owns player 2 state 2 and player 1 state 2 chooses between
+    // player 2 states 3 and 4. The values of b are the probabilities to directly reach a goal.
+    storm::storage::SparseMatrixBuilder<ValueType> gameMatrixBuilder(0, 0, 0, false, true);
+    gameMatrixBuilder.newRowGroup(0);
+    gameMatrixBuilder.addNextValue(0, 0, this->parseNumber("0.2"));
+    gameMatrixBuilder.addNextValue(0, 1, this->parseNumber("0.5"));
+    gameMatrixBuilder.addNextValue(1, 2, this->parseNumber("0.9"));
+    gameMatrixBuilder.newRowGroup(2);
+    gameMatrixBuilder.addNextValue(2, 0, this->parseNumber("0.6"));
+    gameMatrixBuilder.newRowGroup(3);
+    gameMatrixBuilder.addNextValue(3, 0, this->parseNumber("0.5"));
+    gameMatrixBuilder.addNextValue(4, 2, this->parseNumber("0.3"));
+    gameMatrixBuilder.newRowGroup(5);
+    gameMatrixBuilder.addNextValue(5, 0, this->parseNumber("0.4"));
+    gameMatrixBuilder.addNextValue(5, 1, this->parseNumber("0.4"));
+    gameMatrixBuilder.newRowGroup(6);
+    gameMatrixBuilder.addNextValue(6, 2, this->parseNumber("0.8"));
+    storm::storage::SparseMatrix<ValueType> gameMatrix = gameMatrixBuilder.build();
+    std::vector<uint64_t> gameGrouping = {0, 2, 3, 5};
+    std::vector<ValueType> const b = {this->parseNumber("0.3"), this->parseNumber("0.1"), this->parseNumber("0.4"), this->parseNumber("0.5"),
+                                      this->parseNumber("0.7"), this->parseNumber("0.2"), this->parseNumber("0.1")};
+
+    for (auto player1Dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        for (auto player2Dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+            std::vector<std::vector<ValueType>> multiplyResults, solveResults;
+            std::vector<std::vector<uint64_t>> player1Choices, player2Choices;
+            for (bool useIntelTbb : {false, true}) {
+                auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(useIntelTbb);
+                auto gameSolver = factory.create(this->env(), gameGrouping, gameMatrix);
+                multiplyResults.emplace_back(3, this->parseNumber("0"));
+                gameSolver->repeatedMultiply(this->env(), player1Dir, player2Dir, multiplyResults.back(), &b, 5);
+                gameSolver->setTrackSchedulers();
+                solveResults.emplace_back(3, this->parseNumber("0"));
+                gameSolver->solveGame(this->env(), player1Dir, player2Dir, solveResults.back(), b);
+                player1Choices.push_back(gameSolver->getPlayer1SchedulerChoices());
+                player2Choices.push_back(gameSolver->getPlayer2SchedulerChoices());
+            }
+            for (uint64_t state = 0; state < 3; ++state) {
+                EXPECT_NEAR(multiplyResults[0][state], multiplyResults[1][state], this->precision());
+                EXPECT_NEAR(solveResults[0][state], solveResults[1][state], this->precision());
+            }
+            EXPECT_EQ(player1Choices[0], player1Choices[1]);
+            EXPECT_EQ(player2Choices[0], player2Choices[1]);
+        }
+    }
+}
+
 }  // namespace
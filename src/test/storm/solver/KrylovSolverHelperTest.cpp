@@ -0,0 +1,234 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cmath>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/NativeSolverEnvironment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/exceptions/InvalidOperationException.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/helper/KrylovSolverHelper.h"
+#include "storm/solver/helper/NativePreconditioner.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/constants.h"
+#include "storm/utility/graph.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> createMatrix(std::vector<std::vector<double>> const& rows) {
+    storm::storage::SparseMatrixBuilder<double> builder(rows.size(), rows.size());
+    for (uint64_t row = 0; row < rows.size(); ++row) {
+        for (uint64_t column = 0; column < rows[row].size(); ++column) {
+            if (rows[row][column] != 0.0) {
+                builder.addNextValue(row, column, rows[row][column]);
+            }
+        }
+    }
+    return builder.build();
+}
+
+storm::solver::SolverStatus keepIterating(std::vector<double> const&, uint64_t) {
+    return storm::solver::SolverStatus::InProgress;
+}
+
+struct EquationSystem {
+    storm::storage::SparseMatrix<double> matrix;
+    std::vector<double> b;
+};
+
+// Creates the equation system whose solution are the probabilities of the maybe states of the given DTMC to eventually reach the given label.
+EquationSystem createReachabilitySystem(std::string const& programFile, std::string const& label) {
+    storm::prism::Program program = storm::api::parseProgram(programFile);
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("P=? [F \"" + label + "\"]", program));
+    auto dtmc = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+    auto statesWithProbability01 =
+        storm::utility::graph::performProb01(*dtmc, storm::storage::BitVector(dtmc->getNumberOfStates(), true), dtmc->getStates(label));
+    storm::storage::BitVector maybeStates = ~(statesWithProbability01.first | statesWithProbability01.second);
+
+    EquationSystem system;
+    system.matrix = dtmc->getTransitionMatrix().getSubmatrix(false, maybeStates, maybeStates, true);
+    system.matrix.convertToEquationSystem();
+    system.b = dtmc->getTransitionMatrix().getConstrainedRowSumVector(maybeStates, statesWithProbability01.second);
+    return system;
+}
+
+// Determines the smallest maximal number of iterations with which the given method of the native solver converges.
+uint64_t getRequiredIterations(storm::solver::NativeLinearEquationSolverMethod method, EquationSystem const& system, std::vector<double>& x) {
+    storm::Environment env;
+    env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+    env.solver().native().setMethod(method);
+    env.solver().native().setRelativeTerminationCriterion(false);
+    env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-8"));
+    auto convergesWithin = [&](uint64_t maximalNumberOfIterations) {
+        env.solver().native().setMaximalNumberOfIterations(maximalNumberOfIterations);
+        x.assign(system.b.size(), 0.0);
+        auto solver = storm::solver::GeneralLinearEquationSolverFactory<double>().create(env, system.matrix);
+        return solver->solveEquations(env, x, system.b);
+    };
+
+    uint64_t upper = 1;
+    while (!convergesWithin(upper)) {
+        STORM_LOG_THROW(upper < (1ull << 20), storm::exceptions::InvalidOperationException, "The method does not converge.");
+        upper *= 2;
+    }
+    uint64_t lower = upper / 2;
+    while (lower + 1 < upper) {
+        uint64_t middle = (lower + upper) / 2;
+        if (convergesWithin(middle)) {
+            upper = middle;
+        } else {
+            lower = middle;
+        }
+    }
+    convergesWithin(upper);
+    return upper;
+}
+
+// Creates a matrix in which the rows of the forward and backward ILU solves fall into large levels.
+storm::storage::SparseMatrix<double> createLeveledMatrix(uint64_t dimension) {
+    storm::storage::SparseMatrixBuilder<double> builder(dimension, dimension);
+    for (uint64_t row = 0; row < dimension; ++row) {
+        if (row >= 1024) {
+            builder.addNextValue(row, row - 1024, -1.0);
+        }
+        builder.addNextValue(row, row, 4.0);
+        if (row + 512 < dimension) {
+            builder.addNextValue(row, row + 512, -0.5);
+        }
+        if (row + 1024 < dimension) {
+            builder.addNextValue(row, row + 1024, -1.0);
+        }
+    }
+    return builder.build();
+}
+
+TEST(KrylovSolverHelperTest, Convergence) {
+    auto matrix = createMatrix({{2.0, 1.0}, {1.0, 3.0}});
+    storm::solver::helper::KrylovSolverHelper<double> helper(matrix, storm::solver::NativeLinearEquationSolverPreconditioner::None);
+    std::vector<double> const b = {3.0, 4.0};
+
+    std::vector<double> x = {0.0, 0.0};
+    uint64_t iterations = 0;
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, helper.solveBicgstab(x, b, 1e-10, false, 100, iterations, keepIterating));
+    EXPECT_NEAR(1.0, x[0], 1e-8);
+    EXPECT_NEAR(1.0, x[1], 1e-8);
+
+    x = {0.0, 0.0};
+    iterations = 0;
+    EXPECT_EQ(storm::solver::SolverStatus::Converged, helper.solveGmres(x, b, 1e-10, false, 10, 100, iterations, keepIterating));
+    EXPECT_NEAR(1.0, x[0], 1e-8);
+    EXPECT_NEAR(1.0, x[1], 1e-8);
+}
+
+TEST(KrylovSolverHelperTest, BicgstabBreakdown) {
+    // The first search direction is orthogonal to the shadow residual, so BiCGSTAB can not proceed.
+    auto matrix = createMatrix({{0.0, 1.0}, {1.0, 0.0}});
+    storm::solver::helper::KrylovSolverHelper<double> helper(matrix, storm::solver::NativeLinearEquationSolverPreconditioner::None);
+    std::vector<double> x = {0.0, 0.0};
+    uint64_t iterations = 0;
+    EXPECT_EQ(storm::solver::SolverStatus::MaximalIterationsExceeded, helper.solveBicgstab(x, {1.0, 0.0}, 1e-10, false, 100, iterations, keepIterating));
+    EXPECT_TRUE(std::isfinite(x[0]));
+    EXPECT_TRUE(std::isfinite(x[1]));
+}
+
+TEST(KrylovSolverHelperTest, GmresBreakdown) {
+    // The right-hand side lies in the kernel of the singular matrix, so the Hessenberg matrix is singular.
+    auto matrix = createMatrix({{0.0, 0.0}, {0.0, 1.0}});
+    storm::solver::helper::KrylovSolverHelper<double> helper(matrix, storm::solver::NativeLinearEquationSolverPreconditioner::None);
+    std::vector<double> x = {0.0, 0.0};
+    uint64_t iterations = 0;
+    EXPECT_EQ(storm::solver::SolverStatus::MaximalIterationsExceeded, helper.solveGmres(x, {1.0, 0.0}, 1e-10, false, 10, 100, iterations, keepIterating));
+    EXPECT_TRUE(std::isfinite(x[0]));
+    EXPECT_TRUE(std::isfinite(x[1]));
+}
+
+TEST(KrylovSolverHelperTest, FewerIterationsThanStationaryMethods) {
+    std::vector<std::pair<std::string, std::string>> const models = {{STORM_TEST_RESOURCES_DIR "/dtmc/die.pm", "one"},
+                                                                     {STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", "observe0Greater1"}};
+    for (auto const& model : models) {
+        EquationSystem system = createReachabilitySystem(model.first, model.second);
+        uint64_t const dimension = system.b.size();
+        std::vector<double> jacobiX, gaussSeidelX;
+        uint64_t const jacobiIterations = getRequiredIterations(storm::solver::NativeLinearEquationSolverMethod::Jacobi, system, jacobiX);
+        getRequiredIterations(storm::solver::NativeLinearEquationSolverMethod::GaussSeidel, system, gaussSeidelX);
+
+        storm::solver::helper::KrylovSolverHelper<double> helper(system.matrix, storm::solver::NativeLinearEquationSolverPreconditioner::Ilu);
+        std::vector<double> bicgstabX(dimension, 0.0), gmresX(dimension, 0.0);
+        uint64_t bicgstabIterations = 0, gmresIterations = 0;
+        ASSERT_EQ(storm::solver::SolverStatus::Converged,
+                  helper.solveBicgstab(bicgstabX, system.b, 1e-8, false, 10000, bicgstabIterations, keepIterating));
+        ASSERT_EQ(storm::solver::SolverStatus::Converged,
+                  helper.solveGmres(gmresX, system.b, 1e-8, false, 50, 10000, gmresIterations, keepIterating));
+
+        EXPECT_LT(bicgstabIterations, jacobiIterations) << model.first;
+        EXPECT_LT(gmresIterations, jacobiIterations) << model.first;
+        for (uint64_t index = 0; index < dimension; ++index) {
+            EXPECT_NEAR(jacobiX[index], bicgstabX[index], 1e-6);
+            EXPECT_NEAR(gaussSeidelX[index], bicgstabX[index], 1e-6);
+            EXPECT_NEAR(gmresX[index], bicgstabX[index], 1e-6);
+        }
+    }
+}
+
+TEST(KrylovSolverHelperTest, ParallelIluLevels) {
+    // With Intel TBB, the rows of a level of the triangular solves are processed in parallel. This has to yield exactly the sequential result.
+    auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+    auto matrix = createLeveledMatrix(8192);
+    storm::solver::helper::IluPreconditioner<double> sequentialIlu(matrix, false);
+    storm::solver::helper::IluPreconditioner<double> parallelIlu(matrix, true);
+    std::vector<double> r(matrix.getRowCount());
+    for (uint64_t row = 0; row < r.size(); ++row) {
+        r[row] = 1.0 + static_cast<double>(row % 7) / 7.0;
+    }
+    std::vector<double> sequentialZ, parallelZ;
+    sequentialIlu.apply(r, sequentialZ);
+    parallelIlu.apply(r, parallelZ);
+    EXPECT_EQ(sequentialZ, parallelZ);
+}
+
+TEST(KrylovSolverHelperTest, ParallelEqualsSequential) {
+    // Dot products are summed over fixed blocks and all other operations are performed row by row, so enabling Intel TBB must not change
+    // the results or the number of iterations.
+    std::vector<EquationSystem> systems;
+    systems.push_back(createReachabilitySystem(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm", "observe0Greater1"));
+    systems.push_back({createLeveledMatrix(8192), std::vector<double>(8192, 1.0)});
+    for (auto const& system : systems) {
+        uint64_t const dimension = system.b.size();
+        for (auto preconditioner : {storm::solver::NativeLinearEquationSolverPreconditioner::None, storm::solver::NativeLinearEquationSolverPreconditioner::Ilu,
+                                    storm::solver::NativeLinearEquationSolverPreconditioner::Amg}) {
+            std::vector<std::vector<double>> results;
+            std::vector<uint64_t> iterations;
+            for (bool useIntelTbb : {false, true}) {
+                auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(useIntelTbb);
+                storm::solver::helper::KrylovSolverHelper<double> helper(system.matrix, preconditioner);
+                results.emplace_back(dimension, 0.0);
+                iterations.push_back(0);
+                EXPECT_EQ(storm::solver::SolverStatus::Converged,
+                          helper.solveBicgstab(results.back(), system.b, 1e-8, false, 10000, iterations.back(), keepIterating));
+                results.emplace_back(dimension, 0.0);
+                iterations.push_back(0);
+                EXPECT_EQ(storm::solver::SolverStatus::Converged,
+                          helper.solveGmres(results.back(), system.b, 1e-8, false, 50, 10000, iterations.back(), keepIterating));
+            }
+            EXPECT_EQ(results[0], results[2]);
+            EXPECT_EQ(results[1], results[3]);
+            EXPECT_EQ(iterations[0], iterations[2]);
+            EXPECT_EQ(iterations[1], iterations[3]);
+        }
+    }
+}
+
+}  // namespace
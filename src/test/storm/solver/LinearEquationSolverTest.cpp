@@ -6,6 +6,7 @@
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
 #include "storm/solver/LinearEquationSolver.h"
+#include "storm/solver/TerminationCondition.h"
 
 #include "storm/utility/vector.h"
 namespace {
@@ -68,6 +69,22 @@ class NativeDoubleIntervalIterationEnvironment {
     }
 };
 
+class NativeDoubleIntervalIterationDirectedRoundingEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setForceSoundness(true);
+        env.solver().setForceDirectedRounding(true);
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::IntervalIteration);
+        env.solver().native().setRelativeTerminationCriterion(false);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-6"));
+        return env;
+    }
+};
+
 class NativeDoubleJacobiEnvironment {
    public:
     typedef double ValueType;
@@ -133,6 +150,72 @@ class NativeRationalRationalSearchEnvironment {
     }
 };
 
+class NativeDoubleSparseLUEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::SparseLU);
+        return env;
+    }
+};
+
+class NativeRationalSparseLUEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::SparseLU);
+        return env;
+    }
+};
+
+class NativeDoubleBicgstabIluEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Bicgstab);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Ilu);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
+class NativeDoubleGmresAmgEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::Amg);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
+class NativeDoubleGmresNoneEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Native);
+        env.solver().native().setMethod(storm::solver::NativeLinearEquationSolverMethod::Gmres);
+        env.solver().native().setPreconditioner(storm::solver::NativeLinearEquationSolverPreconditioner::None);
+        env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-10"));
+        return env;
+    }
+};
+
 class EliminationRationalEnvironment {
    public:
     typedef storm::RationalNumber ValueType;
@@ -144,6 +227,28 @@ class EliminationRationalEnvironment {
     }
 };
 
+class ModularRationalEnvironment {
+   public:
+    typedef storm::RationalNumber ValueType;
+    static const bool isExact = true;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Modular);
+        return env;
+    }
+};
+
+class ModularDoubleEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().setLinearEquationSolverType(storm::solver::EquationSolverType::Modular);
+        return env;
+    }
+};
+
 class GmmGmresIluEnvironment {
    public:
     typedef double ValueType;
@@ -313,8 +418,11 @@ class LinearEquationSolverTest : public ::testing::Test {
 };
 
 typedef ::testing::Types<NativeDoublePowerEnvironment, NativeDoubleSoundValueIterationEnvironment, NativeDoubleOptimisticValueIterationEnvironment,
-                         NativeDoubleIntervalIterationEnvironment, NativeDoubleJacobiEnvironment, NativeDoubleGaussSeidelEnvironment,
-                         NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment, NativeRationalRationalSearchEnvironment, EliminationRationalEnvironment,
+                         NativeDoubleIntervalIterationEnvironment, NativeDoubleIntervalIterationDirectedRoundingEnvironment,
+                         NativeDoubleJacobiEnvironment, NativeDoubleGaussSeidelEnvironment, NativeDoubleSorEnvironment, NativeDoubleWalkerChaeEnvironment,
+                         NativeRationalRationalSearchEnvironment, NativeDoubleSparseLUEnvironment, NativeRationalSparseLUEnvironment,
+                         NativeDoubleBicgstabIluEnvironment, NativeDoubleGmresAmgEnvironment, NativeDoubleGmresNoneEnvironment,
+                         EliminationRationalEnvironment, ModularRationalEnvironment, ModularDoubleEnvironment,
                          GmmGmresIluEnvironment, GmmGmresDiagonalEnvironment, GmmGmresNoneEnvironment, GmmBicgstabIluEnvironment, GmmQmrDiagonalEnvironment,
                          EigenDGmresDiagonalEnvironment, EigenGmresIluEnvironment, EigenBicgstabNoneEnvironment, EigenDoubleLUEnvironment,
                          EigenRationalLUEnvironment, TopologicalEigenRationalLUEnvironment>
@@ -358,4 +466,77 @@ TYPED_TEST(LinearEquationSolverTest, solveEquationSystem) {
     EXPECT_NEAR(x[1], this->parseNumber("457/9"), this->precision());
     EXPECT_NEAR(x[2], this->parseNumber("875/18"), this->precision());
 }
-}  // namespace
\ No newline at end of file
+
+// Checks that every lower (upper) bound reported by a solver is below (above) the exact solution.
+class ExactSolutionEnclosureCondition : public storm::solver::TerminationCondition<double> {
+   public:
+    ExactSolutionEnclosureCondition(std::vector<storm::RationalNumber> const& exactSolution) : exactSolution(exactSolution) {}
+
+    bool terminateNow(std::function<double(uint64_t const&)> const& valueGetter, storm::solver::SolverGuarantee const& guarantee) const override {
+        for (uint64_t i = 0; i < exactSolution.size(); ++i) {
+            storm::RationalNumber value = storm::utility::convertNumber<storm::RationalNumber>(valueGetter(i));
+            if (guarantee == storm::solver::SolverGuarantee::LessOrEqual) {
+                EXPECT_LE(value, exactSolution[i]) << "at index " << i;
+                ++numberOfCheckedLowerBounds;
+            } else if (guarantee == storm::solver::SolverGuarantee::GreaterOrEqual) {
+                EXPECT_GE(value, exactSolution[i]) << "at index " << i;
+                ++numberOfCheckedUpperBounds;
+            }
+        }
+        return false;
+    }
+
+    bool requiresGuarantee(storm::solver::SolverGuarantee const& guarantee) const override {
+        return guarantee != storm::solver::SolverGuarantee::None;
+    }
+
+    std::vector<storm::RationalNumber> exactSolution;
+    mutable uint64_t numberOfCheckedLowerBounds = 0;
+    mutable uint64_t numberOfCheckedUpperBounds = 0;
+};
+
+TEST(LinearEquationSolverDirectedRoundingTest, EnclosesExactSolution) {
+    // The exact solution is computed for the double approximations of the entries.
+    std::vector<std::vector<double>> entries = {{0.2, 0.4, 0.4}, {0.02, 0.96, 0.02}, {0.4, 0.3, 0.0}};
+    std::vector<double> b = {3.0, -0.01, 12.0};
+    storm::storage::SparseMatrixBuilder<double> builder;
+    storm::storage::SparseMatrixBuilder<storm::RationalNumber> exactBuilder;
+    for (uint64_t row = 0; row < entries.size(); ++row) {
+        for (uint64_t column = 0; column < entries[row].size(); ++column) {
+            builder.addNextValue(row, column, entries[row][column]);
+            exactBuilder.addNextValue(row, column, storm::utility::convertNumber<storm::RationalNumber>(entries[row][column]));
+        }
+    }
+    storm::storage::SparseMatrix<double> A = builder.build();
+    storm::storage::SparseMatrix<storm::RationalNumber> exactA = exactBuilder.build();
+
+    storm::Environment exactEnv = EigenRationalLUEnvironment::createEnvironment();
+    exactA.convertToEquationSystem();
+    std::vector<storm::RationalNumber> exactSolution(3);
+    auto exactSolver = storm::solver::GeneralLinearEquationSolverFactory<storm::RationalNumber>().create(exactEnv, exactA);
+    ASSERT_TRUE(exactSolver->solveEquations(exactEnv, exactSolution, storm::utility::vector::convertNumericVector<storm::RationalNumber>(b)));
+
+    storm::Environment env = NativeDoubleIntervalIterationDirectedRoundingEnvironment::createEnvironment();
+    env.solver().native().setPrecision(storm::utility::convertNumber<storm::RationalNumber, std::string>("1e-12"));
+    auto solver = storm::solver::GeneralLinearEquationSolverFactory<double>().create(env, A);
+    solver->setBounds(-100.0, 100.0);
+    auto condition = std::make_unique<ExactSolutionEnclosureCondition>(exactSolution);
+    auto const& conditionRef = *condition;
+    solver->setTerminationCondition(std::move(condition));
+    std::vector<double> x(3);
+    ASSERT_TRUE(solver->solveEquations(env, x, b));
+    EXPECT_LT(0ull, conditionRef.numberOfCheckedLowerBounds);
+    EXPECT_LT(0ull, conditionRef.numberOfCheckedUpperBounds);
+    EXPECT_NEAR(481.0 / 9.0, x[0], 1e-6);
+
+    // The final bounds are retained and enclose the returned midpoint.
+    ASSERT_TRUE(solver->hasSolutionEnclosure());
+    auto const& enclosure = solver->getSolutionEnclosure();
+    for (uint64_t i = 0; i < exactSolution.size(); ++i) {
+        EXPECT_LE(storm::utility::convertNumber<storm::RationalNumber>(enclosure.first[i]), exactSolution[i]);
+        EXPECT_GE(storm::utility::convertNumber<storm::RationalNumber>(enclosure.second[i]), exactSolution[i]);
+        EXPECT_LE(enclosure.first[i], x[i]);
+        EXPECT_GE(enclosure.second[i], x[i]);
+    }
+}
+}  // namespace
@@ -6,8 +6,12 @@
 #include "storm/environment/solver/MinMaxSolverEnvironment.h"
 #include "storm/environment/solver/NativeSolverEnvironment.h"
 #include "storm/environment/solver/TopologicalSolverEnvironment.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/solver/MinMaxLinearEquationSolver.h"
 #include "storm/solver/SolverSelectionOptions.h"
+#include "storm/solver/TerminationCondition.h"
 #include "storm/storage/SparseMatrix.h"
 
 namespace {
@@ -50,6 +54,20 @@ class DoubleIntervalIterationEnvironment {
     }
 };
 
+class DoubleIntervalIterationDirectedRoundingEnvironment {
+   public:
+    typedef double ValueType;
+    static const bool isExact = false;
+    static storm::Environment createEnvironment() {
+        storm::Environment env;
+        env.solver().minMax().setMethod(storm::solver::MinMaxMethod::IntervalIteration);
+        env.solver().setForceSoundness(true);
+        env.solver().setForceDirectedRounding(true);
+        env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-6));
+        return env;
+    }
+};
+
 class DoubleOptimisticViEnvironment {
    public:
     typedef double ValueType;
@@ -141,9 +159,9 @@ class MinMaxLinearEquationSolverTest : public ::testing::Test {
     storm::Environment _environment;
 };
 
-typedef ::testing::Types<DoubleViEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment, DoubleOptimisticViEnvironment,
-                         DoubleTopologicalViEnvironment, DoubleTopologicalCudaViEnvironment, DoublePIEnvironment, RationalPIEnvironment,
-                         RationalRationalSearchEnvironment>
+typedef ::testing::Types<DoubleViEnvironment, DoubleSoundViEnvironment, DoubleIntervalIterationEnvironment,
+                         DoubleIntervalIterationDirectedRoundingEnvironment, DoubleOptimisticViEnvironment, DoubleTopologicalViEnvironment,
+                         DoubleTopologicalCudaViEnvironment, DoublePIEnvironment, RationalPIEnvironment, RationalRationalSearchEnvironment>
     TestingTypes;
 
 TYPED_TEST_SUITE(MinMaxLinearEquationSolverTest, TestingTypes, );
@@ -175,4 +193,112 @@ TYPED_TEST(MinMaxLinearEquationSolverTest, SolveEquations) {
     ASSERT_NO_THROW(solver->solveEquations(this->env(), storm::OptimizationDirection::Maximize, x, b));
     EXPECT_NEAR(x[0], this->parseNumber("0.99"), this->precision());
 }
+
+// Checks that every lower (upper) bound reported by a solver is below (above) the exact solution.
+class ExactSolutionEnclosureCondition : public storm::solver::TerminationCondition<double> {
+   public:
+    ExactSolutionEnclosureCondition(storm::RationalNumber const& exactSolution) : exactSolution(exactSolution) {}
+
+    bool terminateNow(std::function<double(uint64_t const&)> const& valueGetter, storm::solver::SolverGuarantee const& guarantee) const override {
+        storm::RationalNumber value = storm::utility::convertNumber<storm::RationalNumber>(valueGetter(0));
+        if (guarantee == storm::solver::SolverGuarantee::LessOrEqual) {
+            EXPECT_LE(value, exactSolution);
+            ++numberOfCheckedLowerBounds;
+        } else if (guarantee == storm::solver::SolverGuarantee::GreaterOrEqual) {
+            EXPECT_GE(value, exactSolution);
+            ++numberOfCheckedUpperBounds;
+        }
+        return false;
+    }
+
+    bool requiresGuarantee(storm::solver::SolverGuarantee const& guarantee) const override {
+        return guarantee != storm::solver::SolverGuarantee::None;
+    }
+
+    storm::RationalNumber exactSolution;
+    mutable uint64_t numberOfCheckedLowerBounds = 0;
+    mutable uint64_t numberOfCheckedUpperBounds = 0;
+};
+
+TEST(MinMaxLinearEquationSolverDirectedRoundingTest, EnclosesExactSolution) {
+    storm::storage::SparseMatrixBuilder<double> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 0, 0.9);
+    storm::storage::SparseMatrix<double> A = builder.build(2);
+    std::vector<double> b = {0.099, 0.5};
+
+    storm::Environment env = DoubleIntervalIterationDirectedRoundingEnvironment::createEnvironment();
+    env.solver().minMax().setPrecision(storm::utility::convertNumber<storm::RationalNumber>(1e-12));
+    env.solver().minMax().setRelativeTerminationCriterion(false);
+    auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<double>().create(env, A);
+    solver->setHasUniqueSolution(true);
+    solver->setHasNoEndComponents(true);
+    solver->setBounds(0.0, 2.0);
+
+    // The exact solution is computed for the double approximations of the entries.
+    storm::RationalNumber exactMaximum = storm::utility::convertNumber<storm::RationalNumber>(0.099) /
+                                         (storm::utility::one<storm::RationalNumber>() - storm::utility::convertNumber<storm::RationalNumber>(0.9));
+    for (auto const& dirSolution : {std::make_pair(storm::OptimizationDirection::Minimize, storm::utility::convertNumber<storm::RationalNumber>(0.5)),
+                                    std::make_pair(storm::OptimizationDirection::Maximize, exactMaximum)}) {
+        auto condition = std::make_unique<ExactSolutionEnclosureCondition>(dirSolution.second);
+        auto const& conditionRef = *condition;
+        solver->setTerminationCondition(std::move(condition));
+        std::vector<double> x(1);
+        ASSERT_TRUE(solver->solveEquations(env, dirSolution.first, x, b));
+        EXPECT_LT(0ull, conditionRef.numberOfCheckedLowerBounds);
+        EXPECT_LT(0ull, conditionRef.numberOfCheckedUpperBounds);
+        ASSERT_TRUE(solver->hasSolutionEnclosure());
+        EXPECT_LE(storm::utility::convertNumber<storm::RationalNumber>(solver->getSolutionEnclosure().first[0]), dirSolution.second);
+        EXPECT_GE(storm::utility::convertNumber<storm::RationalNumber>(solver->getSolutionEnclosure().second[0]), dirSolution.second);
+    }
+}
+
+TEST(MinMaxLinearEquationSolverPolicyIterationTest, InPlaceUpdates) {
+    typedef storm::RationalNumber ValueType;
+    auto parse = [](std::string const& input) { return storm::utility::convertNumber<ValueType>(input); };
+    // The choices of a state have different numbers of entries, such that the induced system is updated in place as well as rebuilt.
+    storm::storage::SparseMatrixBuilder<ValueType> builder(0, 0, 0, false, true);
+    builder.newRowGroup(0);
+    builder.addNextValue(0, 1, parse("1/2"));
+    builder.addNextValue(0, 2, parse("1/2"));
+    builder.addNextValue(1, 0, parse("1/5"));
+    builder.addNextValue(1, 3, parse("3/10"));
+    builder.addNextValue(2, 2, parse("9/10"));
+    builder.newRowGroup(3);
+    builder.addNextValue(3, 0, parse("2/5"));
+    builder.addNextValue(3, 2, parse("2/5"));
+    builder.addNextValue(4, 3, parse("1/2"));
+    builder.newRowGroup(5);
+    builder.addNextValue(5, 1, parse("3/5"));
+    builder.addNextValue(6, 0, parse("1/4"));
+    builder.addNextValue(6, 1, parse("1/4"));
+    builder.addNextValue(6, 3, parse("1/4"));
+    builder.newRowGroup(7);
+    builder.addNextValue(7, 3, parse("1/2"));
+    builder.addNextValue(8, 0, parse("1/10"));
+    builder.addNextValue(8, 1, parse("1/10"));
+    storm::storage::SparseMatrix<ValueType> A = builder.build();
+    std::vector<ValueType> b = {parse("0"), parse("1/10"), parse("0"), parse("1/5"), parse("3/10"), parse("1/10"), parse("0"), parse("1/2"), parse("2/5")};
+
+    auto solve = [&](bool inPlaceUpdates, storm::OptimizationDirection dir) {
+        storm::Environment env = RationalPIEnvironment::createEnvironment();
+        env.solver().minMax().setPolicyIterationInPlaceUpdates(inPlaceUpdates);
+        auto solver = storm::solver::GeneralMinMaxLinearEquationSolverFactory<ValueType>().create(env, A);
+        solver->setHasUniqueSolution(true);
+        solver->setHasNoEndComponents(true);
+        solver->setBounds(parse("0"), parse("2"));
+        std::vector<ValueType> x(A.getRowGroupCount());
+        EXPECT_TRUE(solver->solveEquations(env, dir, x, b));
+        return x;
+    };
+
+    for (auto dir : {storm::OptimizationDirection::Minimize, storm::OptimizationDirection::Maximize}) {
+        auto regularResult = solve(false, dir);
+        EXPECT_EQ(regularResult, solve(true, dir));
+
+        // The choices are improved in parallel if Intel TBB is enabled.
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        EXPECT_EQ(regularResult, solve(true, dir));
+    }
+}
 }  // namespace
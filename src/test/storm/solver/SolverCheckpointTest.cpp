@@ -0,0 +1,119 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <cstdio>
+#include <filesystem>
+
+#include "storm/environment/Environment.h"
+#include "storm/environment/solver/SolverEnvironment.h"
+#include "storm/solver/helper/SolverCheckpoint.h"
+#include "storm/storage/SparseMatrix.h"
+#include "storm/utility/SignalHandler.h"
+
+namespace {
+
+storm::storage::SparseMatrix<double> createMatrix(double value) {
+    storm::storage::SparseMatrixBuilder<double> builder(2, 2, 3);
+    builder.addNextValue(0, 0, value);
+    builder.addNextValue(0, 1, 1.0 - value);
+    builder.addNextValue(1, 1, 1.0);
+    return builder.build();
+}
+
+TEST(SolverCheckpointTest, WriteAndRestore) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_solver_checkpoint_test.ckp").string();
+    storm::Environment env;
+    env.solver().setCheckpointFilename(filename);
+    env.solver().setResumeFilename(filename);
+
+    auto matrix = createMatrix(0.5);
+    std::vector<double> b = {0.25, 0.0};
+    std::vector<double> x = {0.125, 1.0};
+    std::vector<uint64_t> scheduler = {1, 0};
+    {
+        storm::solver::helper::SolverCheckpoint<double> checkpoint(env, "test", matrix, {&b});
+        EXPECT_TRUE(checkpoint.isCheckpointingEnabled());
+        checkpoint.write(42, {&x}, &scheduler);
+    }
+
+    // A matching equation system restores the written state.
+    storm::solver::helper::SolverCheckpoint<double> checkpoint(env, "test", matrix, {&b});
+    storm::solver::helper::SolverCheckpoint<double>::State state;
+    ASSERT_TRUE(checkpoint.restore(state, 1, x.size()));
+    EXPECT_EQ(42ull, state.iterations);
+    ASSERT_EQ(1ull, state.vectors.size());
+    EXPECT_EQ(x, state.vectors.front());
+    EXPECT_EQ(scheduler, state.scheduler);
+
+    // Checkpoints of other methods or equation systems are ignored.
+    storm::solver::helper::SolverCheckpoint<double>::State otherState;
+    EXPECT_FALSE(storm::solver::helper::SolverCheckpoint<double>(env, "other", matrix, {&b}).restore(otherState, 1, x.size()));
+    EXPECT_FALSE(storm::solver::helper::SolverCheckpoint<double>(env, "test", createMatrix(0.25), {&b}).restore(otherState, 1, x.size()));
+    std::vector<double> otherB = {0.5, 0.0};
+    EXPECT_FALSE(storm::solver::helper::SolverCheckpoint<double>(env, "test", matrix, {&otherB}).restore(otherState, 1, x.size()));
+    EXPECT_EQ(0ull, otherState.iterations);
+    EXPECT_TRUE(otherState.vectors.empty());
+
+    std::remove(filename.c_str());
+}
+
+TEST(SolverCheckpointTest, RestoreWithRoundedValues) {
+    // Models that are exported and parsed again only have their values up to the output precision.
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_solver_checkpoint_rounded_test.ckp").string();
+    storm::Environment env;
+    env.solver().setCheckpointFilename(filename);
+    env.solver().setResumeFilename(filename);
+
+    std::vector<double> b = {1.0 / 3.0, 0.0};
+    std::vector<double> x = {0.125, 1.0};
+    storm::solver::helper::SolverCheckpoint<double>(env, "test", createMatrix(1.0 / 3.0), {&b}).write(42, {&x});
+
+    std::vector<double> roundedB = {0.3333333333, 0.0};
+    storm::solver::helper::SolverCheckpoint<double>::State state;
+    ASSERT_TRUE(storm::solver::helper::SolverCheckpoint<double>(env, "test", createMatrix(0.3333333333), {&roundedB}).restore(state, 1, x.size()));
+    EXPECT_EQ(42ull, state.iterations);
+    EXPECT_EQ(x, state.vectors.front());
+
+    std::remove(filename.c_str());
+}
+
+TEST(SolverCheckpointTest, AbortCheckpointWrittenOnce) {
+    std::string filename = (std::filesystem::temp_directory_path() / "storm_solver_abort_checkpoint_test.ckp").string();
+    storm::Environment env;
+    env.solver().setCheckpointFilename(filename);
+    env.solver().setResumeFilename(filename);
+
+    auto matrix = createMatrix(0.5);
+    std::vector<double> x = {0.125, 1.0};
+    std::vector<double> y = {0.0, 0.0};
+    storm::solver::helper::SolverCheckpoint<double> interruptedCheckpoint(env, "interrupted", matrix);
+    storm::solver::helper::SolverCheckpoint<double> laterCheckpoint(env, "later", matrix);
+
+    storm::utility::resources::SignalInformation::infos().setTerminate(true);
+    EXPECT_TRUE(interruptedCheckpoint.isDue());
+    interruptedCheckpoint.writeIfDue(42, {&x});
+    // Solvers invoked after the abort do not overwrite the checkpoint.
+    EXPECT_FALSE(laterCheckpoint.isDue());
+    laterCheckpoint.write(1, {&y});
+    storm::utility::resources::SignalInformation::infos().setTerminate(false);
+
+    storm::solver::helper::SolverCheckpoint<double>::State state;
+    EXPECT_FALSE(laterCheckpoint.restore(state, 1, y.size()));
+    ASSERT_TRUE(interruptedCheckpoint.restore(state, 1, x.size()));
+    EXPECT_EQ(42ull, state.iterations);
+    EXPECT_EQ(x, state.vectors.front());
+
+    std::remove(filename.c_str());
+}
+
+TEST(SolverCheckpointTest, Disabled) {
+    storm::Environment env;
+    auto matrix = createMatrix(0.5);
+    storm::solver::helper::SolverCheckpoint<double> checkpoint(env, "test", matrix);
+    EXPECT_FALSE(checkpoint.isCheckpointingEnabled());
+    EXPECT_FALSE(checkpoint.isDue());
+    storm::solver::helper::SolverCheckpoint<double>::State state;
+    EXPECT_FALSE(checkpoint.restore(state, 1, 2));
+}
+
+}  // namespace
@@ -0,0 +1,103 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/solver/helper/SparseLUFactorization.h"
+#include "storm/storage/SparseMatrix.h"
+
+namespace {
+
+// Creates an (unsymmetric) M-matrix consisting of the given number of tridiagonal blocks of size four whose first rows are coupled with the
+// last row. The columns of different blocks are independent in the elimination tree, so the levels of the tree contain many columns.
+storm::storage::SparseMatrix<double> createArrowMatrix(uint64_t numberOfBlocks, double scale) {
+    uint64_t const hub = 4 * numberOfBlocks;
+    storm::storage::SparseMatrixBuilder<double> builder(hub + 1, hub + 1);
+    for (uint64_t row = 0; row < hub; ++row) {
+        uint64_t const positionInBlock = row % 4;
+        if (positionInBlock > 0) {
+            builder.addNextValue(row, row - 1, -0.5 * scale);
+        }
+        builder.addNextValue(row, row, 4.0 * scale);
+        if (positionInBlock < 3) {
+            builder.addNextValue(row, row + 1, -1.0 * scale);
+        }
+        if (positionInBlock == 0) {
+            builder.addNextValue(row, hub, -1.0 * scale);
+        }
+    }
+    for (uint64_t block = 0; block < numberOfBlocks; ++block) {
+        builder.addNextValue(hub, 4 * block, -0.5 * scale);
+    }
+    builder.addNextValue(hub, hub, static_cast<double>(numberOfBlocks) * scale);
+    return builder.build();
+}
+
+double getResidualNorm(storm::storage::SparseMatrix<double> const& matrix, std::vector<double> const& x, std::vector<double> const& b) {
+    std::vector<double> product(b.size());
+    matrix.multiplyWithVector(x, product);
+    double norm = 0.0;
+    for (uint64_t row = 0; row < b.size(); ++row) {
+        norm = std::max(norm, std::abs(product[row] - b[row]));
+    }
+    return norm;
+}
+
+TEST(SparseLUFactorizationTest, ReuseSymbolicFactorization) {
+    auto matrix = createArrowMatrix(8, 1.0);
+    auto scaledMatrix = createArrowMatrix(8, 2.0);
+    auto otherMatrix = createArrowMatrix(9, 1.0);
+
+    // Matrices with the same pattern share their symbolic factorization.
+    storm::solver::helper::SparseLUFactorization<double> factorization(matrix);
+    storm::solver::helper::SparseLUFactorization<double> scaledFactorization(scaledMatrix);
+    storm::solver::helper::SparseLUFactorization<double> otherFactorization(otherMatrix);
+    EXPECT_EQ(&factorization.getSymbolicFactorization(), &scaledFactorization.getSymbolicFactorization());
+    EXPECT_NE(&factorization.getSymbolicFactorization(), &otherFactorization.getSymbolicFactorization());
+    EXPECT_EQ(storm::solver::helper::SparseLUSymbolicFactorization::get(scaledMatrix).get(), &factorization.getSymbolicFactorization());
+
+    // Both factorizations use the shared symbolic factorization with their own values.
+    std::vector<double> const b(matrix.getRowCount(), 1.0);
+    std::vector<double> x(matrix.getRowCount()), scaledX(matrix.getRowCount());
+    ASSERT_TRUE(factorization.factorize(matrix));
+    ASSERT_TRUE(scaledFactorization.factorize(scaledMatrix));
+    factorization.solve(x, b);
+    scaledFactorization.solve(scaledX, b);
+    EXPECT_LT(getResidualNorm(matrix, x, b), 1e-12);
+    EXPECT_LT(getResidualNorm(scaledMatrix, scaledX, b), 1e-12);
+
+    // After clearing the cache, the pattern is analysed again while the existing factorizations remain usable.
+    storm::solver::helper::SparseLUSymbolicFactorization::clearCache();
+    storm::solver::helper::SparseLUFactorization<double> newFactorization(matrix);
+    EXPECT_NE(&factorization.getSymbolicFactorization(), &newFactorization.getSymbolicFactorization());
+    factorization.solve(x, b);
+    EXPECT_LT(getResidualNorm(matrix, x, b), 1e-12);
+}
+
+TEST(SparseLUFactorizationTest, ParallelLevels) {
+    // The lowest levels of the elimination tree contain at least one column of each of the 256 blocks, so they are factorized in parallel
+    // with Intel TBB. As every column is computed as in the sequential factorization, the results have to be equal.
+    auto matrix = createArrowMatrix(256, 1.0);
+    std::vector<double> b(matrix.getRowCount());
+    for (uint64_t row = 0; row < b.size(); ++row) {
+        b[row] = 1.0 + static_cast<double>(row % 5);
+    }
+
+    std::vector<std::vector<double>> results;
+    for (bool useIntelTbb : {false, true}) {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(useIntelTbb);
+        storm::solver::helper::SparseLUFactorization<double> factorization(matrix);
+        ASSERT_TRUE(factorization.factorize(matrix));
+        results.emplace_back(matrix.getRowCount());
+        factorization.solve(results.back(), b);
+        EXPECT_LT(getResidualNorm(matrix, results.back(), b), 1e-12);
+    }
+    EXPECT_EQ(results[0], results[1]);
+}
+
+}  // namespace
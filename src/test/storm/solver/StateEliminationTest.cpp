@@ -0,0 +1,79 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm/adapters/RationalFunctionAdapter.h"
+#include "storm/solver/stateelimination/EliminationArithmetic.h"
+#include "storm/utility/constants.h"
+
+#ifdef STORM_HAVE_CARL
+namespace {
+
+class EliminationArithmeticTest : public ::testing::Test {
+   protected:
+    void SetUp() override {
+        parser.setVariables({"p", "q"});
+    }
+
+    storm::RationalFunction parse(std::string const& polynomial) {
+        return storm::RationalFunction(storm::Polynomial(parser.template parseMultivariatePolynomial<storm::RationalFunctionCoefficient>(polynomial), cache));
+    }
+
+    std::shared_ptr<storm::RawPolynomialCache> cache = std::make_shared<storm::RawPolynomialCache>();
+    carl::StringParser parser;
+};
+
+TEST_F(EliminationArithmeticTest, MemoizesResults) {
+    storm::solver::stateelimination::EliminationArithmetic<storm::RationalFunction> arithmetic;
+    storm::RationalFunction p = parse("p");
+    storm::RationalFunction q = parse("q");
+
+    storm::RationalFunction product = arithmetic.multiply(p, q);
+    EXPECT_EQ(0ull, arithmetic.getNumberOfHits());
+    EXPECT_EQ(1ull, arithmetic.getNumberOfMisses());
+
+    // Both operand orders share one entry.
+    EXPECT_EQ(product, arithmetic.multiply(q, p));
+    EXPECT_EQ(1ull, arithmetic.getNumberOfHits());
+    EXPECT_EQ(1ull, arithmetic.getNumberOfMisses());
+
+    storm::RationalFunction inverse = arithmetic.inverseOneMinus(p);
+    EXPECT_EQ(2ull, arithmetic.getNumberOfMisses());
+    EXPECT_EQ(inverse, arithmetic.inverseOneMinus(p));
+    EXPECT_EQ(2ull, arithmetic.getNumberOfHits());
+    EXPECT_EQ(2ull, arithmetic.getNumberOfMisses());
+    EXPECT_EQ(storm::utility::one<storm::RationalFunction>(), arithmetic.multiply(inverse, storm::utility::one<storm::RationalFunction>() - p));
+
+    // Operations with constant operands are not memoized.
+    uint64_t hits = arithmetic.getNumberOfHits();
+    uint64_t misses = arithmetic.getNumberOfMisses();
+    storm::RationalFunction half(storm::RationalFunctionCoefficient(1) / storm::RationalFunctionCoefficient(2));
+    EXPECT_EQ(p * half, arithmetic.multiply(p, half));
+    EXPECT_EQ(p + half, arithmetic.add(half, p));
+    EXPECT_EQ(storm::RationalFunction(2), arithmetic.inverseOneMinus(half));
+    EXPECT_EQ(hits, arithmetic.getNumberOfHits());
+    EXPECT_EQ(misses, arithmetic.getNumberOfMisses());
+}
+
+TEST_F(EliminationArithmeticTest, FlushesFullTables) {
+    storm::solver::stateelimination::EliminationArithmetic<storm::RationalFunction> arithmetic(2);
+    storm::RationalFunction p = parse("p");
+    storm::RationalFunction q = parse("q");
+    storm::RationalFunction r = parse("p*q");
+
+    arithmetic.add(p, q);
+    arithmetic.add(p, r);
+    EXPECT_EQ(2ull, arithmetic.getNumberOfMisses());
+    arithmetic.add(q, r);
+    EXPECT_EQ(3ull, arithmetic.getNumberOfMisses());
+    EXPECT_EQ(0ull, arithmetic.getNumberOfHits());
+
+    // Storing the third sum flushed the table, so only the third sum is still known.
+    arithmetic.add(q, r);
+    EXPECT_EQ(1ull, arithmetic.getNumberOfHits());
+    EXPECT_EQ(p + q, arithmetic.add(p, q));
+    EXPECT_EQ(4ull, arithmetic.getNumberOfMisses());
+    EXPECT_EQ(1ull, arithmetic.getNumberOfHits());
+}
+
+}  // namespace
+#endif
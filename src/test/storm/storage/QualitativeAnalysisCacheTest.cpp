@@ -0,0 +1,98 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/model_descriptions.h"
+#include "storm-parsers/api/properties.h"
+#include "storm/api/builder.h"
+#include "storm/api/properties.h"
+#include "storm/environment/Environment.h"
+#include "storm/logic/Formulas.h"
+#include "storm/modelchecker/prctl/SparseMdpPrctlModelChecker.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Mdp.h"
+#include "storm/models/sparse/StandardRewardModel.h"
+#include "storm/storage/sparse/QualitativeAnalysisCache.h"
+
+TEST(QualitativeAnalysisCacheTest, Mdp) {
+    std::string formulasString = "Pmin=? [F \"two\"];Pmin=? [F \"two\"];Pmax=? [F \"two\"]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint64_t initialState = *mdp->getInitialStates().begin();
+
+    EXPECT_EQ(nullptr, mdp->getQualitativeAnalysisCache());
+    mdp->enableQualitativeAnalysisCache();
+    ASSERT_NE(nullptr, mdp->getQualitativeAnalysisCache());
+
+    storm::Environment env;
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    for (auto const& formula : formulas) {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formula));
+        EXPECT_NEAR(1.0 / 36.0, result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    }
+
+    // The backward transitions are computed once and the prob0/prob1 states once per optimization direction.
+    auto const& cache = *mdp->getQualitativeAnalysisCache();
+    EXPECT_EQ(3ull, cache.getNumberOfMisses());
+    EXPECT_EQ(3ull, cache.getNumberOfHits());
+}
+
+TEST(QualitativeAnalysisCacheTest, CopyAndModification) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram("Pmin=? [F \"two\"]", program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    mdp->enableQualitativeAnalysisCache();
+
+    storm::Environment env;
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>>(*mdp).check(
+        env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas.front()));
+    EXPECT_EQ(2ull, mdp->getQualitativeAnalysisCache()->getNumberOfMisses());
+
+    // A copy gets its own empty cache.
+    storm::models::sparse::Mdp<double> copy(*mdp);
+    ASSERT_NE(nullptr, copy.getQualitativeAnalysisCache());
+    EXPECT_NE(mdp->getQualitativeAnalysisCache(), copy.getQualitativeAnalysisCache());
+    EXPECT_EQ(0ull, copy.getQualitativeAnalysisCache()->getNumberOfMisses());
+
+    // Retrieving the mutable transition matrix keeps the cache, setting a new transition matrix clears it.
+    mdp->getTransitionMatrix();
+    EXPECT_EQ(2ull, mdp->getQualitativeAnalysisCache()->getNumberOfMisses());
+    mdp->setTransitionMatrix(storm::storage::SparseMatrix<double>(mdp->getTransitionMatrix()));
+    ASSERT_NE(nullptr, mdp->getQualitativeAnalysisCache());
+    EXPECT_EQ(0ull, mdp->getQualitativeAnalysisCache()->getNumberOfMisses());
+
+    // Copy assignment also yields an empty cache.
+    copy.getQualitativeAnalysisCache()->getBackwardTransitions(copy.getTransitionMatrix());
+    copy = *mdp;
+    ASSERT_NE(nullptr, copy.getQualitativeAnalysisCache());
+    EXPECT_NE(mdp->getQualitativeAnalysisCache(), copy.getQualitativeAnalysisCache());
+    EXPECT_EQ(0ull, copy.getQualitativeAnalysisCache()->getNumberOfMisses());
+
+    // Modifications via the mutable transition matrix require clearing the cache explicitly.
+    mdp->getQualitativeAnalysisCache()->getBackwardTransitions(mdp->getTransitionMatrix());
+    EXPECT_EQ(1ull, mdp->getQualitativeAnalysisCache()->getNumberOfMisses());
+    mdp->clearQualitativeAnalysisCache();
+    EXPECT_EQ(0ull, mdp->getQualitativeAnalysisCache()->getNumberOfMisses());
+}
+
+TEST(QualitativeAnalysisCacheTest, MdpRewards) {
+    std::string formulasString = "Pmax=? [F \"done\"];Rmin=? [F \"done\"];Pmin=? [F \"done\"];Rmax=? [F \"done\"]";
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/mdp/two_dice.nm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(formulasString, program));
+    auto mdp = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Mdp<double>>();
+    uint64_t initialState = *mdp->getInitialStates().begin();
+    mdp->enableQualitativeAnalysisCache();
+
+    storm::Environment env;
+    storm::modelchecker::SparseMdpPrctlModelChecker<storm::models::sparse::Mdp<double>> checker(*mdp);
+    std::vector<double> const expected = {1.0, 22.0 / 3.0, 1.0, 22.0 / 3.0};
+    for (uint64_t i = 0; i < formulas.size(); ++i) {
+        auto result = checker.check(env, storm::modelchecker::CheckTask<storm::logic::Formula, double>(*formulas[i]));
+        EXPECT_NEAR(expected[i], result->asExplicitQuantitativeCheckResult<double>()[initialState], 1e-6);
+    }
+
+    // The reward computations reuse the prob1 states of the probability computation with the opposite optimization direction.
+    auto const& cache = *mdp->getQualitativeAnalysisCache();
+    EXPECT_EQ(3ull, cache.getNumberOfMisses());
+    EXPECT_EQ(5ull, cache.getNumberOfHits());
+}
@@ -3,7 +3,9 @@
 
 #include "storm/adapters/RationalFunctionAdapter.h"
 #include "storm/exceptions/InvalidArgumentException.h"
+#include "storm/settings/SettingMemento.h"
 #include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/dd/Add.h"
 #include "storm/storage/dd/DdManager.h"
 #include "storm/storage/dd/DdMetaVariable.h"
@@ -885,6 +887,51 @@ TEST(SylvanDd, AddToRationalTest) {
               rationalDd.getValue(metaVariableToValueMap));
 }
 
+TEST(SylvanDd, AddToMatrixParallelTest) {
+    // With Intel TBB, the translation is split at the topmost row variables and the parts are filled in parallel. This has to yield the same
+    // matrices and vectors as the sequential translation.
+    std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
+    std::pair<storm::expressions::Variable, storm::expressions::Variable> x = manager->addMetaVariable("x", 0, 255);
+
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> rowRange = manager->getRange(x.first).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> columnRange = manager->getRange(x.second).template toAdd<double>();
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> rowIdentity = manager->template getIdentity<double>(x.first);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> columnIdentity = manager->template getIdentity<double>(x.second);
+
+    // A diagonal with the values x + 1, the successors x + 1 and column 3 with the values x.
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> dd =
+        rowIdentity.equals(columnIdentity).template toAdd<double>() * (rowIdentity + manager->template getConstant<double>(1)) * rowRange;
+    dd += (rowIdentity + manager->template getConstant<double>(1)).equals(columnIdentity).template toAdd<double>() * rowRange * columnRange *
+          manager->template getConstant<double>(0.5);
+    dd += manager->getEncoding(x.second, 3).template toAdd<double>() * rowIdentity * rowRange;
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> groupedDd = manager->getEncoding(a.first, 0).ite(dd, dd + rowRange * columnRange);
+    storm::dd::Add<storm::dd::DdType::Sylvan, double> vector =
+        rowRange * manager->getEncoding(a.first, 0).ite(rowIdentity, rowIdentity + manager->template getConstant<double>(2));
+
+    storm::dd::Odd rowOdd = rowRange.createOdd();
+    storm::dd::Odd columnOdd = columnRange.createOdd();
+
+    std::vector<storm::storage::SparseMatrix<double>> matrices, groupedMatrices;
+    std::vector<std::pair<storm::storage::SparseMatrix<double>, std::vector<double>>> matricesAndVectors;
+    for (bool useIntelTbb : {false, true}) {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(useIntelTbb);
+        matrices.push_back(dd.toMatrix({x.first}, {x.second}, rowOdd, columnOdd));
+        groupedMatrices.push_back(groupedDd.toMatrix({a.first}, rowOdd, columnOdd));
+        matricesAndVectors.push_back(groupedDd.toMatrixVector(vector, {a.first}, rowOdd, columnOdd));
+    }
+
+    EXPECT_EQ(256ul, matrices[0].getRowCount());
+    // Column 3 overlaps with the diagonal in row 3 and with the successor in row 2, and row 0 has no entry in column 3.
+    EXPECT_EQ(256ul + 255ul + 255ul - 2ul, matrices[0].getNonzeroEntryCount());
+    EXPECT_EQ(matrices[0], matrices[1]);
+    EXPECT_EQ(512ul, groupedMatrices[0].getRowCount());
+    EXPECT_EQ(256ul, groupedMatrices[0].getRowGroupCount());
+    EXPECT_EQ(groupedMatrices[0], groupedMatrices[1]);
+    EXPECT_EQ(matricesAndVectors[0].first, matricesAndVectors[1].first);
+    EXPECT_EQ(matricesAndVectors[0].second, matricesAndVectors[1].second);
+}
+
 TEST(SylvanDd, BddOddTest) {
     std::shared_ptr<storm::dd::DdManager<storm::dd::DdType::Sylvan>> manager(new storm::dd::DdManager<storm::dd::DdType::Sylvan>());
     std::pair<storm::expressions::Variable, storm::expressions::Variable> a = manager->addMetaVariable("a");
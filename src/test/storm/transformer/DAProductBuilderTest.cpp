@@ -7,6 +7,8 @@
 #include "storm/models/sparse/MarkovAutomaton.h"
 #include "storm/models/sparse/StandardRewardModel.h"
 #include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/settings/modules/IOSettings.h"
 
 #include "storm/storage/BitVector.h"
@@ -135,3 +137,123 @@ TEST(DAProductBuilderTest_aWb, Dtmc) {
     scc.insert(12);
     ASSERT_EQ(product->getAcceptance()->isAccepting(scc), false);
 }
+
+TEST(DAProductBuilderTest_aUb, ParallelStateLabels) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/crowds-5-5.pm");
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    auto dtmc = std::dynamic_pointer_cast<storm::models::sparse::Dtmc<double>>(model);
+
+    std::string aUb =
+        "HOA: v1\n"
+        "States: 3\n"
+        "Start: 0\n"
+        "acc-name: Rabin 1\n"
+        "Acceptance: 2 (Fin(0) & Inf(1))\n"
+        "AP: 2 \"a\" \"b\""
+        "--BODY--\n"
+        "State: 0 \"a U b\" \n { 0 }\n"
+        "  2  /* !a  & !b */\n"
+        "  0  /*  a  & !b */\n"
+        "  1  /* !a  &  b */\n"
+        "  1  /*  a  &  b */\n"
+        "State: 1 { 1 }\n"
+        "  1 1 1 1       /* four transitions on one line */\n"
+        "State: 2 \"sink state\" { 0 }\n"
+        "  2 2 2 2\n"
+        "--END--\n";
+
+    std::istringstream in = std::istringstream(aUb);
+    storm::automata::DeterministicAutomaton::ptr da;
+    ASSERT_NO_THROW(da = storm::automata::DeterministicAutomaton::parse(in));
+
+    std::vector<storm::storage::BitVector> apLabels;
+    apLabels.push_back(~dtmc->getStates("observeIGreater1"));
+    apLabels.push_back(dtmc->getStates("observe0Greater1"));
+
+    // The labels of the model states are computed in parallel if Intel TBB is enabled. This must not affect the product.
+    storm::transformer::DAProduct<storm::models::sparse::Dtmc<double>>::ptr sequentialProduct, parallelProduct;
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(false);
+        sequentialProduct = storm::transformer::DAProductBuilder(*da, apLabels).build(*dtmc, dtmc->getInitialStates());
+    }
+    {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+        parallelProduct = storm::transformer::DAProductBuilder(*da, apLabels).build(*dtmc, dtmc->getInitialStates());
+    }
+
+    uint64_t numberOfProductStates = sequentialProduct->getProductModel().getNumberOfStates();
+    ASSERT_EQ(numberOfProductStates, parallelProduct->getProductModel().getNumberOfStates());
+    EXPECT_EQ(sequentialProduct->getProductModel().getTransitionMatrix(), parallelProduct->getProductModel().getTransitionMatrix());
+    for (uint64_t state = 0; state < numberOfProductStates; ++state) {
+        EXPECT_EQ(sequentialProduct->getModelState(state), parallelProduct->getModelState(state));
+        EXPECT_EQ(sequentialProduct->getAutomatonState(state), parallelProduct->getAutomatonState(state));
+    }
+}
+
+TEST(DAProductBuilderTest_aUb, RestrictToPossiblyAcceptingStates) {
+    storm::prism::Program program = storm::parser::PrismParser::parse(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+
+    std::shared_ptr<storm::models::sparse::Model<double>> model = storm::builder::ExplicitModelBuilder<double>(program).build();
+    auto dtmc = std::dynamic_pointer_cast<storm::models::sparse::Dtmc<double>>(model);
+
+    std::string aUb =
+        "HOA: v1\n"
+        "States: 3\n"
+        "Start: 0\n"
+        "acc-name: Rabin 1\n"
+        "Acceptance: 2 (Fin(0) & Inf(1))\n"
+        "AP: 2 \"a\" \"b\""
+        "--BODY--\n"
+        "State: 0 \"a U b\" \n { 0 }\n"
+        "  2  /* !a  & !b */\n"
+        "  0  /*  a  & !b */\n"
+        "  1  /* !a  &  b */\n"
+        "  1  /*  a  &  b */\n"
+        "State: 1 { 1 }\n"
+        "  1 1 1 1       /* four transitions on one line */\n"
+        "State: 2 \"sink state\" { 0 }\n"
+        "  2 2 2 2\n"
+        "--END--\n";
+
+    std::istringstream in = std::istringstream(aUb);
+    storm::automata::DeterministicAutomaton::ptr da;
+    ASSERT_NO_THROW(da = storm::automata::DeterministicAutomaton::parse(in));
+
+    // Only the sink state of the automaton can not reach an accepting SCC.
+    storm::storage::BitVector possiblyAccepting(3, true);
+    possiblyAccepting.set(2, false);
+    ASSERT_EQ(possiblyAccepting, da->getPossiblyAcceptingStates());
+
+    std::vector<storm::storage::BitVector> apLabels;
+    storm::storage::BitVector apA(dtmc->getNumberOfStates(), true);
+    apA.set(2, false);
+    storm::storage::BitVector apB(dtmc->getNumberOfStates(), false);
+    apB.set(7);
+    apLabels.push_back(apA);
+    apLabels.push_back(apB);
+
+    storm::transformer::DAProductBuilder productBuilder(*da, apLabels);
+    auto fullProduct = productBuilder.build<storm::models::sparse::Dtmc<double>>(dtmc->getTransitionMatrix(), dtmc->getInitialStates());
+    auto restrictedProduct = productBuilder.build<storm::models::sparse::Dtmc<double>>(dtmc->getTransitionMatrix(), dtmc->getInitialStates(), true);
+    EXPECT_TRUE(fullProduct->getUnexploredStates().empty());
+
+    // Product states with the sink state of the automaton are absorbing and their successors are not part of the restricted product.
+    auto const& restrictedMatrix = restrictedProduct->getProductModel().getTransitionMatrix();
+    uint64_t numberOfProductStates = restrictedProduct->getProductModel().getNumberOfStates();
+    ASSERT_EQ(numberOfProductStates, restrictedProduct->getUnexploredStates().size());
+    EXPECT_FALSE(restrictedProduct->getUnexploredStates().empty());
+    EXPECT_LT(numberOfProductStates, fullProduct->getProductModel().getNumberOfStates());
+    for (uint64_t state = 0; state < numberOfProductStates; ++state) {
+        bool unexplored = restrictedProduct->getAutomatonState(state) == 2;
+        EXPECT_EQ(unexplored, restrictedProduct->getUnexploredStates().get(state));
+        if (unexplored) {
+            ASSERT_EQ(1ull, restrictedMatrix.getRow(state).getNumberOfEntries());
+            EXPECT_EQ(state, restrictedMatrix.getRow(state).begin()->getColumn());
+            EXPECT_EQ(1.0, restrictedMatrix.getRow(state).begin()->getValue());
+        } else {
+            EXPECT_EQ(dtmc->getTransitionMatrix().getRow(restrictedProduct->getModelState(state)).getNumberOfEntries(),
+                      restrictedMatrix.getRow(state).getNumberOfEntries());
+        }
+    }
+}
@@ -4,6 +4,9 @@
 #include "storm-parsers/parser/PrismParser.h"
 #include "storm/builder/ExplicitModelBuilder.h"
 #include "storm/models/sparse/Dtmc.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
 #include "storm/storage/SymbolicModelDescription.h"
 #include "storm/utility/graph.h"
 #include "storm/utility/shortestPaths.h"
@@ -105,3 +108,66 @@ TEST(KSPTest, kspPathAsList) {
     //    161, 154, 146, 140, 134, 127, 119, 112, 104, 98, 92, 85, 77, 70, 81, 74, 65, 58, 52, 45, 37, 30, 22, 17, 12, 9, 6, 4, 2, 1, 0}; EXPECT_EQ(reference,
     //    list);
 }
+
+TEST(KSPTest, lazyEnumeration) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, testState);
+    storm::utility::ksp::ShortestPathsGenerator<double> reference(*model, testState);
+
+    double accumulatedDistance = 0;
+    for (unsigned long k = 1; k <= 100; ++k) {
+        auto path = spg.getNextPath();
+        ASSERT_TRUE(path);
+        EXPECT_EQ(k, path->k);
+        EXPECT_NEAR(reference.getDistance(k), path->distance, 1e-12);
+        EXPECT_EQ(reference.getPathAsList(k), path->states);
+        accumulatedDistance += path->distance;
+        EXPECT_NEAR(accumulatedDistance, path->accumulatedDistance, 1e-12);
+    }
+    EXPECT_NEAR(1.5231305000339662e-06, spg.getDistance(100), 1e-12);
+}
+
+TEST(KSPTest, lazyEnumerationExhausted) {
+    auto model = buildExampleModel();
+    storm::utility::ksp::ShortestPathsGenerator<double> spg(*model, stateWithOnlyOnePath);
+
+    EXPECT_TRUE(spg.getNextPath());
+    EXPECT_FALSE(spg.getNextPath());
+    EXPECT_FALSE(spg.getNextPath());
+    EXPECT_TRUE(spg.hasPath(1));
+    EXPECT_FALSE(spg.hasPath(2));
+}
+
+TEST(KSPTest, manyPredecessors) {
+    // The initial state branches to many states that all reach the target. Thus, the target has enough predecessors to collect the initial
+    // candidates in parallel (if enabled). The k-th shortest path visits the state with the k-th largest probability.
+    uint64_t const numberOfBranches = 2000;
+    storm::storage::SparseMatrixBuilder<double> builder(numberOfBranches + 1, numberOfBranches + 1, numberOfBranches);
+    double const sum = numberOfBranches * (numberOfBranches + 1) / 2.0;
+    for (uint64_t state = 1; state <= numberOfBranches; ++state) {
+        builder.addNextValue(0, state, state / sum);
+    }
+    storm::storage::SparseMatrix<double> matrix = builder.build();
+    std::vector<double> targetProbabilities(numberOfBranches + 1, 1.0);
+    targetProbabilities[0] = 0.0;
+    storm::storage::BitVector initialStates(numberOfBranches + 1);
+    initialStates.set(0);
+
+    std::vector<double> sequentialDistances, parallelDistances;
+    std::vector<storm::utility::ksp::OrderedStateList> sequentialPaths, parallelPaths;
+    for (bool useTbb : {false, true}) {
+        auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(useTbb);
+        storm::utility::ksp::ShortestPathsGenerator<double> spg(matrix, targetProbabilities, initialStates, storm::utility::ksp::MatrixFormat::straight);
+        auto& distances = useTbb ? parallelDistances : sequentialDistances;
+        auto& paths = useTbb ? parallelPaths : sequentialPaths;
+        for (unsigned long k = 1; k <= 50; ++k) {
+            distances.push_back(spg.getDistance(k));
+            paths.push_back(spg.getPathAsList(k));
+        }
+    }
+    for (unsigned long k = 1; k <= 50; ++k) {
+        EXPECT_NEAR((numberOfBranches + 1 - k) / sum, sequentialDistances[k - 1], 1e-12);
+    }
+    EXPECT_EQ(sequentialDistances, parallelDistances);
+    EXPECT_EQ(sequentialPaths, parallelPaths);
+}
@@ -0,0 +1,81 @@
+#include "storm-config.h"
+#include "test/storm_gtest.h"
+
+#include "storm-parsers/api/storm-parsers.h"
+#include "storm/api/storm.h"
+#include "storm/modelchecker/results/ExplicitQuantitativeCheckResult.h"
+#include "storm/models/sparse/Dtmc.h"
+#include "storm/settings/SettingMemento.h"
+#include "storm/settings/SettingsManager.h"
+#include "storm/settings/modules/CoreSettings.h"
+#include "storm/utility/ThreadOutputBuffer.h"
+#include "storm/utility/macros.h"
+#include "storm/utility/parallel.h"
+
+namespace {
+
+// Computes the given tasks and records the printed output as well as the order in which tasks are announced and reported.
+std::string computeAndRecord(uint64_t numberOfTasks, uint64_t numberOfWorkers, std::function<void(uint64_t)> const& compute) {
+    testing::internal::CaptureStdout();
+    storm::utility::parallel::computeAndReportInOrder(
+        numberOfTasks, numberOfWorkers, [](uint64_t task) { STORM_PRINT("announce " << task << '\n'); }, compute,
+        [](uint64_t task) { STORM_PRINT("report " << task << '\n'); });
+    return testing::internal::GetCapturedStdout();
+}
+
+TEST(ParallelTest, ThreadOutputBuffer) {
+    testing::internal::CaptureStdout();
+    {
+        storm::utility::ThreadOutputBuffer outer;
+        STORM_PRINT("outer ");
+        {
+            storm::utility::ThreadOutputBuffer inner;
+            STORM_PRINT("inner");
+            EXPECT_EQ("inner", inner.getOutput());
+        }
+        STORM_PRINT("again");
+        EXPECT_EQ("outer again", outer.getOutput());
+    }
+    STORM_PRINT("console");
+    EXPECT_EQ("console", testing::internal::GetCapturedStdout());
+}
+
+TEST(ParallelTest, ComputeAndReportInOrder) {
+    auto compute = [](uint64_t task) {
+        STORM_PRINT("compute " << task << '\n');
+        STORM_LOG_ERROR("error of task " << task);
+    };
+    std::string sequentialOutput = computeAndRecord(10, 1, compute);
+    EXPECT_NE(std::string::npos, sequentialOutput.find("announce 9\ncompute 9\n"));
+
+    auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+    // Every task prints its output (including logged messages) between its announcement and its report.
+    EXPECT_EQ(sequentialOutput, computeAndRecord(10, 4, compute));
+    EXPECT_EQ(sequentialOutput, computeAndRecord(10, 20, compute));
+}
+
+TEST(ParallelTest, ConcurrentModelChecking) {
+    storm::prism::Program program = storm::api::parseProgram(STORM_TEST_RESOURCES_DIR "/dtmc/die.pm");
+    auto formulas = storm::api::extractFormulasFromProperties(storm::api::parsePropertiesForPrismProgram(
+        "P=? [F \"one\"]; P=? [F \"two\"]; P=? [F \"three\"]; P=? [F<=3 \"done\"]; R{\"coin_flips\"}=? [F \"done\"]", program));
+    auto model = storm::api::buildSparseModel<double>(program, formulas)->as<storm::models::sparse::Dtmc<double>>();
+
+    // All properties are checked on the same model.
+    std::vector<double> values(formulas.size());
+    auto check = [&](uint64_t task) {
+        auto result = storm::api::verifyWithSparseEngine<double>(model, storm::api::createTask<double>(formulas[task], true));
+        values[task] = result->asExplicitQuantitativeCheckResult<double>()[*model->getInitialStates().begin()];
+        STORM_PRINT("value " << values[task] << '\n');
+    };
+    std::string sequentialOutput = computeAndRecord(formulas.size(), 1, check);
+    std::vector<double> sequentialValues = values;
+    EXPECT_NEAR(1.0 / 6.0, sequentialValues[0], 1e-6);
+    EXPECT_NEAR(11.0 / 3.0, sequentialValues[4], 1e-6);
+
+    auto tbbMemento = storm::settings::mutableCoreSettings().overrideUseIntelTbbSet(true);
+    std::fill(values.begin(), values.end(), -1.0);
+    EXPECT_EQ(sequentialOutput, computeAndRecord(formulas.size(), formulas.size(), check));
+    EXPECT_EQ(sequentialValues, values);
+}
+
+}  // namespace